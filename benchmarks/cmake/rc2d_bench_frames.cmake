@@ -0,0 +1,66 @@
+# Test de rendu : deux exécutions de rc2d_bench doivent produire exactement les mêmes images.
+#
+# rc2d_bench est lancé deux fois avec --checksum 1, puis les empreintes des images écrites dans les deux
+# fichiers JSON sont comparées (l'animation ne dépend que de l'indice de frame).
+#
+# La scène upload est ensuite lancée : chaque frame doit montrer la texture envoyée par le ring d'upload
+# pendant la même frame ("upload_ok": true). Un command buffer de frame soumis hors du thread principal
+# fait échouer rc2d_bench sur une assertion.
+#
+# Usage : cmake -DRC2D_BENCH=<chemin de rc2d_bench> -DRC2D_BENCH_OUTPUT_DIR=<dossier> -P rc2d_bench_frames.cmake
+
+if(NOT RC2D_BENCH OR NOT RC2D_BENCH_OUTPUT_DIR)
+  message(FATAL_ERROR "RC2D_BENCH and RC2D_BENCH_OUTPUT_DIR must be defined")
+endif()
+
+get_filename_component(RC2D_BENCH_DIR "${RC2D_BENCH}" DIRECTORY)
+
+foreach(run 0 1)
+  set(output "${RC2D_BENCH_OUTPUT_DIR}/rc2d_bench_frames_${run}.json")
+  file(REMOVE "${output}")
+
+  # Le dossier de travail est celui de rc2d_bench, qui contient le dossier shaders
+  execute_process(
+    COMMAND "${RC2D_BENCH}"
+            --scene layers --frames 30 --warmup 0 --sprites 2000 --width 320 --height 180
+            --checksum 1 --output "${output}"
+    WORKING_DIRECTORY "${RC2D_BENCH_DIR}"
+    RESULT_VARIABLE result
+  )
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "rc2d_bench run ${run} failed (${result})")
+  endif()
+
+  file(STRINGS "${output}" checksum_${run} REGEX "\"checksum\"")
+  if(NOT checksum_${run})
+    message(FATAL_ERROR "No checksum in ${output}")
+  endif()
+endforeach()
+
+if(NOT checksum_0 STREQUAL checksum_1)
+  message(FATAL_ERROR "Frames differ between two runs: ${checksum_0} vs ${checksum_1}")
+endif()
+
+message(STATUS "Identical frames across runs: ${checksum_0}")
+
+set(output "${RC2D_BENCH_OUTPUT_DIR}/rc2d_bench_upload.json")
+file(REMOVE "${output}")
+
+execute_process(
+  COMMAND "${RC2D_BENCH}"
+          --scene upload --frames 30 --warmup 0 --width 320 --height 180
+          --output "${output}"
+  WORKING_DIRECTORY "${RC2D_BENCH_DIR}"
+  RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "rc2d_bench --scene upload failed (${result})")
+endif()
+
+file(STRINGS "${output}" upload_ok REGEX "\"upload_ok\": true")
+if(NOT upload_ok)
+  file(READ "${output}" upload_results)
+  message(FATAL_ERROR "Upload ring check failed:\n${upload_results}")
+endif()
+
+message(STATUS "Uploads visible in the frame that sent them")
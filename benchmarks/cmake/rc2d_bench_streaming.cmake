@@ -0,0 +1,37 @@
+# Test de chargement d'images : rc2d_gpu_loadImageAsync et rc2d_gpu_newImage appelées depuis le thread principal
+# et depuis des jobs doivent toutes aboutir, la création des textures restant sur le thread principal.
+#
+# rc2d_bench --scene streaming doit écrire "stream_ok": true dans son JSON (toutes les images prêtes, et une
+# taille de dessin pour chaque image en chargement). Une texture créée hors du thread principal fait échouer
+# rc2d_bench sur une assertion.
+#
+# Usage : cmake -DRC2D_BENCH=<chemin de rc2d_bench> -DRC2D_BENCH_OUTPUT_DIR=<dossier> -P rc2d_bench_streaming.cmake
+
+if(NOT RC2D_BENCH OR NOT RC2D_BENCH_OUTPUT_DIR)
+  message(FATAL_ERROR "RC2D_BENCH and RC2D_BENCH_OUTPUT_DIR must be defined")
+endif()
+
+get_filename_component(RC2D_BENCH_DIR "${RC2D_BENCH}" DIRECTORY)
+
+set(output "${RC2D_BENCH_OUTPUT_DIR}/rc2d_bench_streaming.json")
+file(REMOVE "${output}")
+
+# Le dossier de travail est celui de rc2d_bench, qui contient le dossier shaders
+execute_process(
+  COMMAND "${RC2D_BENCH}"
+          --scene streaming --images 64 --frames 240 --warmup 0 --width 320 --height 180
+          --output "${output}"
+  WORKING_DIRECTORY "${RC2D_BENCH_DIR}"
+  RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "rc2d_bench --scene streaming failed (${result})")
+endif()
+
+file(STRINGS "${output}" stream_ok REGEX "\"stream_ok\": true")
+if(NOT stream_ok)
+  file(READ "${output}" stream_results)
+  message(FATAL_ERROR "Image streaming check failed:\n${stream_results}")
+endif()
+
+message(STATUS "All streamed images ready")
@@ -0,0 +1,537 @@
+#include "rc2d_bench_rres.h"
+#include "rc2d_bench_upload.h"
+
+#include <RC2D/RC2D.h>
+
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_filesystem.h>
+#include <SDL3/SDL_iostream.h>
+#include <SDL3/SDL_timer.h>
+#include <SDL3_image/SDL_image.h>
+
+#include <stdlib.h> // Required for: exit, EXIT_SUCCESS, EXIT_FAILURE
+
+/**
+ * Benchmark de rendu headless de RC2D.
+ *
+ * Joue une scène scriptée pendant un nombre fixe de frames, hors écran (RC2D_EngineConfig::headless),
+ * puis écrit les statistiques des temps de frame au format JSON.
+ * L'animation dépend uniquement de l'indice de frame : deux exécutions rendent exactement les mêmes images.
+ *
+ * Usage : rc2d_bench [--scene clear|sprites|layers|streaming|upload|rres] [--frames N] [--warmup N] [--sprites N]
+ *                    [--width W] [--height H] [--output fichier.json] [--trace fichier.json]
+ *                    [--checksum 0|1] [--images N] [--chunks N]
+ *
+ * --checksum 1 relit chaque frame mesurée et écrit une empreinte FNV-1a de toutes les images dans le JSON :
+ * deux exécutions doivent donner la même empreinte (les temps incluent alors la relecture).
+ * La scène streaming génère N PNG (--images, 200 par défaut) au chargement, puis les charge à la première frame mesurée :
+ * une image sur deux avec rc2d_gpu_loadImageAsync sur le thread principal, les autres depuis des jobs (rc2d_gpu_loadImageAsync,
+ * ou rc2d_gpu_newImage pour une image sur quatre). Le JSON indique en combien de frames toutes les images sont prêtes ;
+ * "stream_ok" vaut false si une image échoue ou si une image en chargement n'a pas de taille de dessin.
+ * La scène upload vérifie le ring d'upload avec des segments de 256 Ko : des jobs y gardent deux réservations
+ * imbriquées pendant que le thread principal remplit une texture dans rc2d_draw et la dessine dans la même frame.
+ * Chaque frame relue doit avoir la couleur de son upload ; le JSON compte les écarts ("upload_ok" vaut false sinon).
+ * La scène rres ne rend rien : elle mesure le module rres sur le CPU (cache de clés Argon2i sur --chunks chunks
+ * chiffrés, 50 par défaut, débit MD5 de 1 à 64 Mo et débit AES-256-CTR tiny-AES / OpenSSL), écrit le JSON et quitte sans créer de device GPU.
+ *
+ * Exemple en CI sans GPU (Vulkan logiciel lavapipe) :
+ *   VK_ICD_FILENAMES=/usr/share/vulkan/icd.d/lvp_icd.x86_64.json ./rc2d_bench --scene sprites --output bench.json
+ */
+
+typedef enum RC2D_BenchScene {
+    RC2D_BENCH_SCENE_CLEAR,     // Aucun dessin : coût fixe de la boucle, du clear et de la soumission
+    RC2D_BENCH_SCENE_SPRITES,   // N rectangles pleins sur un seul layer : une seule draw call
+    RC2D_BENCH_SCENE_LAYERS,    // N rectangles pleins et en contour répartis sur 16 layers : tri et draw calls multiples
+    RC2D_BENCH_SCENE_STREAMING, // Chargement asynchrone de N images pendant le rendu : placeholder puis textures
+    RC2D_BENCH_SCENE_UPLOAD,    // Uploads concurrents dans un petit ring, vérifiés frame par frame
+    RC2D_BENCH_SCENE_RRES       // Micro-benchmarks CPU du module rres, sans rendu
+} RC2D_BenchScene;
+
+typedef struct RC2D_BenchStats {
+    double min_ms;
+    double avg_ms;
+    double p50_ms;
+    double p95_ms;
+    double p99_ms;
+    double max_ms;
+} RC2D_BenchStats;
+
+static struct {
+    RC2D_BenchScene scene;
+    const char* scene_name;
+    Uint32 frames;
+    Uint32 warmup;
+    Uint32 sprites;
+    int width;
+    int height;
+    const char* output;
+    const char* trace;
+    bool checksum;
+
+    // Frame courante (warmup compris)
+    Uint32 frame_index;
+
+    // Temps de frame complets (entre deux rc2d_update) et temps passé dans rc2d_draw, en millisecondes
+    double* frame_ms;
+    double* draw_ms;
+    Uint64 last_update;
+
+    RC2D_GPUBatchStats batch;
+
+    // Empreinte FNV-1a 64 bits des images mesurées (--checksum)
+    Uint64 hash;
+
+    // Scène streaming : images chargées en arrière-plan, et frames mesurées avant qu'elles soient toutes prêtes
+    Uint32 image_count;
+    RC2D_Image** images;
+    Uint32 stream_frames;
+
+    // Scène streaming : jobs de chargement, et images en chargement dessinées sans taille (rc2d_gpu_drawImage)
+    RC2D_JobCounter stream_jobs;
+    Uint32 stream_empty_placeholders;
+
+    // Scène rres : nombre de chunks chiffrés par mesure
+    Uint32 chunk_count;
+} rc2d_bench = {
+    .scene = RC2D_BENCH_SCENE_SPRITES,
+    .scene_name = "sprites",
+    .frames = 600,
+    .warmup = 60,
+    .sprites = 10000,
+    .width = 1280,
+    .height = 720,
+    .output = "rc2d_bench.json",
+    .trace = NULL,
+    .checksum = false,
+    .hash = 0xcbf29ce484222325ULL,
+    .image_count = 200,
+    .chunk_count = 50
+};
+
+static bool rc2d_bench_parseScene(const char* name)
+{
+    if (SDL_strcmp(name, "clear") == 0) rc2d_bench.scene = RC2D_BENCH_SCENE_CLEAR;
+    else if (SDL_strcmp(name, "sprites") == 0) rc2d_bench.scene = RC2D_BENCH_SCENE_SPRITES;
+    else if (SDL_strcmp(name, "layers") == 0) rc2d_bench.scene = RC2D_BENCH_SCENE_LAYERS;
+    else if (SDL_strcmp(name, "streaming") == 0) rc2d_bench.scene = RC2D_BENCH_SCENE_STREAMING;
+    else if (SDL_strcmp(name, "upload") == 0) rc2d_bench.scene = RC2D_BENCH_SCENE_UPLOAD;
+    else if (SDL_strcmp(name, "rres") == 0) rc2d_bench.scene = RC2D_BENCH_SCENE_RRES;
+    else return false;
+
+    rc2d_bench.scene_name = name;
+    return true;
+}
+
+static bool rc2d_bench_parseArgs(int argc, char* argv[])
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (value == NULL)
+        {
+            RC2D_log(RC2D_LOG_CRITICAL, "Missing value for argument %s", arg);
+            return false;
+        }
+
+        if (SDL_strcmp(arg, "--scene") == 0)
+        {
+            if (!rc2d_bench_parseScene(value))
+            {
+                RC2D_log(RC2D_LOG_CRITICAL, "Unknown scene %s (expected clear, sprites, layers, streaming, upload or rres)", value);
+                return false;
+            }
+        }
+        else if (SDL_strcmp(arg, "--frames") == 0) rc2d_bench.frames = (Uint32)SDL_strtoul(value, NULL, 10);
+        else if (SDL_strcmp(arg, "--warmup") == 0) rc2d_bench.warmup = (Uint32)SDL_strtoul(value, NULL, 10);
+        else if (SDL_strcmp(arg, "--sprites") == 0) rc2d_bench.sprites = (Uint32)SDL_strtoul(value, NULL, 10);
+        else if (SDL_strcmp(arg, "--width") == 0) rc2d_bench.width = SDL_atoi(value);
+        else if (SDL_strcmp(arg, "--height") == 0) rc2d_bench.height = SDL_atoi(value);
+        else if (SDL_strcmp(arg, "--output") == 0) rc2d_bench.output = value;
+        else if (SDL_strcmp(arg, "--trace") == 0) rc2d_bench.trace = value;
+        else if (SDL_strcmp(arg, "--checksum") == 0) rc2d_bench.checksum = SDL_atoi(value) != 0;
+        else if (SDL_strcmp(arg, "--images") == 0) rc2d_bench.image_count = (Uint32)SDL_strtoul(value, NULL, 10);
+        else if (SDL_strcmp(arg, "--chunks") == 0) rc2d_bench.chunk_count = (Uint32)SDL_strtoul(value, NULL, 10);
+        else
+        {
+            RC2D_log(RC2D_LOG_CRITICAL, "Unknown argument %s", arg);
+            return false;
+        }
+        i++;
+    }
+
+    if (rc2d_bench.frames == 0 || rc2d_bench.width <= 0 || rc2d_bench.height <= 0)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "--frames, --width and --height must be greater than 0");
+        return false;
+    }
+
+    return true;
+}
+
+static int SDLCALL rc2d_bench_compareDouble(const void* a, const void* b)
+{
+    const double da = *(const double*)a;
+    const double db = *(const double*)b;
+    return (da > db) - (da < db);
+}
+
+/**
+ * Calcule les statistiques d'une série de mesures (la série est triée sur place).
+ */
+static RC2D_BenchStats rc2d_bench_computeStats(double* samples, Uint32 count)
+{
+    SDL_qsort(samples, count, sizeof(double), rc2d_bench_compareDouble);
+
+    double total = 0.0;
+    for (Uint32 i = 0; i < count; i++) total += samples[i];
+
+    RC2D_BenchStats stats;
+    stats.min_ms = samples[0];
+    stats.avg_ms = total / (double)count;
+    stats.p50_ms = samples[(Uint32)SDL_ceil(count * 0.50) - 1];
+    stats.p95_ms = samples[(Uint32)SDL_ceil(count * 0.95) - 1];
+    stats.p99_ms = samples[(Uint32)SDL_ceil(count * 0.99) - 1];
+    stats.max_ms = samples[count - 1];
+    return stats;
+}
+
+static void rc2d_bench_writeStats(SDL_IOStream* io, const char* name, const RC2D_BenchStats* stats, bool last)
+{
+    SDL_IOprintf(io,
+        "  \"%s\": {\"min\": %.4f, \"avg\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f}%s\n",
+        name, stats->min_ms, stats->avg_ms, stats->p50_ms, stats->p95_ms, stats->p99_ms, stats->max_ms, last ? "" : ",");
+}
+
+static bool rc2d_bench_writeResults(void)
+{
+    const RC2D_BenchStats frame = rc2d_bench_computeStats(rc2d_bench.frame_ms, rc2d_bench.frames);
+    const RC2D_BenchStats draw = rc2d_bench_computeStats(rc2d_bench.draw_ms, rc2d_bench.frames);
+
+    SDL_IOStream* io = SDL_IOFromFile(rc2d_bench.output, "w");
+    if (io == NULL)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "Failed to open benchmark output %s: %s", rc2d_bench.output, SDL_GetError());
+        return false;
+    }
+
+    SDL_IOprintf(io, "{\n");
+    SDL_IOprintf(io, "  \"scene\": \"%s\",\n", rc2d_bench.scene_name);
+    SDL_IOprintf(io, "  \"gpu_driver\": \"%s\",\n", SDL_GetGPUDeviceDriver(rc2d_gpu_getDevice()));
+    SDL_IOprintf(io, "  \"width\": %d,\n", rc2d_bench.width);
+    SDL_IOprintf(io, "  \"height\": %d,\n", rc2d_bench.height);
+    SDL_IOprintf(io, "  \"frames\": %u,\n", rc2d_bench.frames);
+    SDL_IOprintf(io, "  \"warmup\": %u,\n", rc2d_bench.warmup);
+    SDL_IOprintf(io, "  \"sprites\": %u,\n", rc2d_bench.batch.sprite_count);
+    SDL_IOprintf(io, "  \"draw_calls\": %u,\n", rc2d_bench.batch.draw_call_count);
+    if (rc2d_bench.checksum)
+    {
+        SDL_IOprintf(io, "  \"checksum\": \"%016" SDL_PRIx64 "\",\n", rc2d_bench.hash);
+    }
+    if (rc2d_bench.scene == RC2D_BENCH_SCENE_STREAMING)
+    {
+        SDL_IOprintf(io, "  \"images\": %u,\n", rc2d_bench.image_count);
+        SDL_IOprintf(io, "  \"stream_frames\": %u,\n", rc2d_bench.stream_frames);
+
+        Uint32 failed = 0;
+        for (Uint32 i = 0; i < rc2d_bench.image_count; i++)
+        {
+            const RC2D_Image* image = (const RC2D_Image*)SDL_GetAtomicPointer((void**)&rc2d_bench.images[i]);
+            if (image == NULL || image->state != RC2D_IMAGE_READY) failed++;
+        }
+        SDL_IOprintf(io, "  \"stream_failed\": %u,\n", failed);
+        SDL_IOprintf(io, "  \"stream_empty_placeholders\": %u,\n", rc2d_bench.stream_empty_placeholders);
+        SDL_IOprintf(io, "  \"stream_ok\": %s,\n",
+            rc2d_bench.stream_frames > 0 && failed == 0 && rc2d_bench.stream_empty_placeholders == 0 ? "true" : "false");
+    }
+    if (rc2d_bench.scene == RC2D_BENCH_SCENE_UPLOAD)
+    {
+        // Appelée avant le dessin de la frame frame_index : les jobs de la frame précédente sont terminés
+        const bool ok = rc2d_bench_uploadWriteResults(io, rc2d_bench.frame_index - 1);
+        SDL_IOprintf(io, "  \"upload_ok\": %s,\n", ok ? "true" : "false");
+    }
+    rc2d_bench_writeStats(io, "frame_ms", &frame, false);
+    rc2d_bench_writeStats(io, "draw_ms", &draw, true);
+    SDL_IOprintf(io, "}\n");
+
+    if (!SDL_CloseIO(io))
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "Failed to write benchmark output %s: %s", rc2d_bench.output, SDL_GetError());
+        return false;
+    }
+
+    RC2D_log(RC2D_LOG_INFO, "Benchmark %s: %u frames, avg %.3f ms, p99 %.3f ms -> %s",
+        rc2d_bench.scene_name, rc2d_bench.frames, frame.avg_ms, frame.p99_ms, rc2d_bench.output);
+    return true;
+}
+
+/**
+ * Génère les PNG de la scène streaming (256x256, un motif par image) dans `rc2d_bench_images/`.
+ */
+static void rc2d_bench_generateImages(void)
+{
+    char path[512];
+    SDL_snprintf(path, sizeof(path), "%src2d_bench_images", SDL_GetBasePath());
+    RC2D_assert_release(SDL_CreateDirectory(path), RC2D_LOG_CRITICAL, "Failed to create %s: %s", path, SDL_GetError());
+
+    SDL_Surface* surface = SDL_CreateSurface(256, 256, SDL_PIXELFORMAT_RGBA32);
+    RC2D_assert_release(surface != NULL, RC2D_LOG_CRITICAL, "Failed to create image surface: %s", SDL_GetError());
+
+    for (Uint32 i = 0; i < rc2d_bench.image_count; i++)
+    {
+        const Uint32 background = SDL_MapSurfaceRGBA(surface, (Uint8)(i * 37), (Uint8)(i * 91), (Uint8)(i * 13), 255);
+        const Uint32 foreground = SDL_MapSurfaceRGBA(surface, 255 - (Uint8)(i * 37), 255 - (Uint8)(i * 91), 255, 255);
+        SDL_FillSurfaceRect(surface, NULL, background);
+        for (int cell = 0; cell < 64; cell += 2 + (int)(i % 3))
+        {
+            const SDL_Rect rect = { (cell % 8) * 32, (cell / 8) * 32, 32, 32 };
+            SDL_FillSurfaceRect(surface, &rect, foreground);
+        }
+
+        SDL_snprintf(path, sizeof(path), "%src2d_bench_images/image_%u.png", SDL_GetBasePath(), i);
+        RC2D_assert_release(IMG_SavePNG(surface, path), RC2D_LOG_CRITICAL, "Failed to write %s: %s", path, SDL_GetError());
+    }
+
+    SDL_DestroySurface(surface);
+}
+
+static void rc2d_bench_load(void)
+{
+    rc2d_bench.frame_ms = RC2D_calloc(rc2d_bench.frames, sizeof(double));
+    rc2d_bench.draw_ms = RC2D_calloc(rc2d_bench.frames, sizeof(double));
+    RC2D_assert_release(rc2d_bench.frame_ms != NULL && rc2d_bench.draw_ms != NULL, RC2D_LOG_CRITICAL, "Failed to allocate benchmark samples");
+
+    if (rc2d_bench.scene == RC2D_BENCH_SCENE_STREAMING && rc2d_bench.image_count > 0)
+    {
+        rc2d_bench.images = RC2D_calloc(rc2d_bench.image_count, sizeof(RC2D_Image*));
+        RC2D_assert_release(rc2d_bench.images != NULL, RC2D_LOG_CRITICAL, "Failed to allocate benchmark images");
+        rc2d_bench_generateImages();
+    }
+
+    if (rc2d_bench.scene == RC2D_BENCH_SCENE_UPLOAD)
+    {
+        RC2D_assert_release(rc2d_bench_uploadLoad(), RC2D_LOG_CRITICAL, "Failed to load upload scene");
+    }
+}
+
+static void rc2d_bench_unload(void)
+{
+    RC2D_safe_free(rc2d_bench.frame_ms);
+    RC2D_safe_free(rc2d_bench.draw_ms);
+
+    // Les images appartiennent au cache du moteur, les jobs de chargement écrivent encore dans le tableau
+    rc2d_job_wait(&rc2d_bench.stream_jobs);
+    RC2D_safe_free(rc2d_bench.images);
+
+    if (rc2d_bench.scene == RC2D_BENCH_SCENE_UPLOAD)
+    {
+        rc2d_bench_uploadUnload();
+    }
+}
+
+/**
+ * Relit la dernière frame soumise et l'ajoute à l'empreinte des images.
+ */
+static void rc2d_bench_hashFrame(void)
+{
+    Uint32 width = 0;
+    Uint32 height = 0;
+    Uint8* pixels = rc2d_gpu_readHeadlessTarget(&width, &height);
+    RC2D_assert_release(pixels != NULL, RC2D_LOG_CRITICAL, "Failed to read back benchmark frame");
+
+    const size_t size = (size_t)width * height * 4;
+    for (size_t i = 0; i < size; i++)
+    {
+        rc2d_bench.hash = (rc2d_bench.hash ^ pixels[i]) * 0x100000001b3ULL;
+    }
+
+    RC2D_free(pixels);
+}
+
+static void rc2d_bench_update(double dt)
+{
+    (void)dt;
+
+    // La frame précédente (frame_index - 1) vient d'être présentée
+    if (rc2d_bench.checksum && rc2d_bench.frame_index > rc2d_bench.warmup)
+    {
+        rc2d_bench_hashFrame();
+    }
+    if (rc2d_bench.scene == RC2D_BENCH_SCENE_UPLOAD && rc2d_bench.frame_index > 0)
+    {
+        rc2d_bench_uploadCheckFrame(rc2d_bench.frame_index - 1);
+    }
+
+    const Uint64 now = SDL_GetPerformanceCounter();
+    if (rc2d_bench.frame_index > rc2d_bench.warmup)
+    {
+        rc2d_bench.frame_ms[rc2d_bench.frame_index - rc2d_bench.warmup - 1] =
+            (double)(now - rc2d_bench.last_update) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+    }
+    rc2d_bench.last_update = now;
+
+    // Statistiques du sprite batch de la frame précédente (identiques d'une frame à l'autre)
+    rc2d_gpu_getBatchStats(&rc2d_bench.batch);
+
+    if (rc2d_bench.frame_index == rc2d_bench.warmup + rc2d_bench.frames)
+    {
+        rc2d_bench_writeResults();
+        if (rc2d_bench.trace != NULL)
+        {
+            rc2d_profiler_exportChromeTrace(rc2d_bench.trace);
+        }
+        rc2d_event_quit();
+    }
+}
+
+static void rc2d_bench_drawScene(void)
+{
+    const float t = (float)rc2d_bench.frame_index;
+    const float size = 16.0f;
+    const Uint32 columns = (Uint32)(rc2d_bench.width / size);
+
+    for (Uint32 i = 0; i < rc2d_bench.sprites; i++)
+    {
+        // Grille qui défile, décalée par sprite pour éviter que tous les quads se superposent
+        const float x = SDL_fmodf((float)(i % columns) * size + t * 2.0f, (float)rc2d_bench.width);
+        const float y = SDL_fmodf((float)(i / columns) * size * 0.5f + (float)(i % 7) * t * 0.5f, (float)rc2d_bench.height);
+
+        rc2d_gpu_setColor((RC2D_Color){ (Uint8)(i * 37), (Uint8)(i * 91), (Uint8)(i * 13), 255 });
+
+        if (rc2d_bench.scene == RC2D_BENCH_SCENE_LAYERS)
+        {
+            rc2d_gpu_setLayer((int)(i % 16));
+            rc2d_gpu_drawRectangle(i % 2 ? RC2D_DRAWMODE_LINE : RC2D_DRAWMODE_FILL, x, y, size, size);
+        }
+        else
+        {
+            rc2d_gpu_drawRectangle(RC2D_DRAWMODE_FILL, x, y, size, size);
+        }
+    }
+}
+
+/**
+ * Job de la scène streaming : charge l'image `slot` depuis un worker. rc2d_gpu_newImage y attend que le thread
+ * principal crée sa texture.
+ */
+static void rc2d_bench_streamLoadJob(void* data)
+{
+    RC2D_Image** slot = (RC2D_Image**)data;
+    const Uint32 i = (Uint32)(slot - rc2d_bench.images);
+
+    char filename[64];
+    SDL_snprintf(filename, sizeof(filename), "rc2d_bench_images/image_%u.png", i);
+    RC2D_Image* image = i % 4 == 3 ? rc2d_gpu_newImage(filename) : rc2d_gpu_loadImageAsync(filename);
+    SDL_SetAtomicPointer((void**)slot, image);
+}
+
+/**
+ * Scène streaming : lance tous les chargements à la première frame mesurée, puis dessine chaque image
+ * (placeholder tant qu'elle n'est pas prête) dans une grille de quads de 32x32.
+ */
+static void rc2d_bench_drawStreaming(void)
+{
+    if (rc2d_bench.frame_index == rc2d_bench.warmup)
+    {
+        for (Uint32 i = 0; i < rc2d_bench.image_count; i++)
+        {
+            if (i % 2 == 1)
+            {
+                rc2d_job_run(rc2d_bench_streamLoadJob, &rc2d_bench.images[i], &rc2d_bench.stream_jobs);
+                continue;
+            }
+
+            char filename[64];
+            SDL_snprintf(filename, sizeof(filename), "rc2d_bench_images/image_%u.png", i);
+            SDL_SetAtomicPointer((void**)&rc2d_bench.images[i], rc2d_gpu_loadImageAsync(filename));
+        }
+    }
+    else if (rc2d_bench.frame_index > rc2d_bench.warmup && rc2d_bench.stream_frames == 0 &&
+             rc2d_job_isDone(&rc2d_bench.stream_jobs) && rc2d_gpu_getPendingImageCount() == 0)
+    {
+        rc2d_bench.stream_frames = rc2d_bench.frame_index - rc2d_bench.warmup;
+    }
+
+    const Uint32 columns = (Uint32)(rc2d_bench.width / 32);
+    rc2d_gpu_setColor((RC2D_Color){ 255, 255, 255, 255 });
+    for (Uint32 i = 0; i < rc2d_bench.image_count; i++)
+    {
+        RC2D_Image* image = (RC2D_Image*)SDL_GetAtomicPointer((void**)&rc2d_bench.images[i]);
+        if (image == NULL) continue;
+
+        // rc2d_gpu_drawImage dessine une image en chargement à la taille du placeholder
+        if (image->state == RC2D_IMAGE_LOADING && (image->width == 0 || image->height == 0))
+        {
+            rc2d_bench.stream_empty_placeholders++;
+        }
+
+        const float x = (float)(i % columns) * 32.0f;
+        const float y = (float)(i / columns) * 32.0f;
+        rc2d_gpu_drawQuad(image, x, y, 32.0f, 32.0f, 0.0f, 0.0f, 1.0f, 1.0f);
+    }
+}
+
+static void rc2d_bench_draw(double alpha)
+{
+    (void)alpha;
+
+    const Uint64 start = SDL_GetPerformanceCounter();
+
+    if (rc2d_bench.scene == RC2D_BENCH_SCENE_STREAMING)
+    {
+        rc2d_bench_drawStreaming();
+    }
+    else if (rc2d_bench.scene == RC2D_BENCH_SCENE_UPLOAD)
+    {
+        rc2d_bench_uploadDraw(rc2d_bench.frame_index, (float)rc2d_bench.width, (float)rc2d_bench.height);
+    }
+    else if (rc2d_bench.scene != RC2D_BENCH_SCENE_CLEAR)
+    {
+        rc2d_bench_drawScene();
+    }
+
+    if (rc2d_bench.frame_index >= rc2d_bench.warmup && rc2d_bench.frame_index < rc2d_bench.warmup + rc2d_bench.frames)
+    {
+        rc2d_bench.draw_ms[rc2d_bench.frame_index - rc2d_bench.warmup] =
+            (double)(SDL_GetPerformanceCounter() - start) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+    }
+    rc2d_bench.frame_index++;
+}
+
+const RC2D_EngineConfig* rc2d_engine_setup(int argc, char* argv[])
+{
+    rc2d_logger_set_priority(RC2D_LOG_INFO);
+
+    // Retourner NULL lancerait le moteur avec la configuration par défaut (fenêtre visible) : on s'arrête ici
+    if (!rc2d_bench_parseArgs(argc, argv))
+    {
+        exit(EXIT_FAILURE);
+    }
+
+    // Scène CPU : pas de moteur à lancer
+    if (rc2d_bench.scene == RC2D_BENCH_SCENE_RRES)
+    {
+        exit(rc2d_bench_runRres(rc2d_bench.output, rc2d_bench.chunk_count) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    RC2D_EngineConfig* config = rc2d_engine_getDefaultConfig();
+    config->headless = true;
+    config->gpuOptions->debugMode = false;
+    config->gpuOptions->verbose = false;
+    config->windowWidth = rc2d_bench.width;
+    config->windowHeight = rc2d_bench.height;
+    config->logicalWidth = rc2d_bench.width;
+    config->logicalHeight = rc2d_bench.height;
+    config->callbacks->rc2d_load = rc2d_bench_load;
+    config->callbacks->rc2d_unload = rc2d_bench_unload;
+    config->callbacks->rc2d_update = rc2d_bench_update;
+    config->callbacks->rc2d_draw = rc2d_bench_draw;
+
+    // Scène upload : des segments petits pour remplir le ring à chaque frame
+    if (rc2d_bench.scene == RC2D_BENCH_SCENE_UPLOAD)
+    {
+        config->gpuUploadRingSize = RC2D_BENCH_UPLOAD_RING_SIZE;
+    }
+
+    return config;
+}
@@ -0,0 +1,236 @@
+#include "rc2d_bench_rres.h"
+
+#include <RC2D/RC2D.h>
+#include <RC2D/RC2D_rres.h>
+
+#include <SDL3/SDL_iostream.h>
+#include <SDL3/SDL_timer.h>
+
+#include <monocypher/monocypher.h>
+
+#define RC2D_BENCH_RRES_PAYLOAD_SIZE 1024
+#define RC2D_BENCH_RRES_HEADER_SIZE 20 // propCount + props[4]
+
+// Débit MD5 mesuré de 1 Mo à 64 Mo (x4 à chaque palier)
+#define RC2D_BENCH_RRES_MD5_MIN_SIZE (1024*1024)
+#define RC2D_BENCH_RRES_MD5_MAX_SIZE (64*1024*1024)
+#define RC2D_BENCH_RRES_MD5_STEPS 4
+
+// Taille chiffrée par chaque implémentation AES-256-CTR
+#define RC2D_BENCH_RRES_AES_SIZE (16*1024*1024)
+
+static const uint8_t rc2d_bench_rres_salt[16] = {
+    0x52, 0x43, 0x32, 0x44, 0x2d, 0x72, 0x72, 0x65,
+    0x73, 0x2d, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00
+};
+
+static double rc2d_bench_rres_elapsedMs(Uint64 start)
+{
+    return (double)(SDL_GetPerformanceCounter() - start) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+}
+
+/**
+ * Dérive la clé des chunks synthétiques comme le fait rrespacker (Argon2i, 16 Mo, 3 passes).
+ */
+static bool rc2d_bench_rres_deriveKey(uint8_t key[32])
+{
+    uint8_t pass[16] = { 0 };
+    const char* password = rc2d_rres_getCipherPassword();
+    SDL_memcpy(pass, password, SDL_min(SDL_strlen(password), sizeof(pass)));
+
+    crypto_argon2_config config = { CRYPTO_ARGON2_I, 16384, 3, 1 };
+    crypto_argon2_inputs inputs = { pass, rc2d_bench_rres_salt, 16, 16 };
+    crypto_argon2_extras extras = { 0 };
+
+    void* workArea = SDL_malloc(16384 * 1024);
+    if (workArea == NULL) return false;
+    crypto_argon2(key, 32, workArea, config, inputs, extras);
+    SDL_free(workArea);
+    return true;
+}
+
+/**
+ * Construit un chunk RAWD chiffré XChaCha20-Poly1305 au format rrespacker : data + salt[16] + nonce[24] + MAC[16].
+ */
+static rresResourceChunk rc2d_bench_rres_makeChunk(const uint8_t key[32], unsigned int id)
+{
+    const unsigned int baseSize = RC2D_BENCH_RRES_HEADER_SIZE + RC2D_BENCH_RRES_PAYLOAD_SIZE;
+
+    uint8_t plain[RC2D_BENCH_RRES_HEADER_SIZE + RC2D_BENCH_RRES_PAYLOAD_SIZE] = { 0 };
+    unsigned int props[5] = { 4, RC2D_BENCH_RRES_PAYLOAD_SIZE, 0, 0, 0 };
+    SDL_memcpy(plain, props, sizeof(props));
+    for (unsigned int i = 0; i < RC2D_BENCH_RRES_PAYLOAD_SIZE; i++) plain[RC2D_BENCH_RRES_HEADER_SIZE + i] = (uint8_t)(i + id);
+
+    rresResourceChunk chunk = { 0 };
+    SDL_memcpy(chunk.info.type, "RAWD", 4);
+    chunk.info.id = id;
+    chunk.info.compType = RRES_COMP_NONE;
+    chunk.info.cipherType = RRES_CIPHER_XCHACHA20_POLY1305;
+    chunk.info.baseSize = baseSize;
+    chunk.info.packedSize = baseSize + 16 + 24 + 16;
+
+    uint8_t* packed = (uint8_t*)RC2D_malloc(chunk.info.packedSize);
+    if (packed == NULL) return chunk;
+
+    uint8_t nonce[24] = { 0 };
+    SDL_memcpy(nonce, &id, sizeof(id));
+
+    SDL_memcpy(packed + baseSize, rc2d_bench_rres_salt, 16);
+    SDL_memcpy(packed + baseSize + 16, nonce, 24);
+    crypto_aead_lock(packed, packed + baseSize + 16 + 24, key, nonce, NULL, 0, plain, baseSize);
+
+    chunk.data.raw = packed;
+    return chunk;
+}
+
+/**
+ * Déchiffre chunkCount chunks partageant le même sel.
+ * Avec coldKeyCache, le cache est vidé avant chaque chunk : chaque chunk paie un étirement de clé complet.
+ */
+static bool rc2d_bench_rres_unpackChunks(const uint8_t key[32], unsigned int chunkCount, bool coldKeyCache, double* ms)
+{
+    Uint64 ticks = 0;
+
+    for (unsigned int i = 0; i < chunkCount; i++)
+    {
+        rresResourceChunk chunk = rc2d_bench_rres_makeChunk(key, i);
+        if (chunk.data.raw == NULL) return false;
+
+        if (coldKeyCache) rc2d_rres_cleanKeyCache();
+
+        const Uint64 start = SDL_GetPerformanceCounter();
+        const int result = rc2d_rres_unpackResourceChunk(&chunk);
+        ticks += SDL_GetPerformanceCounter() - start;
+
+        RC2D_safe_free(chunk.data.props);
+        RC2D_safe_free(chunk.data.raw);
+        if (result != 0)
+        {
+            RC2D_log(RC2D_LOG_CRITICAL, "rres benchmark: chunk %u failed to unpack (%d)", i, result);
+            return false;
+        }
+    }
+
+    *ms = (double)ticks * 1000.0 / (double)SDL_GetPerformanceFrequency();
+    return true;
+}
+
+/**
+ * Mesure le débit de rc2d_rres_computeMD5 (Mo/s) pour chaque taille de RC2D_BENCH_RRES_MD5_MIN_SIZE à RC2D_BENCH_RRES_MD5_MAX_SIZE.
+ */
+static bool rc2d_bench_rres_md5(double mbPerSecond[RC2D_BENCH_RRES_MD5_STEPS])
+{
+    unsigned char* data = (unsigned char*)SDL_malloc(RC2D_BENCH_RRES_MD5_MAX_SIZE);
+    if (data == NULL)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "rres benchmark: failed to allocate the MD5 input");
+        return false;
+    }
+    for (size_t i = 0; i < RC2D_BENCH_RRES_MD5_MAX_SIZE; i++) data[i] = (unsigned char)(i * 31);
+
+    size_t size = RC2D_BENCH_RRES_MD5_MIN_SIZE;
+    for (int i = 0; i < RC2D_BENCH_RRES_MD5_STEPS; i++, size *= 4)
+    {
+        unsigned int hash[4] = { 0 };
+        const Uint64 start = SDL_GetPerformanceCounter();
+        rc2d_rres_computeMD5(data, size, hash);
+        const double ms = SDL_max(rc2d_bench_rres_elapsedMs(start), 1e-6);
+
+        mbPerSecond[i] = ((double)size / (1024.0 * 1024.0)) * 1000.0 / ms;
+    }
+
+    SDL_free(data);
+    return true;
+}
+
+/**
+ * Mesure le débit AES-256-CTR (Mo/s) de tiny-AES et d'OpenSSL EVP sur RC2D_BENCH_RRES_AES_SIZE octets.
+ * Sans le module RC2D_data, OpenSSL n'est pas lié : seul tiny-AES est mesuré (openSSLMbPerSecond reste négatif).
+ */
+static bool rc2d_bench_rres_aes(double* tinyAesMbPerSecond, double* openSSLMbPerSecond)
+{
+    unsigned char key[32] = { 0 };
+    unsigned char* data = (unsigned char*)SDL_calloc(RC2D_BENCH_RRES_AES_SIZE, 1);
+    if (data == NULL)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "rres benchmark: failed to allocate the AES input");
+        return false;
+    }
+
+    const RC2D_RresAESBackend backends[2] = { RC2D_RRES_AES_BACKEND_TINYAES, RC2D_RRES_AES_BACKEND_OPENSSL };
+    double* results[2] = { tinyAesMbPerSecond, openSSLMbPerSecond };
+    const int backendCount = RC2D_DATA_MODULE_ENABLED ? 2 : 1;
+    bool success = true;
+
+    *openSSLMbPerSecond = -1.0;
+    for (int i = 0; i < backendCount && success; i++)
+    {
+        const Uint64 start = SDL_GetPerformanceCounter();
+        success = rc2d_rres_aesCtrXcrypt(key, data, RC2D_BENCH_RRES_AES_SIZE, backends[i]);
+        const double ms = SDL_max(rc2d_bench_rres_elapsedMs(start), 1e-6);
+
+        *results[i] = ((double)RC2D_BENCH_RRES_AES_SIZE / (1024.0 * 1024.0)) * 1000.0 / ms;
+    }
+
+    if (!success) RC2D_log(RC2D_LOG_CRITICAL, "rres benchmark: AES-256-CTR encryption failed");
+
+    SDL_free(data);
+    return success;
+}
+
+bool rc2d_bench_runRres(const char* output, unsigned int chunkCount)
+{
+    uint8_t key[32] = { 0 };
+    if (!rc2d_bench_rres_deriveKey(key))
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "rres benchmark: failed to allocate the Argon2i work area");
+        return false;
+    }
+
+    double coldMs = 0.0;
+    double warmMs = 0.0;
+    rc2d_rres_cleanKeyCache();
+    bool success = rc2d_bench_rres_unpackChunks(key, chunkCount, true, &coldMs);
+    rc2d_rres_cleanKeyCache();
+    success = success && rc2d_bench_rres_unpackChunks(key, chunkCount, false, &warmMs);
+    rc2d_rres_cleanKeyCache();
+    crypto_wipe(key, sizeof(key));
+
+    double md5[RC2D_BENCH_RRES_MD5_STEPS] = { 0 };
+    success = success && rc2d_bench_rres_md5(md5);
+
+    double tinyAes = 0.0;
+    double openSSL = 0.0;
+    success = success && rc2d_bench_rres_aes(&tinyAes, &openSSL);
+    if (!success) return false;
+
+    SDL_IOStream* io = SDL_IOFromFile(output, "w");
+    if (io == NULL)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "Failed to open benchmark output %s: %s", output, SDL_GetError());
+        return false;
+    }
+
+    SDL_IOprintf(io, "{\n");
+    SDL_IOprintf(io, "  \"scene\": \"rres\",\n");
+    SDL_IOprintf(io, "  \"chunks\": %u,\n", chunkCount);
+    SDL_IOprintf(io, "  \"key_cache_ms\": {\"cold\": %.3f, \"warm\": %.3f},\n", coldMs, warmMs);
+    SDL_IOprintf(io, "  \"md5_mb_per_s\": {");
+    for (int i = 0, sizeMB = RC2D_BENCH_RRES_MD5_MIN_SIZE / (1024*1024); i < RC2D_BENCH_RRES_MD5_STEPS; i++, sizeMB *= 4)
+    {
+        SDL_IOprintf(io, "%s\"%d\": %.1f", i == 0 ? "" : ", ", sizeMB, md5[i]);
+    }
+    SDL_IOprintf(io, "},\n");
+    if (openSSL >= 0.0) SDL_IOprintf(io, "  \"aes_ctr_mb_per_s\": {\"tiny_aes\": %.1f, \"openssl\": %.1f}\n", tinyAes, openSSL);
+    else SDL_IOprintf(io, "  \"aes_ctr_mb_per_s\": {\"tiny_aes\": %.1f, \"openssl\": null}\n", tinyAes);
+    SDL_IOprintf(io, "}\n");
+
+    if (!SDL_CloseIO(io))
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "Failed to write benchmark output %s: %s", output, SDL_GetError());
+        return false;
+    }
+
+    RC2D_log(RC2D_LOG_INFO, "Benchmark rres: %u chunks, key cache cold %.1f ms, warm %.1f ms -> %s", chunkCount, coldMs, warmMs, output);
+    return true;
+}
@@ -0,0 +1,15 @@
+#ifndef RC2D_BENCH_RRES_H
+#define RC2D_BENCH_RRES_H
+
+#include <stdbool.h> // Required for: bool
+
+/**
+ * Micro-benchmarks CPU du module rres (scène "rres" de rc2d_bench), sans fenêtre ni GPU.
+ *
+ * \param output Fichier JSON de sortie.
+ * \param chunkCount Nombre de chunks chiffrés déchiffrés par mesure du cache de clés.
+ * \return true si les mesures ont été écrites.
+ */
+bool rc2d_bench_runRres(const char* output, unsigned int chunkCount);
+
+#endif // RC2D_BENCH_RRES_H
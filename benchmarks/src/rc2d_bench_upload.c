@@ -0,0 +1,244 @@
+#include "rc2d_bench_upload.h"
+
+#include <RC2D/RC2D.h>
+#include <RC2D/RC2D_job.h>
+
+// Texture remplie par le thread principal pendant rc2d_draw
+#define RC2D_BENCH_UPLOAD_TEXTURE_SIZE 64
+
+// Jobs lancés à chaque frame, chacun avec deux réservations imbriquées de cette taille (plus d'un tiers de segment)
+#define RC2D_BENCH_UPLOAD_JOB_COUNT 8
+#define RC2D_BENCH_UPLOAD_JOB_SIZE (96*1024)
+
+static struct {
+    RC2D_Image image;
+    SDL_GPUBuffer* buffer;
+
+    // Frames dont la couleur relue ne correspondait pas à l'upload de la frame
+    Uint32 mismatches;
+    Uint32 checked;
+
+    // Réservations refusées par le ring
+    SDL_AtomicInt failures;
+} rc2d_bench_upload = {0};
+
+/**
+ * Couleur de la texture à la frame frameIndex (valeurs exactes en UNORM 8 bits).
+ */
+static SDL_Color rc2d_bench_upload_color(Uint32 frameIndex)
+{
+    return (SDL_Color){ (Uint8)(frameIndex * 37 + 11), (Uint8)(frameIndex * 91 + 7), (Uint8)(frameIndex * 13 + 3), 255 };
+}
+
+/**
+ * Octet écrit par le job jobIndex dans sa réservation intérieure (inner) ou extérieure à la frame frameIndex.
+ */
+static Uint8 rc2d_bench_upload_jobByte(Uint32 frameIndex, Uint32 jobIndex, bool inner)
+{
+    return (Uint8)(frameIndex * 29 + jobIndex * 2 + (inner ? 1 : 0));
+}
+
+typedef struct RC2D_BenchUploadJob {
+    Uint32 frame_index;
+    Uint32 job_index;
+} RC2D_BenchUploadJob;
+
+static RC2D_BenchUploadJob rc2d_bench_upload_jobs[RC2D_BENCH_UPLOAD_JOB_COUNT];
+
+/**
+ * Garde deux réservations ouvertes à la fois : l'ancien ring attendait ici la fin des écritures en cours
+ * dès que le segment était plein, et se bloquait sur la réservation du job lui-même.
+ */
+static void rc2d_bench_upload_job(void* data)
+{
+    const RC2D_BenchUploadJob* job = (const RC2D_BenchUploadJob*)data;
+    const Uint32 offset = job->job_index * 2 * RC2D_BENCH_UPLOAD_JOB_SIZE;
+
+    RC2D_GPUUploadAllocation outer;
+    RC2D_GPUUploadAllocation inner;
+    if (!rc2d_gpu_beginUpload(RC2D_BENCH_UPLOAD_JOB_SIZE, 4, &outer))
+    {
+        SDL_AddAtomicInt(&rc2d_bench_upload.failures, 1);
+        return;
+    }
+    if (!rc2d_gpu_beginUpload(RC2D_BENCH_UPLOAD_JOB_SIZE, 4, &inner))
+    {
+        SDL_AddAtomicInt(&rc2d_bench_upload.failures, 1);
+        rc2d_gpu_cancelUpload(&outer);
+        return;
+    }
+
+    SDL_memset(outer.data, rc2d_bench_upload_jobByte(job->frame_index, job->job_index, false), RC2D_BENCH_UPLOAD_JOB_SIZE);
+    SDL_memset(inner.data, rc2d_bench_upload_jobByte(job->frame_index, job->job_index, true), RC2D_BENCH_UPLOAD_JOB_SIZE);
+
+    rc2d_gpu_endUploadToBuffer(&inner, 0, rc2d_bench_upload.buffer, offset + RC2D_BENCH_UPLOAD_JOB_SIZE, RC2D_BENCH_UPLOAD_JOB_SIZE);
+    rc2d_gpu_endUploadToBuffer(&outer, 0, rc2d_bench_upload.buffer, offset, RC2D_BENCH_UPLOAD_JOB_SIZE);
+}
+
+bool rc2d_bench_uploadLoad(void)
+{
+    rc2d_bench_upload.image.texture = SDL_CreateGPUTexture(rc2d_gpu_getDevice(), &(SDL_GPUTextureCreateInfo){
+        .type = SDL_GPU_TEXTURETYPE_2D,
+        .format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
+        .usage = SDL_GPU_TEXTUREUSAGE_SAMPLER,
+        .width = RC2D_BENCH_UPLOAD_TEXTURE_SIZE,
+        .height = RC2D_BENCH_UPLOAD_TEXTURE_SIZE,
+        .layer_count_or_depth = 1,
+        .num_levels = 1,
+        .sample_count = SDL_GPU_SAMPLECOUNT_1
+    });
+    rc2d_bench_upload.image.width = RC2D_BENCH_UPLOAD_TEXTURE_SIZE;
+    rc2d_bench_upload.image.height = RC2D_BENCH_UPLOAD_TEXTURE_SIZE;
+    rc2d_bench_upload.image.state = RC2D_IMAGE_READY;
+
+    rc2d_bench_upload.buffer = SDL_CreateGPUBuffer(rc2d_gpu_getDevice(), &(SDL_GPUBufferCreateInfo){
+        .usage = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ,
+        .size = RC2D_BENCH_UPLOAD_JOB_COUNT * 2 * RC2D_BENCH_UPLOAD_JOB_SIZE
+    });
+
+    if (rc2d_bench_upload.image.texture == NULL || rc2d_bench_upload.buffer == NULL)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "Failed to create upload scene resources: %s", SDL_GetError());
+        return false;
+    }
+    return true;
+}
+
+void rc2d_bench_uploadUnload(void)
+{
+    if (rc2d_bench_upload.image.texture) SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), rc2d_bench_upload.image.texture);
+    if (rc2d_bench_upload.buffer) SDL_ReleaseGPUBuffer(rc2d_gpu_getDevice(), rc2d_bench_upload.buffer);
+    SDL_zero(rc2d_bench_upload);
+}
+
+void rc2d_bench_uploadDraw(Uint32 frameIndex, float width, float height)
+{
+    RC2D_JobCounter jobs = {0};
+    for (Uint32 i = 0; i < RC2D_BENCH_UPLOAD_JOB_COUNT; i++)
+    {
+        rc2d_bench_upload_jobs[i] = (RC2D_BenchUploadJob){ frameIndex, i };
+        rc2d_job_run(rc2d_bench_upload_job, &rc2d_bench_upload_jobs[i], &jobs);
+    }
+
+    // Pendant que les jobs écrivent, le thread principal remplit la texture qu'il dessine dans cette frame
+    const Uint32 size = RC2D_BENCH_UPLOAD_TEXTURE_SIZE * RC2D_BENCH_UPLOAD_TEXTURE_SIZE * 4;
+    RC2D_GPUUploadAllocation allocation;
+    if (rc2d_gpu_beginUpload(size, 512, &allocation))
+    {
+        const SDL_Color color = rc2d_bench_upload_color(frameIndex);
+        Uint8* pixels = (Uint8*)allocation.data;
+        for (Uint32 i = 0; i < size; i += 4)
+        {
+            pixels[i + 0] = color.r;
+            pixels[i + 1] = color.g;
+            pixels[i + 2] = color.b;
+            pixels[i + 3] = color.a;
+        }
+
+        SDL_GPUTextureRegion region = { .texture = rc2d_bench_upload.image.texture, .w = RC2D_BENCH_UPLOAD_TEXTURE_SIZE, .h = RC2D_BENCH_UPLOAD_TEXTURE_SIZE, .d = 1 };
+        rc2d_gpu_endUploadToTexture(&allocation, 0, &region, RC2D_BENCH_UPLOAD_TEXTURE_SIZE, RC2D_BENCH_UPLOAD_TEXTURE_SIZE);
+    }
+    else
+    {
+        SDL_AddAtomicInt(&rc2d_bench_upload.failures, 1);
+    }
+
+    rc2d_gpu_setColor((RC2D_Color){ 255, 255, 255, 255 });
+    rc2d_gpu_drawQuad(&rc2d_bench_upload.image, 0.0f, 0.0f, width, height, 0.0f, 0.0f, 1.0f, 1.0f);
+
+    rc2d_job_wait(&jobs);
+}
+
+void rc2d_bench_uploadCheckFrame(Uint32 frameIndex)
+{
+    Uint32 width = 0;
+    Uint32 height = 0;
+    Uint8* pixels = rc2d_gpu_readHeadlessTarget(&width, &height);
+    RC2D_assert_release(pixels != NULL, RC2D_LOG_CRITICAL, "Failed to read back benchmark frame");
+
+    const SDL_Color expected = rc2d_bench_upload_color(frameIndex);
+    const Uint8* center = pixels + ((size_t)(height / 2) * width + width / 2) * 4;
+    if (center[0] != expected.r || center[1] != expected.g || center[2] != expected.b)
+    {
+        if (rc2d_bench_upload.mismatches == 0)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "Upload scene: frame %u shows (%u, %u, %u), expected (%u, %u, %u)",
+                frameIndex, center[0], center[1], center[2], expected.r, expected.g, expected.b);
+        }
+        rc2d_bench_upload.mismatches++;
+    }
+    rc2d_bench_upload.checked++;
+
+    RC2D_free(pixels);
+}
+
+/**
+ * Relit le buffer écrit par les jobs et compte les octets qui ne viennent pas de la frame lastFrameIndex.
+ */
+static Uint32 rc2d_bench_upload_checkBuffer(Uint32 lastFrameIndex)
+{
+    const Uint32 size = RC2D_BENCH_UPLOAD_JOB_COUNT * 2 * RC2D_BENCH_UPLOAD_JOB_SIZE;
+
+    // Les uploads des jobs partent avant la relecture, soumise après eux
+    rc2d_gpu_flushUploads();
+
+    SDL_GPUTransferBuffer* download = SDL_CreateGPUTransferBuffer(rc2d_gpu_getDevice(), &(SDL_GPUTransferBufferCreateInfo){
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_DOWNLOAD,
+        .size = size
+    });
+    SDL_GPUCommandBuffer* commandBuffer = download ? SDL_AcquireGPUCommandBuffer(rc2d_gpu_getDevice()) : NULL;
+    RC2D_assert_release(commandBuffer != NULL, RC2D_LOG_CRITICAL, "Failed to read back upload buffer: %s", SDL_GetError());
+
+    SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(commandBuffer);
+    SDL_DownloadFromGPUBuffer(
+        copyPass,
+        &(SDL_GPUBufferRegion){ .buffer = rc2d_bench_upload.buffer, .offset = 0, .size = size },
+        &(SDL_GPUTransferBufferLocation){ .transfer_buffer = download, .offset = 0 }
+    );
+    SDL_EndGPUCopyPass(copyPass);
+
+    SDL_GPUFence* fence = SDL_SubmitGPUCommandBufferAndAcquireFence(commandBuffer);
+    RC2D_assert_release(fence != NULL, RC2D_LOG_CRITICAL, "Failed to read back upload buffer: %s", SDL_GetError());
+    SDL_WaitForGPUFences(rc2d_gpu_getDevice(), true, &fence, 1);
+    SDL_ReleaseGPUFence(rc2d_gpu_getDevice(), fence);
+
+    const Uint8* data = (const Uint8*)SDL_MapGPUTransferBuffer(rc2d_gpu_getDevice(), download, false);
+    RC2D_assert_release(data != NULL, RC2D_LOG_CRITICAL, "Failed to map upload readback: %s", SDL_GetError());
+
+    Uint32 wrong = 0;
+    for (Uint32 i = 0; i < size; i++)
+    {
+        const Uint32 job = i / (2 * RC2D_BENCH_UPLOAD_JOB_SIZE);
+        const bool inner = (i / RC2D_BENCH_UPLOAD_JOB_SIZE) % 2 == 1;
+        if (data[i] != rc2d_bench_upload_jobByte(lastFrameIndex, job, inner)) wrong++;
+    }
+
+    SDL_UnmapGPUTransferBuffer(rc2d_gpu_getDevice(), download);
+    SDL_ReleaseGPUTransferBuffer(rc2d_gpu_getDevice(), download);
+    return wrong;
+}
+
+bool rc2d_bench_uploadWriteResults(SDL_IOStream* io, Uint32 lastFrameIndex)
+{
+    const Uint32 wrongBytes = rc2d_bench_upload_checkBuffer(lastFrameIndex);
+    const int failures = SDL_GetAtomicInt(&rc2d_bench_upload.failures);
+
+    RC2D_GPUUploadStats stats;
+    rc2d_gpu_getUploadStats(&stats);
+
+    SDL_IOprintf(io, "  \"upload_frames_checked\": %u,\n", rc2d_bench_upload.checked);
+    SDL_IOprintf(io, "  \"upload_frame_mismatches\": %u,\n", rc2d_bench_upload.mismatches);
+    SDL_IOprintf(io, "  \"upload_job_wrong_bytes\": %u,\n", wrongBytes);
+    SDL_IOprintf(io, "  \"upload_failures\": %d,\n", failures);
+    SDL_IOprintf(io, "  \"upload_submits\": %" SDL_PRIu64 ",\n", stats.submit_count);
+    SDL_IOprintf(io, "  \"upload_dedicated\": %" SDL_PRIu64 ",\n", stats.dedicated_count);
+    SDL_IOprintf(io, "  \"upload_stalls\": %" SDL_PRIu64 ",\n", stats.stall_count);
+
+    if (rc2d_bench_upload.mismatches > 0 || wrongBytes > 0 || failures > 0)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Upload scene failed: %u frame mismatches, %u wrong bytes, %d failed reservations",
+            rc2d_bench_upload.mismatches, wrongBytes, failures);
+        return false;
+    }
+    return true;
+}
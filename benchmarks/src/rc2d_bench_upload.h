@@ -0,0 +1,50 @@
+#ifndef RC2D_BENCH_UPLOAD_H
+#define RC2D_BENCH_UPLOAD_H
+
+#include <SDL3/SDL_iostream.h>
+
+#include <stdbool.h> // Required for: bool
+
+/**
+ * Scène "upload" de rc2d_bench : test de charge et de correction du ring d'upload GPU.
+ *
+ * À chaque frame, des jobs gardent deux réservations ouvertes à la fois dans un ring volontairement petit
+ * (segments pleins, buffers dédiés), pendant que le thread principal remplit une texture dans rc2d_draw et la
+ * dessine aussitôt sur toute la cible. La frame relue doit avoir la couleur de l'upload de la même frame,
+ * et le buffer écrit par les jobs doit contenir les données de la dernière frame.
+ */
+
+/**
+ * Taille des segments du ring pour cette scène (RC2D_EngineConfig::gpuUploadRingSize).
+ */
+#define RC2D_BENCH_UPLOAD_RING_SIZE (256*1024)
+
+/**
+ * Crée la texture et le buffer GPU de la scène. Appelée depuis rc2d_load.
+ */
+bool rc2d_bench_uploadLoad(void);
+
+/**
+ * Libère les ressources de la scène. Appelée depuis rc2d_unload.
+ */
+void rc2d_bench_uploadUnload(void);
+
+/**
+ * Lance les jobs de la frame, remplit la texture du thread principal et la dessine sur une cible width x height.
+ */
+void rc2d_bench_uploadDraw(Uint32 frameIndex, float width, float height);
+
+/**
+ * Relit la frame frameIndex (déjà présentée) et vérifie qu'elle a la couleur de son upload.
+ */
+void rc2d_bench_uploadCheckFrame(Uint32 frameIndex);
+
+/**
+ * Vérifie le contenu du buffer écrit par les jobs à la frame lastFrameIndex, puis écrit les résultats
+ * (champs JSON, suivis d'une virgule) dans io.
+ *
+ * \return true si aucune frame ni aucune donnée des jobs n'était incorrecte.
+ */
+bool rc2d_bench_uploadWriteResults(SDL_IOStream* io, Uint32 lastFrameIndex);
+
+#endif // RC2D_BENCH_UPLOAD_H
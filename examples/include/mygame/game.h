@@ -9,7 +9,7 @@ extern "C" {
 void rc2d_unload(void);
 void rc2d_load(void);
 void rc2d_update(double dt);
-void rc2d_draw(void);
+void rc2d_draw(double alpha);
 
 /* Termine les définitions de fonctions C lors de l'utilisation de C++ */
 #ifdef __cplusplus
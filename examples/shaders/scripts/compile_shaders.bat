@@ -198,6 +198,11 @@ for %%f in (%SRC_DIR%\*.hlsl) do (
     )
 )
 
+:: Regroupement des fichiers JSON de réflexion dans la table binaire chargée par RC2D
+if "%COMPILE_JSON%"=="true" (
+    powershell -NoProfile -ExecutionPolicy Bypass -File "%~dp0pack_reflection.ps1" -ReflectionDir "%OUT_REFLECTION_DIR%"
+)
+
 :: Récupération du répertoire de sortie absolu des shaders compilés
 pushd "%OUT_COMPILED_DIR%"
 set ABS_OUT_COMPILED_DIR=%CD%
@@ -242,12 +247,13 @@ echo     --only-spirv              Compiler uniquement pour SPIR-V (Vulkan)
 echo     --only-dxil               Compiler uniquement pour DXIL (Direct3D12)
 echo     --only-msl                Compiler uniquement pour MSL (Metal)
 echo     --only-pssl               Compiler uniquement pour PSSL (PlayStation Shader Language)
-echo     --no-json                 Desactiver la generation des fichiers JSON (reflexion des ressources shaders)
+echo     --no-json                 Desactiver la generation des fichiers JSON et de reflection.bin (reflexion des ressources shaders)
 echo     --help                    Afficher cette aide
 echo.
 echo Comportement par defaut :
 echo     Compile les shaders source HLSL en : SPIR-V (Vulkan), DXIL (Direct3D12), MSL (Metal), et PSSL (PlayStation Shader Language).
 echo     Genere les fichiers JSON : Les informations de reflexion automatique sur les ressources utiliser par un shader.
+echo     Regroupe ces fichiers JSON dans reflection.bin : la table binaire lue par RC2D au demarrage (peut etre packee dans un fichier rres).
 echo     Version MSL par defaut : 3.2.0 (macOS 15.0+, iOS/iPadOS 18.0+).
 echo.
 echo Exemples :
@@ -273,7 +279,7 @@ echo         ../compiled/spirv : shaders SPIR-V (Vulkan)
 echo         ../compiled/msl   : shaders MSL (Metal)
 echo         ../compiled/dxil  : shaders DXIL (Direct3D12)
 echo         ../compiled/pssl  : shaders PSSL (PlayStation Shader Language)
-echo         ../reflection     : fichiers JSON de reflexion des ressources shaders
+echo         ../reflection     : fichiers JSON de reflexion des ressources shaders et reflection.bin
 echo.
 echo     Le script verifie si le binaire shadercross est present dans ../tools.
 echo     S'il est absent, un message d'erreur est affiche et le script se termine.
@@ -292,6 +298,7 @@ goto :eof
     echo [32m  Total shader compiler avec succes : %COMPILED_COUNT%[0m
     if "%COMPILE_JSON%"=="true" (
         echo [32m  Total fichiers JSON generer : %COMPILED_COUNT%[0m
+        echo [32m  Table de reflexion binaire : reflection.bin[0m
     )
     endlocal
     goto :eof
@@ -13,6 +13,75 @@ check_shader_main() {
     grep -q "main" "$1"
 }
 
+# Écrit un entier 32 bits non signé en little endian sur la sortie standard
+write_u32_le() {
+    local v=$1
+    printf "\\x$(printf '%02x' $((v & 255)))\\x$(printf '%02x' $(((v >> 8) & 255)))\\x$(printf '%02x' $(((v >> 16) & 255)))\\x$(printf '%02x' $(((v >> 24) & 255)))"
+}
+
+# Extrait la valeur entière d'une clé d'un fichier JSON de réflexion (0 si absente)
+json_u32() {
+    local value
+    value=$(grep -o "\"$2\"[[:space:]]*:[[:space:]]*[0-9]*" "$1" | head -n 1 | grep -o '[0-9]*$')
+    echo "${value:-0}"
+}
+
+# Regroupe les fichiers JSON de réflexion dans une table binaire lue sans analyse par RC2D (reflection.bin)
+#
+# Format (little endian) :
+#   En-tête  : "RC2DREFL" (8 octets), version (u32 = 1), nombre d'entrées (u32)
+#   Entrée   : nom du shader (64 octets, complété par des 0), stage (u32 : 0 vertex, 1 fragment, 2 compute),
+#              samplers, uniform_buffers, storage_buffers, storage_textures,
+#              readonly_storage_textures, readonly_storage_buffers, readwrite_storage_textures, readwrite_storage_buffers,
+#              threadcount_x, threadcount_y, threadcount_z (u32)
+#   Les entrées sont triées par nom (ordre des octets) pour une recherche dichotomique.
+pack_reflection() {
+    local reflection_dir="$1"
+    local output="$reflection_dir/reflection.bin"
+    local names=()
+    local json name stage
+
+    for json in "$reflection_dir"/*.json; do
+        [ -f "$json" ] || continue
+        name=$(basename "$json" .json)
+        if [ ${#name} -ge 64 ]; then
+            print_red "Nom de shader trop long pour la table de réflexion (63 caractères max) : $name"
+            continue
+        fi
+        names+=("$name")
+    done
+
+    {
+        printf 'RC2DREFL'
+        write_u32_le 1
+        write_u32_le ${#names[@]}
+
+        for name in $(printf '%s\n' "${names[@]}" | LC_ALL=C sort); do
+            json="$reflection_dir/$name.json"
+            case "$name" in
+                *.vertex*)   stage=0 ;;
+                *.fragment*) stage=1 ;;
+                *)           stage=2 ;;
+            esac
+
+            printf '%s' "$name"
+            head -c $((64 - ${#name})) /dev/zero
+            write_u32_le $stage
+            write_u32_le "$(json_u32 "$json" samplers)"
+            write_u32_le "$(json_u32 "$json" uniform_buffers)"
+            write_u32_le "$(json_u32 "$json" storage_buffers)"
+            write_u32_le "$(json_u32 "$json" storage_textures)"
+            write_u32_le "$(json_u32 "$json" readonly_storage_textures)"
+            write_u32_le "$(json_u32 "$json" readonly_storage_buffers)"
+            write_u32_le "$(json_u32 "$json" readwrite_storage_textures)"
+            write_u32_le "$(json_u32 "$json" readwrite_storage_buffers)"
+            write_u32_le "$(json_u32 "$json" threadcount_x)"
+            write_u32_le "$(json_u32 "$json" threadcount_y)"
+            write_u32_le "$(json_u32 "$json" threadcount_z)"
+        done
+    } > "$output"
+}
+
 # Affiche un résumé de la compilation
 print_summary() {
     echo -e "\033[93m[SUMMARY] Compilation\033[0m"
@@ -21,6 +90,7 @@ print_summary() {
     echo -e "\033[32m  Total shader compilé avec succès : $COMPILED_COUNT\033[0m"
     if [ "$COMPILE_JSON" = true ]; then
         echo -e "\033[32m  Total fichiers JSON généré : $COMPILED_COUNT\033[0m"
+        echo -e "\033[32m  Table de réflexion binaire : reflection.bin\033[0m"
     fi
 }
 
@@ -45,12 +115,13 @@ print_help() {
     echo "    --only-dxil               Compiler uniquement pour DXIL (Direct3D12)"
     echo "    --only-msl                Compiler uniquement pour MSL et METALLIB (Metal)"
     echo "    --only-pssl               Compiler uniquement pour PSSL (PlayStation Shading Language)"
-    echo "    --no-json                 Désactiver la génération des fichiers JSON (réflexion des ressources shaders)"
+    echo "    --no-json                 Désactiver la génération des fichiers JSON et de reflection.bin (réflexion des ressources shaders)"
     echo "    --help                    Afficher cette aide"
     echo
     echo "Comportement par défaut :"
     echo "    Compile les shaders source HLSL en : SPIR-V (Vulkan), DXIL (Direct3D12), MSL / METALLIB (Metal), et PSSL (PlayStation Shading Language)."
     echo "    Génère les fichiers JSON : Les informations de réflexion automatique sur les ressources utilisées par un shader."
+    echo "    Regroupe ces fichiers JSON dans reflection.bin : la table binaire lue par RC2D au démarrage (peut être packée dans un fichier rres)."
     echo "    Version MSL / METALLIB par défaut : 3.2.0 (macOS 15.0+, iOS/iPadOS 18.0+)."
     echo
     echo "Exemples :"
@@ -77,7 +148,7 @@ print_help() {
     echo "        ../compiled/metallib : shaders METALLIB (Metal)"
     echo "        ../compiled/dxil     : shaders DXIL (Direct3D12)"
     echo "        ../compiled/pssl     : shaders PSSL (PlayStation Shading Language)"
-    echo "        ../reflection        : fichiers JSON de réflexion des ressources shaders"
+    echo "        ../reflection        : fichiers JSON de réflexion des ressources shaders et reflection.bin"
     echo
     echo "    Le script vérifie si le binaire shadercross est présent dans ../tools."
     echo "    S'il est absent, un message d'erreur est affiché et le script se termine."
@@ -312,6 +383,11 @@ for f in "$SRC_DIR"/*.hlsl; do
     fi
 done
 
+# Regroupement des fichiers JSON de réflexion dans la table binaire chargée par RC2D
+if [ "$COMPILE_JSON" = true ]; then
+    pack_reflection "$OUT_REFLECTION_DIR"
+fi
+
 # Récupération du répertoire de sortie absolu des shaders compilés
 ABS_OUT_COMPILED_DIR=$(cd "$OUT_COMPILED_DIR" && pwd)
 
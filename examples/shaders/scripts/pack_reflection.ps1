@@ -0,0 +1,62 @@
+# ==================================================
+# RC2D - Regroupe les fichiers JSON de réflexion des shaders dans reflection.bin
+# Appelé par compile_shaders.bat, même format que pack_reflection dans compile_shaders.sh :
+#
+#   En-tête  : "RC2DREFL" (8 octets), version (u32 = 1), nombre d'entrées (u32)
+#   Entrée   : nom du shader (64 octets, complété par des 0), stage (u32 : 0 vertex, 1 fragment, 2 compute),
+#              samplers, uniform_buffers, storage_buffers, storage_textures,
+#              readonly_storage_textures, readonly_storage_buffers, readwrite_storage_textures, readwrite_storage_buffers,
+#              threadcount_x, threadcount_y, threadcount_z (u32)
+#   Les entrées sont triées par nom (ordre des octets) pour une recherche dichotomique.
+# ==================================================
+param(
+    [Parameter(Mandatory = $true)][string]$ReflectionDir
+)
+
+$fields = @(
+    "samplers", "uniform_buffers", "storage_buffers", "storage_textures",
+    "readonly_storage_textures", "readonly_storage_buffers", "readwrite_storage_textures", "readwrite_storage_buffers",
+    "threadcount_x", "threadcount_y", "threadcount_z"
+)
+
+$entries = @()
+foreach ($file in Get-ChildItem -Path $ReflectionDir -Filter *.json) {
+    $name = [System.IO.Path]::GetFileNameWithoutExtension($file.Name)
+    if ($name.Length -ge 64) {
+        Write-Host "[ERROR] Nom de shader trop long pour la table de reflexion (63 caracteres max) : $name" -ForegroundColor Red
+        continue
+    }
+    $entries += [PSCustomObject]@{ Name = $name; Json = (Get-Content -Raw $file.FullName | ConvertFrom-Json) }
+}
+
+# Tri ordinal, identique à SDL_strcmp
+$sorted = [System.Collections.Generic.List[object]]::new()
+$entries | ForEach-Object { $sorted.Add($_) }
+$sorted.Sort([System.Comparison[object]]{ param($a, $b) [string]::CompareOrdinal($a.Name, $b.Name) })
+
+$stream = [System.IO.MemoryStream]::new()
+$writer = [System.IO.BinaryWriter]::new($stream)
+$writer.Write([System.Text.Encoding]::ASCII.GetBytes("RC2DREFL"))
+$writer.Write([UInt32]1)
+$writer.Write([UInt32]$sorted.Count)
+
+foreach ($entry in $sorted) {
+    $nameBytes = New-Object byte[] 64
+    [System.Text.Encoding]::ASCII.GetBytes($entry.Name).CopyTo($nameBytes, 0)
+    $writer.Write($nameBytes)
+
+    if ($entry.Name -like "*.vertex*") { $stage = 0 }
+    elseif ($entry.Name -like "*.fragment*") { $stage = 1 }
+    else { $stage = 2 }
+    $writer.Write([UInt32]$stage)
+
+    foreach ($field in $fields) {
+        $value = $entry.Json.$field
+        if ($null -eq $value) { $value = 0 }
+        $writer.Write([UInt32]$value)
+    }
+}
+
+$writer.Flush()
+[System.IO.File]::WriteAllBytes((Join-Path (Resolve-Path $ReflectionDir) "reflection.bin"), $stream.ToArray())
+$writer.Dispose()
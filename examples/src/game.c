@@ -77,7 +77,7 @@ void rc2d_load(void)
     };
 
     SDL_GPUMultisampleState multisample = {
-        .sample_count = SDL_GPU_SAMPLECOUNT_1,
+        .sample_count = rc2d_gpu_getSampleCount(),
         .sample_mask = 0,
         .enable_mask = false
     };
@@ -99,10 +99,7 @@ void rc2d_load(void)
         .enable_stencil_test = false
     };
 
-    SDL_GPUTextureFormat swapchainFormat = SDL_GetGPUSwapchainTextureFormat(
-        rc2d_gpu_getDevice(),
-        rc2d_window_getWindow()
-    );
+    SDL_GPUTextureFormat swapchainFormat = rc2d_gpu_getColorTargetFormat();
 
     colorTargetDesc = (SDL_GPUColorTargetDescription){
         .format = swapchainFormat,
@@ -141,7 +138,7 @@ void rc2d_update(double dt)
 
 }
 
-void rc2d_draw(void)
+void rc2d_draw(double alpha)
 {
     // -------------------- SHADER COMPUTE -------------------
 
@@ -2,6 +2,7 @@
 #define RC2D_H
 
 #include <RC2D/RC2D_assert.h>
+#include <RC2D/RC2D_atlas.h>
 #include <RC2D/RC2D_audio.h>
 #include <RC2D/RC2D_camera.h>
 #include <RC2D/RC2D_collision.h>
@@ -14,6 +15,8 @@
 // #include <RC2D/RC2D_gamepad.h>
 #include <RC2D/RC2D_gpu.h>
 #include <RC2D/RC2D_guid.h>
+#include <RC2D/RC2D_hashmap.h>
+#include <RC2D/RC2D_job.h>
 #include <RC2D/RC2D_keyboard.h>
 #include <RC2D/RC2D_keycode.h>
 #include <RC2D/RC2D_local.h>
@@ -27,6 +30,7 @@
 #include <RC2D/RC2D_pixels.h>
 #include <RC2D/RC2D_platform.h>
 #include <RC2D/RC2D_power.h>
+#include <RC2D/RC2D_profiler.h>
 // #include <RC2D/RC2D_rres.h>
 #include <RC2D/RC2D_scancode.h>
 // #include <RC2D/RC2D_spine.h>
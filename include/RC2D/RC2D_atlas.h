@@ -0,0 +1,216 @@
+#ifndef RC2D_ATLAS_H
+#define RC2D_ATLAS_H
+
+#include <RC2D/RC2D_gpu.h>
+
+#include <SDL3/SDL_stdinc.h> // Required for: Uint32, Uint64
+
+#include <stdbool.h>         // Required for: bool
+
+/* Configuration pour les définitions de fonctions C, même lors de l'utilisation de C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Rectangle en pixels dans une page d'atlas.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_AtlasRect {
+    Uint32 x;
+    Uint32 y;
+    Uint32 width;
+    Uint32 height;
+} RC2D_AtlasRect;
+
+/**
+ * \brief Packer MaxRects d'une page d'atlas, sans accès au GPU.
+ *
+ * Le packer garde la liste des rectangles libres maximaux de la page. Chaque insertion choisit le rectangle
+ * libre qui laisse le plus petit reste sur son côté le plus court (Best Short Side Fit), puis découpe les
+ * rectangles libres qu'elle chevauche. Une zone retirée redevient libre et est fusionnée avec ses voisines
+ * quand elles forment un rectangle.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_AtlasPacker RC2D_AtlasPacker;
+
+/**
+ * \brief Statistiques de l'atlas de textures partagé.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_AtlasStats {
+    /**
+     * \brief Nombre de pages et taille d'une page (en pixels).
+     */
+    Uint32 page_count;
+    Uint32 page_size;
+
+    /**
+     * \brief Nombre d'images rangées dans l'atlas.
+     */
+    Uint32 image_count;
+
+    /**
+     * \brief Part de la surface des pages occupée par les images (bordures comprises), entre 0 et 1.
+     */
+    float occupancy;
+
+    /**
+     * \brief Mémoire GPU occupée par les pages (en octets).
+     */
+    Uint64 bytes;
+
+    /**
+     * \brief Nombre de défragmentations depuis le démarrage.
+     */
+    Uint32 defragment_count;
+} RC2D_AtlasStats;
+
+/**
+ * \brief Crée un packer pour une page vide.
+ *
+ * \param {Uint32} width - Largeur de la page.
+ * \param {Uint32} height - Hauteur de la page.
+ * \return {RC2D_AtlasPacker*} - Le packer, ou NULL en cas d'échec d'allocation.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_atlas_destroyPacker
+ */
+RC2D_AtlasPacker* rc2d_atlas_createPacker(Uint32 width, Uint32 height);
+
+/**
+ * \brief Détruit un packer.
+ *
+ * \param {RC2D_AtlasPacker*} packer - Packer à détruire (NULL est ignoré).
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_atlas_destroyPacker(RC2D_AtlasPacker* packer);
+
+/**
+ * \brief Réserve une zone libre dans la page.
+ *
+ * \param {RC2D_AtlasPacker*} packer - Packer de la page.
+ * \param {Uint32} width - Largeur de la zone.
+ * \param {Uint32} height - Hauteur de la zone.
+ * \param {RC2D_AtlasRect*} rect - Reçoit la zone réservée.
+ * \return {bool} - true si la zone a été réservée, false si la page n'a plus de place pour elle.
+ *
+ * \threadsafety Les appels sur un même packer doivent être sérialisés par l'appelant.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_atlas_packerInsert(RC2D_AtlasPacker* packer, Uint32 width, Uint32 height, RC2D_AtlasRect* rect);
+
+/**
+ * \brief Libère une zone réservée avec rc2d_atlas_packerInsert.
+ *
+ * \param {RC2D_AtlasPacker*} packer - Packer de la page.
+ * \param {const RC2D_AtlasRect*} rect - Zone à libérer.
+ *
+ * \note Quand la dernière zone est libérée, la page redevient un seul rectangle libre.
+ *
+ * \threadsafety Les appels sur un même packer doivent être sérialisés par l'appelant.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_atlas_packerRemove(RC2D_AtlasPacker* packer, const RC2D_AtlasRect* rect);
+
+/**
+ * \brief Libère toutes les zones de la page.
+ *
+ * \param {RC2D_AtlasPacker*} packer - Packer de la page.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_atlas_packerClear(RC2D_AtlasPacker* packer);
+
+/**
+ * \brief Récupère la surface réservée dans la page (en pixels).
+ *
+ * \param {const RC2D_AtlasPacker*} packer - Packer de la page.
+ * \return {Uint64} - Somme des surfaces des zones réservées.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+Uint64 rc2d_atlas_getPackerUsedArea(const RC2D_AtlasPacker* packer);
+
+/**
+ * \brief Range une image RGBA 8 bits dans l'atlas de textures partagé.
+ *
+ * L'image est placée dans la première page qui a de la place (une nouvelle page de
+ * RC2D_EngineConfig::atlasPageSize pixels est créée au besoin), entourée d'une bordure de
+ * RC2D_EngineConfig::atlasPadding pixels qui répète ses bords. Les pixels passent par le ring d'upload GPU.
+ *
+ * Les images d'une même page sont dessinées sans changer de texture : les sprites restent dans la même
+ * draw call du sprite batch. Les images du cache (rc2d_gpu_newImage, rc2d_gpu_loadImageAsync) plus petites que
+ * RC2D_EngineConfig::atlasMaxImageSize y sont rangées automatiquement.
+ *
+ * \param {const void*} pixels - Pixels de l'image (SDL_PIXELFORMAT_RGBA32).
+ * \param {int} pitch - Taille d'une ligne de pixels (en octets).
+ * \param {Uint32} width - Largeur de l'image.
+ * \param {Uint32} height - Hauteur de l'image.
+ * \return {RC2D_Image*} - L'image, ou NULL si elle est plus grande qu'une page ou si la page n'a pas pu être créée.
+ *
+ * \warning Les images de l'atlas ne supportent pas les samplers en mode répétition (SDL_GPU_SAMPLERADDRESSMODE_REPEAT).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_atlas_freeImage
+ */
+RC2D_Image* rc2d_atlas_newImage(const void* pixels, int pitch, Uint32 width, Uint32 height);
+
+/**
+ * \brief Retire de l'atlas une image créée avec rc2d_atlas_newImage et la libère.
+ *
+ * La place libérée est réutilisée par les images suivantes. Quand les pages sont assez vides pour en
+ * supprimer au moins une, l'atlas est défragmenté automatiquement au début de la frame suivante.
+ *
+ * \param {RC2D_Image*} image - Image à libérer (NULL est ignoré).
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_atlas_freeImage(RC2D_Image* image);
+
+/**
+ * \brief Réorganise toutes les images de l'atlas dans le moins de pages possible.
+ *
+ * Les images sont replacées de la plus haute à la plus petite dans de nouvelles pages, puis copiées par le GPU
+ * depuis les anciennes pages (sans relire leurs pixels), dans une copy pass du ring d'upload envoyée aussitôt.
+ * Les anciennes pages sont libérées quelques frames plus tard, quand plus aucune frame en cours ne les utilise.
+ *
+ * \note Les pointeurs RC2D_Image restent valides : seules leur texture et leur zone changent.
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_atlas_defragment(void);
+
+/**
+ * \brief Récupère les statistiques de l'atlas de textures.
+ *
+ * \param {RC2D_AtlasStats*} stats - Pointeur vers la structure à remplir.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_atlas_getStats(RC2D_AtlasStats* stats);
+
+/* Termine les définitions de fonctions C lors de l'utilisation de C++ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RC2D_ATLAS_H
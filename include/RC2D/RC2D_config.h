@@ -111,6 +111,22 @@ extern "C" {
 #define RC2D_MEMORY_DEBUG_ENABLED 0
 #endif
 
+/**
+ * \brief Si RC2D_PROFILER_ENABLED est défini à 1, le profiler CPU par zones est activé.
+ *
+ * Les zones délimitées par `RC2D_PROFILE_BEGIN` / `RC2D_PROFILE_END` (dont les phases de la boucle
+ * principale : update, attente de la swapchain, draw, present...) sont horodatées avec
+ * SDL_GetPerformanceCounter dans un buffer circulaire par thread. Elles peuvent être exportées au format
+ * Chrome `trace_event` (chrome://tracing, Perfetto) ou résumées (min/moyenne/p99) via `rc2d_profiler_getZoneStats`.
+ *
+ * \note Lorsque l'option est désactivée, les macros de zones ne génèrent aucun code.
+ *
+ * \since Cette macro de préprocesseur est disponible depuis RC2D 1.0.0.
+ */
+#ifndef RC2D_PROFILER_ENABLED
+#define RC2D_PROFILER_ENABLED 0
+#endif
+
 /* Termine les définitions de fonctions C lors de l'utilisation de C++ */
 #ifdef __cplusplus
 }
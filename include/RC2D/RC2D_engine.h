@@ -314,6 +314,20 @@ typedef struct RC2D_Callbacks {
      */
     void (*rc2d_update)(double dt);
 
+    /**
+     * \brief Appelée à pas de temps fixe pour la simulation (physique, réseau...).
+     *
+     * Active uniquement si RC2D_EngineConfig::fixedUpdateRate est supérieur à 0. Le temps écoulé est accumulé
+     * à chaque frame, et cette fonction est appelée autant de fois que nécessaire (au plus fixedUpdateMaxSteps
+     * fois par frame) avant `rc2d_update` : la simulation avance au même rythme quel que soit le taux de
+     * rafraîchissement du moniteur, et une frame lente ne produit jamais un pas de temps plus grand.
+     *
+     * \param dt Pas de temps fixe (en secondes), toujours égal à 1 / fixedUpdateRate.
+     *
+     * \since Cette fonction est disponible depuis RC2D 1.0.0.
+     */
+    void (*rc2d_fixedupdate)(double dt);
+
     /**
      * \brief Appelée à intervalles réguliers pour rendre la frame de jeu.
      *
@@ -322,9 +336,12 @@ typedef struct RC2D_Callbacks {
      * est responsable du rendu graphique de l'état actuel du jeu (ex. : dessin des
      * sprites, mise à jour de l'écran).
      *
+     * \param alpha Facteur d'interpolation entre les deux derniers états de la simulation à pas fixe (0 à 1) :
+     * dessiner `previous + (current - previous) * alpha`. Vaut toujours 1 si `rc2d_fixedupdate` n'est pas utilisé.
+     *
      * \since Cette fonction est disponible depuis RC2D 1.0.0.
      */
-    void (*rc2d_draw)(void);
+    void (*rc2d_draw)(double alpha);
 
 
     // ------------- Keyboard Callbacks ------------- //
@@ -1235,6 +1252,98 @@ typedef struct RC2D_EngineConfig {
      * - driver : RC2D_GPU_DRIVER_DEFAULT
      */
     RC2D_GPUAdvancedOptions* gpuOptions;
+
+    /**
+     * Taille (en octets) de chaque segment du ring d'upload GPU partagé par les loaders.
+     * Le ring contient un segment par frame en vol, plus un, pour le thread principal, et autant pour
+     * les autres threads (créés à leur première réservation).
+     * 
+     * Par défaut : 8 Mo.
+     */
+    Uint32 gpuUploadRingSize;
+
+    /**
+     * Mode headless : aucune fenêtre visible ni swapchain, le rendu est fait dans une texture hors écran
+     * de windowWidth x windowHeight pixels (format R8G8B8A8_UNORM) et les FPS ne sont pas limités.
+     * 
+     * Le pilote vidéo "dummy" est utilisé, sauf si la variable d'environnement SDL_VIDEO_DRIVER en impose un autre.
+     * Prévu pour les benchmarks et les tests de rendu en CI, y compris sans GPU (ex : Vulkan logiciel avec lavapipe).
+     * 
+     * Par défaut : false.
+     */
+    bool headless;
+
+    /**
+     * Fréquence (en Hz) de la callback rc2d_fixedupdate, ou 0 pour ne pas utiliser de simulation à pas fixe.
+     * 
+     * Par défaut : 0.
+     */
+    int fixedUpdateRate;
+
+    /**
+     * Nombre maximal d'appels à rc2d_fixedupdate par frame. Au-delà (frame très lente, chargement...),
+     * le retard restant est abandonné plutôt que rattrapé, pour ne pas enchaîner des frames de plus en plus lentes.
+     * 
+     * Par défaut : 5.
+     */
+    int fixedUpdateMaxSteps;
+
+    /**
+     * Nombre de workers du système de jobs (rc2d_job_run, rc2d_job_parallelFor...), 0 pour (cœurs logiques - 1),
+     * ou -1 pour ne pas démarrer le système de jobs : les jobs sont alors exécutés directement par le thread appelant.
+     * 
+     * Par défaut : 0.
+     */
+    int jobWorkerCount;
+
+    /**
+     * Attache chaque worker du système de jobs à un cœur (Windows, Linux et Android uniquement).
+     * 
+     * Par défaut : false.
+     */
+    bool jobPinWorkers;
+
+    /**
+     * Temps maximal par frame (en microsecondes) consacré aux tâches confiées au thread principal
+     * (rc2d_job_runOnMainThread), ou 0 pour les exécuter toutes à chaque frame. Les tâches restantes
+     * attendent la frame suivante, pour que les uploads d'un chargement ne fassent pas dépasser la frame.
+     * 
+     * Par défaut : 2000 (2 ms).
+     */
+    Uint32 mainThreadTaskBudget;
+
+    /**
+     * Budget de mémoire GPU (en octets) des textures du cache d'images (rc2d_gpu_newImage, rc2d_gpu_loadImageAsync,
+     * rc2d_rres_newImageFromPack), ou 0 pour ne jamais évincer de texture. Au-delà, les textures les moins récemment
+     * dessinées sont libérées, puis rechargées à leur prochaine utilisation (voir rc2d_gpu_setImageCacheBudget).
+     * 
+     * Par défaut : 0.
+     */
+    Uint64 gpuTextureBudget;
+
+    /**
+     * Côté maximal (en pixels) des images du cache d'images rangées dans l'atlas de textures partagé plutôt que
+     * dans leur propre texture, ou 0 pour ne ranger automatiquement aucune image. Les sprites et icônes d'un même
+     * atlas sont dessinés sans changer de texture (voir rc2d_atlas_newImage).
+     * 
+     * Par défaut : 0.
+     */
+    Uint32 atlasMaxImageSize;
+
+    /**
+     * Taille (en pixels) des pages de l'atlas de textures : 2048 ou 4096.
+     * 
+     * Par défaut : 2048.
+     */
+    Uint32 atlasPageSize;
+
+    /**
+     * Bordure (en pixels) autour de chaque image de l'atlas, remplie en répétant les pixels du bord de l'image :
+     * évite que le filtrage linéaire ne mélange les images voisines.
+     * 
+     * Par défaut : 1.
+     */
+    Uint32 atlasPadding;
 } RC2D_EngineConfig;
 
 /**
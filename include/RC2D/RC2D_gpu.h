@@ -8,6 +8,79 @@
 extern "C" {
 #endif
 
+/**
+ * \brief État de chargement d'une image.
+ *
+ * \since Cette énumération est disponible depuis RC2D 1.0.0.
+ */
+typedef enum RC2D_ImageState {
+    /**
+     * \brief L'image est prête : sa texture contient ses pixels.
+     */
+    RC2D_IMAGE_READY = 0,
+
+    /**
+     * \brief Chargement asynchrone en cours (rc2d_gpu_loadImageAsync) : la texture est le placeholder.
+     */
+    RC2D_IMAGE_LOADING,
+
+    /**
+     * \brief Le chargement a échoué, ou le pack rres de l'image a été fermé : la texture reste le placeholder.
+     */
+    RC2D_IMAGE_FAILED,
+
+    /**
+     * \brief Texture évincée du budget VRAM : la texture est le placeholder, l'image est rechargée
+     * en arrière-plan à sa prochaine utilisation (rc2d_gpu_drawImage, rc2d_gpu_drawQuad).
+     */
+    RC2D_IMAGE_EVICTED
+} RC2D_ImageState;
+
+/**
+ * \brief Taille de dessin (en pixels) d'une image en chargement asynchrone, tant que ses dimensions ne sont pas connues.
+ *
+ * \since Cette macro est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_gpu_loadImageAsync
+ */
+#define RC2D_IMAGE_PLACEHOLDER_SIZE 32
+
+/**
+ * \brief Emplacement d'une image dans une page de l'atlas de textures (voir RC2D_atlas.h).
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_AtlasRegion {
+    /**
+     * \brief Index de la page de l'atlas contenant l'image.
+     */
+    Uint32 page;
+
+    /**
+     * \brief Position des pixels de l'image dans la page (bordure exclue).
+     */
+    Uint32 x;
+    Uint32 y;
+
+    /**
+     * \brief Coordonnées de texture de l'image dans la page.
+     */
+    float u0;
+    float v0;
+    float u1;
+    float v1;
+
+    /**
+     * \brief Image placée dans cette zone (usage interne).
+     */
+    struct RC2D_Image* image;
+
+    /**
+     * \brief L'image a été créée par rc2d_atlas_newImage et appartient à l'atlas (usage interne).
+     */
+    bool owns_image;
+} RC2D_AtlasRegion;
+
 /**
  * \brief Structure représentant une image 2D.
  * 
@@ -36,6 +109,34 @@ typedef struct RC2D_Image {
      * \brief Hauteur de l'image.
      */
     Uint32 height;
+
+    /**
+     * \brief État de chargement de l'image, modifié uniquement par le thread principal.
+     */
+    RC2D_ImageState state;
+
+    /**
+     * \brief Mémoire GPU occupée par la texture (en octets), 0 tant qu'elle n'est pas résidente.
+     */
+    Uint64 bytes;
+
+    /**
+     * \brief Dernière frame où l'image a été dessinée (usage interne : éviction LRU).
+     */
+    Uint64 last_used_frame;
+
+    /**
+     * \brief Entrée du cache d'images, NULL pour une image qui n'appartient pas au cache (usage interne).
+     */
+    struct RC2D_ImageEntry* entry;
+
+    /**
+     * \brief Zone de l'image dans l'atlas de textures, NULL si l'image occupe toute sa texture.
+     *
+     * Pour une image de l'atlas, `texture` est la page qui la contient, et les coordonnées de texture passées à
+     * rc2d_gpu_drawQuad sont relatives à l'image : elles sont converties dans la page au moment du dessin.
+     */
+    RC2D_AtlasRegion* atlas_region;
 } RC2D_Image;
 
 /**
@@ -428,6 +529,200 @@ s    */
     const char* fragment_shader_filename;
 } RC2D_GPUGraphicsPipeline;
 
+/**
+ * \brief Vertex utilisé par le sprite batch de RC2D.
+ *
+ * Un pipeline personnalisé passé à rc2d_gpu_setSpritePipeline doit déclarer ce format d'entrée :
+ * - location 0 : position (FLOAT2, en pixels logiques, origine en haut à gauche)
+ * - location 1 : coordonnées de texture (FLOAT2)
+ * - location 2 : couleur (UBYTE4_NORM)
+ *
+ * Le shader de vertex reçoit en uniform (slot 0) un float4 : xy = échelle, zw = translation vers l'espace NDC.
+ * Le shader de fragment reçoit la texture et son sampler au slot 0.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_GPUSpriteVertex {
+    /**
+     * \brief Position du vertex (en pixels logiques).
+     */
+    float x, y;
+
+    /**
+     * \brief Coordonnées de texture du vertex.
+     */
+    float u, v;
+
+    /**
+     * \brief Couleur du vertex (RGBA, 0 à 255).
+     */
+    RC2D_Color color;
+} RC2D_GPUSpriteVertex;
+
+/**
+ * \brief Statistiques du sprite batch pour la dernière frame.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_GPUBatchStats {
+    /**
+     * \brief Nombre de sprites (quads) dessinés.
+     */
+    Uint32 sprite_count;
+
+    /**
+     * \brief Nombre de draw calls émis (un par suite de sprites consécutifs partageant pipeline, texture et sampler).
+     */
+    Uint32 draw_call_count;
+
+    /**
+     * \brief Nombre de changements de pipeline graphique.
+     */
+    Uint32 pipeline_bind_count;
+
+    /**
+     * \brief Nombre de vidages du batch (rc2d_gpu_flushSprites explicites compris).
+     */
+    Uint32 flush_count;
+} RC2D_GPUBatchStats;
+
+/**
+ * \brief Statistiques du cache d'images (mémoire GPU résidente, budget, hits et évictions).
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_GPUImageCacheStats {
+    /**
+     * \brief Mémoire GPU occupée par les textures résidentes du cache (en octets).
+     */
+    Uint64 resident_bytes;
+
+    /**
+     * \brief Budget de mémoire GPU des textures (en octets), 0 si illimité.
+     */
+    Uint64 budget_bytes;
+
+    /**
+     * \brief Nombre d'images du cache, et nombre d'images dont la texture est résidente.
+     */
+    Uint32 image_count;
+    Uint32 resident_count;
+
+    /**
+     * \brief Utilisations pendant la dernière frame d'images résidentes (hits), ou évincées / en chargement (misses).
+     */
+    Uint32 hits_last_frame;
+    Uint32 misses_last_frame;
+
+    /**
+     * \brief hits / (hits + misses) sur la dernière frame, 1 si aucune image n'a été utilisée.
+     */
+    float hit_rate;
+
+    /**
+     * \brief Textures évincées au début de la frame en cours, et depuis le démarrage.
+     */
+    Uint32 evictions_last_frame;
+    Uint64 evictions_total;
+
+    /**
+     * \brief Rechargements d'images évincées lancés pendant la dernière frame.
+     */
+    Uint32 reloads_last_frame;
+} RC2D_GPUImageCacheStats;
+
+/**
+ * \brief Zone réservée dans le ring d'upload GPU.
+ *
+ * Obtenue via rc2d_gpu_beginUpload : l'appelant écrit ses données dans `data`, puis valide l'upload
+ * avec rc2d_gpu_endUploadToTexture / rc2d_gpu_endUploadToBuffer (ou l'annule avec rc2d_gpu_cancelUpload).
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_GPUUploadAllocation {
+    /**
+     * \brief Pointeur d'écriture dans le buffer de transfert mappé.
+     *
+     * \note La mémoire peut être en écriture combinée : évitez de la relire.
+     */
+    void* data;
+
+    /**
+     * \brief Taille réservée (en octets).
+     */
+    Uint32 size;
+
+    /**
+     * \brief Buffer de transfert contenant la zone réservée.
+     */
+    SDL_GPUTransferBuffer* transfer_buffer;
+
+    /**
+     * \brief Offset de la zone réservée dans le buffer de transfert.
+     */
+    Uint32 offset;
+} RC2D_GPUUploadAllocation;
+
+/**
+ * \brief Statistiques du ring d'upload GPU.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_GPUUploadStats {
+    /**
+     * \brief Octets réservés pendant la dernière frame.
+     */
+    Uint64 bytes_last_frame;
+
+    /**
+     * \brief Maximum d'octets réservés sur une frame depuis le démarrage.
+     */
+    Uint64 bytes_peak_frame;
+
+    /**
+     * \brief Octets réservés depuis le démarrage.
+     */
+    Uint64 bytes_total;
+
+    /**
+     * \brief Nombre de copy pass soumises pendant la dernière frame.
+     */
+    Uint32 copy_passes_last_frame;
+
+    /**
+     * \brief Nombre total de soumissions de command buffers d'upload.
+     */
+    Uint64 submit_count;
+
+    /**
+     * \brief Nombre de fois où le CPU a dû attendre que le GPU libère un segment.
+     *
+     * \note Si cette valeur augmente régulièrement, augmentez RC2D_EngineConfig::gpuUploadRingSize.
+     */
+    Uint64 stall_count;
+
+    /**
+     * \brief Temps total passé à attendre le GPU (en millisecondes).
+     */
+    double stall_time_ms;
+
+    /**
+     * \brief Nombre de réservations faites dans un buffer de transfert dédié (plus grandes qu'un segment,
+     * ou ring occupé par des écritures en cours).
+     */
+    Uint64 dedicated_count;
+
+    /**
+     * \brief Taille d'un segment du ring (en octets).
+     */
+    Uint32 segment_size;
+
+    /**
+     * \brief Nombre de segments par voie du ring (frames en vol + 1).
+     */
+    Uint32 segment_count;
+} RC2D_GPUUploadStats;
+
 /**
  * \brief Remplit une structure RC2D_GPUInfo avec les métadonnées du GPU utilisé.
  * 
@@ -451,6 +746,76 @@ s    */
  */
 RC2D_GPUDevice* rc2d_gpu_getDevice(void);
 
+/**
+ * \brief Récupère le format de la cible de rendu de la frame (swapchain, ou cible hors écran en mode headless).
+ * 
+ * À utiliser comme format de color target lors de la création des pipelines graphiques, à la place
+ * de SDL_GetGPUSwapchainTextureFormat qui n'a pas de sens en mode headless.
+ * 
+ * \return {SDL_GPUTextureFormat} Le format de la cible de rendu, ou SDL_GPU_TEXTUREFORMAT_INVALID en cas d'erreur.
+ * 
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ * 
+ * \see RC2D_EngineConfig::headless
+ */
+SDL_GPUTextureFormat rc2d_gpu_getColorTargetFormat(void);
+
+/**
+ * \brief Récupère le nombre d'échantillons (MSAA) de la cible du render pass de la frame.
+ * 
+ * À utiliser comme RC2D_GPUGraphicsPipelineCreateInfo::multisample_state.sample_count pour les pipelines
+ * qui dessinent dans le render pass de la frame : avec le MSAA, la frame est dessinée dans une cible multisample,
+ * résolue dans la swapchain (ou la cible hors écran).
+ * 
+ * \return {SDL_GPUSampleCount} SDL_GPU_SAMPLECOUNT_1 sans MSAA (mode pixel art, ou non supporté), sinon le meilleur
+ * niveau supporté par le format de la cible de rendu.
+ * 
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ * 
+ * \see rc2d_gpu_getColorTargetFormat
+ */
+SDL_GPUSampleCount rc2d_gpu_getSampleCount(void);
+
+/**
+ * \brief Récupère la texture hors écran dans laquelle les frames sont rendues en mode headless.
+ * 
+ * Après rc2d_gpu_present, la texture contient la dernière frame soumise : elle peut être copiée
+ * dans un buffer de transfert (SDL_DownloadFromGPUTexture) pour comparer des images de référence.
+ * 
+ * \return {SDL_GPUTexture*} La texture hors écran (format R8G8B8A8_UNORM), ou NULL si le mode headless n'est pas actif.
+ * 
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ * 
+ * \see RC2D_EngineConfig::headless
+ */
+SDL_GPUTexture* rc2d_gpu_getHeadlessTarget(void);
+
+/**
+ * \brief Relit sur le CPU la dernière frame soumise en mode headless.
+ * 
+ * Attend que le GPU ait terminé la copie :
+ * la fonction est bloquante, elle est prévue pour les tests de rendu et non pour chaque frame d'un jeu.
+ * 
+ * \param {Uint32*} width - Largeur de l'image relue (en pixels).
+ * \param {Uint32*} height - Hauteur de l'image relue (en pixels).
+ * \return {Uint8*} Les pixels (R8G8B8A8, width * height * 4 octets, à libérer avec RC2D_free), ou NULL en cas d'erreur.
+ * 
+ * \warning Doit être appelée en dehors de rc2d_draw (par exemple dans rc2d_update), lorsque aucune frame n'est en cours d'enregistrement.
+ * 
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ * 
+ * \see RC2D_EngineConfig::headless
+ */
+Uint8* rc2d_gpu_readHeadlessTarget(Uint32* width, Uint32* height);
+
 /**
  * \brief Récupère les formats de shaders supportés par le GPU actuel.
  *
@@ -494,6 +859,29 @@ RC2D_GPUComputePipeline* rc2d_gpu_loadComputeShader(const char* filename);
  */
 RC2D_GPUShader* rc2d_gpu_loadGraphicsShader(const char* filename);
 
+/**
+ * \brief Remplace la table de réflexion des shaders précompilés.
+ * 
+ * En mode compilation hors ligne (RC2D_GPU_SHADER_HOT_RELOAD_ENABLED à 0), rc2d_gpu_loadGraphicsShader et
+ * rc2d_gpu_loadComputeShader lisent les ressources utilisées par chaque shader (samplers, uniform buffers...)
+ * dans une table binaire générée par les scripts compile_shaders (`shaders/reflection/reflection.bin`),
+ * chargée une seule fois à l'initialisation de RC2D.
+ * 
+ * Cette fonction permet de fournir cette table depuis la mémoire, par exemple après l'avoir packée
+ * dans un fichier rres et chargée avec rc2d_rres_loadDataRawFromChunk.
+ * 
+ * \param {const void*} data - Contenu de reflection.bin (copié par RC2D).
+ * \param {size_t} size - Taille en octets des données.
+ * \return {bool} true si la table est valide et a été installée, false sinon (la table précédente est conservée).
+ * 
+ * \warning Doit être appelée avant de charger les shaders concernés, et pas en même temps qu'un chargement de shader.
+ * 
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_gpu_setShaderReflectionTable(const void* data, size_t size);
+
 /**
  * \brief Crée un pipeline graphique à partir des informations fournies.
  * 
@@ -579,23 +967,94 @@ void rc2d_gpu_drawRectangle(RC2D_DrawMode mode, float x, float y, float width, f
 /**
  * \brief Crée une nouvelle image à partir d'un fichier.
  *
- * Charge une image depuis un fichier et crée une texture GPU associée.
+ * Charge une image depuis un fichier (PNG, SVG... via SDL3_image, chemin relatif au dossier de l'exécutable)
+ * et crée une texture GPU associée. L'image est mise en cache : un second appel avec le même fichier
+ * renvoie la même image.
  * 
  * \param {const char*} filename - Chemin du fichier image à charger.
  * \return {RC2D_Image*} - Pointeur vers la nouvelle image créée, ou NULL en cas d'erreur.
  * 
- * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ * \note L'image appartient au cache du moteur, elle est libérée à la fermeture du moteur.
+ * Si un chargement asynchrone du même fichier est en cours, l'image renvoyée peut encore être en chargement.
+ * 
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread. Le fichier est décodé sur le thread
+ * appelant, la création de la texture et l'upload sont confiés au thread principal (rc2d_job_runOnMainThread) :
+ * depuis un autre thread, l'appel attend la prochaine exécution des tâches du thread principal.
  * 
  * \since Cette fonction est disponible depuis RC2D 1.0.0.
  */
 RC2D_Image* rc2d_gpu_newImage(const char* filename);
 
+/**
+ * \brief Charge une image en arrière-plan et renvoie immédiatement son handle.
+ *
+ * Le fichier est lu et décodé (PNG, SVG...) sur un worker du système de jobs, puis la création de la texture
+ * et l'upload sont confiés au thread principal (rc2d_job_runOnMainThread) : ils sont limités par
+ * RC2D_EngineConfig::mainThreadTaskBudget, le jeu continue donc d'afficher des frames pendant le chargement.
+ *
+ * En attendant, `state` vaut RC2D_IMAGE_LOADING et la texture est un placeholder (gris, 1x1) : il est dessiné
+ * par rc2d_gpu_drawQuad à la taille demandée. Les dimensions de l'image ne sont pas encore connues : `width` et
+ * `height` valent RC2D_IMAGE_PLACEHOLDER_SIZE, rc2d_gpu_drawImage dessine donc le placeholder étiré à cette taille,
+ * puis l'image à sa taille réelle une fois prête.
+ *
+ * \param {const char*} filename - Chemin du fichier image à charger (relatif au dossier de l'exécutable).
+ * \return {RC2D_Image*} - Handle de l'image (déjà prête si elle était en cache), ou NULL en cas d'erreur.
+ *
+ * \note L'image appartient au cache du moteur, elle est libérée à la fermeture du moteur.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread : elle ne fait aucun appel SDL_GPU,
+ * le placeholder étant créé au démarrage du moteur.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_Image* rc2d_gpu_loadImageAsync(const char* filename);
+
+/**
+ * \brief Définit le budget de mémoire GPU des textures du cache d'images.
+ *
+ * Au début de chaque frame, tant que les textures résidentes dépassent le budget, les textures les moins
+ * récemment dessinées sont libérées (jamais celles dessinées pendant les 2 dernières frames). Une image évincée
+ * garde ses dimensions et est rechargée (fichier ou pack rres) à sa prochaine utilisation, le placeholder étant
+ * dessiné en attendant.
+ *
+ * \param {Uint64} bytes - Budget en octets, ou 0 pour ne jamais évincer.
+ *
+ * \note Valeur initiale : RC2D_EngineConfig::gpuTextureBudget.
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_setImageCacheBudget(Uint64 bytes);
+
+/**
+ * \brief Récupère les statistiques du cache d'images (octets résidents, taux de hit, évictions par frame...).
+ *
+ * \param {RC2D_GPUImageCacheStats*} stats - Pointeur vers la structure à remplir.
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_getImageCacheStats(RC2D_GPUImageCacheStats* stats);
+
+/**
+ * \brief Récupère le nombre d'images dont le chargement asynchrone n'est pas terminé.
+ *
+ * \return {int} Le nombre d'images en chargement (pour un écran de chargement par exemple).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+int rc2d_gpu_getPendingImageCount(void);
+
 /**
  * \brief Dessine une image à l'écran à la position spécifiée.
  *
- * Cette fonction dessine une image à la position (x, y) dans l'espace viewport (pixels, top-left (0,0)).
- * Elle utilise un pipeline graphique avec shaders HLSL pour dessiner un quad texturé dans le render pass actif,
- * évitant la création d'un nouveau render pass. Le rendu est effectué sur la swapchain texture.
+ * Cette fonction dessine une image à la position (x, y) dans l'espace viewport (pixels logiques, top-left (0,0)).
+ * L'image n'est pas dessinée immédiatement : elle est ajoutée au sprite batch de la frame, teintée par la couleur
+ * courante (rc2d_gpu_setColor), puis dessinée lors de rc2d_gpu_present avec les autres sprites.
  *
  * \param image Pointeur vers l'image RC2D à dessiner.
  * \param x Position X du coin supérieur gauche dans l'espace viewport (pixels).
@@ -604,9 +1063,260 @@ RC2D_Image* rc2d_gpu_newImage(const char* filename);
  * \threadsafety Cette fonction doit être appelée depuis le thread principal.
  *
  * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_gpu_drawQuad
  */
 void rc2d_gpu_drawImage(RC2D_Image* image, float x, float y);
 
+/**
+ * \brief Récupère la couleur globale utilisée pour les opérations de dessin.
+ *
+ * \return {RC2D_Color} La couleur courante.
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_Color rc2d_gpu_getColor(void);
+
+/**
+ * \brief Définit le layer des prochains sprites.
+ *
+ * Les layers définissent l'ordre de dessin : un layer plus grand est dessiné par-dessus.
+ * À l'intérieur d'un même layer, les sprites sont dessinés dans l'ordre d'appel (ordre du peintre) : seuls les
+ * sprites consécutifs de même pipeline, texture et sampler sont regroupés dans une draw call. Dessiner à la suite
+ * les sprites d'une même texture (ou d'un même atlas) réduit donc le nombre de draw calls.
+ *
+ * \param {int} layer - Layer des prochains sprites (0 par défaut, remis à 0 à chaque frame).
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_setLayer(int layer);
+
+/**
+ * \brief Définit le pipeline graphique des prochains sprites.
+ *
+ * \param {RC2D_GPUGraphicsPipeline*} graphicsPipeline - Pipeline utilisant le format RC2D_GPUSpriteVertex,
+ * ou NULL pour le pipeline de sprites par défaut de RC2D (shaders rc2d_sprite.vertex / rc2d_sprite.fragment).
+ *
+ * \note Le pipeline doit être créé pour la cible de la frame : format rc2d_gpu_getColorTargetFormat et
+ * nombre d'échantillons rc2d_gpu_getSampleCount.
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_setSpritePipeline(RC2D_GPUGraphicsPipeline* graphicsPipeline);
+
+/**
+ * \brief Ajoute un quad texturé au sprite batch de la frame.
+ *
+ * \param {RC2D_Image*} image - Image source.
+ * \param {float} x - Position X du coin supérieur gauche (pixels logiques).
+ * \param {float} y - Position Y du coin supérieur gauche (pixels logiques).
+ * \param {float} width - Largeur du quad à l'écran.
+ * \param {float} height - Hauteur du quad à l'écran.
+ * \param {float} u0 - Coordonnée de texture U du coin supérieur gauche (0 à 1).
+ * \param {float} v0 - Coordonnée de texture V du coin supérieur gauche (0 à 1).
+ * \param {float} u1 - Coordonnée de texture U du coin inférieur droit (0 à 1).
+ * \param {float} v1 - Coordonnée de texture V du coin inférieur droit (0 à 1).
+ *
+ * \note Le quad est teinté par la couleur courante (rc2d_gpu_setColor).
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_drawQuad(RC2D_Image* image, float x, float y, float width, float height, float u0, float v0, float u1, float v1);
+
+/**
+ * \brief Dessine immédiatement les sprites en attente.
+ *
+ * Les sprites sont triés par (layer, ordre d'appel), leurs vertices sont envoyés dans un vertex buffer
+ * dynamique, puis une seule draw call est émise par suite de sprites consécutifs partageant le même état.
+ *
+ * \note Appelée automatiquement par rc2d_gpu_present. Appelez-la avant de dessiner directement dans le render pass
+ * (SDL_DrawGPUPrimitives...) si ce dessin doit apparaître par-dessus les sprites déjà ajoutés.
+ *
+ * \warning Le render pass courant est terminé puis repris (rc2d_engine_state.gpu_current_render_pass change).
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_flushSprites(void);
+
+/**
+ * \brief Récupère les statistiques du sprite batch (sprites, draw calls...) pour la dernière frame.
+ *
+ * \param {RC2D_GPUBatchStats*} stats - Pointeur vers la structure à remplir.
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_getBatchStats(RC2D_GPUBatchStats* stats);
+
+/**
+ * \brief Obtient une cible de rendu depuis le pool de render targets.
+ *
+ * Les textures sont identifiées par (largeur, hauteur, format, nombre d'échantillons, usage) : une texture
+ * rendue au pool est réutilisée telle quelle par la prochaine demande identique, au lieu d'être recréée
+ * (et donc réallouée par le driver) à chaque frame. La cible multisample (MSAA) de la frame utilise ce pool.
+ *
+ * \param {Uint32} width - Largeur de la texture (en pixels).
+ * \param {Uint32} height - Hauteur de la texture (en pixels).
+ * \param {SDL_GPUTextureFormat} format - Format de la texture.
+ * \param {SDL_GPUSampleCount} sampleCount - Nombre d'échantillons (MSAA).
+ * \param {SDL_GPUTextureUsageFlags} usage - Usage de la texture (COLOR_TARGET, SAMPLER...).
+ * \return {SDL_GPUTexture*} La texture, ou NULL en cas d'échec de création.
+ *
+ * \note Le contenu d'une texture réutilisée est indéfini : utilisez SDL_GPU_LOADOP_CLEAR
+ * (ou cycle = true) lors du premier render pass.
+ *
+ * \warning La texture doit être rendue avec rc2d_gpu_releaseRenderTarget et ne doit jamais être libérée
+ * avec SDL_ReleaseGPUTexture.
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+SDL_GPUTexture* rc2d_gpu_acquireRenderTarget(Uint32 width, Uint32 height, SDL_GPUTextureFormat format, SDL_GPUSampleCount sampleCount, SDL_GPUTextureUsageFlags usage);
+
+/**
+ * \brief Rend une cible de rendu au pool, pour qu'elle soit réutilisée.
+ *
+ * \param {SDL_GPUTexture*} texture - Texture obtenue via rc2d_gpu_acquireRenderTarget (NULL est ignoré).
+ *
+ * \note La texture peut être rendue alors que le GPU l'utilise encore : SDL synchronise son prochain usage.
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_releaseRenderTarget(SDL_GPUTexture* texture);
+
+/**
+ * \brief Libère toutes les cibles de rendu du pool qui ne sont pas utilisées.
+ *
+ * \note Appelée automatiquement lorsque la taille de la swapchain change.
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_purgeRenderTargets(void);
+
+/**
+ * \brief Réserve une zone dans le ring d'upload GPU partagé.
+ *
+ * Le ring est composé d'un buffer de transfert persistant par frame en vol (+1), protégé par une fence, avec une voie
+ * pour le thread principal et une pour les autres threads. Les uploads validés sont envoyés ensemble dans une seule
+ * copy pass par segment, au lieu d'un buffer de transfert et d'une soumission par ressource. Les command buffers de
+ces copy pass sont toujours acquis et soumis par le thread principal :
+ * - ceux du thread principal au début de la frame et juste avant la soumission du command buffer de la frame
+ *   (rc2d_gpu_present) : une ressource chargée pendant rc2d_load, rc2d_update ou rc2d_draw est remplie avant
+ *   d'être dessinée ;
+ * - ceux des autres threads au premier envoi du thread principal (début de frame, rc2d_gpu_present ou
+ *   rc2d_gpu_flushUploads) qui suit la fin de toutes les écritures de leur segment. Un segment en cours d'écriture
+ *   retarde donc les uploads validés dans ce même segment par d'autres threads.
+ *
+ * \param {Uint32} size - Taille à réserver (en octets).
+ * \param {Uint32} alignment - Alignement de l'offset de la zone (512 pour une copie vers une texture sous Direct3D 12).
+ * \param {RC2D_GPUUploadAllocation*} allocation - Reçoit la zone réservée.
+ * \return {bool} true en cas de succès, false sinon.
+ *
+ * \note Une réservation plus grande qu'un segment utilise un buffer de transfert dédié.
+ *
+ * \note L'appel n'attend jamais la fin des écritures en cours : un thread peut garder plusieurs réservations
+ * ouvertes. Si le segment courant est plein et qu'aucun autre n'est libre, la réservation passe par un buffer
+ * de transfert dédié (RC2D_GPUUploadStats::dedicated_count). Il peut attendre que le GPU ait lu le contenu
+ * précédent du segment (RC2D_GPUUploadStats::stall_count), sans bloquer les autres threads pendant l'attente.
+ *
+ * \warning Chaque réservation doit être terminée par rc2d_gpu_endUploadToTexture, rc2d_gpu_endUploadToBuffer
+ * ou rc2d_gpu_cancelUpload, sans quoi son segment n'est jamais envoyé.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_gpu_beginUpload(Uint32 size, Uint32 alignment, RC2D_GPUUploadAllocation* allocation);
+
+/**
+ * \brief Valide une réservation et programme sa copie vers une texture.
+ *
+ * \param {const RC2D_GPUUploadAllocation*} allocation - Zone réservée via rc2d_gpu_beginUpload.
+ * \param {Uint32} offset - Offset des pixels dans la zone réservée.
+ * \param {const SDL_GPUTextureRegion*} destination - Région de la texture de destination.
+ * \param {Uint32} pixelsPerRow - Nombre de pixels par ligne dans les données source.
+ * \param {Uint32} rowsPerLayer - Nombre de lignes par couche dans les données source.
+ *
+ * \note Depuis le thread principal, la texture reçoit ses données avant les draw calls de la frame en cours
+ * (ou de la suivante, hors frame). Depuis un autre thread, voir rc2d_gpu_beginUpload.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_endUploadToTexture(const RC2D_GPUUploadAllocation* allocation, Uint32 offset, const SDL_GPUTextureRegion* destination, Uint32 pixelsPerRow, Uint32 rowsPerLayer);
+
+/**
+ * \brief Valide une réservation et programme sa copie vers un buffer GPU.
+ *
+ * \param {const RC2D_GPUUploadAllocation*} allocation - Zone réservée via rc2d_gpu_beginUpload.
+ * \param {Uint32} offset - Offset des données dans la zone réservée.
+ * \param {SDL_GPUBuffer*} buffer - Buffer GPU de destination.
+ * \param {Uint32} bufferOffset - Offset de destination dans le buffer GPU.
+ * \param {Uint32} size - Nombre d'octets à copier.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_endUploadToBuffer(const RC2D_GPUUploadAllocation* allocation, Uint32 offset, SDL_GPUBuffer* buffer, Uint32 bufferOffset, Uint32 size);
+
+/**
+ * \brief Abandonne une réservation sans programmer de copie (par exemple après une erreur de décodage).
+ *
+ * \param {const RC2D_GPUUploadAllocation*} allocation - Zone réservée via rc2d_gpu_beginUpload.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_cancelUpload(const RC2D_GPUUploadAllocation* allocation);
+
+/**
+ * \brief Envoie immédiatement les uploads en attente dans une copy pass.
+ *
+ * Utile lorsqu'une ressource doit être disponible avant la prochaine frame. Sinon, RC2D envoie
+ * automatiquement les uploads au début de chaque frame et avant la soumission de son command buffer.
+ *
+ * \note N'attend jamais les écritures en cours : un segment où un autre thread écrit encore part au premier
+ * envoi du thread principal qui suit sa dernière écriture.
+ *
+ * \note Depuis un autre thread que le thread principal, l'appel ferme seulement les segments en cours : ils sont
+ * soumis au prochain envoi du thread principal.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_flushUploads(void);
+
+/**
+ * \brief Récupère les statistiques du ring d'upload GPU (octets par frame, attentes du GPU, soumissions...).
+ *
+ * \param {RC2D_GPUUploadStats*} stats - Pointeur vers la structure à remplir.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_getUploadStats(RC2D_GPUUploadStats* stats);
+
 /* Termine les définitions de fonctions C lors de l'utilisation de C++ */
 #ifdef __cplusplus
 }
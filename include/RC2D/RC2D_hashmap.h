@@ -0,0 +1,165 @@
+#ifndef RC2D_HASHMAP_H
+#define RC2D_HASHMAP_H
+
+#include <SDL3/SDL_stdinc.h> // Required for: Uint32, Uint64
+
+#include <stdbool.h>         // Required for: bool
+
+/* Configuration pour les définitions de fonctions C, même lors de l'utilisation de C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Table de hachage à adressage ouvert, utilisée par les caches de RC2D (shaders, pipelines, images).
+ *
+ * Les clés sont des chemins (ou noms) internés : la table conserve une copie unique de chaque clé
+ * ainsi que son hash 64 bits. Une clé peut aussi être un identifiant 64 bits déjà unique (par exemple
+ * l'adresse d'un objet), voir rc2d_hashmap_getByHash.
+ *
+ * Les lectures sont sans verrou : elles peuvent se faire depuis n'importe quel thread, même pendant
+ * une insertion. Les écritures (insertion, remplacement) doivent être sérialisées par l'appelant,
+ * typiquement avec le mutex qui protège déjà le cache.
+ *
+ * \note Les entrées ne sont jamais supprimées individuellement : elles vivent jusqu'à rc2d_hashmap_destroy.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_HashMap RC2D_HashMap;
+
+/**
+ * \brief Fonction appelée pour chaque entrée par rc2d_hashmap_forEach.
+ *
+ * \param {const char*} key - Clé internée de l'entrée (NULL pour une clé 64 bits).
+ * \param {Uint64} hash - Hash de la clé.
+ * \param {void*} value - Valeur associée.
+ * \param {void*} userdata - Donnée utilisateur passée à rc2d_hashmap_forEach.
+ *
+ * \since Ce type est disponible depuis RC2D 1.0.0.
+ */
+typedef void (*RC2D_HashMapIterator)(const char* key, Uint64 hash, void* value, void* userdata);
+
+/**
+ * \brief Calcule le hash 64 bits (FNV-1a) d'une chaîne de caractères.
+ *
+ * \param {const char*} key - Chaîne à hacher.
+ * \return {Uint64} - Le hash de la chaîne.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+Uint64 rc2d_hashmap_hashString(const char* key);
+
+/**
+ * \brief Crée une table de hachage vide.
+ *
+ * \param {Uint32} initialCapacity - Nombre d'entrées attendues (la table s'agrandit au besoin).
+ * \return {RC2D_HashMap*} - La table créée, ou NULL en cas d'échec d'allocation.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_hashmap_destroy
+ */
+RC2D_HashMap* rc2d_hashmap_create(Uint32 initialCapacity);
+
+/**
+ * \brief Détruit une table de hachage et ses clés internées.
+ *
+ * \param {RC2D_HashMap*} map - Table à détruire (NULL est ignoré).
+ *
+ * \note Les valeurs ne sont pas libérées : elles appartiennent à l'appelant.
+ *
+ * \warning Aucun thread ne doit plus lire la table.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_hashmap_destroy(RC2D_HashMap* map);
+
+/**
+ * \brief Recherche la valeur associée à une clé.
+ *
+ * \param {const RC2D_HashMap*} map - Table dans laquelle chercher.
+ * \param {const char*} key - Clé recherchée.
+ * \return {void*} - La valeur associée, ou NULL si la clé est absente.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread, sans verrou.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void* rc2d_hashmap_get(const RC2D_HashMap* map, const char* key);
+
+/**
+ * \brief Associe une valeur à une clé (insertion ou remplacement).
+ *
+ * \param {RC2D_HashMap*} map - Table à modifier.
+ * \param {const char*} key - Clé (copiée et internée par la table lors de la première insertion).
+ * \param {void*} value - Valeur à associer (non NULL).
+ * \return {bool} - true en cas de succès, false en cas d'échec d'allocation.
+ *
+ * \threadsafety Les écritures doivent être sérialisées par l'appelant. Les lectures concurrentes sont permises.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_hashmap_put(RC2D_HashMap* map, const char* key, void* value);
+
+/**
+ * \brief Recherche la valeur associée à une clé 64 bits.
+ *
+ * \param {const RC2D_HashMap*} map - Table dans laquelle chercher.
+ * \param {Uint64} hash - Clé recherchée (identifiant unique, pas un hash de chaîne).
+ * \return {void*} - La valeur associée, ou NULL si la clé est absente.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread, sans verrou.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void* rc2d_hashmap_getByHash(const RC2D_HashMap* map, Uint64 hash);
+
+/**
+ * \brief Associe une valeur à une clé 64 bits (insertion ou remplacement).
+ *
+ * \param {RC2D_HashMap*} map - Table à modifier.
+ * \param {Uint64} hash - Clé (identifiant unique, pas un hash de chaîne).
+ * \param {void*} value - Valeur à associer (non NULL).
+ * \return {bool} - true en cas de succès, false en cas d'échec d'allocation.
+ *
+ * \threadsafety Les écritures doivent être sérialisées par l'appelant. Les lectures concurrentes sont permises.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_hashmap_putByHash(RC2D_HashMap* map, Uint64 hash, void* value);
+
+/**
+ * \brief Retourne le nombre d'entrées de la table.
+ *
+ * \param {const RC2D_HashMap*} map - Table à interroger.
+ * \return {Uint32} - Nombre d'entrées.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+Uint32 rc2d_hashmap_count(const RC2D_HashMap* map);
+
+/**
+ * \brief Appelle `iterator` pour chaque entrée, dans l'ordre d'insertion.
+ *
+ * \param {const RC2D_HashMap*} map - Table à parcourir.
+ * \param {RC2D_HashMapIterator} iterator - Fonction appelée pour chaque entrée.
+ * \param {void*} userdata - Donnée transmise à `iterator`.
+ *
+ * \threadsafety Ne doit pas être appelée en même temps qu'une écriture.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_hashmap_forEach(const RC2D_HashMap* map, RC2D_HashMapIterator iterator, void* userdata);
+
+/* Termine les définitions de fonctions C lors de l'utilisation de C++ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RC2D_HASHMAP_H
@@ -4,6 +4,7 @@
 #include <RC2D/RC2D_engine.h>
 #include <RC2D/RC2D_math.h>
 #include <RC2D/RC2D_gpu.h>
+#include <RC2D/RC2D_hashmap.h>
 
 #include <SDL3/SDL_events.h>
 #include <SDL3/SDL_init.h>
@@ -84,6 +85,11 @@ typedef struct RC2D_GraphicsShaderEntry {
      * Timestamp de la dernière modification du fichier shader.
      */
     SDL_Time lastModified;
+
+    /**
+     * Hash du nom du fichier (rc2d_hashmap_hashString), pour retrouver rapidement les pipelines qui l'utilisent.
+     */
+    Uint64 filename_hash;
 } RC2D_GraphicsShaderEntry;
 
 /**
@@ -114,6 +120,12 @@ typedef struct RC2D_GraphicsPipelineEntry {
      */
     const char* fragment_shader_filename;
 
+    /**
+     * Hash des noms de fichiers des shaders (rc2d_hashmap_hashString), comparés avant les noms lors d'un hot reload.
+     */
+    Uint64 vertex_shader_hash;
+    Uint64 fragment_shader_hash;
+
     /**
      * Pointeur vers le pipeline graphique chargé.
      * 
@@ -125,11 +137,47 @@ typedef struct RC2D_GraphicsPipelineEntry {
     RC2D_GPUGraphicsPipeline* graphicsPipeline;
 } RC2D_GraphicsPipelineEntry;
 
+/**
+ * \brief Relit et décode la source d'une image évincée du cache (source autre qu'un fichier image, ex : pack rres).
+ *
+ * \param {void*} data - Données de rechargement de l'entrée (RC2D_ImageEntry::reload_data).
+ * \return {void*} Les données décodées, passées à RC2D_ImageEntry::upload, ou NULL en cas d'erreur.
+ *
+ * \note Appelée sur un worker du système de jobs : aucun appel SDL_GPU.
+ *
+ * \since Ce type est disponible depuis RC2D 1.0.0.
+ */
+typedef void* (*RC2D_ImageReloadFunction)(void* data);
+
+/**
+ * \brief Crée la texture d'une image à partir des données décodées par sa fonction de rechargement, puis les libère.
+ *
+ * \param {void*} data - Données de rechargement de l'entrée (RC2D_ImageEntry::reload_data).
+ * \param {void*} loaded - Données renvoyées par RC2D_ImageEntry::reload (NULL si le rechargement a échoué).
+ * \param {Uint32*} width - Reçoit la largeur de la texture.
+ * \param {Uint32*} height - Reçoit la hauteur de la texture.
+ * \param {Uint64*} bytes - Reçoit la mémoire GPU occupée par la texture.
+ * \return {SDL_GPUTexture*} La texture (pixels programmés dans le ring d'upload), ou NULL en cas d'erreur.
+ *
+ * \note Appelée sur le thread principal.
+ *
+ * \since Ce type est disponible depuis RC2D 1.0.0.
+ */
+typedef SDL_GPUTexture* (*RC2D_ImageUploadFunction)(void* data, void* loaded, Uint32* width, Uint32* height, Uint64* bytes);
+
 // Structure pour le cache des images
 typedef struct RC2D_ImageEntry {
     RC2D_Image* image;
-    char* filename;           // Nom du fichier pour le cache
+    char* filename;           // Nom du fichier pour le cache (ou clé de la ressource)
     SDL_Time last_modified;   // Timestamp pour le hot-reload
+
+    /**
+     * Rechargement après éviction : NULL pour relire le fichier `filename`, sinon reload(reload_data) sur un worker
+     * puis upload(reload_data, ...) sur le thread principal. reload_data est libéré avec RC2D_free.
+     */
+    RC2D_ImageReloadFunction reload;
+    RC2D_ImageUploadFunction upload;
+    void* reload_data;
 } RC2D_ImageEntry;
 
 /**
@@ -168,18 +216,21 @@ typedef struct RC2D_EngineState {
     SDL_GPURenderPass* gpu_current_render_pass;
     SDL_GPUViewport* gpu_current_viewport;
     SDL_GPUSampleCount gpu_current_sample_count_supported; // Le meilleur niveau de MSAA supporté par le GPU (sois 8x, 4x, 2x ou 1x)
-    SDL_GPUTexture* gpu_current_resolve_texture; // Texture de résolution pour le multisampling (si applicable via MSAA)
+    SDL_GPUTexture* gpu_current_msaa_texture; // Cible multisample du render pass, résolue dans la swapchain (si MSAA)
+    SDL_GPUColorTargetInfo gpu_current_color_target; // Cible du render pass courant (pour le reprendre après une copy pass)
 
     /**
      * Mise en cache des shaders graphiques
      * 
      * Cette structure contient :
-     * - Tableau dynamique des shaders graphics (vertex/fragment) chargés
+     * - Tableau dynamique des shaders graphics (vertex/fragment) chargés (ordre de chargement, pour le hot reload)
      * - Nombre de shaders graphics (vertex/fragment) chargés
-     * - Mutex pour protéger l'accès aux shaders graphics (vertex/fragment) chargés
+     * - Index nom de fichier -> entrée, consulté sans verrou
+     * - Mutex pour protéger les écritures dans le cache des shaders graphics (vertex/fragment)
      */
-    RC2D_GraphicsShaderEntry* gpu_graphics_shaders_cache;
+    RC2D_GraphicsShaderEntry** gpu_graphics_shaders_cache;
     int gpu_graphics_shader_count;
+    RC2D_HashMap* gpu_graphics_shaders_index;
     SDL_Mutex* gpu_graphics_shader_mutex;
 
     /**
@@ -188,10 +239,12 @@ typedef struct RC2D_EngineState {
      * Cette structure contient :
      * - Tableau dynamique des pipelines graphiques chargés
      * - Nombre de pipelines graphiques chargés
+     * - Index RC2D_GPUGraphicsPipeline* -> entrée, pour ne pas enregistrer deux fois un pipeline recréé
      * - Mutex pour protéger l'accès aux pipelines graphiques chargés
      */
-    RC2D_GraphicsPipelineEntry* gpu_graphics_pipelines_cache;
+    RC2D_GraphicsPipelineEntry** gpu_graphics_pipelines_cache;
     int gpu_graphics_pipeline_count;
+    RC2D_HashMap* gpu_graphics_pipelines_index;
     SDL_Mutex* gpu_graphics_pipeline_mutex;
 
     /**
@@ -200,10 +253,12 @@ typedef struct RC2D_EngineState {
      * Cette structure contient :
      * - Tableau dynamique des shaders de calcul chargés
      * - Nombre de shaders de calcul chargés
-     * - Mutex pour protéger l'accès aux shaders de calcul chargés
+     * - Index nom de fichier -> entrée, consulté sans verrou
+     * - Mutex pour protéger les écritures dans le cache des shaders de calcul
      */
-    RC2D_ComputeShaderEntry* gpu_compute_shaders_cache;
+    RC2D_ComputeShaderEntry** gpu_compute_shaders_cache;
     int gpu_compute_shader_count;
+    RC2D_HashMap* gpu_compute_shaders_index;
     SDL_Mutex* gpu_compute_shader_mutex;
 
     /**
@@ -212,10 +267,12 @@ typedef struct RC2D_EngineState {
      * Cette structure contient :
      * - Tableau dynamique des textures GPU chargées
      * - Nombre de textures GPU chargées
-     * - Mutex pour protéger l'accès aux textures GPU chargées
+     * - Index nom de fichier -> entrée, consulté sans verrou
+     * - Mutex pour protéger les écritures dans le cache des textures GPU
      */
-    RC2D_ImageEntry* gpu_image_cache;
+    RC2D_ImageEntry** gpu_image_cache;
     Uint32 gpu_image_cache_count;
+    RC2D_HashMap* gpu_image_cache_index;
     SDL_Mutex* gpu_image_cache_mutex;
 
     /**
@@ -229,6 +286,9 @@ typedef struct RC2D_EngineState {
     bool game_is_running;
     Uint64 last_frame_time;
 
+    // RC2D : Simulation à pas fixe (temps non encore simulé, en secondes)
+    double fixed_update_accumulator;
+
     // RC2D : Echelle de rendu
     float render_scale;
 
@@ -311,14 +371,41 @@ void rc2d_engine_deltatime_start(void);
  * 
  * Elle permet de fixer le tickrate de la callback principale de l'application (SDL_AppIterate).
  * 
- * \note Si SDL_HINT_MAIN_CALLBACK_RATE est défini, cette fonction ne fait rien.
- * Sinon, elle attend le temps nécessaire pour atteindre le FPS cible.
- * SDL_HINT_MAIN_CALLBACK_RATE peux ne pas marcher sur toutes les plateformes.
+ * \note Sur desktop, la pause est faite par le frame pacer (rc2d_framepacer_wait). Sur les autres
+ * plateformes, SDL_HINT_MAIN_CALLBACK_RATE cadence les frames et cette fonction ne fait rien.
  * 
  * \since Cette fonction est disponible depuis RC2D 1.0.0.
  */
 void rc2d_engine_deltatime_end(void);
 
+/**
+ * \brief Initialise le frame pacer : choix de la plateforme et calibration de la granularité du sommeil de l'OS.
+ *
+ * \note Doit être appelée avant le premier calcul des FPS du moniteur (rc2d_engine_update_fps_based_on_monitor).
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_framepacer_init(void);
+
+/**
+ * \brief Indique si le frame pacer cadence les frames (desktop, hors mode headless).
+ *
+ * \return true si RC2D cadence lui-même les frames, false si SDL_HINT_MAIN_CALLBACK_RATE s'en charge.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_framepacer_isEnabled(void);
+
+/**
+ * \brief Attend l'échéance de la frame courante : sommeil de l'OS jusqu'à (échéance - marge), puis attente active.
+ *
+ * Les échéances sont absolues (échéance précédente + 1 / rc2d_engine_state.fps) : l'erreur d'une frame est
+ * corrigée à la suivante. La marge d'attente active s'adapte aux dépassements de sommeil observés.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_framepacer_wait(void);
+
 /**
  * \brief Configure le moteur RC2D avec les paramètres spécifiés.
  * 
@@ -357,8 +444,451 @@ void rc2d_assert_init(void);
  */
 void rc2d_timer_init(void);
 
+/**
+ * \brief Crée le ring d'upload GPU partagé.
+ *
+ * \param {Uint32} segmentSize - Taille de chaque segment (en octets).
+ * \param {Uint32} segmentCount - Nombre de segments par voie (frames en vol + 1).
+ * \return true si le ring a été créé, false sinon.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_gpu_uploadRingInit(Uint32 segmentSize, Uint32 segmentCount);
+
+/**
+ * \brief Libère le ring d'upload GPU. Le GPU doit être inactif.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_uploadRingQuit(void);
+
+/**
+ * \brief Envoie les uploads de la frame écoulée et met à jour les statistiques par frame.
+ *
+ * \note Appelée par rc2d_gpu_clear, avant l'acquisition du command buffer de la frame.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_uploadRingNewFrame(void);
+
+/**
+ * \brief Programme une copie GPU entre deux textures dans la prochaine copy pass du ring d'upload.
+ *
+ * Les commandes sont exécutées dans l'ordre : une copie voit les uploads validés avant elle par le même thread.
+ *
+ * \param {const SDL_GPUTextureLocation*} source - Coin de la zone source.
+ * \param {const SDL_GPUTextureLocation*} destination - Coin de la zone destination.
+ * \param {Uint32} width - Largeur de la zone copiée.
+ * \param {Uint32} height - Hauteur de la zone copiée.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_copyTextureRegion(const SDL_GPUTextureLocation* source, const SDL_GPUTextureLocation* destination, Uint32 width, Uint32 height);
+
+/**
+ * \brief Réinitialise les compteurs par frame du sprite batch.
+ *
+ * \note Appelée par rc2d_gpu_clear au début de chaque frame.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_spriteBatchNewFrame(void);
+
+/**
+ * \brief Libère les ressources GPU et CPU du sprite batch. Le GPU doit être inactif.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_spriteBatchQuit(void);
+
+/**
+ * \brief Libère les cibles de rendu inutilisées du pool si la taille de la swapchain a changé.
+ *
+ * \param {Uint32} swapchainWidth - Largeur de la swapchain de la frame.
+ * \param {Uint32} swapchainHeight - Hauteur de la swapchain de la frame.
+ *
+ * \note Appelée par rc2d_gpu_clear, après l'acquisition de la texture de swapchain.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_renderTargetPoolNewFrame(Uint32 swapchainWidth, Uint32 swapchainHeight);
+
+/**
+ * \brief Libère toutes les cibles de rendu du pool, y compris celles encore empruntées. Le GPU doit être inactif.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_renderTargetPoolQuit(void);
+
+/**
+ * \brief Crée le placeholder (gris, 1x1) des images en chargement ou évincées du cache d'images.
+ *
+ * \return {bool} true en cas de succès, false sinon.
+ *
+ * \note Appelée par le moteur au démarrage, après la création du ring d'upload.
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_gpu_imageCacheInit(void);
+
+/**
+ * \brief Ajoute au cache d'images une texture déjà créée, rechargeable après éviction avec `reload`.
+ *
+ * \param {const char*} key - Clé unique de l'image dans le cache.
+ * \param {SDL_GPUTexture*} texture - Texture de l'image, qui appartient ensuite au cache.
+ * \param {Uint32} width - Largeur de la texture.
+ * \param {Uint32} height - Hauteur de la texture.
+ * \param {Uint64} bytes - Mémoire GPU occupée par la texture.
+ * \param {RC2D_ImageReloadFunction} reload - Fonction de rechargement après éviction (worker).
+ * \param {RC2D_ImageUploadFunction} upload - Fonction de création de la texture rechargée (thread principal).
+ * \param {void*} reloadData - Données de rechargement (allouées avec RC2D_malloc), qui appartiennent ensuite au cache.
+ * \return {RC2D_Image*} L'image, ou l'image déjà en cache pour `key` (texture et reloadData sont alors libérés).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_Image* rc2d_gpu_cacheImage(const char* key, SDL_GPUTexture* texture, Uint32 width, Uint32 height, Uint64 bytes,
+                                RC2D_ImageReloadFunction reload, RC2D_ImageUploadFunction upload, void* reloadData);
+
+/**
+ * \brief Libère les textures des images du cache dont la clé commence par `keyPrefix` (ex : images d'un pack fermé).
+ *
+ * Les chargements en cours sont attendus d'abord. Les images restent des handles valides : elles passent à l'état
+ * RC2D_IMAGE_FAILED et dessinent le placeholder, sans rechargement possible.
+ *
+ * \param {const char*} keyPrefix - Préfixe des clés à purger.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_purgeImages(const char* keyPrefix);
+
+/**
+ * Âge minimal (en frames) d'une texture évincée : une image dessinée pendant les dernières frames peut encore être
+ * référencée par une frame en vol.
+ */
+#define RC2D_IMAGE_EVICTION_MIN_AGE 2
+
+/**
+ * \brief Choisit les images à évincer pour repasser sous le budget VRAM (politique LRU du cache d'images).
+ *
+ * Seules les images prêtes, hors atlas et non dessinées pendant les RC2D_IMAGE_EVICTION_MIN_AGE dernières frames
+ * sont candidates. Elles sont rangées de la moins récemment dessinée à la plus récente au début de `images`.
+ *
+ * \param {RC2D_Image**} images - Images du cache, réordonnées en place (les candidates d'abord).
+ * \param {Uint32} count - Nombre d'images.
+ * \param {Uint64} frame - Numéro de la frame courante.
+ * \param {Uint64} residentBytes - Mémoire GPU occupée par les textures résidentes.
+ * \param {Uint64} budget - Budget en octets.
+ * \return {Uint32} Nombre d'images à évincer, prises au début de `images`.
+ *
+ * \note Sans accès au GPU : rc2d_gpu_imageCacheNewFrame libère ensuite les textures choisies.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+Uint32 rc2d_gpu_selectImagesToEvict(RC2D_Image** images, Uint32 count, Uint64 frame, Uint64 residentBytes, Uint64 budget);
+
+/**
+ * \brief Marque une image du cache comme utilisée pendant la frame, et lance son rechargement si elle a été évincée.
+ *
+ * \param {RC2D_Image*} image - Image dont `entry` n'est pas NULL.
+ *
+ * \note Appelée par le sprite batch pour chaque sprite (rc2d_gpu_drawQuad).
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_useImage(RC2D_Image* image);
+
+/**
+ * \brief Met à jour les statistiques par frame du cache d'images et évince les textures au-delà du budget VRAM.
+ *
+ * \note Appelée par rc2d_gpu_clear au début de chaque frame.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_imageCacheNewFrame(void);
+
+/**
+ * \brief Attend la fin des chargements d'images asynchrones en cours (rc2d_gpu_loadImageAsync).
+ *
+ * \note Appelée par rc2d_engine_quit avant l'arrêt du système de jobs.
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_imageLoaderQuit(void);
+
+/**
+ * \brief Libère les images du cache (textures comprises), le placeholder et le cache lui-même. Le GPU doit être inactif.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_imageCacheQuit(void);
+
+/**
+ * \brief Indique si une image de cette taille doit être rangée dans l'atlas (RC2D_EngineConfig::atlasMaxImageSize).
+ *
+ * \param {Uint32} width - Largeur de l'image.
+ * \param {Uint32} height - Hauteur de l'image.
+ * \return {bool} true si l'image est assez petite et que l'atlas automatique est activé.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_atlas_isEligible(Uint32 width, Uint32 height);
+
+/**
+ * \brief Range les pixels d'une image existante dans l'atlas : `texture`, `atlas_region`, `width` et `height` sont remplis.
+ *
+ * \param {RC2D_Image*} image - Image à remplir, qui reste à l'appelant.
+ * \param {const void*} pixels - Pixels de l'image (SDL_PIXELFORMAT_RGBA32).
+ * \param {int} pitch - Taille d'une ligne de pixels (en octets).
+ * \param {Uint32} width - Largeur de l'image.
+ * \param {Uint32} height - Hauteur de l'image.
+ * \return {bool} true si l'image a été rangée, false si elle ne tient pas dans une page ou en cas d'erreur.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_atlas_insertImage(RC2D_Image* image, const void* pixels, int pitch, Uint32 width, Uint32 height);
+
+/**
+ * \brief Libère la zone d'une image de l'atlas, sans libérer l'image.
+ *
+ * \param {RC2D_Image*} image - Image rangée avec rc2d_atlas_insertImage.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_atlas_removeImage(RC2D_Image* image);
+
+/**
+ * \brief Libère les pages remplacées par une défragmentation et défragmente l'atlas s'il est devenu trop creux.
+ *
+ * \note Appelée par rc2d_gpu_clear au début de chaque frame.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_atlas_newFrame(void);
+
+/**
+ * \brief Libère les pages de l'atlas et les images créées avec rc2d_atlas_newImage. Le GPU doit être inactif.
+ *
+ * \note Appelée après rc2d_gpu_imageCacheQuit : les images du cache rangées dans l'atlas sont déjà libérées.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_atlas_quit(void);
+
+/**
+ * \brief Crée la cible hors écran du mode headless et les fences qui bornent les frames en vol.
+ *
+ * \param {Uint32} width - Largeur de la cible (en pixels).
+ * \param {Uint32} height - Hauteur de la cible (en pixels).
+ * \param {Uint32} framesInFlight - Nombre de frames que le CPU peut avoir d'avance sur le GPU.
+ * \return true si la cible a été créée, false sinon.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_gpu_headlessInit(Uint32 width, Uint32 height, Uint32 framesInFlight);
+
+/**
+ * \brief Libère la cible hors écran du mode headless (sans effet si elle n'existe pas). Le GPU doit être inactif.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_headlessQuit(void);
+
+/**
+ * \brief Acquiert le command buffer et la cible de rendu de la frame, puis commence le render pass (effacé en noir).
+ *
+ * Remplit rc2d_engine_state.gpu_current_command_buffer, gpu_current_swapchain_texture, gpu_current_render_pass,
+ * gpu_current_color_target et gpu_current_msaa_texture.
+ *
+ * \return true si le rendu peut continuer, false si la frame est sautée (fenêtre minimisée, skip_rendering vaut alors true).
+ *
+ * \note Appelée par rc2d_gpu_clear.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_gpu_beginFrame(void);
+
+/**
+ * \brief Soumet le command buffer d'une frame (avec une fence de frame en vol en mode headless).
+ *
+ * \param {SDL_GPUCommandBuffer*} commandBuffer - Command buffer acquis par rc2d_gpu_beginFrame.
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_submitCommandBuffer(SDL_GPUCommandBuffer* commandBuffer);
+
+/**
+ * \brief Prépare l'encodage des sprites de la frame : crée les ressources par défaut (sampler, pipeline), agrandit
+ * les buffers GPU si nécessaire, puis mappe le buffer de transfert qui recevra les vertices.
+ *
+ * \return {RC2D_GPUSpriteVertex*} Vertices à remplir avec rc2d_gpu_spriteBatchBuild, ou NULL s'il n'y a rien à dessiner
+ * (la liste est alors vidée).
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_GPUSpriteVertex* rc2d_gpu_spriteBatchBeginEncode(void);
+
+/**
+ * \brief Trie les sprites de la frame par (layer, ordre d'ajout) et écrit leurs vertices dans l'ordre de dessin.
+ * N'appelle aucune fonction SDL_GPU.
+ *
+ * \param {RC2D_GPUSpriteVertex*} vertices - Vertices renvoyés par rc2d_gpu_spriteBatchBeginEncode.
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_spriteBatchBuild(RC2D_GPUSpriteVertex* vertices);
+
+/**
+ * \brief Démappe le buffer de transfert, copie les vertices dans le vertex buffer, puis émet une draw call par suite
+ * de sprites consécutifs partageant le même état. La liste est vidée.
+ *
+ * \param {SDL_GPUCommandBuffer*} commandBuffer - Command buffer de la frame, ou NULL si la frame est sautée.
+ * \param {SDL_GPURenderPass**} renderPass - Render pass courant, terminé puis repris autour de la copy pass.
+ * \param {const SDL_GPUColorTargetInfo*} colorTarget - Cible du render pass, pour le reprendre.
+ * \param {const SDL_GPUViewport*} viewport - Viewport de la frame.
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal (qui a acquis le command buffer).
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_spriteBatchEndEncode(SDL_GPUCommandBuffer* commandBuffer, SDL_GPURenderPass** renderPass,
+                                   const SDL_GPUColorTargetInfo* colorTarget, const SDL_GPUViewport* viewport);
+
+/**
+ * \brief Charge la table de réflexion des shaders précompilés (`shaders/reflection/reflection.bin`).
+ *
+ * \note Sans effet en mode rechargement à chaud : la réflexion est alors faite par SDL_shadercross.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_shaderReflectionInit(void);
+
+/**
+ * \brief Libère la table de réflexion des shaders précompilés.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_shaderReflectionQuit(void);
+
+/**
+ * \brief Libère les buffers du profiler de tous les threads.
+ *
+ * \warning Aucun autre thread ne doit plus enregistrer de zone.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_profiler_quit(void);
+
+/**
+ * \brief Exécute les tâches confiées au thread principal (rc2d_job_runOnMainThread), dans l'ordre de soumission.
+ *
+ * \param {Uint64} budgetNS - Temps au-delà duquel les tâches restantes attendent l'appel suivant (en nanosecondes),
+ * ou 0 pour tout exécuter. Au moins une tâche est exécutée par appel.
+ *
+ * \note Appelée par la boucle principale avant rc2d_update (RC2D_EngineConfig::mainThreadTaskBudget).
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_job_runMainThreadTasks(Uint64 budgetNS);
+
 void rc2d_gpu_hotReloadGraphicsShadersAndGraphicsPipeline(void);
-void rc2d_gpu_hotReloadComputeShader(void);;
+void rc2d_gpu_hotReloadComputeShader(void);
+
+#if RC2D_GPU_SHADER_HOT_RELOAD_ENABLED
+/**
+ * \brief Démarre le thread qui surveille les sources HLSL (`shaders/src/`).
+ *
+ * Utilise inotify sous Linux, et un scan périodique du dossier sur les autres plateformes.
+ *
+ * \return true si le watcher a démarré, false sinon (le rechargement à chaud est alors inactif).
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_gpu_shaderWatcherInit(void);
+
+/**
+ * \brief Arrête le thread du watcher et libère ses ressources.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_shaderWatcherQuit(void);
+
+/**
+ * \brief Prend en compte les shaders modifiés depuis la frame précédente.
+ *
+ * \return false sans verrou ni accès disque si aucun shader n'a été modifié.
+ *
+ * \note Si elle retourne true, rc2d_gpu_shaderWatcherEndFrame doit être appelée après le rechargement.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_gpu_shaderWatcherBeginFrame(void);
+
+/**
+ * \brief Indique si un shader (ex: "test.vertex") fait partie des shaders modifiés de la frame.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_gpu_shaderWatcherIsChanged(const char* filename);
+
+/**
+ * \brief Oublie les shaders modifiés de la frame, une fois le rechargement effectué.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_shaderWatcherEndFrame(void);
+
+/**
+ * \brief Démarre le thread de rechargement des shaders.
+ *
+ * Les shaders modifiés sont recompilés (HLSL -> SPIR-V -> shader) et leurs pipelines graphiques
+ * reconstruits sur ce thread : les anciens objets continuent d'être utilisés pour le rendu en attendant.
+ *
+ * \return true si le thread a démarré, false sinon (le rechargement à chaud est alors inactif).
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_gpu_shaderReloadInit(void);
+
+/**
+ * \brief Arrête le thread de rechargement et libère les shaders et pipelines en attente. Le GPU doit être inactif.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_shaderReloadQuit(void);
+
+/**
+ * \brief Échange les shaders et pipelines recompilés depuis la frame précédente, à la frontière de frame.
+ *
+ * Les objets remplacés sont libérés une fois que les frames en vol qui pouvaient les utiliser sont terminées.
+ *
+ * \note Appelée par la boucle principale avant rc2d_update, ne prend aucun verrou si rien n'est prêt.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_gpu_shaderReloadNewFrame(void);
+#endif
 
 #if RC2D_ONNX_MODULE_ENABLED
 /**
@@ -0,0 +1,249 @@
+#ifndef RC2D_JOB_H
+#define RC2D_JOB_H
+
+#include <SDL3/SDL_atomic.h> // Required for: SDL_AtomicInt, SDL_SpinLock
+#include <SDL3/SDL_stdinc.h> // Required for: Uint32
+
+#include <stdbool.h>         // Required for: bool
+
+/* Configuration pour les définitions de fonctions C, même lors de l'utilisation de C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Nombre maximal de workers du système de jobs.
+ *
+ * \since Cette macro de préprocesseur est disponible depuis RC2D 1.0.0.
+ */
+#ifndef RC2D_JOB_MAX_WORKERS
+#define RC2D_JOB_MAX_WORKERS 64
+#endif
+
+/**
+ * \brief Capacité de la file (deque) de chaque thread, et nombre de jobs qu'un thread peut avoir en cours.
+ *
+ * Doit être une puissance de 2. Au-delà, le thread qui soumet exécute des jobs en attendant qu'un emplacement se libère.
+ *
+ * \since Cette macro de préprocesseur est disponible depuis RC2D 1.0.0.
+ */
+#ifndef RC2D_JOB_QUEUE_SIZE
+#define RC2D_JOB_QUEUE_SIZE 4096
+#endif
+
+/**
+ * \brief Fonction exécutée par un job.
+ *
+ * \param {void*} data - Données passées à rc2d_job_run.
+ *
+ * \since Ce type est disponible depuis RC2D 1.0.0.
+ */
+typedef void (*RC2D_JobFunction)(void* data);
+
+/**
+ * \brief Fonction exécutée par chaque lot d'un rc2d_job_parallelFor, sur les indices [start, end[.
+ *
+ * \param {Uint32} start - Premier indice du lot.
+ * \param {Uint32} end - Indice suivant le dernier indice du lot.
+ * \param {void*} data - Données passées à rc2d_job_parallelFor.
+ *
+ * \since Ce type est disponible depuis RC2D 1.0.0.
+ */
+typedef void (*RC2D_JobRangeFunction)(Uint32 start, Uint32 end, void* data);
+
+/**
+ * \brief Compteur de jobs en cours.
+ *
+ * Chaque job soumis avec un compteur l'incrémente, et le décrémente une fois terminé : le compteur vaut 0
+ * quand tous ses jobs sont terminés. Un compteur sert aussi de dépendance (rc2d_job_runAfter).
+ *
+ * \note Doit être initialisé à zéro (`RC2D_JobCounter counter = {0};`) et peut être réutilisé une fois revenu à 0.
+ *
+ * \warning Un compteur ne doit pas être détruit (fin de portée...) avant que rc2d_job_wait ne soit revenue.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_JobCounter {
+    /**
+     * Nombre de jobs non terminés.
+     */
+    SDL_AtomicInt value;
+
+    /**
+     * Protège la liste des jobs en attente de ce compteur (usage interne).
+     */
+    SDL_SpinLock lock;
+
+    /**
+     * Jobs démarrés quand le compteur revient à 0 (usage interne).
+     */
+    struct RC2D_Job* waiting;
+} RC2D_JobCounter;
+
+/**
+ * \brief Démarre le pool de workers du système de jobs.
+ *
+ * Chaque worker possède une file (deque de Chase-Lev) : il exécute ses propres jobs en LIFO et, lorsqu'elle est vide,
+ * vole les plus anciens jobs des autres threads. Le thread appelant (thread principal) a aussi sa file :
+ * il exécute des jobs pendant rc2d_job_wait.
+ *
+ * \param {int} workerCount - Nombre de workers, ou 0 pour (cœurs logiques - 1).
+ * \param {bool} pinWorkers - true pour attacher chaque worker à un cœur (Windows, Linux et Android uniquement).
+ * \return {bool} true en cas de succès, false sinon.
+ *
+ * \note Appelée par le moteur au démarrage (RC2D_EngineConfig::jobWorkerCount). Sans système de jobs démarré,
+ * rc2d_job_run exécute directement le job sur le thread appelant.
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_job_init(int workerCount, bool pinWorkers);
+
+/**
+ * \brief Arrête les workers et libère le système de jobs.
+ *
+ * \warning Tous les compteurs doivent avoir été attendus (rc2d_job_wait) : les jobs encore en file ne sont pas forcément exécutés.
+ *
+ * \note Appelée depuis le thread principal, elle exécute les tâches confiées au thread principal
+ * (rc2d_job_runOnMainThread) jusqu'à la sortie des workers : un job qui attend l'une d'elles ne bloque pas l'arrêt.
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread qui a appelé rc2d_job_init.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_job_quit(void);
+
+/**
+ * \brief Récupère le nombre de workers du système de jobs (sans compter le thread principal).
+ *
+ * \return {int} Le nombre de workers, 0 si le système de jobs n'est pas démarré.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+int rc2d_job_getWorkerCount(void);
+
+/**
+ * \brief Soumet un job.
+ *
+ * \param {RC2D_JobFunction} function - Fonction du job.
+ * \param {void*} data - Données passées à la fonction.
+ * \param {RC2D_JobCounter*} counter - Compteur incrémenté maintenant et décrémenté à la fin du job, ou NULL.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread, y compris depuis un job.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_job_run(RC2D_JobFunction function, void* data, RC2D_JobCounter* counter);
+
+/**
+ * \brief Soumet un job qui ne démarre qu'une fois le compteur `dependency` revenu à 0.
+ *
+ * \param {RC2D_JobFunction} function - Fonction du job.
+ * \param {void*} data - Données passées à la fonction.
+ * \param {RC2D_JobCounter*} counter - Compteur incrémenté maintenant et décrémenté à la fin du job, ou NULL.
+ * \param {RC2D_JobCounter*} dependency - Compteur à attendre, ou NULL (équivalent à rc2d_job_run).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread, y compris depuis un job.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_job_runAfter(RC2D_JobFunction function, void* data, RC2D_JobCounter* counter, RC2D_JobCounter* dependency);
+
+/**
+ * \brief Attend qu'un compteur revienne à 0, en exécutant des jobs en attendant.
+ *
+ * \param {RC2D_JobCounter*} counter - Compteur à attendre.
+ *
+ * \note Depuis un thread extérieur au système de jobs, la fonction exécute les jobs soumis par les threads extérieurs
+ * et vole ceux des workers.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread, y compris depuis un job.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_job_wait(RC2D_JobCounter* counter);
+
+/**
+ * \brief Indique si tous les jobs d'un compteur sont terminés, sans attendre.
+ *
+ * \param {RC2D_JobCounter*} counter - Compteur à tester.
+ * \return {bool} true si le compteur vaut 0.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_job_isDone(RC2D_JobCounter* counter);
+
+/**
+ * \brief Découpe [0, count[ en lots et les soumet comme jobs, sans attendre.
+ *
+ * \param {Uint32} count - Nombre d'indices.
+ * \param {Uint32} batchSize - Nombre d'indices par lot, ou 0 pour environ 4 lots par thread.
+ * \param {RC2D_JobRangeFunction} function - Fonction appelée pour chaque lot.
+ * \param {void*} data - Données passées à la fonction.
+ * \param {RC2D_JobCounter*} counter - Compteur incrémenté pour chaque lot, ou NULL.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread, y compris depuis un job.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_job_parallelForAsync(Uint32 count, Uint32 batchSize, RC2D_JobRangeFunction function, void* data, RC2D_JobCounter* counter);
+
+/**
+ * \brief Découpe [0, count[ en lots, les exécute en parallèle et attend la fin de tous les lots.
+ *
+ * Le thread appelant exécute lui aussi des lots pendant l'attente.
+ *
+ * \param {Uint32} count - Nombre d'indices.
+ * \param {Uint32} batchSize - Nombre d'indices par lot, ou 0 pour environ 4 lots par thread.
+ * \param {RC2D_JobRangeFunction} function - Fonction appelée pour chaque lot.
+ * \param {void*} data - Données passées à la fonction.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread, y compris depuis un job.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_job_parallelFor(Uint32 count, Uint32 batchSize, RC2D_JobRangeFunction function, void* data);
+
+/**
+ * \brief Confie une tâche au thread principal, exécutée au début d'une prochaine frame.
+ *
+ * Prévu pour l'étape finale GPU d'un chargement (création de texture, upload, pipeline...) : un worker décode
+ * ou décompresse en parallèle, puis confie seulement cette étape au thread principal. La file est sans verrou
+ * (plusieurs producteurs, un consommateur) et vidée par le moteur avant rc2d_update, dans la limite de
+ * RC2D_EngineConfig::mainThreadTaskBudget : les tâches restantes attendent la frame suivante.
+ *
+ * \param {RC2D_JobFunction} function - Fonction de la tâche.
+ * \param {void*} data - Données passées à la fonction.
+ * \param {RC2D_JobCounter*} counter - Compteur incrémenté maintenant et décrémenté à la fin de la tâche, ou NULL.
+ *
+ * \note Depuis le thread principal, la tâche est exécutée immédiatement. rc2d_job_wait appelée depuis le thread
+ * principal exécute aussi les tâches en attente, sans limite de temps.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread, y compris depuis un job.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_job_runOnMainThread(RC2D_JobFunction function, void* data, RC2D_JobCounter* counter);
+
+/**
+ * \brief Récupère le nombre de tâches en attente d'exécution sur le thread principal.
+ *
+ * \return {int} Le nombre de tâches confiées par rc2d_job_runOnMainThread et pas encore exécutées.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+int rc2d_job_getMainThreadTaskCount(void);
+
+/* Termine les définitions de fonctions C lors de l'utilisation de C++ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RC2D_JOB_H
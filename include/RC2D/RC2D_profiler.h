@@ -0,0 +1,143 @@
+#ifndef RC2D_PROFILER_H
+#define RC2D_PROFILER_H
+
+#include <RC2D/RC2D_config.h>
+
+#include <SDL3/SDL_stdinc.h> // Required for: Uint32, Uint64
+
+#include <stdbool.h>         // Required for: bool
+
+/* Configuration pour les définitions de fonctions C, même lors de l'utilisation de C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Nombre d'événements conservés par thread (buffer circulaire).
+ *
+ * \since Cette macro de préprocesseur est disponible depuis RC2D 1.0.0.
+ */
+#ifndef RC2D_PROFILER_RING_SIZE
+#define RC2D_PROFILER_RING_SIZE 16384
+#endif
+
+/**
+ * \brief Nombre maximal de dernières mesures utilisées par rc2d_profiler_getZoneStats.
+ *
+ * \since Cette macro de préprocesseur est disponible depuis RC2D 1.0.0.
+ */
+#ifndef RC2D_PROFILER_STATS_WINDOW
+#define RC2D_PROFILER_STATS_WINDOW 240
+#endif
+
+/**
+ * \brief Statistiques glissantes d'une zone, calculées sur ses dernières mesures.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_ProfilerZoneStats {
+    /**
+     * Nombre de mesures utilisées (au plus RC2D_PROFILER_STATS_WINDOW).
+     */
+    Uint32 samples;
+
+    /**
+     * Durée minimale, moyenne, au 99e centile et maximale, en millisecondes.
+     */
+    double min_ms;
+    double avg_ms;
+    double p99_ms;
+    double max_ms;
+} RC2D_ProfilerZoneStats;
+
+/**
+ * \brief Ouvre une zone sur le thread appelant.
+ *
+ * \param {const char*} name - Nom de la zone. Doit rester valide jusqu'à la fin de l'application (littéral).
+ *
+ * \note Utilisez plutôt la macro RC2D_PROFILE_BEGIN, qui ne génère aucun code si RC2D_PROFILER_ENABLED vaut 0.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_profiler_endZone
+ */
+void rc2d_profiler_beginZone(const char* name);
+
+/**
+ * \brief Ferme la dernière zone ouverte sur le thread appelant et l'enregistre dans le buffer du thread.
+ *
+ * \note Utilisez plutôt la macro RC2D_PROFILE_END.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_profiler_beginZone
+ */
+void rc2d_profiler_endZone(void);
+
+/**
+ * \brief Calcule les statistiques (min/moyenne/p99/max) des dernières mesures d'une zone, tous threads confondus.
+ *
+ * Les phases de la boucle principale sont enregistrées sous les noms : "frame", "deltatime", "shader_reload", "main_thread_tasks",
+ * "fixedupdate", "update", "gpu_clear", "swapchain_wait" (incluse dans "gpu_clear"), "draw", "gpu_present" et "frame_pacing".
+ *
+ * \param {const char*} name - Nom de la zone.
+ * \param {RC2D_ProfilerZoneStats*} stats - Statistiques à remplir.
+ * \return {bool} true si au moins une mesure existe, false sinon (ou si le profiler est désactivé).
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_profiler_getZoneStats(const char* name, RC2D_ProfilerZoneStats* stats);
+
+/**
+ * \brief Exporte les zones enregistrées au format JSON Chrome `trace_event`.
+ *
+ * Le fichier peut être ouvert dans chrome://tracing ou https://ui.perfetto.dev.
+ *
+ * \param {const char*} path - Chemin du fichier JSON à écrire.
+ * \return {bool} true en cas de succès, false sinon (ou si le profiler est désactivé).
+ *
+ * \note Seuls les RC2D_PROFILER_RING_SIZE derniers événements de chaque thread sont exportés.
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_profiler_exportChromeTrace(const char* path);
+
+/**
+ * \brief Vide les buffers de tous les threads.
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal, sans zone ouverte sur un autre thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_profiler_reset(void);
+
+/**
+ * \brief Macros de zones du profiler.
+ *
+ * Une zone est délimitée par RC2D_PROFILE_BEGIN("nom") et RC2D_PROFILE_END(), les zones peuvent être imbriquées.
+ * Si RC2D_PROFILER_ENABLED vaut 0, ces macros ne génèrent aucun code.
+ *
+ * \since Ces macros sont disponibles depuis RC2D 1.0.0.
+ */
+#if RC2D_PROFILER_ENABLED
+#define RC2D_PROFILE_BEGIN(name) rc2d_profiler_beginZone(name)
+#define RC2D_PROFILE_END() rc2d_profiler_endZone()
+#else
+#define RC2D_PROFILE_BEGIN(name) ((void)0)
+#define RC2D_PROFILE_END() ((void)0)
+#endif
+
+/* Termine les définitions de fonctions C lors de l'utilisation de C++ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RC2D_PROFILER_H
@@ -1,6 +1,8 @@
 #ifndef RC2D_RRES_H
 #define RC2D_RRES_H
 
+#include <RC2D/RC2D_gpu.h>
+
 #include <rres/rres.h>
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
@@ -114,6 +116,99 @@ typedef struct Wave {
     // Mix_Chunk *sound;
 } Wave;
 
+/**
+ * \brief Pack RRES ouvert en projection mémoire, avec un index identifiant -> chunk.
+ *
+ * Structure opaque créée par rc2d_rres_openPack et détruite par rc2d_rres_closePack.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_RresPack RC2D_RresPack;
+
+/**
+ * \brief Lot de chunks décodés en parallèle, créé par rc2d_rres_unpackBatch.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_RresBatch RC2D_RresBatch;
+
+/**
+ * \brief Résultat du décodage d'un chunk d'un lot.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_RresBatchResult {
+    /**
+     * \brief Identifiant de la ressource demandée.
+     */
+    unsigned int id;
+
+    /**
+     * \brief Code retour de rc2d_rres_unpackResourceChunk (0 en cas de succès),
+     * ou -1 si la ressource est introuvable dans le pack.
+     */
+    int result;
+
+    /**
+     * \brief Chunk décodé, à libérer avec rc2d_rres_unloadChunkFromPack.
+     */
+    rresResourceChunk chunk;
+} RC2D_RresBatchResult;
+
+/**
+ * \brief Statistiques du cache de clés dérivées (Argon2i).
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_RresKeyCacheStats {
+    /**
+     * \brief Nombre de clés trouvées dans le cache (aucun étirement de clé).
+     */
+    Uint32 hits;
+
+    /**
+     * \brief Nombre de clés dérivées avec Argon2i (absentes du cache).
+     */
+    Uint32 misses;
+} RC2D_RresKeyCacheStats;
+
+/**
+ * \brief Contexte de calcul MD5 incrémental (init / update / final).
+ *
+ * Utilisé pour vérifier l'intégrité des chunks chiffrés en AES. Chaque contexte est indépendant :
+ * plusieurs chunks peuvent être vérifiés en parallèle sur des threads différents.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_RresMD5Context {
+    unsigned int state[4];
+    Uint64 size;
+    unsigned char buffer[64];
+} RC2D_RresMD5Context;
+
+/**
+ * \brief Implémentation AES-CTR utilisée pour le déchiffrement des chunks RRES.
+ *
+ * \since Cette énumération est disponible depuis RC2D 1.0.0.
+ */
+typedef enum RC2D_RresAESBackend {
+    /**
+     * OpenSSL EVP (accélération matérielle si disponible), avec repli sur tiny-AES en cas d'échec.
+     * Sans le module RC2D_data (RC2D_DATA_MODULE_ENABLED=OFF), OpenSSL n'est pas lié : tiny-AES.
+     */
+    RC2D_RRES_AES_BACKEND_AUTO = 0,
+
+    /**
+     * OpenSSL EVP uniquement. Non supporté sans le module RC2D_data : rc2d_rres_aesCtrXcrypt renvoie false.
+     */
+    RC2D_RRES_AES_BACKEND_OPENSSL = 1,
+
+    /**
+     * Implémentation logicielle tiny-AES (src/external/aes).
+     */
+    RC2D_RRES_AES_BACKEND_TINYAES = 2
+} RC2D_RresAESBackend;
+
 /**
  * \brief Charge des données brutes à partir d'un chunk RRES de type RRES_DATA_RAW.
  *
@@ -163,8 +258,15 @@ char *rc2d_rres_loadDataTextFromChunk(rresResourceChunk chunk);
  * \param chunk Le chunk RRES contenant les données d'image (doit être de type RRES_DATA_IMAGE).
  * \return Une structure Image contenant la surface SDL et les métadonnées, ou une structure vide en cas d'erreur.
  *
- * \note Les données doivent être non compressées et non chiffrées. Si elles sont compressées ou chiffrées,
- * appelez d'abord rc2d_rres_unpackResourceChunk.
+ * \note Les chunks compressés (LZ4) et/ou chiffrés (AES, XChaCha20-Poly1305) sont acceptés directement : ils sont
+ * décodés dans le buffer de transfert GPU, sans copie intermédiaire des pixels. Il est donc inutile (et plus coûteux)
+ * d'appeler rc2d_rres_unpackResourceChunk avant. Le mot de passe doit avoir été défini via rc2d_rres_setCipherPassword.
+ *
+ * \note Les pixels passent par le ring d'upload GPU partagé, dans la même copy pass que les autres ressources chargées.
+ * Depuis le thread principal, la texture est remplie avant les draw calls de la frame en cours (ou de la suivante, hors
+ * frame). Depuis un autre thread, elle l'est au premier envoi du thread principal qui suit la fin des autres écritures
+ * du même segment (voir rc2d_gpu_beginUpload). Depuis le thread principal, appelez rc2d_gpu_flushUploads si elle
+ * doit être remplie immédiatement.
  * 
  * \warning La texture `image.texture` doit être libérée par l'appelant avec `SDL_ReleaseGPUTexture` lorsque l'image n'est plus nécessaire.
  *
@@ -175,6 +277,32 @@ char *rc2d_rres_loadDataTextFromChunk(rresResourceChunk chunk);
  */
 Image rc2d_rres_loadImageFromChunk(rresResourceChunk chunk);
 
+/**
+ * \brief Taille de l'en-tête d'un chunk image décodé (propCount + 4 propriétés), placé devant les pixels.
+ *
+ * \since Cette macro est disponible depuis RC2D 1.0.0.
+ */
+#define RC2D_RRES_IMAGE_HEADER_SIZE 20
+
+/**
+ * \brief Décode un chunk image compressé (LZ4) et/ou chiffré dans un buffer fourni par l'appelant.
+ *
+ * C'est le décodage utilisé par rc2d_rres_loadImageFromChunk, qui l'applique directement au buffer de transfert GPU.
+ * Le buffer reçoit l'en-tête décodé (RC2D_RRES_IMAGE_HEADER_SIZE octets) suivi des pixels ; le déchiffrement AES ne
+ * relit jamais le buffer, qui peut donc être une mémoire en écriture combinée.
+ *
+ * \param chunk Le chunk empaqueté, tel que lu dans le fichier (ses données ne sont pas modifiées).
+ * \param buffer Le buffer de sortie.
+ * \param bufferSize Taille du buffer de sortie, au moins `chunk->info.baseSize`.
+ * \param props Reçoit la largeur, la hauteur et le format (rresPixelFormat) lus dans l'en-tête décodé.
+ * \return true en cas de succès, false si le chunk est invalide, le mot de passe incorrect ou les données corrompues.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_rres_decodeImageChunk(const rresResourceChunk *chunk, void *buffer, unsigned int bufferSize, unsigned int props[3]);
+
 /**
  * \brief Charge des données audio Wave à partir d'un chunk RRES de type RRES_DATA_WAVE.
  *
@@ -231,9 +359,12 @@ Font rc2d_rres_loadFontFromChunk(rresResourceChunk chunk, float ptsize);
  *         - 2 : Mot de passe incorrect lors du déchiffrement.
  *         - 3 : Algorithme de compression non supporté.
  *         - 4 : Erreur lors de la décompression des données.
+ *         - 5 : Échec de la dérivation de la clé (mémoire insuffisante), le mot de passe n'a pas été vérifié.
  *
  * \note Le mot de passe doit être défini via rc2d_rres_setCipherPassword avant d'appeler cette fonction
  * pour les données chiffrées. Un mot de passe incorrect entraînera un code d'erreur 2.
+ *
+ * \note Les clés dérivées sont mises en cache par couple (mot de passe, sel), voir rc2d_rres_setPackSaltMode.
  * 
  * \warning Les champs `chunk->data.props` et `chunk->data.raw` alloués dynamiquement doivent 
  * être libérés par l'appelant avec `RC2D_safe_free` lorsque le chunk n'est plus nécessaire.
@@ -292,6 +423,336 @@ const char *rc2d_rres_getCipherPassword(void);
  */
 void rc2d_rres_cleanCipherPassword(void);
 
+/**
+ * \brief Active ou désactive le mode "sel au niveau du pack" pour la dérivation des clés.
+ *
+ * Les clés de déchiffrement sont dérivées du mot de passe via Argon2i (16 Mo, 3 passes), ce qui représente
+ * l'essentiel du temps de chargement d'un chunk chiffré. Les clés dérivées sont toujours mises en cache par
+ * couple (mot de passe, sel). Lorsque ce mode est activé, le pack est supposé utiliser un sel unique pour
+ * tous ses chunks : la première clé dérivée est épinglée et n'est jamais évincée du cache, de sorte que
+ * charger N chunks ne coûte qu'un seul étirement de clé.
+ *
+ * \param enabled true pour activer le mode sel au niveau du pack, false pour revenir au sel par chunk.
+ *
+ * \note Un chunk dont le sel diffère de celui du pack reste déchiffré correctement (une nouvelle clé est
+ * dérivée et un avertissement est affiché via RC2D_log).
+ *
+ * \warning Le chiffrement AES de rrespacker utilise le mode CTR sans IV : partager un sel entre plusieurs
+ * chunks AES revient à réutiliser le même flux de clé. Réservez ce mode aux packs chiffrés avec
+ * XChaCha20-Poly1305, dont le nonce est unique par chunk.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_rres_setPackSaltMode(bool enabled);
+
+/**
+ * \brief Efface toutes les clés dérivées du cache et remet ses statistiques à zéro.
+ *
+ * Cette fonction est appelée automatiquement par rc2d_rres_cleanCipherPassword (et donc par
+ * rc2d_rres_setCipherPassword) ainsi qu'à la fermeture du moteur. Elle peut être appelée manuellement
+ * à la fin d'un écran de chargement pour ne pas garder les clés en mémoire.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_rres_cleanKeyCache(void);
+
+/**
+ * \brief Récupère les statistiques du cache de clés dérivées.
+ *
+ * \param stats Pointeur vers la structure à remplir.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_rres_cleanKeyCache
+ */
+void rc2d_rres_getKeyCacheStats(RC2D_RresKeyCacheStats *stats);
+
+/**
+ * \brief Ouvre un fichier .rres en projection mémoire et construit son index de ressources.
+ *
+ * Le fichier est projeté en entier (mmap / MapViewOfFile) et un index à adressage ouvert est construit
+ * à partir du répertoire central (ou, à défaut, des en-têtes de chunks) : la recherche d'une ressource
+ * par identifiant se fait ensuite en O(1), sans lecture de fichier ni appel système.
+ *
+ * \param fileName Chemin du fichier .rres.
+ * \return Un pointeur vers le pack ouvert, ou NULL en cas d'erreur.
+ *
+ * \note Sur les plateformes où la projection n'est pas possible (ex: assets Android), le fichier est
+ * chargé une seule fois en mémoire via SDL_LoadFile ; l'API reste identique.
+ *
+ * \note Les packs produits par rc2d_rrespack alignent le début de chaque chunk sur rresFileHeader::reserved
+ * octets (4096 par défaut) : ils se lisent avec cette fonction, pas avec le parcours séquentiel de rres.h.
+ *
+ * \warning Le pack doit être fermé avec rc2d_rres_closePack. Les vues retournées par
+ * rc2d_rres_loadChunkFromPack deviennent invalides après la fermeture du pack.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_RresPack *rc2d_rres_openPack(const char *fileName);
+
+/**
+ * \brief Ferme un pack RRES ouvert avec rc2d_rres_openPack et libère ses ressources.
+ *
+ * Les images du pack chargées dans le cache (rc2d_rres_newImageFromPack) ne peuvent plus être relues : après
+ * les rechargements en cours, leurs textures sont libérées et elles passent à l'état RC2D_IMAGE_FAILED
+ * (le placeholder est dessiné). Leurs handles restent valides jusqu'à la fermeture du moteur.
+ *
+ * \param pack Le pack à fermer (peut être NULL).
+ *
+ * \warning Un pack dont des images ont été dessinées pendant la frame en cours doit être fermé hors de rc2d_draw
+ * (ex : dans rc2d_update) : les sprites de la frame ne sont encodés qu'à rc2d_gpu_present.
+ *
+ * \threadsafety Cette fonction ne doit pas être appelée tant que d'autres threads utilisent le pack.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_rres_closePack(RC2D_RresPack *pack);
+
+/**
+ * \brief Récupère l'identifiant d'une ressource à partir de son nom de fichier d'origine.
+ *
+ * \param pack Le pack ouvert.
+ * \param fileName Le nom du fichier tel qu'enregistré dans le répertoire central.
+ * \return L'identifiant de la ressource, ou 0 si elle est introuvable ou si le pack n'a pas de répertoire central.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+int rc2d_rres_getResourceIdFromPack(const RC2D_RresPack *pack, const char *fileName);
+
+/**
+ * \brief Récupère un chunk d'un pack à partir de son identifiant.
+ *
+ * Si le chunk n'est ni compressé ni chiffré, `chunk.data.raw` est une vue qui pointe directement dans la
+ * projection du fichier : aucune copie n'est effectuée. Sinon, les données empaquetées sont copiées dans un
+ * buffer appartenant au chunk, prêt à être passé à rc2d_rres_unpackResourceChunk.
+ *
+ * \param pack Le pack ouvert.
+ * \param id L'identifiant de la ressource.
+ * \return Le chunk trouvé, ou un chunk vide (`data.raw == NULL`) si la ressource est introuvable ou corrompue.
+ *
+ * \warning Le chunk doit être libéré avec rc2d_rres_unloadChunkFromPack (et non avec RC2D_safe_free sur
+ * `chunk.data.raw`), car une vue appartient au pack.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+rresResourceChunk rc2d_rres_loadChunkFromPack(const RC2D_RresPack *pack, unsigned int id);
+
+/**
+ * \brief Indique si les données d'un chunk sont une vue dans la projection du pack.
+ *
+ * \param pack Le pack ouvert.
+ * \param chunk Le chunk à tester.
+ * \return true si `chunk->data.raw` pointe dans le pack, false sinon.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_rres_isChunkViewOfPack(const RC2D_RresPack *pack, const rresResourceChunk *chunk);
+
+/**
+ * \brief Libère un chunk obtenu avec rc2d_rres_loadChunkFromPack.
+ *
+ * Les propriétés sont libérées ; les données brutes ne sont libérées que si elles n'appartiennent pas
+ * au pack (chunk décompressé/déchiffré par rc2d_rres_unpackResourceChunk).
+ *
+ * \param pack Le pack dont provient le chunk.
+ * \param chunk Le chunk à libérer, remis à zéro.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_rres_unloadChunkFromPack(const RC2D_RresPack *pack, rresResourceChunk *chunk);
+
+/**
+ * \brief Charge une image d'un pack dans le cache d'images du moteur.
+ *
+ * Contrairement à rc2d_rres_loadImageFromChunk, l'image appartient au cache : elle est partagée entre les appels
+ * avec le même pack et le même nom, comptée dans le budget de mémoire vidéo (RC2D_EngineConfig::gpuTextureBudget)
+ * et libérée à la fermeture du moteur. Si sa texture est évincée, elle est relue depuis le pack au prochain dessin.
+ *
+ * \param pack Le pack ouvert.
+ * \param fileName Le nom du fichier tel qu'enregistré dans le répertoire central.
+ * \return L'image, ou NULL si elle est introuvable ou si sa texture n'a pas pu être créée.
+ *
+ * \note Le pack est relu après chaque éviction tant qu'il est ouvert ; rc2d_rres_closePack libère les textures
+ * de ses images. La clé du cache contient un identifiant unique du pack : un pack rouvert recharge ses images.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread. Le chunk est décodé sur le thread
+ * appelant, la création de la texture est confiée au thread principal (rc2d_job_runOnMainThread).
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_Image *rc2d_rres_newImageFromPack(const RC2D_RresPack *pack, const char *fileName);
+
+/**
+ * \brief Décode en parallèle une liste de chunks d'un pack.
+ *
+ * Le déchiffrement, la vérification d'intégrité et la décompression LZ4 de chaque chunk sont répartis sur
+ * les workers du système de jobs (voir rc2d_job_init), sans créer de thread. Les chunks décodés sont publiés,
+ * dans leur ordre de complétion, dans une file que le thread appelant vide avec rc2d_rres_pollBatch ou
+ * rc2d_rres_waitBatch.
+ *
+ * \param pack Le pack ouvert avec rc2d_rres_openPack (doit rester ouvert jusqu'à la destruction du lot).
+ * \param ids Les identifiants des ressources à décoder (copiés).
+ * \param count Le nombre d'identifiants.
+ * \return Le lot en cours de décodage, ou NULL en cas d'erreur.
+ *
+ * \note Sans système de jobs démarré, le lot est entièrement décodé sur le thread appelant avant le retour.
+ *
+ * \note Chaque sel différent coûte un étirement de clé Argon2i (16 Mo) : un pack à sel unique
+ * (voir rc2d_rres_setPackSaltMode) n'en paie qu'un seul.
+ *
+ * \warning Le lot doit être détruit avec rc2d_rres_destroyBatch.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_RresBatch *rc2d_rres_unpackBatch(const RC2D_RresPack *pack, const unsigned int *ids, int count);
+
+/**
+ * \brief Récupère, sans bloquer, le prochain chunk décodé d'un lot.
+ *
+ * \param batch Le lot.
+ * \param result Reçoit le résultat ; le chunk appartient ensuite à l'appelant.
+ * \return true si un résultat a été récupéré, false si aucun chunk n'est prêt pour le moment.
+ *
+ * \threadsafety Un seul thread doit vider la file d'un lot donné.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_rres_pollBatch(RC2D_RresBatch *batch, RC2D_RresBatchResult *result);
+
+/**
+ * \brief Attend et récupère le prochain chunk décodé d'un lot.
+ *
+ * \param batch Le lot.
+ * \param result Reçoit le résultat ; le chunk appartient ensuite à l'appelant.
+ * \return true si un résultat a été récupéré, false si tous les résultats ont déjà été récupérés.
+ *
+ * \note Tant qu'aucun chunk n'est prêt, le thread appelant décode lui-même les chunks pas encore distribués.
+ *
+ * \threadsafety Un seul thread doit vider la file d'un lot donné.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_rres_waitBatch(RC2D_RresBatch *batch, RC2D_RresBatchResult *result);
+
+/**
+ * \brief Indique si tous les résultats d'un lot ont été récupérés.
+ *
+ * \param batch Le lot.
+ * \return true si la file de complétion a été entièrement vidée.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_rres_isBatchDone(RC2D_RresBatch *batch);
+
+/**
+ * \brief Arrête le décodage d'un lot et libère ses ressources.
+ *
+ * Les chunks en cours de décodage sont terminés, ceux qui n'ont pas encore été distribués sont abandonnés
+ * et les résultats non récupérés sont libérés.
+ *
+ * \param batch Le lot à détruire (peut être NULL).
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread qui vide la file du lot.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_rres_destroyBatch(RC2D_RresBatch *batch);
+
+/**
+ * \brief Initialise un contexte MD5.
+ *
+ * \param ctx Le contexte à initialiser.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_rres_md5Init(RC2D_RresMD5Context *ctx);
+
+/**
+ * \brief Ajoute des données au calcul MD5 en cours.
+ *
+ * Les blocs complets sont traités directement depuis `data`, sans copie ; seul un éventuel bloc partiel
+ * (moins de 64 octets) est conservé dans le contexte.
+ *
+ * \param ctx Le contexte initialisé avec rc2d_rres_md5Init.
+ * \param data Les données à hacher.
+ * \param size La taille des données en octets.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread, un contexte ne doit pas être partagé.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_rres_md5Update(RC2D_RresMD5Context *ctx, const void *data, size_t size);
+
+/**
+ * \brief Termine le calcul MD5 et écrit l'empreinte dans le buffer de l'appelant.
+ *
+ * \param ctx Le contexte (remis à zéro après l'appel).
+ * \param hash Reçoit l'empreinte de 128 bits sous forme de 4 entiers, au format stocké par rrespacker.
+ *
+ * \note Comme rrespacker, la longueur est encodée sur 32 bits : l'empreinte n'est identique au MD5
+ * standard que pour des données de moins de 512 Mo.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread, un contexte ne doit pas être partagé.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_rres_md5Final(RC2D_RresMD5Context *ctx, unsigned int hash[4]);
+
+/**
+ * \brief Calcule en une fois l'empreinte MD5 d'un buffer.
+ *
+ * \param data Les données à hacher.
+ * \param size La taille des données en octets.
+ * \param hash Reçoit l'empreinte de 128 bits sous forme de 4 entiers.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_rres_computeMD5(const void *data, size_t size, unsigned int hash[4]);
+
+/**
+ * \brief Chiffre ou déchiffre un buffer en place en AES-256-CTR, comme le fait rrespacker.
+ *
+ * Le compteur démarre à zéro (IV nul). Le chemin OpenSSL EVP exploite AES-NI (x86) ou les extensions
+ * cryptographiques ARMv8 lorsqu'elles sont disponibles ; tiny-AES reste disponible en repli.
+ * Les deux implémentations produisent une sortie identique à l'octet près.
+ * OpenSSL n'est lié qu'avec le module RC2D_data (RC2D_DATA_MODULE_ENABLED) : sans lui, seul tiny-AES est utilisé.
+ *
+ * \param key Clé de 256 bits.
+ * \param data Données à traiter en place.
+ * \param size Taille des données en octets.
+ * \param backend Implémentation à utiliser (RC2D_RRES_AES_BACKEND_AUTO par défaut).
+ * \return true en cas de succès, false en cas d'erreur (ou RC2D_RRES_AES_BACKEND_OPENSSL sans le module RC2D_data).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_rres_aesCtrXcrypt(const unsigned char key[32], unsigned char *data, size_t size, RC2D_RresAESBackend backend);
+
 /* Termine les définitions de fonctions C lors de l'utilisation de C++ */
 #ifdef __cplusplus
 }
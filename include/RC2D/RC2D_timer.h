@@ -51,6 +51,48 @@ typedef struct RC2D_Timer {
 	void* userdata;           
 } RC2D_Timer;
 
+/**
+ * \brief Nombre de dernières frames utilisées par rc2d_timer_getFramePacingStats.
+ *
+ * \since Cette macro de préprocesseur est disponible depuis RC2D 1.0.0.
+ */
+#ifndef RC2D_FRAMEPACER_HISTORY
+#define RC2D_FRAMEPACER_HISTORY 256
+#endif
+
+/**
+ * \brief Statistiques du frame pacer sur les dernières frames.
+ *
+ * La gigue (jitter) d'une frame est l'écart absolu entre sa durée réelle et la durée cible (1 / FPS cible).
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_FramePacingStats {
+    /**
+     * Nombre de frames mesurées (au plus RC2D_FRAMEPACER_HISTORY).
+     */
+    Uint32 samples;
+
+    /**
+     * Durée cible et durée moyenne d'une frame, en millisecondes.
+     */
+    double target_ms;
+    double avg_ms;
+
+    /**
+     * Gigue médiane, au 95e et 99e centile et maximale, en millisecondes.
+     */
+    double jitter_p50_ms;
+    double jitter_p95_ms;
+    double jitter_p99_ms;
+    double jitter_max_ms;
+
+    /**
+     * Marge courante d'attente active avant l'échéance (calibrée au démarrage, puis ajustée à chaque frame), en millisecondes.
+     */
+    double spin_margin_ms;
+} RC2D_FramePacingStats;
+
 /**
  * \brief Ajoute un timer qui déclenchera une fonction de rappel après un intervalle spécifié. 
  * 
@@ -139,6 +181,22 @@ double rc2d_timer_getTime(void);
  */
 void rc2d_timer_sleep(const double seconds);
 
+/**
+ * \brief Récupère les statistiques de cadence des dernières frames (durée moyenne, gigue).
+ *
+ * Sur desktop, RC2D cadence lui-même les frames sur le taux de rafraîchissement du moniteur : sommeil de l'OS
+ * jusqu'à peu avant l'échéance, puis attente active jusqu'à l'échéance exacte.
+ *
+ * \param {RC2D_FramePacingStats*} stats - Statistiques à remplir.
+ * \return {bool} true si au moins une frame a été mesurée, false sinon (ou si le frame pacer n'est pas actif :
+ * mobile, web, mode headless).
+ *
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_timer_getFramePacingStats(RC2D_FramePacingStats* stats);
+
 #ifdef __cplusplus
 };
 #endif
@@ -0,0 +1,839 @@
+#include <RC2D/RC2D_atlas.h>
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_assert.h>
+#include <RC2D/RC2D_logger.h>
+#include <RC2D/RC2D_memory.h>
+
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_gpu.h>
+#include <SDL3/SDL_mutex.h>
+
+/**
+ * Nombre de frames pendant lesquelles une page remplacée par une défragmentation reste en vie : la liste de
+ * sprites de la frame en cours peut encore la référencer jusqu'à rc2d_gpu_present.
+ */
+#define RC2D_ATLAS_RETIRE_FRAMES 2
+
+/**
+ * Défragmentation automatique quand les images tiendraient dans une page de moins, remplie à ce taux au plus.
+ */
+#define RC2D_ATLAS_DEFRAGMENT_OCCUPANCY 0.75f
+
+struct RC2D_AtlasPacker {
+    Uint32 width;
+    Uint32 height;
+
+    // Rectangles libres maximaux (ils peuvent se chevaucher)
+    RC2D_AtlasRect* free_rects;
+    Uint32 free_count;
+    Uint32 free_capacity;
+
+    Uint64 used_area;
+};
+
+/**
+ * Page de l'atlas : une texture partagée et le packer de sa surface.
+ */
+typedef struct RC2D_AtlasPage {
+    SDL_GPUTexture* texture;
+    RC2D_AtlasPacker* packer;
+    Uint32 image_count;
+} RC2D_AtlasPage;
+
+/**
+ * Page remplacée par une défragmentation, libérée après RC2D_ATLAS_RETIRE_FRAMES frames.
+ */
+typedef struct RC2D_AtlasRetiredPage {
+    SDL_GPUTexture* texture;
+    Uint64 frame;
+} RC2D_AtlasRetiredPage;
+
+/**
+ * État de l'atlas de textures partagé.
+ */
+static struct {
+    RC2D_AtlasPage* pages;
+    Uint32 page_count;
+
+    // Zones de toutes les images rangées, pour la défragmentation
+    RC2D_AtlasRegion** regions;
+    Uint32 region_count;
+    Uint32 region_capacity;
+
+    RC2D_AtlasRetiredPage* retired;
+    Uint32 retired_count;
+    Uint32 retired_capacity;
+
+    // Taille et bordure des pages, figées à la création de la première page
+    Uint32 page_size;
+    Uint32 padding;
+
+    Uint64 frame;
+    Uint32 defragment_count;
+
+    // Une image a été retirée depuis la dernière défragmentation
+    bool fragmented;
+} rc2d_atlas = {0};
+
+/**
+ * Mutex de l'atlas, créé paresseusement sous la protection d'un spinlock : une image peut être rangée
+ * (rc2d_gpu_newImage, rc2d_gpu_loadImageAsync) avant toute autre utilisation de l'atlas.
+ */
+static SDL_Mutex* rc2d_atlas_mutex = NULL;
+static SDL_SpinLock rc2d_atlas_mutexLock = 0;
+
+static SDL_Mutex* rc2d_atlas_getMutex(void)
+{
+    SDL_LockSpinlock(&rc2d_atlas_mutexLock);
+    if (rc2d_atlas_mutex == NULL)
+    {
+        rc2d_atlas_mutex = SDL_CreateMutex();
+        RC2D_assert_release(rc2d_atlas_mutex != NULL, RC2D_LOG_CRITICAL, "Failed to create atlas mutex: %s", SDL_GetError());
+    }
+    SDL_UnlockSpinlock(&rc2d_atlas_mutexLock);
+
+    return rc2d_atlas_mutex;
+}
+
+/* -------------------------------------------------------------------------------------------------------------- */
+/* Packer MaxRects                                                                                                */
+/* -------------------------------------------------------------------------------------------------------------- */
+
+static bool rc2d_atlas_pushFreeRect(RC2D_AtlasPacker* packer, Uint32 x, Uint32 y, Uint32 width, Uint32 height)
+{
+    if (packer->free_count == packer->free_capacity)
+    {
+        Uint32 capacity = packer->free_capacity ? packer->free_capacity * 2 : 32;
+        RC2D_AtlasRect* rects = RC2D_realloc(packer->free_rects, capacity * sizeof(RC2D_AtlasRect));
+        if (rects == NULL) return false;
+        packer->free_rects = rects;
+        packer->free_capacity = capacity;
+    }
+
+    packer->free_rects[packer->free_count++] = (RC2D_AtlasRect){ x, y, width, height };
+    return true;
+}
+
+static bool rc2d_atlas_rectContains(const RC2D_AtlasRect* outer, const RC2D_AtlasRect* inner)
+{
+    return inner->x >= outer->x && inner->y >= outer->y &&
+           inner->x + inner->width <= outer->x + outer->width &&
+           inner->y + inner->height <= outer->y + outer->height;
+}
+
+static bool rc2d_atlas_rectIntersects(const RC2D_AtlasRect* a, const RC2D_AtlasRect* b)
+{
+    return a->x < b->x + b->width && b->x < a->x + a->width &&
+           a->y < b->y + b->height && b->y < a->y + a->height;
+}
+
+/**
+ * Supprime les rectangles vides (width == 0) et ceux contenus dans un autre rectangle libre.
+ */
+static void rc2d_atlas_pruneFreeRects(RC2D_AtlasPacker* packer)
+{
+    for (Uint32 i = 0; i < packer->free_count; i++)
+    {
+        if (packer->free_rects[i].width == 0) continue;
+
+        for (Uint32 j = i + 1; j < packer->free_count; j++)
+        {
+            if (packer->free_rects[j].width == 0) continue;
+
+            if (rc2d_atlas_rectContains(&packer->free_rects[i], &packer->free_rects[j]))
+            {
+                packer->free_rects[j].width = 0;
+            }
+            else if (rc2d_atlas_rectContains(&packer->free_rects[j], &packer->free_rects[i]))
+            {
+                packer->free_rects[i].width = 0;
+                break;
+            }
+        }
+    }
+
+    Uint32 count = 0;
+    for (Uint32 i = 0; i < packer->free_count; i++)
+    {
+        if (packer->free_rects[i].width != 0) packer->free_rects[count++] = packer->free_rects[i];
+    }
+    packer->free_count = count;
+}
+
+/**
+ * Fusionne les rectangles libres qui partagent un côté entier, jusqu'à ce qu'aucune fusion ne soit possible.
+ */
+static void rc2d_atlas_mergeFreeRects(RC2D_AtlasPacker* packer)
+{
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+        for (Uint32 i = 0; i < packer->free_count; i++)
+        {
+            RC2D_AtlasRect* a = &packer->free_rects[i];
+            for (Uint32 j = i + 1; j < packer->free_count; j++)
+            {
+                RC2D_AtlasRect* b = &packer->free_rects[j];
+                if (a->x == b->x && a->width == b->width && (a->y + a->height == b->y || b->y + b->height == a->y))
+                {
+                    a->y = SDL_min(a->y, b->y);
+                    a->height += b->height;
+                }
+                else if (a->y == b->y && a->height == b->height && (a->x + a->width == b->x || b->x + b->width == a->x))
+                {
+                    a->x = SDL_min(a->x, b->x);
+                    a->width += b->width;
+                }
+                else
+                {
+                    continue;
+                }
+
+                packer->free_rects[j] = packer->free_rects[--packer->free_count];
+                merged = true;
+                j = i;
+            }
+        }
+    }
+}
+
+RC2D_AtlasPacker* rc2d_atlas_createPacker(Uint32 width, Uint32 height)
+{
+    RC2D_AtlasPacker* packer = RC2D_calloc(1, sizeof(RC2D_AtlasPacker));
+    if (packer == NULL) return NULL;
+
+    packer->width = width;
+    packer->height = height;
+    if (!rc2d_atlas_pushFreeRect(packer, 0, 0, width, height))
+    {
+        RC2D_free(packer);
+        return NULL;
+    }
+
+    return packer;
+}
+
+void rc2d_atlas_destroyPacker(RC2D_AtlasPacker* packer)
+{
+    if (packer == NULL) return;
+
+    RC2D_safe_free(packer->free_rects);
+    RC2D_free(packer);
+}
+
+bool rc2d_atlas_packerInsert(RC2D_AtlasPacker* packer, Uint32 width, Uint32 height, RC2D_AtlasRect* rect)
+{
+    RC2D_assert_release(packer != NULL && rect != NULL, RC2D_LOG_CRITICAL, "packer or rect is NULL");
+    if (width == 0 || height == 0) return false;
+
+    // Best Short Side Fit : le plus petit reste sur le côté le plus court, puis sur le côté le plus long
+    Uint32 bestIndex = packer->free_count;
+    Uint32 bestShort = SDL_MAX_UINT32;
+    Uint32 bestLong = SDL_MAX_UINT32;
+    for (Uint32 i = 0; i < packer->free_count; i++)
+    {
+        const RC2D_AtlasRect* free = &packer->free_rects[i];
+        if (free->width < width || free->height < height) continue;
+
+        Uint32 leftoverX = free->width - width;
+        Uint32 leftoverY = free->height - height;
+        Uint32 shortSide = SDL_min(leftoverX, leftoverY);
+        Uint32 longSide = SDL_max(leftoverX, leftoverY);
+        if (shortSide < bestShort || (shortSide == bestShort && longSide < bestLong))
+        {
+            bestIndex = i;
+            bestShort = shortSide;
+            bestLong = longSide;
+        }
+    }
+
+    if (bestIndex == packer->free_count) return false;
+
+    RC2D_AtlasRect placed = { packer->free_rects[bestIndex].x, packer->free_rects[bestIndex].y, width, height };
+
+    // Découpe des rectangles libres chevauchés en (au plus) 4 rectangles maximaux
+    const Uint32 count = packer->free_count;
+    for (Uint32 i = 0; i < count; i++)
+    {
+        RC2D_AtlasRect free = packer->free_rects[i];
+        if (free.width == 0 || !rc2d_atlas_rectIntersects(&free, &placed)) continue;
+
+        packer->free_rects[i].width = 0;
+
+        bool pushed = true;
+        if (placed.x > free.x)
+        {
+            pushed &= rc2d_atlas_pushFreeRect(packer, free.x, free.y, placed.x - free.x, free.height);
+        }
+        if (placed.x + placed.width < free.x + free.width)
+        {
+            pushed &= rc2d_atlas_pushFreeRect(packer, placed.x + placed.width, free.y, free.x + free.width - (placed.x + placed.width), free.height);
+        }
+        if (placed.y > free.y)
+        {
+            pushed &= rc2d_atlas_pushFreeRect(packer, free.x, free.y, free.width, placed.y - free.y);
+        }
+        if (placed.y + placed.height < free.y + free.height)
+        {
+            pushed &= rc2d_atlas_pushFreeRect(packer, free.x, placed.y + placed.height, free.width, free.y + free.height - (placed.y + placed.height));
+        }
+
+        // Sans mémoire, la place perdue reste correcte : aucun rectangle libre ne chevauche une zone réservée
+        if (!pushed) RC2D_log(RC2D_LOG_WARN, "Atlas packer: failed to grow free list, some space is lost");
+    }
+
+    rc2d_atlas_pruneFreeRects(packer);
+
+    packer->used_area += (Uint64)width * height;
+    *rect = placed;
+    return true;
+}
+
+void rc2d_atlas_packerRemove(RC2D_AtlasPacker* packer, const RC2D_AtlasRect* rect)
+{
+    RC2D_assert_release(packer != NULL && rect != NULL, RC2D_LOG_CRITICAL, "packer or rect is NULL");
+
+    packer->used_area -= SDL_min(packer->used_area, (Uint64)rect->width * rect->height);
+    if (packer->used_area == 0)
+    {
+        rc2d_atlas_packerClear(packer);
+        return;
+    }
+
+    if (!rc2d_atlas_pushFreeRect(packer, rect->x, rect->y, rect->width, rect->height)) return;
+
+    rc2d_atlas_mergeFreeRects(packer);
+    rc2d_atlas_pruneFreeRects(packer);
+}
+
+void rc2d_atlas_packerClear(RC2D_AtlasPacker* packer)
+{
+    RC2D_assert_release(packer != NULL, RC2D_LOG_CRITICAL, "packer is NULL");
+
+    packer->free_count = 0;
+    packer->used_area = 0;
+    rc2d_atlas_pushFreeRect(packer, 0, 0, packer->width, packer->height);
+}
+
+Uint64 rc2d_atlas_getPackerUsedArea(const RC2D_AtlasPacker* packer)
+{
+    return packer != NULL ? packer->used_area : 0;
+}
+
+/* -------------------------------------------------------------------------------------------------------------- */
+/* Atlas de textures                                                                                              */
+/* -------------------------------------------------------------------------------------------------------------- */
+
+/**
+ * Zone réservée pour une image, bordure comprise.
+ */
+static RC2D_AtlasRect rc2d_atlas_getSlot(const RC2D_AtlasRegion* region)
+{
+    const RC2D_Image* image = region->image;
+    return (RC2D_AtlasRect){
+        region->x - rc2d_atlas.padding,
+        region->y - rc2d_atlas.padding,
+        image->width + 2 * rc2d_atlas.padding,
+        image->height + 2 * rc2d_atlas.padding
+    };
+}
+
+static void rc2d_atlas_setRegion(RC2D_AtlasRegion* region, Uint32 page, const RC2D_AtlasRect* slot)
+{
+    const RC2D_Image* image = region->image;
+    const float size = (float)rc2d_atlas.page_size;
+
+    region->page = page;
+    region->x = slot->x + rc2d_atlas.padding;
+    region->y = slot->y + rc2d_atlas.padding;
+    region->u0 = (float)region->x / size;
+    region->v0 = (float)region->y / size;
+    region->u1 = (float)(region->x + image->width) / size;
+    region->v1 = (float)(region->y + image->height) / size;
+}
+
+static SDL_GPUTexture* rc2d_atlas_createPageTexture(void)
+{
+    SDL_GPUTextureCreateInfo createInfo = {
+        .type = SDL_GPU_TEXTURETYPE_2D,
+        .format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
+        .usage = SDL_GPU_TEXTUREUSAGE_SAMPLER,
+        .width = rc2d_atlas.page_size,
+        .height = rc2d_atlas.page_size,
+        .layer_count_or_depth = 1,
+        .num_levels = 1,
+        .sample_count = SDL_GPU_SAMPLECOUNT_1
+    };
+
+    SDL_GPUTexture* texture = SDL_CreateGPUTexture(rc2d_gpu_getDevice(), &createInfo);
+    if (texture == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to create atlas page texture: %s", SDL_GetError());
+    }
+    return texture;
+}
+
+/**
+ * Ajoute une page vide. Appelée avec le mutex de l'atlas verrouillé.
+ */
+static bool rc2d_atlas_addPage(void)
+{
+    RC2D_AtlasPage* pages = RC2D_realloc(rc2d_atlas.pages, (rc2d_atlas.page_count + 1) * sizeof(RC2D_AtlasPage));
+    if (pages == NULL) return false;
+    rc2d_atlas.pages = pages;
+
+    RC2D_AtlasPage* page = &rc2d_atlas.pages[rc2d_atlas.page_count];
+    page->image_count = 0;
+    page->packer = rc2d_atlas_createPacker(rc2d_atlas.page_size, rc2d_atlas.page_size);
+    page->texture = page->packer ? rc2d_atlas_createPageTexture() : NULL;
+    if (page->texture == NULL)
+    {
+        rc2d_atlas_destroyPacker(page->packer);
+        return false;
+    }
+
+    rc2d_atlas.page_count++;
+    RC2D_log(RC2D_LOG_INFO, "Atlas page %u created (%ux%u)", rc2d_atlas.page_count - 1, rc2d_atlas.page_size, rc2d_atlas.page_size);
+    return true;
+}
+
+/**
+ * Copie les pixels d'une image dans sa zone, en répétant ses bords dans la bordure.
+ */
+static bool rc2d_atlas_uploadImage(SDL_GPUTexture* texture, const RC2D_AtlasRect* slot, const void* pixels, int pitch,
+                                   Uint32 width, Uint32 height)
+{
+    const Uint32 padding = rc2d_atlas.padding;
+    const Uint32 rowSize = slot->width * 4;
+
+    RC2D_GPUUploadAllocation allocation;
+    if (!rc2d_gpu_beginUpload(rowSize * slot->height, 512, &allocation))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to reserve upload space for atlas image");
+        return false;
+    }
+
+    for (Uint32 y = 0; y < slot->height; y++)
+    {
+        Uint32 sourceY = (y < padding) ? 0 : SDL_min(y - padding, height - 1);
+        const Uint32* source = (const Uint32*)((const Uint8*)pixels + (size_t)sourceY * pitch);
+        Uint32* destination = (Uint32*)((Uint8*)allocation.data + (size_t)y * rowSize);
+
+        for (Uint32 x = 0; x < padding; x++)
+        {
+            destination[x] = source[0];
+            destination[padding + width + x] = source[width - 1];
+        }
+        SDL_memcpy(destination + padding, source, (size_t)width * 4);
+    }
+
+    SDL_GPUTextureRegion region = {
+        .texture = texture,
+        .x = slot->x,
+        .y = slot->y,
+        .w = slot->width,
+        .h = slot->height,
+        .d = 1
+    };
+    rc2d_gpu_endUploadToTexture(&allocation, 0, &region, slot->width, slot->height);
+    return true;
+}
+
+bool rc2d_atlas_isEligible(Uint32 width, Uint32 height)
+{
+    const Uint32 maxSize = rc2d_engine_state.config->atlasMaxImageSize;
+    return maxSize > 0 && width > 0 && height > 0 && width <= maxSize && height <= maxSize;
+}
+
+/**
+ * Garantit la place d'une zone de plus dans la liste des zones. Appelée avec le mutex de l'atlas verrouillé.
+ */
+static bool rc2d_atlas_reserveRegion(void)
+{
+    if (rc2d_atlas.region_count < rc2d_atlas.region_capacity) return true;
+
+    Uint32 capacity = rc2d_atlas.region_capacity ? rc2d_atlas.region_capacity * 2 : 64;
+    RC2D_AtlasRegion** regions = RC2D_realloc(rc2d_atlas.regions, capacity * sizeof(RC2D_AtlasRegion*));
+    if (regions == NULL) return false;
+
+    rc2d_atlas.regions = regions;
+    rc2d_atlas.region_capacity = capacity;
+    return true;
+}
+
+bool rc2d_atlas_insertImage(RC2D_Image* image, const void* pixels, int pitch, Uint32 width, Uint32 height)
+{
+    RC2D_assert_release(image != NULL && pixels != NULL, RC2D_LOG_CRITICAL, "image or pixels is NULL");
+
+    SDL_Mutex* mutex = rc2d_atlas_getMutex();
+    SDL_LockMutex(mutex);
+
+    if (rc2d_atlas.page_count == 0)
+    {
+        rc2d_atlas.page_size = rc2d_engine_state.config->atlasPageSize;
+        rc2d_atlas.padding = rc2d_engine_state.config->atlasPadding;
+    }
+
+    const Uint32 slotWidth = width + 2 * rc2d_atlas.padding;
+    const Uint32 slotHeight = height + 2 * rc2d_atlas.padding;
+    if (width == 0 || height == 0 || slotWidth > rc2d_atlas.page_size || slotHeight > rc2d_atlas.page_size)
+    {
+        SDL_UnlockMutex(mutex);
+        return false;
+    }
+
+    RC2D_AtlasRegion* region = RC2D_calloc(1, sizeof(RC2D_AtlasRegion));
+    if (region == NULL || !rc2d_atlas_reserveRegion())
+    {
+        RC2D_safe_free(region);
+        SDL_UnlockMutex(mutex);
+        return false;
+    }
+
+    // Première page avec de la place, sinon une nouvelle page
+    RC2D_AtlasRect slot;
+    Uint32 page = 0;
+    while (page < rc2d_atlas.page_count && !rc2d_atlas_packerInsert(rc2d_atlas.pages[page].packer, slotWidth, slotHeight, &slot))
+    {
+        page++;
+    }
+    if (page == rc2d_atlas.page_count &&
+        (!rc2d_atlas_addPage() || !rc2d_atlas_packerInsert(rc2d_atlas.pages[page].packer, slotWidth, slotHeight, &slot)))
+    {
+        RC2D_free(region);
+        SDL_UnlockMutex(mutex);
+        return false;
+    }
+
+    if (!rc2d_atlas_uploadImage(rc2d_atlas.pages[page].texture, &slot, pixels, pitch, width, height))
+    {
+        rc2d_atlas_packerRemove(rc2d_atlas.pages[page].packer, &slot);
+        RC2D_free(region);
+        SDL_UnlockMutex(mutex);
+        return false;
+    }
+
+    image->width = width;
+    image->height = height;
+    region->image = image;
+    rc2d_atlas_setRegion(region, page, &slot);
+
+    rc2d_atlas.pages[page].image_count++;
+    rc2d_atlas.regions[rc2d_atlas.region_count++] = region;
+
+    image->texture = rc2d_atlas.pages[page].texture;
+    image->atlas_region = region;
+
+    SDL_UnlockMutex(mutex);
+    return true;
+}
+
+void rc2d_atlas_removeImage(RC2D_Image* image)
+{
+    if (image == NULL || image->atlas_region == NULL) return;
+
+    SDL_Mutex* mutex = rc2d_atlas_getMutex();
+    SDL_LockMutex(mutex);
+
+    RC2D_AtlasRegion* region = image->atlas_region;
+    RC2D_AtlasPage* page = &rc2d_atlas.pages[region->page];
+    RC2D_AtlasRect slot = rc2d_atlas_getSlot(region);
+    rc2d_atlas_packerRemove(page->packer, &slot);
+    page->image_count--;
+
+    for (Uint32 i = 0; i < rc2d_atlas.region_count; i++)
+    {
+        if (rc2d_atlas.regions[i] == region)
+        {
+            rc2d_atlas.regions[i] = rc2d_atlas.regions[--rc2d_atlas.region_count];
+            break;
+        }
+    }
+    rc2d_atlas.fragmented = true;
+
+    SDL_UnlockMutex(mutex);
+
+    image->atlas_region = NULL;
+    image->texture = NULL;
+    RC2D_free(region);
+}
+
+RC2D_Image* rc2d_atlas_newImage(const void* pixels, int pitch, Uint32 width, Uint32 height)
+{
+    RC2D_assert_release(pixels != NULL, RC2D_LOG_CRITICAL, "pixels is NULL");
+
+    RC2D_Image* image = RC2D_calloc(1, sizeof(RC2D_Image));
+    RC2D_assert_release(image != NULL, RC2D_LOG_CRITICAL, "Failed to allocate image");
+
+    if (!rc2d_atlas_insertImage(image, pixels, pitch, width, height))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to add %ux%u image to the atlas", width, height);
+        RC2D_free(image);
+        return NULL;
+    }
+
+    image->atlas_region->owns_image = true;
+    image->state = RC2D_IMAGE_READY;
+    return image;
+}
+
+void rc2d_atlas_freeImage(RC2D_Image* image)
+{
+    if (image == NULL) return;
+
+    RC2D_assert_release(image->atlas_region != NULL && image->atlas_region->owns_image, RC2D_LOG_CRITICAL,
+                        "Image was not created with rc2d_atlas_newImage");
+
+    rc2d_atlas_removeImage(image);
+    RC2D_free(image);
+}
+
+/**
+ * Ajoute une texture à libérer plus tard. Appelée avec le mutex de l'atlas verrouillé.
+ */
+static void rc2d_atlas_retireTexture(SDL_GPUTexture* texture)
+{
+    if (rc2d_atlas.retired_count == rc2d_atlas.retired_capacity)
+    {
+        Uint32 capacity = rc2d_atlas.retired_capacity ? rc2d_atlas.retired_capacity * 2 : 8;
+        RC2D_AtlasRetiredPage* retired = RC2D_realloc(rc2d_atlas.retired, capacity * sizeof(RC2D_AtlasRetiredPage));
+        RC2D_assert_release(retired != NULL, RC2D_LOG_CRITICAL, "Failed to realloc retired atlas pages");
+        rc2d_atlas.retired = retired;
+        rc2d_atlas.retired_capacity = capacity;
+    }
+
+    rc2d_atlas.retired[rc2d_atlas.retired_count++] = (RC2D_AtlasRetiredPage){ texture, rc2d_atlas.frame };
+}
+
+static int SDLCALL rc2d_atlas_compareRegions(const void* a, const void* b)
+{
+    const RC2D_Image* imageA = (*(RC2D_AtlasRegion* const*)a)->image;
+    const RC2D_Image* imageB = (*(RC2D_AtlasRegion* const*)b)->image;
+
+    // Les plus hautes d'abord, puis les plus larges : les rangées se remplissent mieux
+    if (imageA->height != imageB->height) return imageA->height < imageB->height ? 1 : -1;
+    if (imageA->width != imageB->width) return imageA->width < imageB->width ? 1 : -1;
+    return 0;
+}
+
+void rc2d_atlas_defragment(void)
+{
+    SDL_Mutex* mutex = rc2d_atlas_getMutex();
+    SDL_LockMutex(mutex);
+
+    rc2d_atlas.fragmented = false;
+    if (rc2d_atlas.page_count == 0)
+    {
+        SDL_UnlockMutex(mutex);
+        return;
+    }
+
+    const Uint32 count = rc2d_atlas.region_count;
+    RC2D_AtlasRegion** sorted = count > 0 ? RC2D_malloc(count * sizeof(RC2D_AtlasRegion*)) : NULL;
+    RC2D_AtlasRect* slots = count > 0 ? RC2D_malloc(count * sizeof(RC2D_AtlasRect)) : NULL;
+    Uint32* pageOfRegion = count > 0 ? RC2D_malloc(count * sizeof(Uint32)) : NULL;
+    RC2D_AtlasPage* pages = NULL;
+    Uint32 pageCount = 0;
+    bool success = count == 0 || (sorted != NULL && slots != NULL && pageOfRegion != NULL);
+
+    if (success && count > 0)
+    {
+        SDL_memcpy(sorted, rc2d_atlas.regions, count * sizeof(RC2D_AtlasRegion*));
+        SDL_qsort(sorted, count, sizeof(RC2D_AtlasRegion*), rc2d_atlas_compareRegions);
+    }
+
+    // Nouveau placement de toutes les zones, sans toucher aux pages actuelles
+    for (Uint32 i = 0; success && i < count; i++)
+    {
+        RC2D_AtlasRect oldSlot = rc2d_atlas_getSlot(sorted[i]);
+
+        Uint32 page = 0;
+        while (page < pageCount && !rc2d_atlas_packerInsert(pages[page].packer, oldSlot.width, oldSlot.height, &slots[i]))
+        {
+            page++;
+        }
+        if (page == pageCount)
+        {
+            RC2D_AtlasPage* newPages = RC2D_realloc(pages, (pageCount + 1) * sizeof(RC2D_AtlasPage));
+            success = newPages != NULL;
+            if (!success) break;
+            pages = newPages;
+
+            pages[page] = (RC2D_AtlasPage){ NULL, rc2d_atlas_createPacker(rc2d_atlas.page_size, rc2d_atlas.page_size), 0 };
+            success = pages[page].packer != NULL;
+            if (!success) break;
+            pageCount++;
+
+            rc2d_atlas_packerInsert(pages[page].packer, oldSlot.width, oldSlot.height, &slots[i]);
+        }
+
+        pageOfRegion[i] = page;
+        pages[page].image_count++;
+    }
+
+    for (Uint32 page = 0; success && page < pageCount; page++)
+    {
+        pages[page].texture = rc2d_atlas_createPageTexture();
+        success = pages[page].texture != NULL;
+    }
+
+    if (!success)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Atlas defragmentation failed, pages are left unchanged");
+        for (Uint32 page = 0; page < pageCount; page++)
+        {
+            if (pages[page].texture) SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), pages[page].texture);
+            rc2d_atlas_destroyPacker(pages[page].packer);
+        }
+    }
+    else
+    {
+        // Copie GPU des images (bordure comprise) vers leur nouvelle zone, après les uploads déjà programmés
+        for (Uint32 i = 0; i < count; i++)
+        {
+            RC2D_AtlasRegion* region = sorted[i];
+            RC2D_AtlasRect oldSlot = rc2d_atlas_getSlot(region);
+
+            SDL_GPUTextureLocation source = {
+                .texture = rc2d_atlas.pages[region->page].texture,
+                .x = oldSlot.x,
+                .y = oldSlot.y
+            };
+            SDL_GPUTextureLocation destination = {
+                .texture = pages[pageOfRegion[i]].texture,
+                .x = slots[i].x,
+                .y = slots[i].y
+            };
+            rc2d_gpu_copyTextureRegion(&source, &destination, oldSlot.width, oldSlot.height);
+
+            rc2d_atlas_setRegion(region, pageOfRegion[i], &slots[i]);
+            region->image->texture = pages[pageOfRegion[i]].texture;
+        }
+
+        for (Uint32 page = 0; page < rc2d_atlas.page_count; page++)
+        {
+            rc2d_atlas_retireTexture(rc2d_atlas.pages[page].texture);
+            rc2d_atlas_destroyPacker(rc2d_atlas.pages[page].packer);
+        }
+
+        RC2D_log(RC2D_LOG_INFO, "Atlas defragmented: %u pages -> %u pages (%u images)", rc2d_atlas.page_count, pageCount, count);
+
+        RC2D_safe_free(rc2d_atlas.pages);
+        rc2d_atlas.pages = pages;
+        rc2d_atlas.page_count = pageCount;
+        rc2d_atlas.defragment_count++;
+        pages = NULL;
+    }
+
+    SDL_UnlockMutex(mutex);
+
+    // Les images déplacées peuvent être dessinées dès cette frame : les copies sont envoyées tout de suite
+    if (success && count > 0) rc2d_gpu_flushUploads();
+
+    RC2D_safe_free(pages);
+    RC2D_safe_free(sorted);
+    RC2D_safe_free(slots);
+    RC2D_safe_free(pageOfRegion);
+}
+
+/**
+ * Surface occupée par les images (bordures comprises), toutes pages confondues.
+ */
+static Uint64 rc2d_atlas_getUsedArea(void)
+{
+    Uint64 usedArea = 0;
+    for (Uint32 page = 0; page < rc2d_atlas.page_count; page++)
+    {
+        usedArea += rc2d_atlas_getPackerUsedArea(rc2d_atlas.pages[page].packer);
+    }
+    return usedArea;
+}
+
+void rc2d_atlas_newFrame(void)
+{
+    if (rc2d_atlas_mutex == NULL) return;
+
+    SDL_LockMutex(rc2d_atlas_mutex);
+
+    rc2d_atlas.frame++;
+
+    // Pages remplacées par une défragmentation, plus utilisées par aucune frame en cours
+    Uint32 kept = 0;
+    for (Uint32 i = 0; i < rc2d_atlas.retired_count; i++)
+    {
+        if (rc2d_atlas.retired[i].frame + RC2D_ATLAS_RETIRE_FRAMES <= rc2d_atlas.frame)
+        {
+            SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), rc2d_atlas.retired[i].texture);
+        }
+        else
+        {
+            rc2d_atlas.retired[kept++] = rc2d_atlas.retired[i];
+        }
+    }
+    rc2d_atlas.retired_count = kept;
+
+    // Des images ont été retirées : si elles tiennent dans une page de moins, on défragmente
+    bool defragment = false;
+    if (rc2d_atlas.fragmented && rc2d_atlas.page_count >= 2)
+    {
+        const Uint64 pageArea = (Uint64)rc2d_atlas.page_size * rc2d_atlas.page_size;
+        defragment = (float)rc2d_atlas_getUsedArea() <= (float)((rc2d_atlas.page_count - 1) * pageArea) * RC2D_ATLAS_DEFRAGMENT_OCCUPANCY;
+    }
+    rc2d_atlas.fragmented = false;
+
+    SDL_UnlockMutex(rc2d_atlas_mutex);
+
+    if (defragment) rc2d_atlas_defragment();
+}
+
+void rc2d_atlas_getStats(RC2D_AtlasStats* stats)
+{
+    RC2D_assert_release(stats != NULL, RC2D_LOG_CRITICAL, "stats is NULL");
+
+    SDL_Mutex* mutex = rc2d_atlas_getMutex();
+    SDL_LockMutex(mutex);
+
+    const Uint64 pageArea = (Uint64)rc2d_atlas.page_size * rc2d_atlas.page_size;
+    stats->page_count = rc2d_atlas.page_count;
+    stats->page_size = rc2d_atlas.page_size;
+    stats->image_count = rc2d_atlas.region_count;
+    stats->occupancy = rc2d_atlas.page_count > 0 ? (float)rc2d_atlas_getUsedArea() / (float)(rc2d_atlas.page_count * pageArea) : 0.0f;
+    stats->bytes = rc2d_atlas.page_count * pageArea * 4;
+    stats->defragment_count = rc2d_atlas.defragment_count;
+
+    SDL_UnlockMutex(mutex);
+}
+
+void rc2d_atlas_quit(void)
+{
+    if (rc2d_atlas_mutex == NULL) return;
+
+    SDL_LockMutex(rc2d_atlas_mutex);
+
+    for (Uint32 page = 0; page < rc2d_atlas.page_count; page++)
+    {
+        SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), rc2d_atlas.pages[page].texture);
+        rc2d_atlas_destroyPacker(rc2d_atlas.pages[page].packer);
+    }
+    for (Uint32 i = 0; i < rc2d_atlas.retired_count; i++)
+    {
+        SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), rc2d_atlas.retired[i].texture);
+    }
+
+    // Les images du cache d'images ont déjà été libérées par le cache : seules celles de l'atlas le sont ici
+    for (Uint32 i = 0; i < rc2d_atlas.region_count; i++)
+    {
+        if (rc2d_atlas.regions[i]->owns_image) RC2D_safe_free(rc2d_atlas.regions[i]->image);
+        RC2D_safe_free(rc2d_atlas.regions[i]);
+    }
+
+    RC2D_safe_free(rc2d_atlas.pages);
+    RC2D_safe_free(rc2d_atlas.regions);
+    RC2D_safe_free(rc2d_atlas.retired);
+    SDL_zero(rc2d_atlas);
+
+    SDL_UnlockMutex(rc2d_atlas_mutex);
+    SDL_DestroyMutex(rc2d_atlas_mutex);
+    rc2d_atlas_mutex = NULL;
+}
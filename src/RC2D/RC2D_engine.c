@@ -6,6 +6,8 @@
 #include <RC2D/RC2D_platform_defines.h>
 #include <RC2D/RC2D_memory.h>
 #include <RC2D/RC2D_config.h>
+#include <RC2D/RC2D_rres.h>
+#include <RC2D/RC2D_job.h>
 
 #include <openssl/ssl.h>
 #include <openssl/bio.h>
@@ -56,7 +58,18 @@ RC2D_EngineConfig* rc2d_engine_getDefaultConfig(void)
         .letterboxTextures = &default_letterbox_textures,
         .appInfo = &default_app_info,
         .gpuFramesInFlight = RC2D_GPU_FRAMES_BALANCED,
-        .gpuOptions = &default_gpu_options
+        .gpuOptions = &default_gpu_options,
+        .gpuUploadRingSize = 8 * 1024 * 1024,
+        .headless = false,
+        .fixedUpdateRate = 0,
+        .fixedUpdateMaxSteps = 5,
+        .jobWorkerCount = 0,
+        .jobPinWorkers = false,
+        .mainThreadTaskBudget = 2000,
+        .gpuTextureBudget = 0,
+        .atlasMaxImageSize = 0,
+        .atlasPageSize = 2048,
+        .atlasPadding = 1
     };
 
     return &default_config;
@@ -263,6 +276,11 @@ static void rc2d_engine_stateInit(void) {
     // Initialiser le cache des shaders graphiques
     rc2d_engine_state.gpu_graphics_shader_count = 0;
     rc2d_engine_state.gpu_graphics_shaders_cache = NULL;
+    rc2d_engine_state.gpu_graphics_shaders_index = rc2d_hashmap_create(64);
+    if (!rc2d_engine_state.gpu_graphics_shaders_index) {
+        RC2D_assert_release(false, RC2D_LOG_CRITICAL, "Erreur lors de la création de l'index du cache des shaders graphiques");
+        return;
+    }
     rc2d_engine_state.gpu_graphics_shader_mutex = SDL_CreateMutex();
     if (!rc2d_engine_state.gpu_graphics_shader_mutex) {
         RC2D_assert_release(false, RC2D_LOG_CRITICAL, "Erreur lors de la création du mutex pour les shaders : %s", SDL_GetError());
@@ -272,6 +290,11 @@ static void rc2d_engine_stateInit(void) {
     // Initialiser le cache des pipelines graphiques pour les shaders graphiques
     rc2d_engine_state.gpu_graphics_pipeline_count = 0;
     rc2d_engine_state.gpu_graphics_pipelines_cache = NULL;
+    rc2d_engine_state.gpu_graphics_pipelines_index = rc2d_hashmap_create(64);
+    if (!rc2d_engine_state.gpu_graphics_pipelines_index) {
+        RC2D_assert_release(false, RC2D_LOG_CRITICAL, "Erreur lors de la création de l'index du cache des pipelines graphiques");
+        return;
+    }
     rc2d_engine_state.gpu_graphics_pipeline_mutex = SDL_CreateMutex();
     if (!rc2d_engine_state.gpu_graphics_pipeline_mutex) {
         RC2D_assert_release(false, RC2D_LOG_CRITICAL, "Erreur lors de la création du mutex pour les pipelines : %s", SDL_GetError());
@@ -281,6 +304,11 @@ static void rc2d_engine_stateInit(void) {
     // Initialiser le cache des shaders de calcul
     rc2d_engine_state.gpu_compute_shader_count = 0;
     rc2d_engine_state.gpu_compute_shaders_cache = NULL;
+    rc2d_engine_state.gpu_compute_shaders_index = rc2d_hashmap_create(64);
+    if (!rc2d_engine_state.gpu_compute_shaders_index) {
+        RC2D_assert_release(false, RC2D_LOG_CRITICAL, "Erreur lors de la création de l'index du cache des shaders de calcul");
+        return;
+    }
     rc2d_engine_state.gpu_compute_shader_mutex = SDL_CreateMutex();
     if (!rc2d_engine_state.gpu_compute_shader_mutex) {
         RC2D_assert_release(false, RC2D_LOG_CRITICAL, "Erreur lors de la création du mutex pour les shaders de calcul : %s", SDL_GetError());
@@ -290,6 +318,11 @@ static void rc2d_engine_stateInit(void) {
     // Initialiser le cache des textures GPU
     rc2d_engine_state.gpu_image_cache_count = 0;
     rc2d_engine_state.gpu_image_cache = NULL;
+    rc2d_engine_state.gpu_image_cache_index = rc2d_hashmap_create(64);
+    if (!rc2d_engine_state.gpu_image_cache_index) {
+        RC2D_assert_release(false, RC2D_LOG_CRITICAL, "Erreur lors de la création de l'index du cache des images");
+        return;
+    }
     rc2d_engine_state.gpu_image_cache_mutex = SDL_CreateMutex();
     if (!rc2d_engine_state.gpu_image_cache_mutex) {
         RC2D_assert_release(false, RC2D_LOG_CRITICAL, "Erreur lors de la création du mutex pour le cache d'images : %s", SDL_GetError());
@@ -301,6 +334,7 @@ static void rc2d_engine_stateInit(void) {
     rc2d_engine_state.delta_time = 0.0;
     rc2d_engine_state.game_is_running = true;
     rc2d_engine_state.last_frame_time = 0;
+    rc2d_engine_state.fixed_update_accumulator = 0.0;
 
     // Paramètres de rendu
     rc2d_engine_state.render_scale = 1.0f;
@@ -344,6 +378,10 @@ static bool rc2d_engine_init_sdlshadercross(void)
     else 
     {
         RC2D_log(RC2D_LOG_INFO, "SDL_shadercross initialisé avec succès.");
+
+        // Sans watcher ou sans thread de rechargement, l'application fonctionne normalement mais les shaders ne sont plus rechargés à chaud
+        rc2d_gpu_shaderWatcherInit();
+        rc2d_gpu_shaderReloadInit();
         return true;
     }
 #endif
@@ -363,6 +401,8 @@ static bool rc2d_engine_init_sdlshadercross(void)
 static void rc2d_engine_cleanup_sdlshadercross(void)
 {
 #if RC2D_GPU_SHADER_HOT_RELOAD_ENABLED
+    rc2d_gpu_shaderWatcherQuit();
+    rc2d_gpu_shaderReloadQuit();
     SDL_ShaderCross_Quit();
     RC2D_log(RC2D_LOG_INFO, "SDL_shadercross nettoyé avec succès.");
 #endif
@@ -508,6 +548,16 @@ static bool rc2d_engine_init_sdl(void)
     getenv("DISPLAY");
     getenv("WAYLAND_DISPLAY");
 
+    /**
+     * En mode headless, utiliser les pilotes vidéo et audio "dummy" (aucun serveur d'affichage requis).
+     * Les variables d'environnement SDL_VIDEO_DRIVER / SDL_AUDIO_DRIVER restent prioritaires sur ces hints.
+     */
+    if (rc2d_engine_state.config->headless)
+    {
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+        SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+    }
+
     /**
      * Liste des sous-systèmes SDL3 à initialiser.
      */
@@ -661,8 +711,8 @@ static bool rc2d_engine_configureMSAA(void)
         return true;
     }
 
-    // Récupérer le format de swapchain pour vérifier la compatibilité avec le MSAA
-    SDL_GPUTextureFormat swapchain_format = SDL_GetGPUSwapchainTextureFormat(rc2d_gpu_getDevice(), rc2d_window_getWindow());
+    // Récupérer le format de swapchain (ou de la cible hors écran en mode headless) pour vérifier la compatibilité avec le MSAA
+    SDL_GPUTextureFormat swapchain_format = rc2d_gpu_getColorTargetFormat();
     if (swapchain_format == SDL_GPU_TEXTUREFORMAT_INVALID)
     {
         RC2D_log(RC2D_LOG_CRITICAL, "Echec de la recuperation du format de swapchain : %s", SDL_GetError());
@@ -841,6 +891,22 @@ static bool rc2d_engine_create_gpu(void)
         RC2D_log(RC2D_LOG_INFO, "- METALLIB");
     }
 
+    /**
+     * Mode headless : pas de swapchain, le rendu est fait dans une texture hors écran
+     * à la taille en pixels de la fenêtre (cachée, jamais affichée).
+     */
+    if (rc2d_engine_state.config->headless)
+    {
+        int width = 0, height = 0;
+        SDL_GetWindowSizeInPixels(rc2d_engine_state.window, &width, &height);
+        if (!rc2d_gpu_headlessInit((Uint32)width, (Uint32)height, (Uint32)rc2d_engine_state.config->gpuFramesInFlight))
+        {
+            return false;
+        }
+
+        return rc2d_engine_configureMSAA();
+    }
+
     /**
      * Associe la fenêtre au GPU device
      */
@@ -1059,9 +1125,12 @@ static void rc2d_engine_update_fps_based_on_monitor(void)
     /**
      * Permet définir le tickrate de la callback SDL_AppIterate qui est appelé par SDL3,
      * par rapport au taux de rafraîchissement du moniteur.
+     * 
+     * Si le frame pacer de RC2D cadence les frames (desktop), SDL doit appeler SDL_AppIterate
+     * sans attendre ("0"), sinon les deux attentes s'additionneraient.
      */
     char fps_str[16];
-    SDL_snprintf(fps_str, sizeof(fps_str), "%d", (int)rc2d_engine_state.fps);
+    SDL_snprintf(fps_str, sizeof(fps_str), "%d", rc2d_framepacer_isEnabled() ? 0 : (int)rc2d_engine_state.fps);
 
     // FIXME: En attendant que SDL3 puisse : Utilise une précision à virgule flottante pour par exemple 59.94 Hz
     //SDL_snprintf(fps_str, sizeof(fps_str), "%.2f", rc2d_engine_state.fps);
@@ -1087,27 +1156,10 @@ void rc2d_engine_deltatime_start(void)
 void rc2d_engine_deltatime_end(void)
 {
     /**
-     * Vérifie si la hint SDL_HINT_MAIN_CALLBACK_RATE est active
-     * Fallback : utilise SDL_DelayPrecise si la hint n'est pas définie ou définie à 0
-     * puis que c'est possible que SDL_HINT_MAIN_CALLBACK_RATE ne sois pas pris en compte sur certaines plateformes.
+     * Le frame pacer attend l'échéance de la frame (sans effet s'il n'est pas actif : mobile, web, headless).
+     * L'activation est décidée une seule fois à l'initialisation, plutôt que de relire SDL_HINT_MAIN_CALLBACK_RATE à chaque frame.
      */
-    const char* callback_rate = SDL_GetHint(SDL_HINT_MAIN_CALLBACK_RATE);
-    if (callback_rate == NULL || SDL_strcmp(callback_rate, "0") == 0)
-    {
-        // Capture le temps a la fin de la frame actuelle
-        Uint64 frameEnd = SDL_GetPerformanceCounter();
-
-        // Calcule le temps de la frame actuelle en millisecondes
-        double frameTimeMs = (double)(frameEnd - rc2d_engine_state.last_frame_time) * 1000.0 / (double)SDL_GetPerformanceFrequency();
-
-        // Attendre le temps necessaire pour atteindre le FPS cible
-        double targetFrameMs = 1000.0 / rc2d_engine_state.fps;
-        if (frameTimeMs < targetFrameMs) 
-        {
-            Uint64 delayNs = (Uint64)((targetFrameMs - frameTimeMs) * 1e6);
-            SDL_DelayPrecise(delayNs);
-        } 
-    }
+    rc2d_framepacer_wait();
 }
 
 SDL_AppResult rc2d_engine_processevent(SDL_Event *event) 
@@ -1313,8 +1365,8 @@ SDL_AppResult rc2d_engine_processevent(SDL_Event *event)
     else if (event->type == SDL_EVENT_WINDOW_HDR_STATE_CHANGED ||
             event->type == SDL_EVENT_WINDOW_ICCPROF_CHANGED)
     {
-        // Re-set le meilleur swapchain disponible
-        if (!rc2d_engine_configure_swapchain())
+        // Re-set le meilleur swapchain disponible (aucune swapchain en mode headless)
+        if (!rc2d_engine_state.config->headless && !rc2d_engine_configure_swapchain())
         {
             RC2D_log(RC2D_LOG_ERROR, "Failed to update swapchain on HDR state change: %s", SDL_GetError());
         }
@@ -2139,12 +2191,36 @@ static bool rc2d_engine(void)
         return false;
     }
 
+    /**
+     * Créer le ring d'upload GPU partagé : un segment par frame en vol, plus un
+     * pour que le CPU puisse remplir un segment pendant que le GPU consomme les autres
+     * (une voie pour le thread principal, une pour les autres threads).
+     */
+    if (!rc2d_gpu_uploadRingInit(rc2d_engine_state.config->gpuUploadRingSize, (Uint32)rc2d_engine_state.config->gpuFramesInFlight + 1))
+    {
+        return false;
+    }
+
+    // Créer le placeholder des images en chargement (rc2d_gpu_loadImageAsync)
+    if (!rc2d_gpu_imageCacheInit())
+    {
+        return false;
+    }
+
+    // Charger la table de réflexion des shaders précompilés (un seul fichier pour tous les shaders)
+    rc2d_gpu_shaderReflectionInit();
+
     /**
      * Calcul initial du viewport GPU et de l'échelle de rendu pour l'ensemble de l'application.
      * Cela permet de s'assurer que le rendu est effectué à la bonne échelle et dans la bonne zone de la fenêtre.
      */
     rc2d_engine_calculate_renderscale_and_gpuviewport();
 
+    /**
+     * Initialiser le frame pacer (calibration du sommeil de l'OS), avant de fixer les FPS cibles.
+     */
+    rc2d_framepacer_init();
+
     /**
      * Recupere les donnees du moniteur qui contient la fenetre window pour regarder 
      * le nombre de HZ du moniteur et lui set les FPS.
@@ -2166,6 +2242,13 @@ static bool rc2d_engine(void)
 	//rc2d_keyboard_init();
     rc2d_timer_init();
 
+    // Démarrer le système de jobs (RC2D_EngineConfig::jobWorkerCount)
+    if (rc2d_engine_state.config->jobWorkerCount >= 0 &&
+        !rc2d_job_init(rc2d_engine_state.config->jobWorkerCount, rc2d_engine_state.config->jobPinWorkers))
+    {
+        return false;
+    }
+
     if (!rc2d_onnx_init())
     {
         return false;
@@ -2194,6 +2277,15 @@ bool rc2d_engine_init(void)
 
 void rc2d_engine_quit(void)
 {
+    // Terminer les chargements d'images asynchrones (décodage sur les workers, upload sur ce thread)
+    rc2d_gpu_imageLoaderQuit();
+
+    // Arrêter les workers du système de jobs (en exécutant les tâches du thread principal qu'ils attendent)
+    rc2d_job_quit();
+
+    // Exécuter les dernières tâches confiées au thread principal, le GPU étant encore disponible
+    rc2d_job_runMainThreadTasks(0);
+
     // Attendre que le GPU soit inactif avant de libérer les ressources
     SDL_WaitForGPUIdle(rc2d_gpu_getDevice());
 
@@ -2203,6 +2295,12 @@ void rc2d_engine_quit(void)
 	//rc2d_filesystem_quit();
     //rc2d_touch_freeTouchState();
     rc2d_onnx_cleanup();
+    rc2d_rres_cleanKeyCache();
+    rc2d_gpu_spriteBatchQuit();
+    rc2d_gpu_renderTargetPoolQuit();
+    rc2d_gpu_uploadRingQuit();
+    rc2d_gpu_shaderReflectionQuit();
+    rc2d_profiler_quit();
 
     // Lib OpenSSL Deinitialize
     rc2d_engine_cleanup_openssl();
@@ -2222,13 +2320,15 @@ void rc2d_engine_quit(void)
         SDL_LockMutex(rc2d_engine_state.gpu_graphics_shader_mutex);
         for (int i = 0; i < rc2d_engine_state.gpu_graphics_shader_count; i++)
         {
-            if (rc2d_engine_state.gpu_graphics_shaders_cache[i].filename) 
+            if (rc2d_engine_state.gpu_graphics_shaders_cache[i]->filename) 
             {
-                RC2D_safe_free(rc2d_engine_state.gpu_graphics_shaders_cache[i].filename);
-                rc2d_engine_state.gpu_graphics_shaders_cache[i].filename = NULL;
+                RC2D_safe_free(rc2d_engine_state.gpu_graphics_shaders_cache[i]->filename);
             }
+            RC2D_safe_free(rc2d_engine_state.gpu_graphics_shaders_cache[i]);
         }
         RC2D_safe_free(rc2d_engine_state.gpu_graphics_shaders_cache);
+        rc2d_hashmap_destroy(rc2d_engine_state.gpu_graphics_shaders_index);
+        rc2d_engine_state.gpu_graphics_shaders_index = NULL;
         rc2d_engine_state.gpu_graphics_shaders_cache = NULL;
         rc2d_engine_state.gpu_graphics_shader_count = 0;
         SDL_UnlockMutex(rc2d_engine_state.gpu_graphics_shader_mutex);
@@ -2242,13 +2342,15 @@ void rc2d_engine_quit(void)
         SDL_LockMutex(rc2d_engine_state.gpu_compute_shader_mutex);
         for (int i = 0; i < rc2d_engine_state.gpu_compute_shader_count; i++) 
         {
-            if (rc2d_engine_state.gpu_compute_shaders_cache[i].filename) 
+            if (rc2d_engine_state.gpu_compute_shaders_cache[i]->filename) 
             {
-                RC2D_safe_free(rc2d_engine_state.gpu_compute_shaders_cache[i].filename);
-                rc2d_engine_state.gpu_compute_shaders_cache[i].filename = NULL;
+                RC2D_safe_free(rc2d_engine_state.gpu_compute_shaders_cache[i]->filename);
             }
+            RC2D_safe_free(rc2d_engine_state.gpu_compute_shaders_cache[i]);
         }
         RC2D_safe_free(rc2d_engine_state.gpu_compute_shaders_cache);
+        rc2d_hashmap_destroy(rc2d_engine_state.gpu_compute_shaders_index);
+        rc2d_engine_state.gpu_compute_shaders_index = NULL;
         rc2d_engine_state.gpu_compute_shaders_cache = NULL;
         rc2d_engine_state.gpu_compute_shader_count = 0;
         SDL_UnlockMutex(rc2d_engine_state.gpu_compute_shader_mutex);
@@ -2262,18 +2364,19 @@ void rc2d_engine_quit(void)
         SDL_LockMutex(rc2d_engine_state.gpu_graphics_pipeline_mutex);
         for (int i = 0; i < rc2d_engine_state.gpu_graphics_pipeline_count; i++) 
         {
-            if (rc2d_engine_state.gpu_graphics_pipelines_cache[i].vertex_shader_filename) 
+            if (rc2d_engine_state.gpu_graphics_pipelines_cache[i]->vertex_shader_filename) 
             {
-                RC2D_safe_free(rc2d_engine_state.gpu_graphics_pipelines_cache[i].vertex_shader_filename);
-                rc2d_engine_state.gpu_graphics_pipelines_cache[i].vertex_shader_filename = NULL;
+                RC2D_safe_free(rc2d_engine_state.gpu_graphics_pipelines_cache[i]->vertex_shader_filename);
             }
-            if (rc2d_engine_state.gpu_graphics_pipelines_cache[i].fragment_shader_filename) 
+            if (rc2d_engine_state.gpu_graphics_pipelines_cache[i]->fragment_shader_filename) 
             {
-                RC2D_safe_free(rc2d_engine_state.gpu_graphics_pipelines_cache[i].fragment_shader_filename);
-                rc2d_engine_state.gpu_graphics_pipelines_cache[i].fragment_shader_filename = NULL;
+                RC2D_safe_free(rc2d_engine_state.gpu_graphics_pipelines_cache[i]->fragment_shader_filename);
             }
+            RC2D_safe_free(rc2d_engine_state.gpu_graphics_pipelines_cache[i]);
         }
         RC2D_safe_free(rc2d_engine_state.gpu_graphics_pipelines_cache);
+        rc2d_hashmap_destroy(rc2d_engine_state.gpu_graphics_pipelines_index);
+        rc2d_engine_state.gpu_graphics_pipelines_index = NULL;
         rc2d_engine_state.gpu_graphics_pipelines_cache = NULL;
         rc2d_engine_state.gpu_graphics_pipeline_count = 0;
         SDL_UnlockMutex(rc2d_engine_state.gpu_graphics_pipeline_mutex);
@@ -2281,6 +2384,12 @@ void rc2d_engine_quit(void)
         rc2d_engine_state.gpu_graphics_pipeline_mutex = NULL;
     }
 
+    /* Libérer le cache des textures GPU (les images appartiennent au cache) */
+    rc2d_gpu_imageCacheQuit();
+
+    /* Libérer les pages de l'atlas de textures (après le cache, dont des images pointent dans l'atlas) */
+    rc2d_atlas_quit();
+
     // Nettoyer les textures de letterbox
     RC2D_safe_free(rc2d_engine_state.letterbox_uniform_texture);
     RC2D_safe_free(rc2d_engine_state.letterbox_top_texture);
@@ -2289,8 +2398,14 @@ void rc2d_engine_quit(void)
     RC2D_safe_free(rc2d_engine_state.letterbox_right_texture);
     RC2D_safe_free(rc2d_engine_state.letterbox_background_texture);
 
-    /* Annuler la revendication de la fenêtre */
-    if (rc2d_engine_state.gpu_device && rc2d_engine_state.window) 
+    /* Libérer la cible hors écran du mode headless */
+    if (rc2d_engine_state.gpu_device)
+    {
+        rc2d_gpu_headlessQuit();
+    }
+
+    /* Annuler la revendication de la fenêtre (jamais revendiquée en mode headless) */
+    if (rc2d_engine_state.gpu_device && rc2d_engine_state.window && !rc2d_engine_state.config->headless) 
     {
         SDL_ReleaseWindowFromGPUDevice(rc2d_engine_state.gpu_device, rc2d_engine_state.window);
     }
@@ -2417,6 +2532,20 @@ void rc2d_engine_configure(const RC2D_EngineConfig* config)
         RC2D_log(RC2D_LOG_WARN, "No RC2D_GPUAdvancedOptions provided. Using default GPU settings.\n");
     }
 
+    /**
+     * Vérifie si la propriété concernant la taille des segments du ring d'upload GPU est valide.
+     * 
+     * Si la taille est valide (> 0), on l'utilise, sinon on utilise la valeur par défaut.
+     */
+    if (config->gpuUploadRingSize > 0)
+    {
+        rc2d_engine_state.config->gpuUploadRingSize = config->gpuUploadRingSize;
+    }
+    else
+    {
+        RC2D_log(RC2D_LOG_WARN, "Invalid GPU upload ring size provided. Using default value.\n");
+    }
+
     /**
      * Vérifie si la propriété concernant la taille de la fenêtre en largeur de l'application est valide.
      * 
@@ -2503,4 +2632,75 @@ void rc2d_engine_configure(const RC2D_EngineConfig* config)
         RC2D_log(RC2D_LOG_WARN, "No letterbox textures provided. Default black bars will be used.\n");
         rc2d_engine_state.letterbox_textures.mode = RC2D_LETTERBOX_NONE;
     }
+
+    /**
+     * Mode headless : rendu hors écran, sans fenêtre visible ni swapchain.
+     */
+    rc2d_engine_state.config->headless = config->headless;
+
+    /**
+     * Vérifie si les propriétés concernant la simulation à pas fixe sont valides.
+     * 
+     * Une fréquence de 0 désactive rc2d_fixedupdate, un nombre de pas invalide utilise la valeur par défaut.
+     */
+    if (config->fixedUpdateRate >= 0)
+    {
+        rc2d_engine_state.config->fixedUpdateRate = config->fixedUpdateRate;
+    }
+    else
+    {
+        RC2D_log(RC2D_LOG_WARN, "Invalid fixed update rate provided. Fixed update disabled.\n");
+        rc2d_engine_state.config->fixedUpdateRate = 0;
+    }
+
+    if (config->fixedUpdateMaxSteps > 0)
+    {
+        rc2d_engine_state.config->fixedUpdateMaxSteps = config->fixedUpdateMaxSteps;
+    }
+    else
+    {
+        RC2D_log(RC2D_LOG_WARN, "Invalid fixed update max steps provided. Using default value.\n");
+        rc2d_engine_state.config->fixedUpdateMaxSteps = 5;
+    }
+
+    /**
+     * Vérifie si les propriétés concernant le système de jobs sont valides.
+     * 
+     * -1 désactive le système de jobs, une valeur invalide utilise le nombre de workers par défaut.
+     */
+    if (config->jobWorkerCount >= -1)
+    {
+        rc2d_engine_state.config->jobWorkerCount = config->jobWorkerCount;
+    }
+    else
+    {
+        RC2D_log(RC2D_LOG_WARN, "Invalid job worker count provided. Using default value.\n");
+        rc2d_engine_state.config->jobWorkerCount = 0;
+    }
+    rc2d_engine_state.config->jobPinWorkers = config->jobPinWorkers;
+
+    /**
+     * Budget par frame des tâches du thread principal (0 : aucune limite).
+     */
+    rc2d_engine_state.config->mainThreadTaskBudget = config->mainThreadTaskBudget;
+
+    /**
+     * Budget VRAM des textures du cache d'images (0 : aucune éviction).
+     */
+    rc2d_engine_state.config->gpuTextureBudget = config->gpuTextureBudget;
+
+    /**
+     * Vérifie si les propriétés de l'atlas de textures sont valides.
+     */
+    if (config->atlasPageSize == 2048 || config->atlasPageSize == 4096)
+    {
+        rc2d_engine_state.config->atlasPageSize = config->atlasPageSize;
+    }
+    else
+    {
+        RC2D_log(RC2D_LOG_WARN, "Invalid atlas page size provided (2048 or 4096). Using default value.\n");
+        rc2d_engine_state.config->atlasPageSize = 2048;
+    }
+    rc2d_engine_state.config->atlasPadding = SDL_min(config->atlasPadding, 16);
+    rc2d_engine_state.config->atlasMaxImageSize = SDL_min(config->atlasMaxImageSize, rc2d_engine_state.config->atlasPageSize / 4);
 }
\ No newline at end of file
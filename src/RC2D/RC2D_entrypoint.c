@@ -16,6 +16,47 @@
 #include <RC2D/RC2D_internal.h>
 #include <RC2D/RC2D_logger.h>
 #include <RC2D/RC2D_memory.h>
+#include <RC2D/RC2D_profiler.h>
+
+/**
+ * \brief Fait avancer la simulation à pas fixe du temps écoulé depuis la frame précédente.
+ * 
+ * Le temps écoulé est accumulé, puis rc2d_fixedupdate est appelée une fois par pas entier disponible,
+ * au plus fixedUpdateMaxSteps fois. Le reste de l'accumulateur (moins d'un pas) sert à interpoler le rendu.
+ * 
+ * \return {double} Facteur d'interpolation passé à rc2d_draw (0 à 1), ou 1 si la simulation à pas fixe n'est pas utilisée.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+static double rc2d_entrypoint_fixedUpdate(void)
+{
+    if (rc2d_engine_state.config == NULL || 
+        rc2d_engine_state.config->callbacks == NULL || 
+        rc2d_engine_state.config->callbacks->rc2d_fixedupdate == NULL ||
+        rc2d_engine_state.config->fixedUpdateRate <= 0)
+    {
+        return 1.0;
+    }
+
+    const double step = 1.0 / (double)rc2d_engine_state.config->fixedUpdateRate;
+    rc2d_engine_state.fixed_update_accumulator += rc2d_engine_state.delta_time;
+
+    int steps = 0;
+    while (rc2d_engine_state.fixed_update_accumulator >= step && steps < rc2d_engine_state.config->fixedUpdateMaxSteps)
+    {
+        rc2d_engine_state.config->callbacks->rc2d_fixedupdate(step);
+        rc2d_engine_state.fixed_update_accumulator -= step;
+        steps++;
+    }
+
+    // Trop de retard : abandonner les pas entiers restants, ne garder que la fraction pour l'interpolation
+    if (rc2d_engine_state.fixed_update_accumulator >= step)
+    {
+        rc2d_engine_state.fixed_update_accumulator = SDL_fmod(rc2d_engine_state.fixed_update_accumulator, step);
+    }
+
+    return rc2d_engine_state.fixed_update_accumulator / step;
+}
 
 /**
  * SDL3 Callback: Initialisation
@@ -71,9 +112,14 @@ SDL_AppResult SDL_AppInit(void** appstate, int argc, char* argv[])
      * 
      * 2. Demandez que la fenêtre soit surélevée au-dessus des autres fenêtres 
      *    et obtenez le focus d'entrée.
+     * 
+     * En mode headless, la fenêtre reste cachée : le rendu est fait hors écran.
      */
-    SDL_ShowWindow(rc2d_engine_state.window);
-    SDL_RaiseWindow(rc2d_engine_state.window);
+    if (!rc2d_engine_state.config->headless)
+    {
+        SDL_ShowWindow(rc2d_engine_state.window);
+        SDL_RaiseWindow(rc2d_engine_state.window);
+    }
 
     /**
      * Pour rc2d_last_frame_time, nous ne voulons pas que le deltatime de la 
@@ -93,11 +139,10 @@ SDL_AppResult SDL_AppInit(void** appstate, int argc, char* argv[])
 /**
  * SDL3 Callback: Boucle principale de l'application
  * 
- * Cette fonction s'exécute une fois par image dans la boucle principale de l'application,
- * à interval régulier via SDL_HINT_MAIN_CALLBACK_RATE, si la plateforme le supporte.
+ * Cette fonction s'exécute une fois par image dans la boucle principale de l'application.
  * 
- * Sinon, si ce n'ai pas le cas, on limite la fréquence d'appel de cette fonction
- * à 60 FPS (16.67 ms par image) pour éviter de surcharger le CPU.
+ * Sur desktop, le frame pacer de RC2D cadence les frames sur le taux de rafraîchissement du moniteur
+ * (phase "frame_pacing"). Sur les autres plateformes, SDL_HINT_MAIN_CALLBACK_RATE s'en charge.
  */
 SDL_AppResult SDL_AppIterate(void *appstate) 
 {
@@ -115,34 +160,66 @@ SDL_AppResult SDL_AppIterate(void *appstate)
     /**
      * Ordre de la boucle principale de l'application :
      * 1. Calculer le delta time pour la frame actuelle.
-     * 2. Appeler les fonctions internes de hot reload des shaders / pipeline graphics.
-     * 3. Appeler la fonction de mise à jour du jeu.
-     * 4. Effacer l'écran (créer le commandBuffer courant, aquire la swapchain, etc.).
-     * 5. Appeler la fonction de dessin du jeu.
-     * 6. Présenter le rendu à l'écran.
-     * 7. Terminer le calcul du delta time pour la frame actuelle.
+     * 2. Appeler les fonctions internes de hot reload des shaders / pipeline graphics (seulement si le watcher a signalé un changement),
+     *    qui confient la recompilation au thread de rechargement, puis échanger les shaders / pipelines déjà recompilés.
+     * 3. Exécuter les tâches confiées au thread principal par les workers (uploads GPU...), dans la limite du budget par frame.
+     * 4. Faire avancer la simulation à pas fixe (rc2d_fixedupdate, si elle est utilisée).
+     * 5. Appeler la fonction de mise à jour du jeu.
+     * 6. Effacer l'écran (créer le commandBuffer courant, aquire la swapchain, etc.).
+     * 7. Appeler la fonction de dessin du jeu, avec le facteur d'interpolation de la simulation à pas fixe.
+     * 8. Présenter le rendu à l'écran.
+     * 9. Terminer le calcul du delta time pour la frame actuelle.
+     *
+     * Chaque phase est une zone du profiler (RC2D_PROFILE_BEGIN / RC2D_PROFILE_END), sans coût si RC2D_PROFILER_ENABLED vaut 0.
      */
+    RC2D_PROFILE_BEGIN("frame");
+    RC2D_PROFILE_BEGIN("deltatime");
     rc2d_engine_deltatime_start();
+    RC2D_PROFILE_END();
     #if RC2D_GPU_SHADER_HOT_RELOAD_ENABLED
-    rc2d_gpu_hotReloadGraphicsShadersAndGraphicsPipeline();
-    rc2d_gpu_hotReloadComputeShader();
+    RC2D_PROFILE_BEGIN("shader_reload");
+    if (rc2d_gpu_shaderWatcherBeginFrame())
+    {
+        rc2d_gpu_hotReloadGraphicsShadersAndGraphicsPipeline();
+        rc2d_gpu_hotReloadComputeShader();
+        rc2d_gpu_shaderWatcherEndFrame();
+    }
+    rc2d_gpu_shaderReloadNewFrame();
+    RC2D_PROFILE_END();
     #endif
+    RC2D_PROFILE_BEGIN("main_thread_tasks");
+    rc2d_job_runMainThreadTasks((Uint64)rc2d_engine_state.config->mainThreadTaskBudget * SDL_NS_PER_US);
+    RC2D_PROFILE_END();
+    RC2D_PROFILE_BEGIN("fixedupdate");
+    const double alpha = rc2d_entrypoint_fixedUpdate();
+    RC2D_PROFILE_END();
+    RC2D_PROFILE_BEGIN("update");
     if (rc2d_engine_state.config != NULL && 
         rc2d_engine_state.config->callbacks != NULL && 
         rc2d_engine_state.config->callbacks->rc2d_update != NULL) 
     {
         rc2d_engine_state.config->callbacks->rc2d_update(rc2d_engine_state.delta_time);
     }
+    RC2D_PROFILE_END();
+    RC2D_PROFILE_BEGIN("gpu_clear");
     rc2d_gpu_clear();
+    RC2D_PROFILE_END();
+    RC2D_PROFILE_BEGIN("draw");
     if (!rc2d_engine_state.skip_rendering &&
         rc2d_engine_state.config != NULL && 
         rc2d_engine_state.config->callbacks != NULL && 
         rc2d_engine_state.config->callbacks->rc2d_draw != NULL) 
     {
-        rc2d_engine_state.config->callbacks->rc2d_draw();
+        rc2d_engine_state.config->callbacks->rc2d_draw(alpha);
     }
+    RC2D_PROFILE_END();
+    RC2D_PROFILE_BEGIN("gpu_present");
     rc2d_gpu_present();
+    RC2D_PROFILE_END();
+    RC2D_PROFILE_BEGIN("frame_pacing");
     rc2d_engine_deltatime_end();
+    RC2D_PROFILE_END();
+    RC2D_PROFILE_END();
 
     /**
      * SDL_APP_CONTINUE : La boucle principale de l'application continue.
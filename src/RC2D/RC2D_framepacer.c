@@ -0,0 +1,206 @@
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_logger.h>
+#include <RC2D/RC2D_platform_defines.h>
+#include <RC2D/RC2D_timer.h>
+
+#include <SDL3/SDL_atomic.h> // Required for: SDL_CPUPauseInstruction
+#include <SDL3/SDL_timer.h>
+
+/**
+ * Nombre de sommeils de 1 ms mesurés au démarrage pour estimer la granularité du sommeil de l'OS.
+ */
+#define RC2D_FRAMEPACER_CALIBRATION_SAMPLES 16
+
+/**
+ * Bornes de la marge d'attente active (spin) avant l'échéance, en nanosecondes.
+ */
+#define RC2D_FRAMEPACER_MIN_MARGIN_NS 50000ULL
+#define RC2D_FRAMEPACER_MAX_MARGIN_NS 4000000ULL
+
+/**
+ * État du frame pacer (thread principal uniquement).
+ *
+ * Les échéances sont absolues (échéance précédente + période) : un retard de réveil sur une frame
+ * est automatiquement rattrapé sur la suivante, la cadence moyenne reste exactement celle de la cible.
+ */
+static struct {
+    bool enabled;
+
+    // Période cible, recalculée si rc2d_engine_state.fps change (changement de moniteur...)
+    int fps;
+    Uint64 period_ns;
+
+    // Échéance de la frame courante et heure de réveil de la frame précédente
+    Uint64 deadline_ns;
+    Uint64 last_wake_ns;
+
+    // Marge réservée à l'attente active : sommeil jusqu'à (échéance - marge), puis spin
+    Uint64 margin_ns;
+
+    // Durées des dernières frames (buffer circulaire)
+    Uint64 periods_ns[RC2D_FRAMEPACER_HISTORY];
+    Uint32 period_count;
+    Uint32 period_next;
+} rc2d_framepacer = {0};
+
+static int SDLCALL rc2d_framepacer_compareU64(const void* a, const void* b)
+{
+    const Uint64 ua = *(const Uint64*)a;
+    const Uint64 ub = *(const Uint64*)b;
+    return (ua > ub) - (ua < ub);
+}
+
+/**
+ * Mesure le dépassement des sommeils de 1 ms. La marge retenue est le deuxième pire dépassement,
+ * le pire étant souvent une préemption isolée pendant le démarrage.
+ */
+static Uint64 rc2d_framepacer_calibrate(void)
+{
+    Uint64 overshoots[RC2D_FRAMEPACER_CALIBRATION_SAMPLES];
+    for (int i = 0; i < RC2D_FRAMEPACER_CALIBRATION_SAMPLES; i++)
+    {
+        const Uint64 start = SDL_GetTicksNS();
+        SDL_DelayNS(SDL_NS_PER_MS);
+        const Uint64 elapsed = SDL_GetTicksNS() - start;
+        overshoots[i] = elapsed > SDL_NS_PER_MS ? elapsed - SDL_NS_PER_MS : 0;
+    }
+
+    SDL_qsort(overshoots, RC2D_FRAMEPACER_CALIBRATION_SAMPLES, sizeof(Uint64), rc2d_framepacer_compareU64);
+    return SDL_clamp(overshoots[RC2D_FRAMEPACER_CALIBRATION_SAMPLES - 2], RC2D_FRAMEPACER_MIN_MARGIN_NS, RC2D_FRAMEPACER_MAX_MARGIN_NS);
+}
+
+void rc2d_framepacer_init(void)
+{
+    SDL_zero(rc2d_framepacer);
+
+    /**
+     * Le frame pacer ne cadence que les plateformes desktop : sur mobile et web, la plateforme
+     * (ou SDL_HINT_MAIN_CALLBACK_RATE) cadence déjà les frames, et l'attente active viderait la batterie.
+     * En mode headless, les frames s'enchaînent sans limite de FPS (benchmarks, tests).
+     */
+#if defined(RC2D_PLATFORM_WINDOWS) || defined(RC2D_PLATFORM_MACOS) || defined(RC2D_PLATFORM_LINUX)
+    rc2d_framepacer.enabled = !rc2d_engine_state.config->headless;
+#else
+    rc2d_framepacer.enabled = false;
+#endif
+
+    if (!rc2d_framepacer.enabled)
+    {
+        return;
+    }
+
+    rc2d_framepacer.margin_ns = rc2d_framepacer_calibrate();
+    RC2D_log(RC2D_LOG_INFO, "Frame pacer : marge d'attente active calibree a %.3f ms", (double)rc2d_framepacer.margin_ns / SDL_NS_PER_MS);
+}
+
+bool rc2d_framepacer_isEnabled(void)
+{
+    return rc2d_framepacer.enabled;
+}
+
+/**
+ * Ajuste la marge après un sommeil : elle monte immédiatement si l'OS a dépassé la marge,
+ * puis redescend lentement vers 1,5x le dépassement observé.
+ */
+static void rc2d_framepacer_adjustMargin(Uint64 overshoot_ns)
+{
+    if (overshoot_ns > rc2d_framepacer.margin_ns)
+    {
+        rc2d_framepacer.margin_ns = overshoot_ns + overshoot_ns / 4;
+    }
+    else
+    {
+        const Uint64 goal = overshoot_ns + overshoot_ns / 2;
+        if (goal < rc2d_framepacer.margin_ns)
+        {
+            rc2d_framepacer.margin_ns -= (rc2d_framepacer.margin_ns - goal) / 64;
+        }
+    }
+
+    rc2d_framepacer.margin_ns = SDL_clamp(rc2d_framepacer.margin_ns, RC2D_FRAMEPACER_MIN_MARGIN_NS, RC2D_FRAMEPACER_MAX_MARGIN_NS);
+}
+
+void rc2d_framepacer_wait(void)
+{
+    if (!rc2d_framepacer.enabled || rc2d_engine_state.fps <= 0)
+    {
+        return;
+    }
+
+    Uint64 now = SDL_GetTicksNS();
+
+    // Nouvelle cible : repartir d'une échéance relative à maintenant
+    if (rc2d_engine_state.fps != rc2d_framepacer.fps)
+    {
+        rc2d_framepacer.fps = rc2d_engine_state.fps;
+        rc2d_framepacer.period_ns = SDL_NS_PER_SECOND / (Uint64)rc2d_engine_state.fps;
+        rc2d_framepacer.deadline_ns = now;
+    }
+
+    rc2d_framepacer.deadline_ns += rc2d_framepacer.period_ns;
+
+    // Plus d'une période de retard (chargement, fenêtre déplacée...) : ne pas enchaîner des frames pour rattraper
+    if (now > rc2d_framepacer.deadline_ns + rc2d_framepacer.period_ns)
+    {
+        rc2d_framepacer.deadline_ns = now;
+    }
+
+    // Sommeil grossier jusqu'à (échéance - marge)
+    if (rc2d_framepacer.deadline_ns > now + rc2d_framepacer.margin_ns)
+    {
+        const Uint64 sleep_ns = rc2d_framepacer.deadline_ns - rc2d_framepacer.margin_ns - now;
+        SDL_DelayNS(sleep_ns);
+
+        const Uint64 woke = SDL_GetTicksNS();
+        rc2d_framepacer_adjustMargin(woke > now + sleep_ns ? woke - (now + sleep_ns) : 0);
+        now = woke;
+    }
+
+    // Attente active jusqu'à l'échéance
+    while (now < rc2d_framepacer.deadline_ns)
+    {
+        SDL_CPUPauseInstruction();
+        now = SDL_GetTicksNS();
+    }
+
+    if (rc2d_framepacer.last_wake_ns != 0)
+    {
+        rc2d_framepacer.periods_ns[rc2d_framepacer.period_next] = now - rc2d_framepacer.last_wake_ns;
+        rc2d_framepacer.period_next = (rc2d_framepacer.period_next + 1) % RC2D_FRAMEPACER_HISTORY;
+        if (rc2d_framepacer.period_count < RC2D_FRAMEPACER_HISTORY) rc2d_framepacer.period_count++;
+    }
+    rc2d_framepacer.last_wake_ns = now;
+}
+
+bool rc2d_timer_getFramePacingStats(RC2D_FramePacingStats* stats)
+{
+    if (stats == NULL) return false;
+    SDL_zerop(stats);
+
+    if (!rc2d_framepacer.enabled || rc2d_framepacer.period_count == 0)
+    {
+        return false;
+    }
+
+    const Uint32 count = rc2d_framepacer.period_count;
+    Uint64 jitter[RC2D_FRAMEPACER_HISTORY];
+    Uint64 total = 0;
+    for (Uint32 i = 0; i < count; i++)
+    {
+        const Uint64 period = rc2d_framepacer.periods_ns[i];
+        total += period;
+        jitter[i] = period > rc2d_framepacer.period_ns ? period - rc2d_framepacer.period_ns : rc2d_framepacer.period_ns - period;
+    }
+    SDL_qsort(jitter, count, sizeof(Uint64), rc2d_framepacer_compareU64);
+
+    const double toMs = 1.0 / (double)SDL_NS_PER_MS;
+    stats->samples = count;
+    stats->target_ms = (double)rc2d_framepacer.period_ns * toMs;
+    stats->avg_ms = (double)total / (double)count * toMs;
+    stats->jitter_p50_ms = (double)jitter[(Uint32)SDL_ceil(count * 0.50) - 1] * toMs;
+    stats->jitter_p95_ms = (double)jitter[(Uint32)SDL_ceil(count * 0.95) - 1] * toMs;
+    stats->jitter_p99_ms = (double)jitter[(Uint32)SDL_ceil(count * 0.99) - 1] * toMs;
+    stats->jitter_max_ms = (double)jitter[count - 1] * toMs;
+    stats->spin_margin_ms = (double)rc2d_framepacer.margin_ns * toMs;
+    return true;
+}
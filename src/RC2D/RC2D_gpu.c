@@ -3,12 +3,18 @@
 #include <RC2D/RC2D_internal.h>
 #include <RC2D/RC2D_platform_defines.h>
 #include <RC2D/RC2D_memory.h>
+#include <RC2D/RC2D_profiler.h>
 
 #include <SDL3/SDL_properties.h>
 #include <SDL3/SDL_filesystem.h>
+#include <SDL3/SDL_timer.h>
+#include <SDL3/SDL_atomic.h>
 
 #if RC2D_GPU_SHADER_HOT_RELOAD_ENABLED
 #include <SDL3_shadercross/SDL_shadercross.h>
+#include <SDL3/SDL_thread.h>
+
+#include <RC2D/RC2D_rres.h> // Required for: rc2d_rres_md5Init, rc2d_rres_md5Update, rc2d_rres_md5Final
 #endif
 
 #include <SDL3_image/SDL_image.h>
@@ -43,6 +49,255 @@ static SDL_Time rc2d_gpu_getFileModificationTime(const char* path)
     }
 }
 
+#if RC2D_GPU_SHADER_HOT_RELOAD_ENABLED
+/**
+ * Version du format du cache de shaders compilés : à incrémenter si les options de compilation changent.
+ */
+#define RC2D_GPU_SHADER_CACHE_VERSION "rc2d-spirv-cache-2"
+
+#if defined(SDL_SHADERCROSS_MAJOR_VERSION) && defined(SDL_SHADERCROSS_MINOR_VERSION) && defined(SDL_SHADERCROSS_MICRO_VERSION)
+#define RC2D_GPU_SHADERCROSS_VERSION_STRING SDL_STRINGIFY_ARG(SDL_SHADERCROSS_MAJOR_VERSION) "." SDL_STRINGIFY_ARG(SDL_SHADERCROSS_MINOR_VERSION) "." SDL_STRINGIFY_ARG(SDL_SHADERCROSS_MICRO_VERSION)
+#else
+#define RC2D_GPU_SHADERCROSS_VERSION_STRING "unknown"
+#endif
+
+/**
+ * Calcule la clé du cache (MD5 en hexadécimal, via l'implémentation du module rres) d'une compilation
+ * HLSL -> SPIR-V : source HLSL, stage, point d'entrée, mode debug et version de SDL3_shadercross.
+ * La clé sert à retrouver un fichier de cache, pas à l'authentifier : MD5 suffit et évite de dépendre d'OpenSSL.
+ */
+static bool rc2d_gpu_getShaderCacheKey(const SDL_ShaderCross_HLSL_Info* hlslInfo, char key[33])
+{
+    const Sint32 stage = (Sint32)hlslInfo->shader_stage;
+    const Uint8 debug = hlslInfo->enable_debug ? 1 : 0;
+    unsigned int digest[4];
+
+    RC2D_RresMD5Context ctx;
+    rc2d_rres_md5Init(&ctx);
+    rc2d_rres_md5Update(&ctx, RC2D_GPU_SHADER_CACHE_VERSION, sizeof(RC2D_GPU_SHADER_CACHE_VERSION));
+    rc2d_rres_md5Update(&ctx, RC2D_GPU_SHADERCROSS_VERSION_STRING, sizeof(RC2D_GPU_SHADERCROSS_VERSION_STRING));
+    rc2d_rres_md5Update(&ctx, &stage, sizeof(stage));
+    rc2d_rres_md5Update(&ctx, &debug, sizeof(debug));
+    rc2d_rres_md5Update(&ctx, hlslInfo->entrypoint, SDL_strlen(hlslInfo->entrypoint) + 1);
+    rc2d_rres_md5Update(&ctx, hlslInfo->source, SDL_strlen(hlslInfo->source));
+    rc2d_rres_md5Final(&ctx, digest);
+
+    // Octets du condensat dans l'ordre MD5 standard (mots petit-boutistes)
+    for (int i = 0; i < 16; i++)
+    {
+        SDL_snprintf(&key[i * 2], 3, "%02x", (digest[i / 4] >> ((i % 4) * 8)) & 0xFF);
+    }
+    return true;
+}
+
+/**
+ * Compile du HLSL en SPIR-V en passant par le cache disque `shaders/cache/` (à côté de `shaders/src/`).
+ *
+ * Si un SPIR-V compilé à partir de la même source (même stage, point d'entrée, mode debug et version de
+ * SDL3_shadercross) existe, il est relu au lieu de relancer DXC. Sinon le HLSL est compilé puis le résultat
+ * est écrit dans le cache (fichier temporaire puis renommage, pour ne jamais laisser un fichier tronqué).
+ *
+ * La réflexion n'est pas mise en cache : elle est recalculée depuis le SPIR-V par SPIRV-Cross (sans DXC),
+ * car les structures de métadonnées de SDL3_shadercross contiennent des pointeurs et changent entre versions.
+ *
+ * @returns {void*} - Le SPIR-V (à libérer avec RC2D_safe_free), ou NULL en cas d'échec de compilation.
+ */
+static void* rc2d_gpu_compileSPIRVFromHLSLCached(const SDL_ShaderCross_HLSL_Info* hlslInfo, size_t* spirvSize)
+{
+    *spirvSize = 0;
+
+    char key[33];
+    char cachePath[512];
+    const char* basePath = SDL_GetBasePath();
+    bool useCache = basePath != NULL && rc2d_gpu_getShaderCacheKey(hlslInfo, key);
+
+    if (useCache)
+    {
+        SDL_snprintf(cachePath, sizeof(cachePath), "%sshaders/cache/%s.spv", basePath, key);
+
+        size_t size = 0;
+        Uint32* cached = (Uint32*)SDL_LoadFile(cachePath, &size);
+
+        // Vérifier le nombre magique SPIR-V : un fichier corrompu est simplement recompilé
+        if (cached != NULL && size >= 20 && size % 4 == 0 && cached[0] == 0x07230203)
+        {
+            RC2D_log(RC2D_LOG_DEBUG, "Shader %s loaded from SPIR-V cache", hlslInfo->name);
+            *spirvSize = size;
+            return cached;
+        }
+        RC2D_safe_free(cached);
+    }
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    void* spirv = SDL_ShaderCross_CompileSPIRVFromHLSL(hlslInfo, spirvSize);
+    if (spirv == NULL || *spirvSize == 0) return spirv;
+
+    RC2D_log(RC2D_LOG_DEBUG, "Shader %s compiled from HLSL in %.2f ms", hlslInfo->name,
+             (double)(SDL_GetPerformanceCounter() - start) * 1000.0 / (double)SDL_GetPerformanceFrequency());
+
+    if (useCache)
+    {
+        char cacheDir[512];
+        char tempPath[560];
+        SDL_snprintf(cacheDir, sizeof(cacheDir), "%sshaders/cache", basePath);
+        SDL_snprintf(tempPath, sizeof(tempPath), "%s.%llu.tmp", cachePath, (unsigned long long)SDL_GetCurrentThreadID());
+
+        // Un échec d'écriture (dossier en lecture seule...) ne fait que désactiver le cache pour ce shader
+        if (!SDL_CreateDirectory(cacheDir) || !SDL_SaveFile(tempPath, spirv, *spirvSize) || !SDL_RenamePath(tempPath, cachePath))
+        {
+            RC2D_log(RC2D_LOG_WARN, "Failed to write SPIR-V cache for %s: %s", hlslInfo->name, SDL_GetError());
+            SDL_RemovePath(tempPath);
+        }
+    }
+
+    return spirv;
+}
+#endif
+
+/**
+ * Table de réflexion des shaders précompilés (`shaders/reflection/reflection.bin`), générée par les scripts
+ * compile_shaders à partir des fichiers JSON de SDL_shadercross. Les entrées sont lues en place, sans analyse.
+ */
+#define RC2D_SHADER_REFLECTION_MAGIC "RC2DREFL"
+#define RC2D_SHADER_REFLECTION_VERSION 1
+
+typedef struct RC2D_ShaderReflectionHeader {
+    char magic[8];
+    Uint32 version;
+    Uint32 count;
+} RC2D_ShaderReflectionHeader;
+
+typedef struct RC2D_ShaderReflectionRecord {
+    char name[64];
+    Uint32 stage; // 0 vertex, 1 fragment, 2 compute
+    Uint32 num_samplers;
+    Uint32 num_uniform_buffers;
+    Uint32 num_storage_buffers;
+    Uint32 num_storage_textures;
+    Uint32 num_readonly_storage_textures;
+    Uint32 num_readonly_storage_buffers;
+    Uint32 num_readwrite_storage_textures;
+    Uint32 num_readwrite_storage_buffers;
+    Uint32 threadcount_x;
+    Uint32 threadcount_y;
+    Uint32 threadcount_z;
+} RC2D_ShaderReflectionRecord;
+
+SDL_COMPILE_TIME_ASSERT(rc2d_shader_reflection_header_size, sizeof(RC2D_ShaderReflectionHeader) == 16);
+SDL_COMPILE_TIME_ASSERT(rc2d_shader_reflection_record_size, sizeof(RC2D_ShaderReflectionRecord) == 112);
+
+static struct {
+    void* data;
+    const RC2D_ShaderReflectionRecord* records;
+    Uint32 count;
+} rc2d_shaderreflection = {0};
+
+static int SDLCALL rc2d_gpu_compareShaderReflectionRecord(const void* key, const void* record)
+{
+    return SDL_strcmp((const char*)key, ((const RC2D_ShaderReflectionRecord*)record)->name);
+}
+
+bool rc2d_gpu_setShaderReflectionTable(const void* data, size_t size)
+{
+    if (data == NULL || size < sizeof(RC2D_ShaderReflectionHeader)) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Invalid shader reflection table: too small (%u bytes)", (unsigned)size);
+        return false;
+    }
+
+    const RC2D_ShaderReflectionHeader* header = (const RC2D_ShaderReflectionHeader*)data;
+    const Uint32 version = SDL_Swap32LE(header->version);
+    const Uint32 count = SDL_Swap32LE(header->count);
+    if (SDL_memcmp(header->magic, RC2D_SHADER_REFLECTION_MAGIC, sizeof(header->magic)) != 0 || version != RC2D_SHADER_REFLECTION_VERSION) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Invalid shader reflection table: bad magic or unsupported version %u", version);
+        return false;
+    }
+    if ((size - sizeof(RC2D_ShaderReflectionHeader)) / sizeof(RC2D_ShaderReflectionRecord) < count) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Invalid shader reflection table: truncated (%u entries expected)", count);
+        return false;
+    }
+
+    // Copie alignée : les données peuvent provenir d'un chunk rres libéré ensuite par l'appelant
+    const size_t tableSize = sizeof(RC2D_ShaderReflectionHeader) + count * sizeof(RC2D_ShaderReflectionRecord);
+    void* copy = RC2D_malloc(tableSize);
+    if (copy == NULL) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to allocate shader reflection table (%u bytes)", (unsigned)tableSize);
+        return false;
+    }
+    SDL_memcpy(copy, data, tableSize);
+
+    // Les noms doivent être terminés par un 0 et triés pour la recherche dichotomique
+    RC2D_ShaderReflectionRecord* records = (RC2D_ShaderReflectionRecord*)((Uint8*)copy + sizeof(RC2D_ShaderReflectionHeader));
+    for (Uint32 i = 0; i < count; i++) 
+    {
+        records[i].name[sizeof(records[i].name) - 1] = '\0';
+        if (i > 0 && SDL_strcmp(records[i - 1].name, records[i].name) >= 0) 
+        {
+            RC2D_log(RC2D_LOG_ERROR, "Invalid shader reflection table: entries are not sorted (%s)", records[i].name);
+            RC2D_free(copy);
+            return false;
+        }
+    }
+
+    RC2D_safe_free(rc2d_shaderreflection.data);
+    rc2d_shaderreflection.data = copy;
+    rc2d_shaderreflection.records = records;
+    rc2d_shaderreflection.count = count;
+    return true;
+}
+
+void rc2d_gpu_shaderReflectionInit(void)
+{
+#if !RC2D_GPU_SHADER_HOT_RELOAD_ENABLED
+    const char* basePath = SDL_GetBasePath();
+    if (basePath == NULL) return;
+
+    // Un seul fichier pour tous les shaders, au lieu d'un fichier JSON par shader
+    char path[512];
+    SDL_snprintf(path, sizeof(path), "%sshaders/reflection/reflection.bin", basePath);
+
+    size_t size = 0;
+    void* data = SDL_LoadFile(path, &size);
+    if (data == NULL) 
+    {
+        // La table peut aussi être fournie plus tard, depuis un fichier rres (rc2d_gpu_setShaderReflectionTable)
+        RC2D_log(RC2D_LOG_INFO, "Shader reflection table not found: %s", path);
+        return;
+    }
+
+    rc2d_gpu_setShaderReflectionTable(data, size);
+    SDL_free(data);
+#endif
+}
+
+void rc2d_gpu_shaderReflectionQuit(void)
+{
+    RC2D_safe_free(rc2d_shaderreflection.data);
+    rc2d_shaderreflection.records = NULL;
+    rc2d_shaderreflection.count = 0;
+}
+
+#if !RC2D_GPU_SHADER_HOT_RELOAD_ENABLED
+/**
+ * Recherche les informations de réflexion d'un shader précompilé (ex: "test.vertex").
+ */
+static const RC2D_ShaderReflectionRecord* rc2d_gpu_findShaderReflection(const char* filename)
+{
+    if (rc2d_shaderreflection.count == 0) return NULL;
+
+    return (const RC2D_ShaderReflectionRecord*)SDL_bsearch(
+        filename,
+        rc2d_shaderreflection.records,
+        rc2d_shaderreflection.count,
+        sizeof(RC2D_ShaderReflectionRecord),
+        rc2d_gpu_compareShaderReflectionRecord
+    );
+}
+#endif
+
 RC2D_GPUShader* rc2d_gpu_loadGraphicsShader(const char* filename) 
 {
     /**
@@ -50,32 +305,18 @@ RC2D_GPUShader* rc2d_gpu_loadGraphicsShader(const char* filename)
      */
     RC2D_assert_release(filename != NULL, RC2D_LOG_CRITICAL, "Graphics Shader filename is NULL");
 
-    /**
-     * Locker le mutex pour éviter les accès concurrents au cache des shaders graphiques
-     */
-    SDL_LockMutex(rc2d_engine_state.gpu_graphics_shader_mutex);
-
     /**
      * Vérifier si le shader graphique est déjà dans le cache (donc déjà chargé une fois)
+     *
+     * La lecture de l'index se fait sans verrou : un cache hit ne bloque jamais les autres threads.
      */
-    for (int i = 0; i < rc2d_engine_state.gpu_graphics_shader_count; i++) 
+    RC2D_GraphicsShaderEntry* cachedEntry = rc2d_hashmap_get(rc2d_engine_state.gpu_graphics_shaders_index, filename);
+    if (cachedEntry != NULL) 
     {
-        if (SDL_strcmp(rc2d_engine_state.gpu_graphics_shaders_cache[i].filename, filename) == 0) 
-        {
-            RC2D_GPUShader* graphicsShader = rc2d_engine_state.gpu_graphics_shaders_cache[i].shader;
-            SDL_UnlockMutex(rc2d_engine_state.gpu_graphics_shader_mutex);
-
-            RC2D_log(RC2D_LOG_INFO, "Graphics Shader already loaded from cache: %s", filename);
-            return graphicsShader;
-        }
+        RC2D_log(RC2D_LOG_INFO, "Graphics Shader already loaded from cache: %s", filename);
+        return (RC2D_GPUShader*)SDL_GetAtomicPointer((void**)&cachedEntry->shader);
     }
 
-    /**
-     * On unlock le mutex après avoir vérifié le cache des shaders graphiques.
-     * Cela permet aux autres threads d'accéder au cache des shaders graphiques.
-     */
-    SDL_UnlockMutex(rc2d_engine_state.gpu_graphics_shader_mutex);
-
     // Récupérer le chemin de base de l'application (où est exécuté l'exécutable)
     const char* basePath = SDL_GetBasePath();
     RC2D_assert_release(basePath != NULL, RC2D_LOG_CRITICAL, "SDL_GetBasePath() failed, SDL_Error: %s", SDL_GetError());
@@ -168,63 +409,28 @@ RC2D_GPUShader* rc2d_gpu_loadGraphicsShader(const char* filename)
     }
 
     /**
-     * En mode compilation hors ligne des shaders, on utilise un fichier JSON généré par le script de compilation des shaders.
-     * On génère le chemin d'accès au fichier JSON de réflexion en fonction du nom du shader et de son stage.
-     */
-    char jsonPath[512];
-    SDL_snprintf(jsonPath, sizeof(jsonPath), "%sshaders/reflection/%s.json", basePath, filename);
-
-    /**
-     * On ouvre le fichier JSON de réflexion pour récupérer les informations de réflexions sur le shader.
-     * On utilise SDL_LoadFile pour charger le fichier JSON de réflexion.
-     * On utilise SDL_sscanf pour extraire les valeurs des champs : samplers, uniform_buffers, storage_buffers et storage_textures.
-     * On ferme le fichier JSON après la lecture.
-     * 
-     * Exemple de contenu JSON attendu :
-     * ```json
-     * {
-     *   "samplers": 0,
-     *   "uniform_buffers": 0,
-     *   "storage_buffers": 0,
-     *   "storage_textures": 0
-     * }
-     * ```
+     * En mode compilation hors ligne des shaders, les informations de réflexion (samplers, uniform_buffers,
+     * storage_buffers et storage_textures) proviennent de la table reflection.bin générée par le script
+     * de compilation des shaders, chargée une seule fois à l'initialisation (ou depuis un fichier rres).
      */
     Uint32 numSamplers = 0;
     Uint32 numUniformBuffers = 0;
     Uint32 numStorageBuffers = 0;
     Uint32 numStorageTextures = 0;
-    void* jsonContent = SDL_LoadFile(jsonPath, NULL);
-    if (jsonContent) 
+    const RC2D_ShaderReflectionRecord* reflection = rc2d_gpu_findShaderReflection(filename);
+    if (reflection) 
     {
-        // Cast le contenu du fichier JSON en chaîne de caractères
-        const char* content = (const char*)jsonContent;
-    
-        // Essayer les différentes clés connues, y compris alternatives
-        if (SDL_strstr(content, "\"samplers\""))
-            SDL_sscanf(content, "%*[^\"samplers\"]\"samplers\"%*[: ]%u", &numSamplers);
-        if (SDL_strstr(content, "\"uniform_buffers\""))
-            SDL_sscanf(content, "%*[^\"uniform_buffers\"]\"uniform_buffers\"%*[: ]%u", &numUniformBuffers);
-        else if (SDL_strstr(content, "\"uniformBuffers\""))
-            SDL_sscanf(content, "%*[^\"uniformBuffers\"]\"uniformBuffers\"%*[: ]%u", &numUniformBuffers);
-        if (SDL_strstr(content, "\"storage_buffers\""))
-            SDL_sscanf(content, "%*[^\"storage_buffers\"]\"storage_buffers\"%*[: ]%u", &numStorageBuffers);
-        else if (SDL_strstr(content, "\"readOnlyStorageBuffers\""))
-            SDL_sscanf(content, "%*[^\"readOnlyStorageBuffers\"]\"readOnlyStorageBuffers\"%*[: ]%u", &numStorageBuffers);
-        if (SDL_strstr(content, "\"storage_textures\""))
-            SDL_sscanf(content, "%*[^\"storage_textures\"]\"storage_textures\"%*[: ]%u", &numStorageTextures);
-        else if (SDL_strstr(content, "\"readOnlyStorageTextures\""))
-            SDL_sscanf(content, "%*[^\"readOnlyStorageTextures\"]\"readOnlyStorageTextures\"%*[: ]%u", &numStorageTextures);
-    
-        // Libérer le contenu JSON après la lecture
-        RC2D_safe_free(jsonContent);
+        numSamplers = SDL_Swap32LE(reflection->num_samplers);
+        numUniformBuffers = SDL_Swap32LE(reflection->num_uniform_buffers);
+        numStorageBuffers = SDL_Swap32LE(reflection->num_storage_buffers);
+        numStorageTextures = SDL_Swap32LE(reflection->num_storage_textures);
     }
     else 
     {
-        RC2D_log(RC2D_LOG_ERROR, "Shader reflection file not found: %s, SDL_Error: %s", jsonPath, SDL_GetError());
+        RC2D_log(RC2D_LOG_ERROR, "Shader reflection not found for %s in shaders/reflection/reflection.bin", filename);
     }
     
-    // Création du shader GPU avec les informations de réflexion récupérées depuis le fichier JSON
+    // Création du shader GPU avec les informations de réflexion de la table reflection.bin
     SDL_GPUShaderCreateInfo info = {
         .code = codeShaderCompiled,
         .code_size = codeShaderCompiledSize,
@@ -284,7 +490,7 @@ RC2D_GPUShader* rc2d_gpu_loadGraphicsShader(const char* filename)
 
     // Compiler HLSL vers SPIR-V
     size_t spirvByteCodeSize = 0;
-    void* spirvByteCode = SDL_ShaderCross_CompileSPIRVFromHLSL(&hlslInfo, &spirvByteCodeSize);
+    void* spirvByteCode = rc2d_gpu_compileSPIRVFromHLSLCached(&hlslInfo, &spirvByteCodeSize);
 
     // Libérer le code HLSL source après la compilation
     RC2D_safe_free(codeHLSLSource);
@@ -345,21 +551,39 @@ RC2D_GPUShader* rc2d_gpu_loadGraphicsShader(const char* filename)
      */
     SDL_LockMutex(rc2d_engine_state.gpu_graphics_shader_mutex);
 
+    // Un autre thread a pu charger le même shader pendant la compilation : on garde le premier
+    cachedEntry = rc2d_hashmap_get(rc2d_engine_state.gpu_graphics_shaders_index, filename);
+    if (cachedEntry != NULL) 
+    {
+        SDL_UnlockMutex(rc2d_engine_state.gpu_graphics_shader_mutex);
+        SDL_ReleaseGPUShader(rc2d_gpu_getDevice(), graphicsShader);
+        return (RC2D_GPUShader*)SDL_GetAtomicPointer((void**)&cachedEntry->shader);
+    }
+
     // On réalloue le cache des shaders graphiques pour ajouter le nouveau shader graphique (on dois augmenter la taille du cache)
-    RC2D_GraphicsShaderEntry* newShaders = RC2D_realloc(
+    RC2D_GraphicsShaderEntry** newShaders = RC2D_realloc(
         rc2d_engine_state.gpu_graphics_shaders_cache,
-        (rc2d_engine_state.gpu_graphics_shader_count + 1) * sizeof(RC2D_GraphicsShaderEntry)
+        (rc2d_engine_state.gpu_graphics_shader_count + 1) * sizeof(RC2D_GraphicsShaderEntry*)
     );
 
     // Vérifier si la réallocation a réussi
     RC2D_assert_release(newShaders != NULL, RC2D_LOG_CRITICAL, "Failed to realloc shader cache");
-
-    // Mettre à jour le cache des shaders graphiques avec le nouveau shader graphique
     rc2d_engine_state.gpu_graphics_shaders_cache = newShaders;
-    RC2D_GraphicsShaderEntry* entry = &rc2d_engine_state.gpu_graphics_shaders_cache[rc2d_engine_state.gpu_graphics_shader_count++];
+
+    // Créer l'entrée (allouée séparément : son adresse reste stable pour les lecteurs de l'index)
+    RC2D_GraphicsShaderEntry* entry = RC2D_malloc(sizeof(RC2D_GraphicsShaderEntry));
+    RC2D_assert_release(entry != NULL, RC2D_LOG_CRITICAL, "Failed to allocate shader cache entry");
     entry->filename = RC2D_strdup(filename);
     entry->shader = graphicsShader;
     entry->lastModified = rc2d_gpu_getFileModificationTime(fullPath);
+    entry->filename_hash = rc2d_hashmap_hashString(filename);
+
+    // Mettre à jour le cache des shaders graphiques avec le nouveau shader graphique, puis le publier dans l'index
+    rc2d_engine_state.gpu_graphics_shaders_cache[rc2d_engine_state.gpu_graphics_shader_count++] = entry;
+    if (!rc2d_hashmap_put(rc2d_engine_state.gpu_graphics_shaders_index, filename, entry)) 
+    {
+        RC2D_log(RC2D_LOG_WARN, "Failed to index graphics shader %s, it will be reloaded on next request", filename);
+    }
 
     /**
      * On unlock le mutex après avoir ajouté le shader graphique au cache.
@@ -379,29 +603,14 @@ RC2D_GPUComputePipeline* rc2d_gpu_loadComputeShader(const char* filename)
      */
     RC2D_assert_release(filename != NULL, RC2D_LOG_CRITICAL, "Compute Shader filename is NULL");
 
-    /**
-     * Locker le mutex pour éviter les accès concurrents au cache des shaders de calcul
-     */
-    SDL_LockMutex(rc2d_engine_state.gpu_compute_shader_mutex);
-
-    // Vérifier si le shader compute est déjà dans le cache (donc déjà chargé une fois)
-    for (int i = 0; i < rc2d_engine_state.gpu_compute_shader_count; i++) 
+    // Vérifier si le shader compute est déjà dans le cache (donc déjà chargé une fois), sans verrou
+    RC2D_ComputeShaderEntry* cachedEntry = rc2d_hashmap_get(rc2d_engine_state.gpu_compute_shaders_index, filename);
+    if (cachedEntry != NULL) 
     {
-        if (SDL_strcmp(rc2d_engine_state.gpu_compute_shaders_cache[i].filename, filename) == 0) 
-        {
-            RC2D_GPUComputePipeline* computeShader = rc2d_engine_state.gpu_compute_shaders_cache[i].shader;
-            SDL_UnlockMutex(rc2d_engine_state.gpu_compute_shader_mutex);
-
-            RC2D_log(RC2D_LOG_INFO, "Compute Shader already loaded from cache: %s", filename);
-            return computeShader;
-        }
+        RC2D_log(RC2D_LOG_INFO, "Compute Shader already loaded from cache: %s", filename);
+        return (RC2D_GPUComputePipeline*)SDL_GetAtomicPointer((void**)&cachedEntry->shader);
     }
 
-    /**
-     * On unlock le mutex après avoir vérifié le cache des shaders de calcul.
-     */
-    SDL_UnlockMutex(rc2d_engine_state.gpu_compute_shader_mutex);
-
     // Récupérer le chemin de base de l'application (où est exécuté l'exécutable)
     const char* basePath = SDL_GetBasePath();
     RC2D_assert_release(basePath != NULL, RC2D_LOG_CRITICAL, "SDL_GetBasePath() failed");
@@ -475,32 +684,9 @@ RC2D_GPUComputePipeline* rc2d_gpu_loadComputeShader(const char* filename)
     }
 
     /**
-     * En mode compilation hors ligne des shaders, on utilise un fichier JSON généré par le script de compilation des shaders.
-     * On génère le chemin d'accès au fichier JSON de réflexion en fonction du nom du shader et de son stage.
-     */
-    char jsonPath[512];
-    SDL_snprintf(jsonPath, sizeof(jsonPath), "%sshaders/reflection/%s.json", basePath, filename);
-
-    /**
-     * On ouvre le fichier JSON de réflexion pour récupérer les informations de réflexions sur le shader.
-     * On utilise SDL_LoadFile pour charger le fichier JSON de réflexion.
-     * On utilise SDL_sscanf pour extraire les valeurs des champs : "samplers", "readonly_storage_textures", "readonly_storage_buffers", "readwrite_storage_textures", "readwrite_storage_buffers", "uniform_buffers", "threadcount_x", "threadcount_y" et "threadcount_z".
-     * On ferme le fichier JSON après la lecture.
-     * 
-     * Exemple de contenu JSON attendu :
-     * ```json
-     * {
-     *   "samplers": 0,
-     *   "readonly_storage_textures": 0,
-     *   "readonly_storage_buffers": 1,
-     *   "readwrite_storage_textures": 0,
-     *   "readwrite_storage_buffers": 1,
-     *   "uniform_buffers": 0,
-     *   "threadcount_x": 64,
-     *   "threadcount_y": 1,
-     *   "threadcount_z": 1
-     * }
-     * ```
+     * En mode compilation hors ligne des shaders, les informations de réflexion (samplers, storage textures/buffers
+     * en lecture seule et en lecture/écriture, uniform_buffers et threadcount) proviennent de la table reflection.bin
+     * générée par le script de compilation des shaders, chargée une seule fois à l'initialisation (ou depuis un fichier rres).
      */
     Uint32 numSamplers = 0;
     Uint32 numReadonlyStorageTextures = 0;
@@ -511,57 +697,25 @@ RC2D_GPUComputePipeline* rc2d_gpu_loadComputeShader(const char* filename)
     Uint32 numThreadCountX = 0;
     Uint32 numThreadCountY = 0;
     Uint32 numThreadCountZ = 0;
-    void* jsonContent = SDL_LoadFile(jsonPath, NULL);
-    if (jsonContent) 
+    const RC2D_ShaderReflectionRecord* reflection = rc2d_gpu_findShaderReflection(filename);
+    if (reflection) 
     {
-        // Cast le contenu du fichier JSON en chaîne de caractères
-        const char* content = (const char*)jsonContent;
-    
-        // Essayer les différentes clés connues, y compris alternatives
-        if (SDL_strstr(content, "\"samplers\""))
-            SDL_sscanf(content, "%*[^\"samplers\"]\"samplers\"%*[: ]%u", &numSamplers);
-        if (SDL_strstr(content, "\"readonly_storage_textures\""))
-            SDL_sscanf(content, "%*[^\"readonly_storage_textures\"]\"readonly_storage_textures\"%*[: ]%u", &numReadonlyStorageTextures);
-        else if (SDL_strstr(content, "\"readOnlyStorageTextures\""))
-            SDL_sscanf(content, "%*[^\"readOnlyStorageTextures\"]\"readOnlyStorageTextures\"%*[: ]%u", &numReadonlyStorageTextures);
-        if (SDL_strstr(content, "\"readonly_storage_buffers\""))
-            SDL_sscanf(content, "%*[^\"readonly_storage_buffers\"]\"readonly_storage_buffers\"%*[: ]%u", &numReadonlyStorageBuffers);
-        else if (SDL_strstr(content, "\"readOnlyStorageBuffers\""))
-            SDL_sscanf(content, "%*[^\"readOnlyStorageBuffers\"]\"readOnlyStorageBuffers\"%*[: ]%u", &numReadonlyStorageBuffers);
-        if (SDL_strstr(content, "\"readwrite_storage_textures\""))
-            SDL_sscanf(content, "%*[^\"readwrite_storage_textures\"]\"readwrite_storage_textures\"%*[: ]%u", &numReadwriteStorageTextures);
-        else if (SDL_strstr(content, "\"readWriteStorageTextures\""))
-            SDL_sscanf(content, "%*[^\"readWriteStorageTextures\"]\"readWriteStorageTextures\"%*[: ]%u", &numReadwriteStorageTextures);
-        if (SDL_strstr(content, "\"readwrite_storage_buffers\""))
-            SDL_sscanf(content, "%*[^\"readwrite_storage_buffers\"]\"readwrite_storage_buffers\"%*[: ]%u", &numReadwriteStorageBuffers);
-        else if (SDL_strstr(content, "\"readWriteStorageBuffers\""))
-            SDL_sscanf(content, "%*[^\"readWriteStorageBuffers\"]\"readWriteStorageBuffers\"%*[: ]%u", &numReadwriteStorageBuffers);
-        if (SDL_strstr(content, "\"uniform_buffers\""))
-            SDL_sscanf(content, "%*[^\"uniform_buffers\"]\"uniform_buffers\"%*[: ]%u", &numUniformBuffers);
-        else if (SDL_strstr(content, "\"uniformBuffers\""))
-            SDL_sscanf(content, "%*[^\"uniformBuffers\"]\"uniformBuffers\"%*[: ]%u", &numUniformBuffers);
-        if (SDL_strstr(content, "\"threadcount_x\""))
-            SDL_sscanf(content, "%*[^\"threadcount_x\"]\"threadcount_x\"%*[: ]%u", &numThreadCountX);
-        else if (SDL_strstr(content, "\"threadCountX\""))
-            SDL_sscanf(content, "%*[^\"threadCountX\"]\"threadCountX\"%*[: ]%u", &numThreadCountX);
-        if (SDL_strstr(content, "\"threadcount_y\""))
-            SDL_sscanf(content, "%*[^\"threadcount_y\"]\"threadcount_y\"%*[: ]%u", &numThreadCountY);
-        else if (SDL_strstr(content, "\"threadCountY\""))
-            SDL_sscanf(content, "%*[^\"threadCountY\"]\"threadCountY\"%*[: ]%u", &numThreadCountY);
-        if (SDL_strstr(content, "\"threadcount_z\""))
-            SDL_sscanf(content, "%*[^\"threadcount_z\"]\"threadcount_z\"%*[: ]%u", &numThreadCountZ);
-        else if (SDL_strstr(content, "\"threadCountZ\""))
-            SDL_sscanf(content, "%*[^\"threadCountZ\"]\"threadCountZ\"%*[: ]%u", &numThreadCountZ);
-        
-        // Libérer le contenu JSON après la lecture
-        RC2D_safe_free(jsonContent);
+        numSamplers = SDL_Swap32LE(reflection->num_samplers);
+        numReadonlyStorageTextures = SDL_Swap32LE(reflection->num_readonly_storage_textures);
+        numReadonlyStorageBuffers = SDL_Swap32LE(reflection->num_readonly_storage_buffers);
+        numReadwriteStorageTextures = SDL_Swap32LE(reflection->num_readwrite_storage_textures);
+        numReadwriteStorageBuffers = SDL_Swap32LE(reflection->num_readwrite_storage_buffers);
+        numUniformBuffers = SDL_Swap32LE(reflection->num_uniform_buffers);
+        numThreadCountX = SDL_Swap32LE(reflection->threadcount_x);
+        numThreadCountY = SDL_Swap32LE(reflection->threadcount_y);
+        numThreadCountZ = SDL_Swap32LE(reflection->threadcount_z);
     }
     else 
     {
-        RC2D_log(RC2D_LOG_WARN, "Shader reflection file not found: %s", jsonPath);
+        RC2D_log(RC2D_LOG_WARN, "Shader reflection not found for %s in shaders/reflection/reflection.bin", filename);
     }
     
-    // Création du shader compute avec les informations de réflexion récupérées depuis le fichier JSON
+    // Création du shader compute avec les informations de réflexion de la table reflection.bin
     SDL_GPUComputePipelineCreateInfo info = {
         .code = codeShaderCompiled,
         .code_size = codeShaderCompiledSize,
@@ -627,7 +781,7 @@ RC2D_GPUComputePipeline* rc2d_gpu_loadComputeShader(const char* filename)
 
     // Compiler HLSL vers SPIR-V
     size_t spirvByteCodeSize = 0;
-    void* spirvByteCode = SDL_ShaderCross_CompileSPIRVFromHLSL(&hlslInfo, &spirvByteCodeSize);
+    void* spirvByteCode = rc2d_gpu_compileSPIRVFromHLSLCached(&hlslInfo, &spirvByteCodeSize);
 
     // Libérer le code HLSL source après la compilation
     RC2D_safe_free(codeHLSLSource);
@@ -689,22 +843,39 @@ RC2D_GPUComputePipeline* rc2d_gpu_loadComputeShader(const char* filename)
      */
     SDL_LockMutex(rc2d_engine_state.gpu_compute_shader_mutex);
 
+    // Un autre thread a pu charger le même shader pendant la compilation : on garde le premier
+    cachedEntry = rc2d_hashmap_get(rc2d_engine_state.gpu_compute_shaders_index, filename);
+    if (cachedEntry != NULL) 
+    {
+        SDL_UnlockMutex(rc2d_engine_state.gpu_compute_shader_mutex);
+        SDL_ReleaseGPUComputePipeline(rc2d_gpu_getDevice(), computePipelineShader);
+        return (RC2D_GPUComputePipeline*)SDL_GetAtomicPointer((void**)&cachedEntry->shader);
+    }
+
     // On réalloue le cache des shaders de calcul pour ajouter le nouveau shader de calcul plus bas
-    RC2D_ComputeShaderEntry* newShaders = RC2D_realloc(
+    RC2D_ComputeShaderEntry** newShaders = RC2D_realloc(
         rc2d_engine_state.gpu_compute_shaders_cache,
-        (rc2d_engine_state.gpu_compute_shader_count + 1) * sizeof(RC2D_ComputeShaderEntry)
+        (rc2d_engine_state.gpu_compute_shader_count + 1) * sizeof(RC2D_ComputeShaderEntry*)
     );
 
     // Vérifier si la réallocation a réussi
     RC2D_assert_release(newShaders != NULL, RC2D_LOG_CRITICAL, "Failed to realloc compute shader cache");
-
-    // Mettre à jour le cache des shaders de calcul avec le nouveau shader de calcul
     rc2d_engine_state.gpu_compute_shaders_cache = newShaders;
-    RC2D_ComputeShaderEntry* entry = &rc2d_engine_state.gpu_compute_shaders_cache[rc2d_engine_state.gpu_compute_shader_count++];
+
+    // Créer l'entrée (allouée séparément : son adresse reste stable pour les lecteurs de l'index)
+    RC2D_ComputeShaderEntry* entry = RC2D_malloc(sizeof(RC2D_ComputeShaderEntry));
+    RC2D_assert_release(entry != NULL, RC2D_LOG_CRITICAL, "Failed to allocate compute shader cache entry");
     entry->filename = RC2D_strdup(filename);
     entry->shader = computePipelineShader;
     entry->lastModified = rc2d_gpu_getFileModificationTime(fullPath);
 
+    // Mettre à jour le cache des shaders de calcul avec le nouveau shader de calcul, puis le publier dans l'index
+    rc2d_engine_state.gpu_compute_shaders_cache[rc2d_engine_state.gpu_compute_shader_count++] = entry;
+    if (!rc2d_hashmap_put(rc2d_engine_state.gpu_compute_shaders_index, filename, entry)) 
+    {
+        RC2D_log(RC2D_LOG_WARN, "Failed to index compute shader %s, it will be reloaded on next request", filename);
+    }
+
     /**
      * On unlock le mutex après avoir ajouté le shader de calcul au cache.
      * Cela permet aux autres threads d'accéder au cache des shaders de calcul.
@@ -719,571 +890,903 @@ RC2D_GPUComputePipeline* rc2d_gpu_loadComputeShader(const char* filename)
     return computePipelineShader;
 }
 
-void rc2d_gpu_hotReloadGraphicsShadersAndGraphicsPipeline(void)
+/**
+ * Crée l'objet SDL_GPUGraphicsPipeline à partir d'une description, avec son nom de débogage éventuel.
+ * Utilisé par rc2d_gpu_createGraphicsPipeline et par le thread de rechargement des shaders.
+ */
+static SDL_GPUGraphicsPipeline* rc2d_gpu_createGraphicsPipelineObject(const SDL_GPUGraphicsPipelineCreateInfo* createInfo, const char* debugName)
 {
-#if RC2D_GPU_SHADER_HOT_RELOAD_ENABLED
-    /**
-     * Vérifier si les mutex pour les shaders graphiques et pipelines graphiques sont initialisés
-     */
-    if (!rc2d_engine_state.gpu_graphics_shader_mutex)
-    {
-        RC2D_assert_release(false, RC2D_LOG_CRITICAL, "gpu_graphics_shader_mutex is NULL");
-    }
-    if (!rc2d_engine_state.gpu_graphics_pipeline_mutex)
-    {
-        RC2D_assert_release(false, RC2D_LOG_CRITICAL, "gpu_graphics_pipeline_mutex is NULL");
-    }
-
-    /**
-     * Récupérer le chemin de base de l'application (où est exécuté l'exécutable)
-     */
-    const char* basePath = SDL_GetBasePath();
-    if (basePath == NULL) 
+    // Créer props pour le nom de débogage si nécessaire
+    SDL_PropertiesID props = 0;
+    if (debugName != NULL)
     {
-        RC2D_assert_release(false, RC2D_LOG_CRITICAL, "SDL_GetBasePath() failed, SDL_Error: %s", SDL_GetError());
-        return;
+        props = SDL_CreateProperties();
+        SDL_SetStringProperty(props, SDL_PROP_GPU_GRAPHICSPIPELINE_CREATE_NAME_STRING, debugName);
     }
 
-    /**
-     * On verrouille les mutex pour éviter les conflits d'accès concurrents
-     * lors de la mise à jour des shaders graphiques et des pipelines graphiques.
-     */
-    SDL_LockMutex(rc2d_engine_state.gpu_graphics_shader_mutex);
-    SDL_LockMutex(rc2d_engine_state.gpu_graphics_pipeline_mutex);
-
-    /**
-     * Parcourir tous les shaders graphiques dans le cache
-     * et vérifier s'ils ont été modifiés depuis leur dernière compilation.
-     */
-    for (int i = 0; i < rc2d_engine_state.gpu_graphics_shader_count; i++) 
-    {
-        // Récupérer le shader graphique à partir du cache
-        RC2D_GraphicsShaderEntry* entry = &rc2d_engine_state.gpu_graphics_shaders_cache[i];
-
-        /**
-         * Générer le chemin d'accès complet au fichier HLSL source
-         * 
-         * En utilisant le nom du fichier du shader graphique récupéré du cache,
-         * via `entry->filename`.
-         * 
-         * On utilise SDL_snprintf pour formater le chemin d'accès au fichier HLSL source.
-         */
-        char fullPath[512];
-        SDL_snprintf(fullPath, sizeof(fullPath), "%sshaders/src/%s.hlsl", basePath, entry->filename);
-
-        /**
-         * Vérifier si le fichier HLSL source a été modifié depuis la dernière compilation
-         * 
-         * On utilise `rc2d_gpu_getFileModificationTime` pour obtenir le temps de modification du fichier.
-         */
-        SDL_Time currentModified = rc2d_gpu_getFileModificationTime(fullPath);
-
-        // Si le fichier HLSL source a été modifié depuis la dernière compilation
-        if (currentModified > entry->lastModified) 
-        {            
-            // Déterminer le stage
-            SDL_GPUShaderStage stage;
-            if (SDL_strstr(entry->filename, ".vertex")) 
-            {
-                stage = SDL_GPU_SHADERSTAGE_VERTEX;
-            } 
-            else if (SDL_strstr(entry->filename, ".fragment")) 
-            {
-                stage = SDL_GPU_SHADERSTAGE_FRAGMENT;
-            } 
-            else 
-            {
-                RC2D_log(RC2D_LOG_ERROR, "Unknown shader stage for %s during reload", entry->filename);
-                continue;
-            }
-
-            /**
-             * Charger le fichier HLSL
-             * 
-             * Attend un peu que l'os ou l'ide est le temps d'écrire le 
-             * fichier avant de le lire
-             */
-            char* codeHLSLSource = NULL;
-            for (int attempt = 0; attempt < 3; attempt++) {
-                codeHLSLSource = SDL_LoadFile(fullPath, NULL);
-                if (codeHLSLSource != NULL) break;
-                SDL_Delay(20);
-            }
-
-            /**
-             * Si le code HLSL n'a pas pu être chargé après plusieurs tentatives, log l'erreur
-             * et continue avec le prochain shader graphique.
-             */
-            if (!codeHLSLSource) 
-            {
-                RC2D_log(RC2D_LOG_ERROR, "Failed to load HLSL shader source after retries: %s", fullPath);
-                continue;
-            }
-
-            // Préparer les informations HLSL
-            SDL_ShaderCross_HLSL_Info hlslInfo = {
-                .source = codeHLSLSource,
-                .entrypoint = "main",
-                .include_dir = NULL,
-                .defines = NULL,
-                .shader_stage = (SDL_ShaderCross_ShaderStage)stage,
-                .enable_debug = true,
-                .name = entry->filename,
-                .props = 0
-            };
-
-            // Temps de début pour mesurer la compilation
-            Uint64 t0 = SDL_GetPerformanceCounter();
-
-            // Compiler HLSL vers SPIR-V
-            size_t spirvByteCodeSize = 0;
-            void* spirvByteCode = SDL_ShaderCross_CompileSPIRVFromHLSL(&hlslInfo, &spirvByteCodeSize);
-
-            // Libérer le code HLSL source après la compilation
-            RC2D_safe_free(codeHLSLSource);
-
-            // Vérifier si la compilation HLSL vers SPIR-V a réussi
-            if (spirvByteCode == NULL || spirvByteCodeSize == 0)
-            {
-                RC2D_log(RC2D_LOG_ERROR, "Failed to compile HLSL to SPIR-V during reload: %s", entry->filename);
-                continue;
-            }
+    // Copie la structure pour injection, en modifiant uniquement props
+    SDL_GPUGraphicsPipelineCreateInfo info = *createInfo;
+    info.props = props;
 
-            // Réfléchir les métadonnées
-            SDL_ShaderCross_GraphicsShaderMetadata* metadata = SDL_ShaderCross_ReflectGraphicsSPIRV(
-                spirvByteCode, 
-                spirvByteCodeSize, 
-                0
-            );
-            // Vérifier si la réflexion des métadonnées a réussi
-            if (!metadata) 
-            {
-                RC2D_log(RC2D_LOG_ERROR, "Failed to reflect graphics shader metadata during reload: %s", entry->filename);
-                RC2D_safe_free(spirvByteCode);
-                continue;
-            }
+    SDL_GPUGraphicsPipeline* pipeline = SDL_CreateGPUGraphicsPipeline(rc2d_gpu_getDevice(), &info);
+    SDL_DestroyProperties(props);
+    return pipeline;
+}
 
-            // Préparer les informations SPIR-V
-            SDL_ShaderCross_SPIRV_Info spirvInfo = {
-                .bytecode = spirvByteCode,
-                .bytecode_size = spirvByteCodeSize,
-                .entrypoint = "main",
-                .shader_stage = (SDL_ShaderCross_ShaderStage)stage,
-                .enable_debug = true,
-                .name = entry->filename,
-                .props = 0
-            };
-
-            // Compiler le shader
-            SDL_GPUShader* newShader = SDL_ShaderCross_CompileGraphicsShaderFromSPIRV(
-                rc2d_gpu_getDevice(),
-                &spirvInfo,
-                metadata,
-                0
-            );
-
-            // Temps de fin pour mesurer la compilation
-            Uint64 t1 = SDL_GetPerformanceCounter();
-            double compileTimeMs = (double)(t1 - t0) * 1000.0 / SDL_GetPerformanceFrequency();
-
-            // Libérer les ressources allouées pour les métadonnées et le code SPIR-V
-            RC2D_safe_free(metadata);
-            RC2D_safe_free(spirvByteCode);
-
-            if (newShader) 
-            {
-                /**
-                 * Soumettre le buffer de commandes actuel et attendre que le GPU ait fini de traiter
-                 * On utilise SDL_SubmitGPUCommandBufferAndAcquireFence pour soumettre le buffer de commandes
-                 * et acquérir une fence pour synchroniser l'attente.
-                 */
-                SDL_GPUFence* fence = NULL;
-                if (rc2d_engine_state.gpu_current_command_buffer) 
-                {
-                    // Soumettre le buffer de commandes actuel et acquérir une fence
-                    fence = SDL_SubmitGPUCommandBufferAndAcquireFence(rc2d_engine_state.gpu_current_command_buffer);
-                    if (!fence) 
-                    {
-                        RC2D_log(RC2D_LOG_ERROR, "Failed to submit command buffer and acquire fence");
-                        SDL_ReleaseGPUShader(rc2d_gpu_getDevice(), newShader);
-                        continue;
-                    }
-
-                    // Attendre que le GPU ait fini de traiter le buffer de commandes
-                    if (!SDL_WaitForGPUFences(rc2d_gpu_getDevice(), true, &fence, 1))
-                    {
-                        RC2D_log(RC2D_LOG_ERROR, "Failed to wait for GPU fence: %s", SDL_GetError());
-                        SDL_ReleaseGPUShader(rc2d_gpu_getDevice(), newShader);
-                        continue;
-                    }
-
-                    // Libérer la fence après utilisation
-                    SDL_ReleaseGPUFence(rc2d_gpu_getDevice(), fence);
-                }
+#if RC2D_GPU_SHADER_HOT_RELOAD_ENABLED
+/**
+ * Type de travail confié au thread de rechargement des shaders.
+ */
+typedef enum RC2D_ShaderReloadKind {
+    RC2D_SHADER_RELOAD_GRAPHICS,
+    RC2D_SHADER_RELOAD_COMPUTE
+} RC2D_ShaderReloadKind;
 
-                // Acquérir un nouveau buffer de commandes
-                rc2d_engine_state.gpu_current_command_buffer = SDL_AcquireGPUCommandBuffer(rc2d_gpu_getDevice());
-                if (!rc2d_engine_state.gpu_current_command_buffer) 
-                {
-                    RC2D_log(RC2D_LOG_ERROR, "Failed to acquire new command buffer after shader reload : %s", SDL_GetError());
-                    SDL_ReleaseGPUShader(rc2d_gpu_getDevice(), newShader);
-                    continue;
-                }
+/**
+ * Pipeline graphique reconstruit par le thread de rechargement, en attente d'être échangé.
+ */
+typedef struct RC2D_ShaderReloadPipeline {
+    RC2D_GPUGraphicsPipeline* graphicsPipeline;
+    SDL_GPUGraphicsPipeline* pipeline; // NULL si la reconstruction a échoué (l'ancien pipeline est conservé)
+} RC2D_ShaderReloadPipeline;
 
-                // Libérer l'ancien shader
-                if (entry->shader) 
-                {
-                    SDL_ReleaseGPUShader(rc2d_gpu_getDevice(), entry->shader);
-                }
+/**
+ * Travail de recompilation : créé par le thread principal, exécuté par le thread de rechargement,
+ * puis rendu au thread principal qui échange les objets au début de la frame suivante.
+ */
+typedef struct RC2D_ShaderReloadJob {
+    RC2D_ShaderReloadKind kind;
+    char* filename;
+    SDL_GPUShaderStage stage;
+    RC2D_GraphicsShaderEntry* graphicsEntry;
+    RC2D_ComputeShaderEntry* computeEntry;
 
-                // Remplacer l'ancien shader graphique par le nouveau shader graphique, dans le cache de RC2D
-                entry->shader = newShader;
+    // Résultat (NULL si la recompilation a échoué)
+    SDL_GPUShader* shader;
+    SDL_GPUComputePipeline* computePipeline;
+    RC2D_ShaderReloadPipeline* pipelines;
+    int pipeline_count;
+    double compile_time_ms;
 
-                // Mettre à jour le timestamp de dernière modification, c'est le moment où le shader a été rechargé (donc le timestamp actuel)
-                entry->lastModified = currentModified;
+    struct RC2D_ShaderReloadJob* next;
+} RC2D_ShaderReloadJob;
 
-                // Log la réussite du rechargement du shader
-                RC2D_log(RC2D_LOG_INFO, "Successfully Shader %s reloaded in %.2f ms", entry->filename, compileTimeMs);
+/**
+ * Objet GPU remplacé, libéré une fois que les frames en vol qui pouvaient l'utiliser sont terminées.
+ */
+typedef struct RC2D_ShaderReloadRetired {
+    SDL_GPUShader* shader;
+    SDL_GPUGraphicsPipeline* pipeline;
+    SDL_GPUComputePipeline* computePipeline;
+    Uint64 release_frame;
+} RC2D_ShaderReloadRetired;
+
+static struct {
+    SDL_Thread* thread;
+    SDL_Semaphore* wake;
+    SDL_AtomicInt running;
+
+    // Travaux en attente (thread principal -> thread de rechargement) et terminés (retour)
+    SDL_Mutex* mutex;
+    RC2D_ShaderReloadJob* queued_head;
+    RC2D_ShaderReloadJob* queued_tail;
+    RC2D_ShaderReloadJob* done_head;
+    RC2D_ShaderReloadJob* done_tail;
+    SDL_AtomicInt has_done;
+
+    // Dernier shader compilé pour chaque fichier, échangé ou non (thread de rechargement uniquement)
+    RC2D_HashMap* latest_shaders;
+
+    // Objets remplacés en attente de libération (thread principal uniquement)
+    RC2D_ShaderReloadRetired* retired;
+    int retired_count;
+    int retired_capacity;
+    Uint64 frame;
+} rc2d_shaderreload = {0};
 
-                // Mettre à jour tous les pipelines graphiques qui utilisent ce shader
-                for (int j = 0; j < rc2d_engine_state.gpu_graphics_pipeline_count; j++) 
-                {
-                    // Récupérer le pipeline graphique à partir du cache
-                    RC2D_GraphicsPipelineEntry* pipeline = &rc2d_engine_state.gpu_graphics_pipelines_cache[j];
-
-                    // Check si le pipeline graphique utilise le shader graphique actuel
-                    if ((stage == SDL_GPU_SHADERSTAGE_VERTEX && SDL_strcmp(pipeline->vertex_shader_filename, entry->filename) == 0) ||
-                        (stage == SDL_GPU_SHADERSTAGE_FRAGMENT && SDL_strcmp(pipeline->fragment_shader_filename, entry->filename) == 0)) 
-                    {
-                        /**
-                         * Si le pipeline graphique utilise le shader graphique actuel, on détruit l'ancien pipeline graphique
-                         * et on le recrée avec le nouveau shader graphique.
-                         */
-                        SDL_ReleaseGPUGraphicsPipeline(rc2d_gpu_getDevice(), pipeline->graphicsPipeline->pipeline);
-                        pipeline->graphicsPipeline->pipeline = NULL;
-
-                        // Mettre à jour le shader graphique dans le pipeline graphique
-                        if (stage == SDL_GPU_SHADERSTAGE_VERTEX) 
-                        {
-                            pipeline->graphicsPipeline->create_info.vertex_shader = newShader;
-                        } 
-                        else if (stage == SDL_GPU_SHADERSTAGE_FRAGMENT) 
-                        {
-                            pipeline->graphicsPipeline->create_info.fragment_shader = newShader;
-                        }
-
-                        // Recréer le pipeline graphique avec le nouveau shader graphique
-                        bool ok = rc2d_gpu_createGraphicsPipeline(pipeline->graphicsPipeline);
-                        if (!ok || pipeline->graphicsPipeline->pipeline == NULL) {
-                            RC2D_log(RC2D_LOG_CRITICAL, "Failed to rebuild pipeline for shader: %s (resulting pipeline is NULL)", entry->filename);
-                            continue;
-                        }
-
-                        // Log optionnel pour debug
-                        RC2D_log(RC2D_LOG_DEBUG, "Successfully rebuilt graphics pipeline using shader: %s", entry->filename);
-                    }
-                }
-            } 
-            else 
-            {
-                // Log l'erreur si la compilation du shader graphique a échoué
-                RC2D_log(RC2D_LOG_ERROR, "Failed to reload shader: %s", entry->filename);
-            }
-        }
+/**
+ * Charge le code HLSL source d'un shader.
+ * 
+ * Attend un peu que l'os ou l'ide est le temps d'écrire le fichier avant de le lire.
+ */
+static char* rc2d_shaderreload_loadSource(const char* filename)
+{
+    const char* basePath = SDL_GetBasePath();
+    if (basePath == NULL) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to get base path for shader reload: %s", SDL_GetError());
+        return NULL;
     }
 
-    /**
-     * Unlock les mutex pour permettre l'accès concurrent aux shaders graphiques et pipelines graphiques
-     */
-    SDL_UnlockMutex(rc2d_engine_state.gpu_graphics_pipeline_mutex);
-    SDL_UnlockMutex(rc2d_engine_state.gpu_graphics_shader_mutex);
-#endif
-}
+    char fullPath[512];
+    SDL_snprintf(fullPath, sizeof(fullPath), "%sshaders/src/%s.hlsl", basePath, filename);
 
-void rc2d_gpu_hotReloadComputeShader(void)
-{
-#if RC2D_GPU_SHADER_HOT_RELOAD_ENABLED
-    // Vérifier que le mutex pour les compute shaders est valide
-    if (!rc2d_engine_state.gpu_compute_shader_mutex)
+    char* codeHLSLSource = NULL;
+    for (int attempt = 0; attempt < 3; attempt++) 
     {
-        RC2D_assert_release(false, RC2D_LOG_CRITICAL, "gpu_compute_shader_mutex is NULL");
-        return;
+        codeHLSLSource = SDL_LoadFile(fullPath, NULL);
+        if (codeHLSLSource != NULL) break;
+        SDL_Delay(20);
     }
 
-    // Récupérer le chemin de base de l'application (chemin où est exécuté l'exécutable)
-    const char* basePath = SDL_GetBasePath();
-    if (basePath == NULL) 
+    if (!codeHLSLSource) 
     {
-        RC2D_log(RC2D_LOG_ERROR, "Failed to get base path for shader updates");
-        return;
+        RC2D_log(RC2D_LOG_ERROR, "Failed to load HLSL shader source after retries: %s", fullPath);
     }
+    return codeHLSLSource;
+}
 
-    /**
-     * On lock le mutex pour éviter les accès concurrents
-     * lors de la mise à jour des compute shaders.
-     */
-    SDL_LockMutex(rc2d_engine_state.gpu_compute_shader_mutex);
+/**
+ * Recompile un shader graphique depuis sa source HLSL (thread de rechargement).
+ */
+static SDL_GPUShader* rc2d_shaderreload_compileGraphicsShader(const char* filename, SDL_GPUShaderStage stage)
+{
+    char* codeHLSLSource = rc2d_shaderreload_loadSource(filename);
+    if (codeHLSLSource == NULL) return NULL;
+
+    // Préparer les informations HLSL
+    SDL_ShaderCross_HLSL_Info hlslInfo = {
+        .source = codeHLSLSource,
+        .entrypoint = "main",
+        .include_dir = NULL,
+        .defines = NULL,
+        .shader_stage = (SDL_ShaderCross_ShaderStage)stage,
+        .enable_debug = true,
+        .name = filename,
+        .props = 0
+    };
+
+    // Compiler HLSL vers SPIR-V
+    size_t spirvByteCodeSize = 0;
+    void* spirvByteCode = rc2d_gpu_compileSPIRVFromHLSLCached(&hlslInfo, &spirvByteCodeSize);
+    RC2D_safe_free(codeHLSLSource);
+    if (spirvByteCode == NULL || spirvByteCodeSize == 0)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to compile HLSL to SPIR-V during reload: %s", filename);
+        return NULL;
+    }
+
+    // Réfléchir les métadonnées
+    SDL_ShaderCross_GraphicsShaderMetadata* metadata = SDL_ShaderCross_ReflectGraphicsSPIRV(
+        spirvByteCode, 
+        spirvByteCodeSize, 
+        0
+    );
+    if (!metadata) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to reflect graphics shader metadata during reload: %s", filename);
+        RC2D_safe_free(spirvByteCode);
+        return NULL;
+    }
+
+    // Préparer les informations SPIR-V
+    SDL_ShaderCross_SPIRV_Info spirvInfo = {
+        .bytecode = spirvByteCode,
+        .bytecode_size = spirvByteCodeSize,
+        .entrypoint = "main",
+        .shader_stage = (SDL_ShaderCross_ShaderStage)stage,
+        .enable_debug = true,
+        .name = filename,
+        .props = 0
+    };
+
+    // Compiler le shader
+    SDL_GPUShader* shader = SDL_ShaderCross_CompileGraphicsShaderFromSPIRV(
+        rc2d_gpu_getDevice(),
+        &spirvInfo,
+        metadata,
+        0
+    );
+
+    // Libérer les ressources allouées pour les métadonnées et le code SPIR-V
+    RC2D_safe_free(metadata);
+    RC2D_safe_free(spirvByteCode);
+    return shader;
+}
+
+/**
+ * Recompile un compute shader depuis sa source HLSL (thread de rechargement).
+ */
+static SDL_GPUComputePipeline* rc2d_shaderreload_compileComputePipeline(const char* filename)
+{
+    char* codeHLSLSource = rc2d_shaderreload_loadSource(filename);
+    if (codeHLSLSource == NULL) return NULL;
+
+    // Préparer les informations HLSL
+    SDL_ShaderCross_HLSL_Info hlslInfo = {
+        .source = codeHLSLSource,
+        .entrypoint = "main",
+        .include_dir = NULL,
+        .defines = NULL,
+        .shader_stage = SDL_SHADERCROSS_SHADERSTAGE_COMPUTE,
+        .enable_debug = true,
+        .name = filename,
+        .props = 0
+    };
+
+    // Compiler HLSL vers SPIR-V
+    size_t spirvSize = 0;
+    void* spirvBytecode = rc2d_gpu_compileSPIRVFromHLSLCached(&hlslInfo, &spirvSize);
+    RC2D_safe_free(codeHLSLSource);
+    if (spirvBytecode == NULL || spirvSize == 0)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to compile HLSL to SPIR-V during reload: %s", filename);
+        return NULL;
+    }
 
     /**
-     * Parcourir tous les compute shaders dans le cache
-     * et vérifier s'ils ont été modifiés depuis leur dernière compilation.
+     * Réfléchir les métadonnées
+     * 
+     * ATTENTION : La documentation de SDL_ShaderCross_ReflectComputeSPIRV, dis de libérer les ressources allouées
+     * pour les métadonnées, mais pour le compute shader, il n'y a pas de métadonnées à libérer, il est déjà
+     * libérer en interne par SDL_shadercross.
      */
-    for (int i = 0; i < rc2d_engine_state.gpu_compute_shader_count; i++) 
+    SDL_ShaderCross_ComputePipelineMetadata* metadata = SDL_ShaderCross_ReflectComputeSPIRV(
+        spirvBytecode, spirvSize, 0
+    );
+    if (!metadata) 
     {
-        // Récupérer le shader de calcul à partir du cache
-        RC2D_ComputeShaderEntry* entry = &rc2d_engine_state.gpu_compute_shaders_cache[i];
+        RC2D_log(RC2D_LOG_ERROR, "Failed to reflect compute pipeline metadata during reload: %s", filename);
+        RC2D_safe_free(spirvBytecode);
+        return NULL;
+    }
 
-        // Construire le chemin complet vers le fichier HLSL source
-        char fullPath[512];
-        SDL_snprintf(fullPath, sizeof(fullPath), "%sshaders/src/%s.hlsl", basePath, entry->filename);
+    // Préparer les informations SPIR-V
+    SDL_ShaderCross_SPIRV_Info spirvInfo = {
+        .bytecode = spirvBytecode,
+        .bytecode_size = spirvSize,
+        .entrypoint = "main",
+        .shader_stage = SDL_SHADERCROSS_SHADERSTAGE_COMPUTE,
+        .enable_debug = true,
+        .name = filename,
+        .props = 0
+    };
 
-        // Vérifier le timestamp de dernière modification
-        SDL_Time currentModified = rc2d_gpu_getFileModificationTime(fullPath);
-        if (currentModified <= entry->lastModified) 
+    // Compiler le pipeline de calcul
+    SDL_GPUComputePipeline* computePipeline = SDL_ShaderCross_CompileComputePipelineFromSPIRV(
+        rc2d_gpu_getDevice(),
+        &spirvInfo,
+        metadata,
+        0
+    );
+
+    // Libérer les ressources allouées pour les métadonnées et le code SPIR-V
+    RC2D_safe_free(metadata);
+    RC2D_safe_free(spirvBytecode);
+    return computePipeline;
+}
+
+/**
+ * Reconstruit, avec le nouveau shader du travail, tous les pipelines graphiques qui l'utilisent (thread de rechargement).
+ * 
+ * Les descriptions sont copiées sous le mutex des pipelines, puis les pipelines sont créés sans verrou.
+ * L'autre étage de chaque pipeline utilise le dernier shader compilé par ce thread s'il n'a pas encore été échangé.
+ */
+static void rc2d_shaderreload_rebuildPipelines(RC2D_ShaderReloadJob* job)
+{
+    typedef struct {
+        SDL_GPUGraphicsPipelineCreateInfo create_info;
+        const char* debug_name;
+        const char* other_filename;
+    } RC2D_PipelineSnapshot;
+
+    const RC2D_GraphicsShaderEntry* entry = job->graphicsEntry;
+    const bool isVertex = job->stage == SDL_GPU_SHADERSTAGE_VERTEX;
+    RC2D_PipelineSnapshot* snapshots = NULL;
+
+    SDL_LockMutex(rc2d_engine_state.gpu_graphics_pipeline_mutex);
+
+    // Compter les pipelines qui utilisent ce shader
+    int count = 0;
+    for (int i = 0; i < rc2d_engine_state.gpu_graphics_pipeline_count; i++) 
+    {
+        const RC2D_GraphicsPipelineEntry* pipeline = rc2d_engine_state.gpu_graphics_pipelines_cache[i];
+        if (isVertex ? (pipeline->vertex_shader_hash == entry->filename_hash && SDL_strcmp(pipeline->vertex_shader_filename, entry->filename) == 0)
+                     : (pipeline->fragment_shader_hash == entry->filename_hash && SDL_strcmp(pipeline->fragment_shader_filename, entry->filename) == 0)) 
         {
-            // Pas de modification, passer au shader suivant
-            continue;
+            count++;
         }
+    }
 
-        /**
-         * Charger le fichier HLSL
-         * 
-         * Attend un peu que l'os ou l'ide est le temps d'écrire le 
-         * fichier avant de le lire
-         */
-        char* codeHLSLSource = NULL;
-        for (int attempt = 0; attempt < 3; attempt++) 
+    if (count > 0) 
+    {
+        job->pipelines = RC2D_calloc(count, sizeof(RC2D_ShaderReloadPipeline));
+        snapshots = RC2D_calloc(count, sizeof(RC2D_PipelineSnapshot));
+        if (job->pipelines == NULL || snapshots == NULL) 
         {
-            codeHLSLSource = SDL_LoadFile(fullPath, NULL);
-            if (codeHLSLSource != NULL) break;
-            SDL_Delay(20); // Attendre un peu au cas où le fichier est en cours d'écriture
+            RC2D_safe_free(job->pipelines);
+            RC2D_safe_free(snapshots);
+            count = 0;
         }
+    }
 
-        /**
-         * Si le code HLSL n'a pas pu être chargé après plusieurs tentatives, log l'erreur
-         * et continuer avec le prochain shader de calcul.
-         */
-        if (!codeHLSLSource) 
+    // Copier les descriptions des pipelines concernés
+    for (int i = 0, j = 0; j < count && i < rc2d_engine_state.gpu_graphics_pipeline_count; i++) 
+    {
+        const RC2D_GraphicsPipelineEntry* pipeline = rc2d_engine_state.gpu_graphics_pipelines_cache[i];
+        if (isVertex ? (pipeline->vertex_shader_hash == entry->filename_hash && SDL_strcmp(pipeline->vertex_shader_filename, entry->filename) == 0)
+                     : (pipeline->fragment_shader_hash == entry->filename_hash && SDL_strcmp(pipeline->fragment_shader_filename, entry->filename) == 0)) 
         {
-            RC2D_log(RC2D_LOG_ERROR, "Failed to load HLSL shader source after retries: %s", fullPath);
-            continue;
+            job->pipelines[j].graphicsPipeline = pipeline->graphicsPipeline;
+            snapshots[j].create_info = pipeline->graphicsPipeline->create_info;
+            snapshots[j].debug_name = pipeline->graphicsPipeline->debug_name;
+            snapshots[j].other_filename = isVertex ? pipeline->fragment_shader_filename : pipeline->vertex_shader_filename;
+            j++;
         }
+    }
+    job->pipeline_count = count;
 
-        // Préparer les informations HLSL
-        SDL_ShaderCross_HLSL_Info hlslInfo = {
-            .source = codeHLSLSource,
-            .entrypoint = "main",
-            .include_dir = NULL,
-            .defines = NULL,
-            .shader_stage = SDL_SHADERCROSS_SHADERSTAGE_COMPUTE,
-            .enable_debug = true,
-            .name = entry->filename,
-            .props = 0
-        };
-
-        // Mesurer le temps de compilation
-        Uint64 t0 = SDL_GetPerformanceCounter();
-
-        // Compiler HLSL vers SPIR-V
-        size_t spirvSize = 0;
-        void* spirvBytecode = SDL_ShaderCross_CompileSPIRVFromHLSL(&hlslInfo, &spirvSize);
-    
-        // Libérer le code HLSL source après la compilation
-        RC2D_safe_free(codeHLSLSource);
+    SDL_UnlockMutex(rc2d_engine_state.gpu_graphics_pipeline_mutex);
 
-        // Vérifier si la compilation HLSL vers SPIR-V a réussi
-        if (spirvBytecode == NULL || spirvSize == 0)
+    // Créer les nouveaux pipelines, l'ancien pipeline continue d'être utilisé pour le rendu en attendant
+    for (int j = 0; j < count; j++) 
+    {
+        SDL_GPUGraphicsPipelineCreateInfo* info = &snapshots[j].create_info;
+        SDL_GPUShader* otherShader = snapshots[j].other_filename ? (SDL_GPUShader*)rc2d_hashmap_get(rc2d_shaderreload.latest_shaders, snapshots[j].other_filename) : NULL;
+        if (isVertex) 
         {
-            RC2D_log(RC2D_LOG_ERROR, "Failed to compile HLSL to SPIR-V during reload: %s", entry->filename);
-            continue;
+            info->vertex_shader = job->shader;
+            if (otherShader) info->fragment_shader = otherShader;
+        } 
+        else 
+        {
+            info->fragment_shader = job->shader;
+            if (otherShader) info->vertex_shader = otherShader;
         }
 
-        /**
-         * Réfléchir les métadonnées
-         * 
-         * ATTENTION : La documentation de SDL_ShaderCross_ReflectComputeSPIRV, dis de libérer les ressources allouées
-         * pour les métadonnées, mais pour le compute shader, il n'y a pas de métadonnées à libérer, il est déjà
-         * libérer en interne par SDL_shadercross.
-         */
-        SDL_ShaderCross_ComputePipelineMetadata* metadata = SDL_ShaderCross_ReflectComputeSPIRV(
-            spirvBytecode, spirvSize, 0
-        );
-        // Vérifier si la réflexion des métadonnées a réussi
-        if (!metadata) 
+        job->pipelines[j].pipeline = rc2d_gpu_createGraphicsPipelineObject(info, snapshots[j].debug_name);
+        if (job->pipelines[j].pipeline == NULL) 
         {
-            RC2D_log(RC2D_LOG_ERROR, "Failed to reflect compute pipeline metadata during reload: %s", entry->filename);
-            RC2D_safe_free(spirvBytecode);
-            continue;
+            RC2D_log(RC2D_LOG_ERROR, "Failed to rebuild pipeline for shader %s, keeping the previous one: %s", job->filename, SDL_GetError());
         }
+    }
 
-        // Préparer les informations SPIR-V
-        SDL_ShaderCross_SPIRV_Info spirvInfo = {
-            .bytecode = spirvBytecode,
-            .bytecode_size = spirvSize,
-            .entrypoint = "main",
-            .shader_stage = SDL_SHADERCROSS_SHADERSTAGE_COMPUTE,
-            .enable_debug = true,
-            .name = entry->filename,
-            .props = 0
-        };
-
-        // Compiler le pipeline de calcul
-        SDL_GPUComputePipeline* newShader = SDL_ShaderCross_CompileComputePipelineFromSPIRV(
-            rc2d_gpu_getDevice(),
-            &spirvInfo,
-            metadata,
-            0
-        );
-
-        // Calculer le temps de compilation
-        Uint64 t1 = SDL_GetPerformanceCounter();
-        double compileTimeMs = (double)(t1 - t0) * 1000.0 / SDL_GetPerformanceFrequency();
+    RC2D_safe_free(snapshots);
+}
 
-        // Libérer les ressources allouées pour les métadonnées et le code SPIR-V
-        RC2D_safe_free(metadata);
-        RC2D_safe_free(spirvBytecode);
+/**
+ * Exécute un travail de recompilation (thread de rechargement).
+ */
+static void rc2d_shaderreload_process(RC2D_ShaderReloadJob* job)
+{
+    Uint64 t0 = SDL_GetPerformanceCounter();
 
-        if (newShader) 
+    if (job->kind == RC2D_SHADER_RELOAD_GRAPHICS) 
+    {
+        job->shader = rc2d_shaderreload_compileGraphicsShader(job->filename, job->stage);
+        if (job->shader) 
         {
-            /**
-             * Soumettre le buffer de commandes actuel et attendre que le GPU ait fini de traiter
-             * On utilise SDL_SubmitGPUCommandBufferAndAcquireFence pour soumettre le buffer de commandes
-             * et acquérir une fence pour synchroniser l'attente.
-             */
-            SDL_GPUFence* fence = NULL;
-            if (rc2d_engine_state.gpu_current_command_buffer) 
-            {
-                // Soumettre le buffer de commandes actuel et acquérir une fence
-                fence = SDL_SubmitGPUCommandBufferAndAcquireFence(rc2d_engine_state.gpu_current_command_buffer);
-                if (!fence) 
-                {
-                    RC2D_log(RC2D_LOG_ERROR, "Failed to submit command buffer and acquire fence : %s", SDL_GetError());
-                    SDL_ReleaseGPUComputePipeline(rc2d_gpu_getDevice(), newShader);
-                    continue;
-                }
+            rc2d_hashmap_put(rc2d_shaderreload.latest_shaders, job->filename, job->shader);
+            rc2d_shaderreload_rebuildPipelines(job);
+        }
+    } 
+    else 
+    {
+        job->computePipeline = rc2d_shaderreload_compileComputePipeline(job->filename);
+    }
 
-                // Attendre que le GPU ait fini de traiter le buffer
-                if (!SDL_WaitForGPUFences(rc2d_gpu_getDevice(), true, &fence, 1)) 
-                {
-                    RC2D_log(RC2D_LOG_ERROR, "Failed to wait for GPU fence : %s", SDL_GetError());
-                    SDL_ReleaseGPUComputePipeline(rc2d_gpu_getDevice(), newShader);
-                    continue;
-                }
+    Uint64 t1 = SDL_GetPerformanceCounter();
+    job->compile_time_ms = (double)(t1 - t0) * 1000.0 / SDL_GetPerformanceFrequency();
+}
 
-                // Libérer la fence après utilisation
-                SDL_ReleaseGPUFence(rc2d_gpu_getDevice(), fence);
-            }
+static int SDLCALL rc2d_shaderreload_thread(void* userdata)
+{
+    (void)userdata;
 
-            // Acquérir un nouveau command buffer
-            rc2d_engine_state.gpu_current_command_buffer = SDL_AcquireGPUCommandBuffer(rc2d_gpu_getDevice());
-            if (!rc2d_engine_state.gpu_current_command_buffer) 
-            {
-                RC2D_log(RC2D_LOG_ERROR, "Failed to acquire new command buffer after shader reload : %s", SDL_GetError());
-                SDL_ReleaseGPUComputePipeline(rc2d_gpu_getDevice(), newShader);
-                continue;
-            }
+    while (true) 
+    {
+        SDL_WaitSemaphore(rc2d_shaderreload.wake);
+        if (!SDL_GetAtomicInt(&rc2d_shaderreload.running)) break;
 
-            // Libérer l'ancien compute shader
-            if (entry->shader) 
-            {
-                SDL_ReleaseGPUComputePipeline(rc2d_gpu_getDevice(), entry->shader);
-            }
+        SDL_LockMutex(rc2d_shaderreload.mutex);
+        RC2D_ShaderReloadJob* job = rc2d_shaderreload.queued_head;
+        if (job != NULL) 
+        {
+            rc2d_shaderreload.queued_head = job->next;
+            if (rc2d_shaderreload.queued_head == NULL) rc2d_shaderreload.queued_tail = NULL;
+            job->next = NULL;
+        }
+        SDL_UnlockMutex(rc2d_shaderreload.mutex);
 
-            // Remplacer l'ancien compute shader par le nouveau compute shader, dans le cache de RC2D
-            entry->shader = newShader;
+        if (job == NULL) continue;
 
-            // Mettre à jour le timestamp de dernière modification, c'est le moment où le shader a été rechargé (donc le timestamp actuel)
-            entry->lastModified = currentModified;
+        rc2d_shaderreload_process(job);
 
-            RC2D_log(RC2D_LOG_INFO, "Successfully reloaded compute shader %s in %.2f ms", entry->filename, compileTimeMs);
-        } 
-        else 
-        {
-            RC2D_log(RC2D_LOG_ERROR, "Failed to reload compute shader: %s", entry->filename);
-        }
+        // Rendre le résultat au thread principal, qui l'échangera au début de la prochaine frame
+        SDL_LockMutex(rc2d_shaderreload.mutex);
+        if (rc2d_shaderreload.done_tail) rc2d_shaderreload.done_tail->next = job;
+        else rc2d_shaderreload.done_head = job;
+        rc2d_shaderreload.done_tail = job;
+        SDL_SetAtomicInt(&rc2d_shaderreload.has_done, 1);
+        SDL_UnlockMutex(rc2d_shaderreload.mutex);
     }
 
-    /**
-     * Unlock le mutex pour permettre l'accès concurrent aux compute shaders
-     * après la mise à jour des shaders de calcul.
-     */
-    SDL_UnlockMutex(rc2d_engine_state.gpu_compute_shader_mutex);
-#endif
+    return 0;
 }
 
-bool rc2d_gpu_createGraphicsPipeline(RC2D_GPUGraphicsPipeline* graphicsPipeline)
+/**
+ * Ajoute un travail à la file du thread de rechargement (thread principal).
+ */
+static void rc2d_shaderreload_enqueue(RC2D_ShaderReloadKind kind, const char* filename, SDL_GPUShaderStage stage,
+                                      RC2D_GraphicsShaderEntry* graphicsEntry, RC2D_ComputeShaderEntry* computeEntry)
 {
-    // Vérification des paramètres d'entrée
-    RC2D_assert_release(graphicsPipeline != NULL, RC2D_LOG_CRITICAL, "pipeline is NULL");
+    RC2D_ShaderReloadJob* job = RC2D_calloc(1, sizeof(RC2D_ShaderReloadJob));
+    if (job == NULL) return;
 
-    // Créer props pour le nom de débogage si nécessaire
-    SDL_PropertiesID props = 0;
-    if (graphicsPipeline->debug_name != NULL)
+    // Le nom est copié : la liste des shaders modifiés du watcher est libérée à la fin de la frame
+    job->filename = RC2D_strdup(filename);
+    if (job->filename == NULL) 
     {
-        props = SDL_CreateProperties();
-        SDL_SetStringProperty(props, SDL_PROP_GPU_GRAPHICSPIPELINE_CREATE_NAME_STRING, graphicsPipeline->debug_name);
+        RC2D_free(job);
+        return;
     }
+    job->kind = kind;
+    job->stage = stage;
+    job->graphicsEntry = graphicsEntry;
+    job->computeEntry = computeEntry;
+
+    SDL_LockMutex(rc2d_shaderreload.mutex);
+    if (rc2d_shaderreload.queued_tail) rc2d_shaderreload.queued_tail->next = job;
+    else rc2d_shaderreload.queued_head = job;
+    rc2d_shaderreload.queued_tail = job;
+    SDL_UnlockMutex(rc2d_shaderreload.mutex);
+
+    SDL_SignalSemaphore(rc2d_shaderreload.wake);
+}
 
-    // Copie la structure pour injection, en modifiant uniquement props
-    SDL_GPUGraphicsPipelineCreateInfo info = graphicsPipeline->create_info;
-    info.props = props;
+/**
+ * Met de côté un objet remplacé jusqu'à ce que les frames en vol qui l'utilisaient soient terminées (thread principal).
+ */
+static void rc2d_shaderreload_retire(SDL_GPUShader* shader, SDL_GPUGraphicsPipeline* pipeline, SDL_GPUComputePipeline* computePipeline)
+{
+    if (shader == NULL && pipeline == NULL && computePipeline == NULL) return;
 
-    // Créer le pipeline graphique
-    graphicsPipeline->pipeline = SDL_CreateGPUGraphicsPipeline(rc2d_gpu_getDevice(), &info);
-    SDL_DestroyProperties(props);
-    if (graphicsPipeline->pipeline == NULL) 
+    if (rc2d_shaderreload.retired_count == rc2d_shaderreload.retired_capacity) 
     {
-        // Si la création du pipeline échoue, on log l'erreur
-        RC2D_log(RC2D_LOG_ERROR, "Failed to create graphics pipeline: %s", SDL_GetError());
-        return false;
+        int capacity = rc2d_shaderreload.retired_capacity ? rc2d_shaderreload.retired_capacity * 2 : 16;
+        RC2D_ShaderReloadRetired* retired = RC2D_realloc(rc2d_shaderreload.retired, capacity * sizeof(RC2D_ShaderReloadRetired));
+        if (retired == NULL) 
+        {
+            // Sans place pour différer la libération, on attend que le GPU soit inactif
+            SDL_WaitForGPUIdle(rc2d_gpu_getDevice());
+            if (shader) SDL_ReleaseGPUShader(rc2d_gpu_getDevice(), shader);
+            if (pipeline) SDL_ReleaseGPUGraphicsPipeline(rc2d_gpu_getDevice(), pipeline);
+            if (computePipeline) SDL_ReleaseGPUComputePipeline(rc2d_gpu_getDevice(), computePipeline);
+            return;
+        }
+        rc2d_shaderreload.retired = retired;
+        rc2d_shaderreload.retired_capacity = capacity;
     }
 
-    /**
-     * On lock le mutex pour éviter les accès concurrents
-     * lors de l'ajout du pipeline graphique au cache.
-     */
-    SDL_LockMutex(rc2d_engine_state.gpu_graphics_pipeline_mutex);
-
-    /**
-     * ON réalloue le cache des pipelines graphiques pour ajouter le nouveau pipeline graphique.
-     */
-    RC2D_GraphicsPipelineEntry* newPipelines = RC2D_realloc(
-        rc2d_engine_state.gpu_graphics_pipelines_cache,
-        (rc2d_engine_state.gpu_graphics_pipeline_count + 1) * sizeof(RC2D_GraphicsPipelineEntry)
-    );
-
-    // Vérifier si la réallocation a réussi
-    RC2D_assert_release(newPipelines != NULL, RC2D_LOG_CRITICAL, "Failed to realloc pipeline cache");
-
-    // Mettre à jour le cache des pipelines graphiques avec le nouveau pipeline graphique
-    rc2d_engine_state.gpu_graphics_pipelines_cache = newPipelines;
+    RC2D_ShaderReloadRetired* slot = &rc2d_shaderreload.retired[rc2d_shaderreload.retired_count++];
+    slot->shader = shader;
+    slot->pipeline = pipeline;
+    slot->computePipeline = computePipeline;
 
-    // Si on ajoute le pipeline graphique au cache, on crée une nouvelle entrée
-    RC2D_GraphicsPipelineEntry* entry = &rc2d_engine_state.gpu_graphics_pipelines_cache[rc2d_engine_state.gpu_graphics_pipeline_count++];
-    entry->graphicsPipeline = graphicsPipeline;
-    entry->vertex_shader_filename = RC2D_strdup(graphicsPipeline->vertex_shader_filename);
-    entry->fragment_shader_filename = RC2D_strdup(graphicsPipeline->fragment_shader_filename);
+    // La frame courante a pu être soumise avec l'ancien objet : on attend que toutes les frames en vol soient terminées
+    slot->release_frame = rc2d_shaderreload.frame + (Uint64)rc2d_engine_state.config->gpuFramesInFlight + 1;
+}
 
-    /**
-     * On unlock le mutex après avoir ajouté le pipeline graphique au cache.
-     * Cela permet aux autres threads d'accéder au cache des pipelines graphiques.
-     */
-    SDL_UnlockMutex(rc2d_engine_state.gpu_graphics_pipeline_mutex);
+/**
+ * Libère les objets remplacés dont les frames en vol sont terminées, ou tous si `all` est vrai (GPU inactif).
+ */
+static void rc2d_shaderreload_releaseRetired(bool all)
+{
+    int kept = 0;
+    for (int i = 0; i < rc2d_shaderreload.retired_count; i++) 
+    {
+        RC2D_ShaderReloadRetired* slot = &rc2d_shaderreload.retired[i];
+        if (!all && slot->release_frame > rc2d_shaderreload.frame) 
+        {
+            rc2d_shaderreload.retired[kept++] = *slot;
+            continue;
+        }
 
-    return true;
+        if (slot->shader) SDL_ReleaseGPUShader(rc2d_gpu_getDevice(), slot->shader);
+        if (slot->pipeline) SDL_ReleaseGPUGraphicsPipeline(rc2d_gpu_getDevice(), slot->pipeline);
+        if (slot->computePipeline) SDL_ReleaseGPUComputePipeline(rc2d_gpu_getDevice(), slot->computePipeline);
+    }
+    rc2d_shaderreload.retired_count = kept;
 }
 
-void rc2d_gpu_bindGraphicsPipeline(RC2D_GPUGraphicsPipeline* graphicsPipeline)
+/**
+ * Libère un travail, et les objets qu'il a créés si `releaseResults` est vrai (travail jamais échangé).
+ */
+static void rc2d_shaderreload_freeJob(RC2D_ShaderReloadJob* job, bool releaseResults)
 {
-    RC2D_assert_release(graphicsPipeline != NULL, RC2D_LOG_CRITICAL, "graphicsPipeline is NULL");
-    RC2D_assert_release(graphicsPipeline->pipeline != NULL, RC2D_LOG_CRITICAL, "Attempted to bind NULL graphics pipeline");
+    if (releaseResults) 
+    {
+        if (job->shader) SDL_ReleaseGPUShader(rc2d_gpu_getDevice(), job->shader);
+        if (job->computePipeline) SDL_ReleaseGPUComputePipeline(rc2d_gpu_getDevice(), job->computePipeline);
+        for (int i = 0; i < job->pipeline_count; i++) 
+        {
+            if (job->pipelines[i].pipeline) SDL_ReleaseGPUGraphicsPipeline(rc2d_gpu_getDevice(), job->pipelines[i].pipeline);
+        }
+    }
 
-    // Bind le pipeline graphique
-    SDL_BindGPUGraphicsPipeline(rc2d_engine_state.gpu_current_render_pass, graphicsPipeline->pipeline);
+    RC2D_safe_free(job->pipelines);
+    RC2D_safe_free(job->filename);
+    RC2D_free(job);
 }
 
-// TODO: Disponible à partir de SDL 3.4.0 (pour la fonction : SDL_GetGPUShaderFormats)
-/*void rc2d_gpu_getInfo(RC2D_GPUInfo* gpuInfo) 
+/**
+ * Échange le shader (et ses pipelines) ou le compute shader d'un travail terminé (thread principal).
+ */
+static void rc2d_shaderreload_apply(RC2D_ShaderReloadJob* job)
+{
+    if (job->kind == RC2D_SHADER_RELOAD_COMPUTE) 
+    {
+        if (job->computePipeline == NULL) 
+        {
+            RC2D_log(RC2D_LOG_ERROR, "Failed to reload compute shader: %s", job->filename);
+            return;
+        }
+
+        /**
+         * Remplacer l'ancien compute shader par le nouveau compute shader, dans le cache de RC2D.
+         * Le remplacement est atomique car l'index est lu sans verrou.
+         */
+        SDL_LockMutex(rc2d_engine_state.gpu_compute_shader_mutex);
+        RC2D_GPUComputePipeline* oldShader = (RC2D_GPUComputePipeline*)SDL_GetAtomicPointer((void**)&job->computeEntry->shader);
+        SDL_SetAtomicPointer((void**)&job->computeEntry->shader, job->computePipeline);
+        SDL_UnlockMutex(rc2d_engine_state.gpu_compute_shader_mutex);
+
+        rc2d_shaderreload_retire(NULL, NULL, oldShader);
+        job->computePipeline = NULL;
+
+        RC2D_log(RC2D_LOG_INFO, "Successfully reloaded compute shader %s in %.2f ms", job->filename, job->compile_time_ms);
+        return;
+    }
+
+    if (job->shader == NULL) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to reload shader: %s", job->filename);
+        return;
+    }
+
+    /**
+     * Remplacer l'ancien shader graphique par le nouveau shader graphique, dans le cache de RC2D.
+     * Le remplacement est atomique car l'index est lu sans verrou.
+     */
+    SDL_LockMutex(rc2d_engine_state.gpu_graphics_shader_mutex);
+    RC2D_GPUShader* oldShader = (RC2D_GPUShader*)SDL_GetAtomicPointer((void**)&job->graphicsEntry->shader);
+    SDL_SetAtomicPointer((void**)&job->graphicsEntry->shader, job->shader);
+    SDL_UnlockMutex(rc2d_engine_state.gpu_graphics_shader_mutex);
+    rc2d_shaderreload_retire(oldShader, NULL, NULL);
+
+    // Échanger les pipelines reconstruits, les anciens sont libérés une fois les frames en vol terminées
+    SDL_LockMutex(rc2d_engine_state.gpu_graphics_pipeline_mutex);
+    for (int i = 0; i < job->pipeline_count; i++) 
+    {
+        RC2D_GPUGraphicsPipeline* graphicsPipeline = job->pipelines[i].graphicsPipeline;
+
+        // La description référence toujours le dernier shader, même si la reconstruction a échoué
+        if (job->stage == SDL_GPU_SHADERSTAGE_VERTEX) 
+        {
+            graphicsPipeline->create_info.vertex_shader = job->shader;
+        } 
+        else 
+        {
+            graphicsPipeline->create_info.fragment_shader = job->shader;
+        }
+
+        if (job->pipelines[i].pipeline) 
+        {
+            rc2d_shaderreload_retire(NULL, graphicsPipeline->pipeline, NULL);
+            graphicsPipeline->pipeline = job->pipelines[i].pipeline;
+            job->pipelines[i].pipeline = NULL;
+
+            RC2D_log(RC2D_LOG_DEBUG, "Successfully rebuilt graphics pipeline using shader: %s", job->filename);
+        }
+    }
+    SDL_UnlockMutex(rc2d_engine_state.gpu_graphics_pipeline_mutex);
+
+    job->shader = NULL;
+
+    // Log la réussite du rechargement du shader
+    RC2D_log(RC2D_LOG_INFO, "Successfully Shader %s reloaded in %.2f ms", job->filename, job->compile_time_ms);
+}
+
+bool rc2d_gpu_shaderReloadInit(void)
+{
+    rc2d_shaderreload.mutex = SDL_CreateMutex();
+    rc2d_shaderreload.wake = SDL_CreateSemaphore(0);
+    rc2d_shaderreload.latest_shaders = rc2d_hashmap_create(32);
+    if (rc2d_shaderreload.mutex == NULL || rc2d_shaderreload.wake == NULL || rc2d_shaderreload.latest_shaders == NULL) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to create shader reload worker state: %s", SDL_GetError());
+        rc2d_gpu_shaderReloadQuit();
+        return false;
+    }
+
+    SDL_SetAtomicInt(&rc2d_shaderreload.running, 1);
+    rc2d_shaderreload.thread = SDL_CreateThread(rc2d_shaderreload_thread, "rc2d_shader_reload", NULL);
+    if (rc2d_shaderreload.thread == NULL) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to create shader reload thread: %s", SDL_GetError());
+        rc2d_gpu_shaderReloadQuit();
+        return false;
+    }
+
+    return true;
+}
+
+void rc2d_gpu_shaderReloadQuit(void)
+{
+    if (rc2d_shaderreload.thread) 
+    {
+        SDL_SetAtomicInt(&rc2d_shaderreload.running, 0);
+        SDL_SignalSemaphore(rc2d_shaderreload.wake);
+        SDL_WaitThread(rc2d_shaderreload.thread, NULL);
+        rc2d_shaderreload.thread = NULL;
+    }
+
+    // Le GPU est inactif : les résultats jamais échangés et les objets remplacés peuvent être libérés
+    while (rc2d_shaderreload.queued_head) 
+    {
+        RC2D_ShaderReloadJob* next = rc2d_shaderreload.queued_head->next;
+        rc2d_shaderreload_freeJob(rc2d_shaderreload.queued_head, false);
+        rc2d_shaderreload.queued_head = next;
+    }
+    while (rc2d_shaderreload.done_head) 
+    {
+        RC2D_ShaderReloadJob* next = rc2d_shaderreload.done_head->next;
+        rc2d_shaderreload_freeJob(rc2d_shaderreload.done_head, true);
+        rc2d_shaderreload.done_head = next;
+    }
+    rc2d_shaderreload.queued_tail = NULL;
+    rc2d_shaderreload.done_tail = NULL;
+    SDL_SetAtomicInt(&rc2d_shaderreload.has_done, 0);
+
+    rc2d_shaderreload_releaseRetired(true);
+    RC2D_safe_free(rc2d_shaderreload.retired);
+    rc2d_shaderreload.retired_capacity = 0;
+
+    rc2d_hashmap_destroy(rc2d_shaderreload.latest_shaders);
+    rc2d_shaderreload.latest_shaders = NULL;
+    if (rc2d_shaderreload.wake) 
+    {
+        SDL_DestroySemaphore(rc2d_shaderreload.wake);
+        rc2d_shaderreload.wake = NULL;
+    }
+    if (rc2d_shaderreload.mutex) 
+    {
+        SDL_DestroyMutex(rc2d_shaderreload.mutex);
+        rc2d_shaderreload.mutex = NULL;
+    }
+}
+
+void rc2d_gpu_shaderReloadNewFrame(void)
+{
+    rc2d_shaderreload.frame++;
+    if (rc2d_shaderreload.retired_count > 0) rc2d_shaderreload_releaseRetired(false);
+
+    // Rien à échanger : aucun verrou
+    if (!SDL_GetAtomicInt(&rc2d_shaderreload.has_done)) return;
+
+    SDL_LockMutex(rc2d_shaderreload.mutex);
+    RC2D_ShaderReloadJob* job = rc2d_shaderreload.done_head;
+    rc2d_shaderreload.done_head = NULL;
+    rc2d_shaderreload.done_tail = NULL;
+    SDL_SetAtomicInt(&rc2d_shaderreload.has_done, 0);
+    SDL_UnlockMutex(rc2d_shaderreload.mutex);
+
+    // Les travaux sont échangés dans l'ordre où ils ont été terminés
+    while (job) 
+    {
+        RC2D_ShaderReloadJob* next = job->next;
+        rc2d_shaderreload_apply(job);
+        rc2d_shaderreload_freeJob(job, true);
+        job = next;
+    }
+}
+#endif
+
+void rc2d_gpu_hotReloadGraphicsShadersAndGraphicsPipeline(void)
+{
+#if RC2D_GPU_SHADER_HOT_RELOAD_ENABLED
+    /**
+     * Vérifier si le mutex pour les shaders graphiques est initialisé
+     */
+    if (!rc2d_engine_state.gpu_graphics_shader_mutex)
+    {
+        RC2D_assert_release(false, RC2D_LOG_CRITICAL, "gpu_graphics_shader_mutex is NULL");
+    }
+
+    // Sans thread de rechargement, les shaders ne sont pas rechargés à chaud
+    if (rc2d_shaderreload.thread == NULL) return;
+
+    /**
+     * Récupérer le chemin de base de l'application (où est exécuté l'exécutable)
+     */
+    const char* basePath = SDL_GetBasePath();
+    if (basePath == NULL) 
+    {
+        RC2D_assert_release(false, RC2D_LOG_CRITICAL, "SDL_GetBasePath() failed, SDL_Error: %s", SDL_GetError());
+        return;
+    }
+
+    /**
+     * On verrouille le mutex pour parcourir le cache des shaders graphiques.
+     * La recompilation et la reconstruction des pipelines se font sur le thread de rechargement :
+     * les anciens objets continuent d'être utilisés jusqu'à l'échange par rc2d_gpu_shaderReloadNewFrame.
+     */
+    SDL_LockMutex(rc2d_engine_state.gpu_graphics_shader_mutex);
+
+    for (int i = 0; i < rc2d_engine_state.gpu_graphics_shader_count; i++) 
+    {
+        // Récupérer le shader graphique à partir du cache
+        RC2D_GraphicsShaderEntry* entry = rc2d_engine_state.gpu_graphics_shaders_cache[i];
+
+        // Seuls les shaders signalés par le watcher sont vérifiés sur le disque
+        if (!rc2d_gpu_shaderWatcherIsChanged(entry->filename)) continue;
+
+        // Générer le chemin d'accès complet au fichier HLSL source
+        char fullPath[512];
+        SDL_snprintf(fullPath, sizeof(fullPath), "%sshaders/src/%s.hlsl", basePath, entry->filename);
+
+        // Vérifier si le fichier HLSL source a été modifié depuis la dernière compilation
+        SDL_Time currentModified = rc2d_gpu_getFileModificationTime(fullPath);
+        if (currentModified <= entry->lastModified) continue;
+
+        // Déterminer le stage
+        SDL_GPUShaderStage stage;
+        if (SDL_strstr(entry->filename, ".vertex")) 
+        {
+            stage = SDL_GPU_SHADERSTAGE_VERTEX;
+        } 
+        else if (SDL_strstr(entry->filename, ".fragment")) 
+        {
+            stage = SDL_GPU_SHADERSTAGE_FRAGMENT;
+        } 
+        else 
+        {
+            RC2D_log(RC2D_LOG_ERROR, "Unknown shader stage for %s during reload", entry->filename);
+            continue;
+        }
+
+        /**
+         * Le timestamp est mis à jour dès maintenant : un échec de compilation sera retenté
+         * à la prochaine sauvegarde du fichier, pas à chaque frame.
+         */
+        entry->lastModified = currentModified;
+        rc2d_shaderreload_enqueue(RC2D_SHADER_RELOAD_GRAPHICS, entry->filename, stage, entry, NULL);
+    }
+
+    SDL_UnlockMutex(rc2d_engine_state.gpu_graphics_shader_mutex);
+#endif
+}
+
+void rc2d_gpu_hotReloadComputeShader(void)
+{
+#if RC2D_GPU_SHADER_HOT_RELOAD_ENABLED
+    // Vérifier que le mutex pour les compute shaders est valide
+    if (!rc2d_engine_state.gpu_compute_shader_mutex)
+    {
+        RC2D_assert_release(false, RC2D_LOG_CRITICAL, "gpu_compute_shader_mutex is NULL");
+        return;
+    }
+
+    // Sans thread de rechargement, les shaders ne sont pas rechargés à chaud
+    if (rc2d_shaderreload.thread == NULL) return;
+
+    // Récupérer le chemin de base de l'application (chemin où est exécuté l'exécutable)
+    const char* basePath = SDL_GetBasePath();
+    if (basePath == NULL) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to get base path for shader updates");
+        return;
+    }
+
+    /**
+     * On lock le mutex pour parcourir le cache des compute shaders,
+     * la recompilation se fait sur le thread de rechargement.
+     */
+    SDL_LockMutex(rc2d_engine_state.gpu_compute_shader_mutex);
+
+    for (int i = 0; i < rc2d_engine_state.gpu_compute_shader_count; i++) 
+    {
+        // Récupérer le shader de calcul à partir du cache
+        RC2D_ComputeShaderEntry* entry = rc2d_engine_state.gpu_compute_shaders_cache[i];
+
+        // Seuls les shaders signalés par le watcher sont vérifiés sur le disque
+        if (!rc2d_gpu_shaderWatcherIsChanged(entry->filename)) continue;
+
+        // Construire le chemin complet vers le fichier HLSL source
+        char fullPath[512];
+        SDL_snprintf(fullPath, sizeof(fullPath), "%sshaders/src/%s.hlsl", basePath, entry->filename);
+
+        // Vérifier le timestamp de dernière modification
+        SDL_Time currentModified = rc2d_gpu_getFileModificationTime(fullPath);
+        if (currentModified <= entry->lastModified) 
+        {
+            // Pas de modification, passer au shader suivant
+            continue;
+        }
+
+        entry->lastModified = currentModified;
+        rc2d_shaderreload_enqueue(RC2D_SHADER_RELOAD_COMPUTE, entry->filename, SDL_GPU_SHADERSTAGE_VERTEX, NULL, entry);
+    }
+
+    SDL_UnlockMutex(rc2d_engine_state.gpu_compute_shader_mutex);
+#endif
+}
+
+bool rc2d_gpu_createGraphicsPipeline(RC2D_GPUGraphicsPipeline* graphicsPipeline)
+{
+    // Vérification des paramètres d'entrée
+    RC2D_assert_release(graphicsPipeline != NULL, RC2D_LOG_CRITICAL, "pipeline is NULL");
+
+    // Créer le pipeline graphique
+    graphicsPipeline->pipeline = rc2d_gpu_createGraphicsPipelineObject(&graphicsPipeline->create_info, graphicsPipeline->debug_name);
+    if (graphicsPipeline->pipeline == NULL) 
+    {
+        // Si la création du pipeline échoue, on log l'erreur
+        RC2D_log(RC2D_LOG_ERROR, "Failed to create graphics pipeline: %s", SDL_GetError());
+        return false;
+    }
+
+    /**
+     * On lock le mutex pour éviter les accès concurrents
+     * lors de l'ajout du pipeline graphique au cache.
+     */
+    SDL_LockMutex(rc2d_engine_state.gpu_graphics_pipeline_mutex);
+
+    /**
+     * Un pipeline recréé (hot reload, ou nouvel appel de l'utilisateur) est déjà dans le cache :
+     * on ne l'ajoute pas une seconde fois.
+     */
+    if (rc2d_hashmap_getByHash(rc2d_engine_state.gpu_graphics_pipelines_index, (Uint64)(uintptr_t)graphicsPipeline) != NULL) 
+    {
+        SDL_UnlockMutex(rc2d_engine_state.gpu_graphics_pipeline_mutex);
+        return true;
+    }
+
+    /**
+     * ON réalloue le cache des pipelines graphiques pour ajouter le nouveau pipeline graphique.
+     */
+    RC2D_GraphicsPipelineEntry** newPipelines = RC2D_realloc(
+        rc2d_engine_state.gpu_graphics_pipelines_cache,
+        (rc2d_engine_state.gpu_graphics_pipeline_count + 1) * sizeof(RC2D_GraphicsPipelineEntry*)
+    );
+
+    // Vérifier si la réallocation a réussi
+    RC2D_assert_release(newPipelines != NULL, RC2D_LOG_CRITICAL, "Failed to realloc pipeline cache");
+
+    // Mettre à jour le cache des pipelines graphiques avec le nouveau pipeline graphique
+    rc2d_engine_state.gpu_graphics_pipelines_cache = newPipelines;
+
+    // Si on ajoute le pipeline graphique au cache, on crée une nouvelle entrée
+    RC2D_GraphicsPipelineEntry* entry = RC2D_malloc(sizeof(RC2D_GraphicsPipelineEntry));
+    RC2D_assert_release(entry != NULL, RC2D_LOG_CRITICAL, "Failed to allocate pipeline cache entry");
+    entry->graphicsPipeline = graphicsPipeline;
+    entry->vertex_shader_filename = RC2D_strdup(graphicsPipeline->vertex_shader_filename);
+    entry->fragment_shader_filename = RC2D_strdup(graphicsPipeline->fragment_shader_filename);
+    entry->vertex_shader_hash = rc2d_hashmap_hashString(graphicsPipeline->vertex_shader_filename);
+    entry->fragment_shader_hash = rc2d_hashmap_hashString(graphicsPipeline->fragment_shader_filename);
+    rc2d_engine_state.gpu_graphics_pipelines_cache[rc2d_engine_state.gpu_graphics_pipeline_count++] = entry;
+    rc2d_hashmap_putByHash(rc2d_engine_state.gpu_graphics_pipelines_index, (Uint64)(uintptr_t)graphicsPipeline, entry);
+
+    /**
+     * On unlock le mutex après avoir ajouté le pipeline graphique au cache.
+     * Cela permet aux autres threads d'accéder au cache des pipelines graphiques.
+     */
+    SDL_UnlockMutex(rc2d_engine_state.gpu_graphics_pipeline_mutex);
+
+    return true;
+}
+
+void rc2d_gpu_bindGraphicsPipeline(RC2D_GPUGraphicsPipeline* graphicsPipeline)
+{
+    RC2D_assert_release(graphicsPipeline != NULL, RC2D_LOG_CRITICAL, "graphicsPipeline is NULL");
+    RC2D_assert_release(graphicsPipeline->pipeline != NULL, RC2D_LOG_CRITICAL, "Attempted to bind NULL graphics pipeline");
+
+    // Bind le pipeline graphique
+    SDL_BindGPUGraphicsPipeline(rc2d_engine_state.gpu_current_render_pass, graphicsPipeline->pipeline);
+}
+
+// TODO: Disponible à partir de SDL 3.4.0 (pour la fonction : SDL_GetGPUShaderFormats)
+/*void rc2d_gpu_getInfo(RC2D_GPUInfo* gpuInfo) 
 {
     // Vérification des paramètres d'entrée
     RC2D_assert_release(gpuInfo != NULL, RC2D_LOG_CRITICAL, "GPU info is NULL.");
@@ -1333,20 +1836,206 @@ RC2D_GPUDevice* rc2d_gpu_getDevice(void)
     return rc2d_engine_state.gpu_device;
 }
 
-void rc2d_gpu_clear(void)
+/**
+ * Format de la cible hors écran du mode headless.
+ */
+#define RC2D_GPU_HEADLESS_FORMAT SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM
+
+/**
+ * Cible hors écran du mode headless. Sans swapchain, rien ne bloque le CPU : les fences des dernières
+ * soumissions bornent le nombre de frames en vol, comme le ferait SDL_WaitAndAcquireGPUSwapchainTexture.
+ */
+static struct {
+    SDL_GPUTexture* target;
+    Uint32 width;
+    Uint32 height;
+
+    SDL_GPUFence** fences;
+    Uint32 fence_count;
+    Uint32 current;
+} rc2d_gpu_headless = {0};
+
+bool rc2d_gpu_headlessInit(Uint32 width, Uint32 height, Uint32 framesInFlight)
 {
-    /**
-     * \brief Étape 1 : Acquisition d’un GPUCommandBuffer
-     *
-     * Le GPUCommandBuffer est une structure temporaire qui enregistre toutes les commandes de rendu
-     * (comme le début de render pass, les draw calls, les changements de pipeline, etc.) pour cette frame.
-     * On ne peut soumettre les commandes au GPU qu’après avoir fini d’enregistrer dans ce buffer.
-     * SDL nous fournit ce buffer via SDL_AcquireGPUCommandBuffer(), qui doit être appelé avant toute commande GPU.
-     */
-    rc2d_engine_state.gpu_current_command_buffer = SDL_AcquireGPUCommandBuffer(rc2d_gpu_getDevice());
-    RC2D_assert_release(rc2d_engine_state.gpu_current_command_buffer != NULL, RC2D_LOG_CRITICAL, "Failed to acquire GPU command buffer, SDL_Error: %s", SDL_GetError());
+    RC2D_assert_release(width > 0 && height > 0 && framesInFlight > 0, RC2D_LOG_CRITICAL, "Invalid headless target size");
 
-    /**
+    rc2d_gpu_headless.fences = RC2D_calloc(framesInFlight, sizeof(SDL_GPUFence*));
+    if (rc2d_gpu_headless.fences == NULL)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "Failed to allocate headless frame fences");
+        return false;
+    }
+    rc2d_gpu_headless.fence_count = framesInFlight;
+
+    rc2d_gpu_headless.target = SDL_CreateGPUTexture(
+        rc2d_gpu_getDevice(),
+        &(SDL_GPUTextureCreateInfo){
+            .type = SDL_GPU_TEXTURETYPE_2D,
+            .format = RC2D_GPU_HEADLESS_FORMAT,
+            .usage = SDL_GPU_TEXTUREUSAGE_COLOR_TARGET | SDL_GPU_TEXTUREUSAGE_SAMPLER,
+            .width = width,
+            .height = height,
+            .layer_count_or_depth = 1,
+            .num_levels = 1,
+            .sample_count = SDL_GPU_SAMPLECOUNT_1
+        }
+    );
+    if (rc2d_gpu_headless.target == NULL)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "Failed to create headless render target: %s", SDL_GetError());
+        rc2d_gpu_headlessQuit();
+        return false;
+    }
+    rc2d_gpu_headless.width = width;
+    rc2d_gpu_headless.height = height;
+
+    RC2D_log(RC2D_LOG_INFO, "Mode headless : rendu hors ecran en %ux%u, %u frames en vol", width, height, framesInFlight);
+    return true;
+}
+
+void rc2d_gpu_headlessQuit(void)
+{
+    for (Uint32 i = 0; i < rc2d_gpu_headless.fence_count; i++)
+    {
+        if (rc2d_gpu_headless.fences[i] != NULL)
+        {
+            SDL_ReleaseGPUFence(rc2d_gpu_getDevice(), rc2d_gpu_headless.fences[i]);
+        }
+    }
+    RC2D_safe_free(rc2d_gpu_headless.fences);
+
+    if (rc2d_gpu_headless.target != NULL)
+    {
+        SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), rc2d_gpu_headless.target);
+    }
+
+    SDL_zero(rc2d_gpu_headless);
+}
+
+/**
+ * Attend la fin de la frame soumise avec le même slot de fence, puis fournit la cible hors écran.
+ */
+static SDL_GPUTexture* rc2d_gpu_headlessAcquire(Uint32* width, Uint32* height)
+{
+    SDL_GPUFence** fence = &rc2d_gpu_headless.fences[rc2d_gpu_headless.current];
+    if (*fence != NULL)
+    {
+        SDL_WaitForGPUFences(rc2d_gpu_getDevice(), true, fence, 1);
+        SDL_ReleaseGPUFence(rc2d_gpu_getDevice(), *fence);
+        *fence = NULL;
+    }
+
+    *width = rc2d_gpu_headless.width;
+    *height = rc2d_gpu_headless.height;
+    return rc2d_gpu_headless.target;
+}
+
+/**
+ * Soumet le command buffer de la frame en conservant sa fence dans le slot courant.
+ */
+static void rc2d_gpu_headlessSubmit(SDL_GPUCommandBuffer* commandBuffer)
+{
+    SDL_GPUFence* fence = SDL_SubmitGPUCommandBufferAndAcquireFence(commandBuffer);
+    if (fence == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to submit headless frame: %s", SDL_GetError());
+    }
+
+    rc2d_gpu_headless.fences[rc2d_gpu_headless.current] = fence;
+    rc2d_gpu_headless.current = (rc2d_gpu_headless.current + 1) % rc2d_gpu_headless.fence_count;
+}
+
+SDL_GPUTextureFormat rc2d_gpu_getColorTargetFormat(void)
+{
+    if (rc2d_engine_state.config != NULL && rc2d_engine_state.config->headless)
+    {
+        return RC2D_GPU_HEADLESS_FORMAT;
+    }
+
+    return SDL_GetGPUSwapchainTextureFormat(rc2d_gpu_getDevice(), rc2d_engine_state.window);
+}
+
+SDL_GPUSampleCount rc2d_gpu_getSampleCount(void)
+{
+    return rc2d_engine_state.gpu_current_sample_count_supported;
+}
+
+SDL_GPUTexture* rc2d_gpu_getHeadlessTarget(void)
+{
+    return rc2d_gpu_headless.target;
+}
+
+Uint8* rc2d_gpu_readHeadlessTarget(Uint32* width, Uint32* height)
+{
+    RC2D_assert_release(width != NULL && height != NULL, RC2D_LOG_CRITICAL, "width or height is NULL");
+
+    if (rc2d_gpu_headless.target == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_gpu_readHeadlessTarget requires RC2D_EngineConfig::headless");
+        return NULL;
+    }
+
+    const Uint32 size = rc2d_gpu_headless.width * rc2d_gpu_headless.height * 4;
+    SDL_GPUTransferBuffer* download = SDL_CreateGPUTransferBuffer(rc2d_gpu_getDevice(), &(SDL_GPUTransferBufferCreateInfo){
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_DOWNLOAD,
+        .size = size
+    });
+    SDL_GPUCommandBuffer* commandBuffer = download ? SDL_AcquireGPUCommandBuffer(rc2d_gpu_getDevice()) : NULL;
+    if (commandBuffer == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to read back headless target: %s", SDL_GetError());
+        if (download) SDL_ReleaseGPUTransferBuffer(rc2d_gpu_getDevice(), download);
+        return NULL;
+    }
+
+    SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(commandBuffer);
+    SDL_DownloadFromGPUTexture(
+        copyPass,
+        &(SDL_GPUTextureRegion){ .texture = rc2d_gpu_headless.target, .w = rc2d_gpu_headless.width, .h = rc2d_gpu_headless.height, .d = 1 },
+        &(SDL_GPUTextureTransferInfo){ .transfer_buffer = download, .offset = 0 }
+    );
+    SDL_EndGPUCopyPass(copyPass);
+
+    // Soumis après la dernière frame : la copie lit son contenu final
+    SDL_GPUFence* fence = SDL_SubmitGPUCommandBufferAndAcquireFence(commandBuffer);
+    if (fence != NULL)
+    {
+        SDL_WaitForGPUFences(rc2d_gpu_getDevice(), true, &fence, 1);
+        SDL_ReleaseGPUFence(rc2d_gpu_getDevice(), fence);
+    }
+
+    Uint8* pixels = fence ? RC2D_malloc(size) : NULL;
+    const void* mapped = pixels ? SDL_MapGPUTransferBuffer(rc2d_gpu_getDevice(), download, false) : NULL;
+    if (mapped == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to read back headless target: %s", SDL_GetError());
+        RC2D_safe_free(pixels);
+        SDL_ReleaseGPUTransferBuffer(rc2d_gpu_getDevice(), download);
+        return NULL;
+    }
+    SDL_memcpy(pixels, mapped, size);
+    SDL_UnmapGPUTransferBuffer(rc2d_gpu_getDevice(), download);
+    SDL_ReleaseGPUTransferBuffer(rc2d_gpu_getDevice(), download);
+
+    *width = rc2d_gpu_headless.width;
+    *height = rc2d_gpu_headless.height;
+    return pixels;
+}
+
+bool rc2d_gpu_beginFrame(void)
+{
+    /**
+     * \brief Étape 1 : Acquisition d’un GPUCommandBuffer
+     *
+     * Le GPUCommandBuffer est une structure temporaire qui enregistre toutes les commandes de rendu
+     * (comme le début de render pass, les draw calls, les changements de pipeline, etc.) pour cette frame.
+     * On ne peut soumettre les commandes au GPU qu’après avoir fini d’enregistrer dans ce buffer.
+     * SDL nous fournit ce buffer via SDL_AcquireGPUCommandBuffer(), qui doit être appelé avant toute commande GPU.
+     */
+    rc2d_engine_state.gpu_current_command_buffer = SDL_AcquireGPUCommandBuffer(rc2d_gpu_getDevice());
+    RC2D_assert_release(rc2d_engine_state.gpu_current_command_buffer != NULL, RC2D_LOG_CRITICAL, "Failed to acquire GPU command buffer, SDL_Error: %s", SDL_GetError());
+
+    /**
      * \brief Étape 2 : Acquisition de la texture de swapchain
      *
      * La swapchain texture est une image représentative du contenu de la fenêtre.
@@ -1355,16 +2044,28 @@ void rc2d_gpu_clear(void)
      * puis la lie au command buffer courant. La fonction remplit également les dimensions de la texture.
      *
      * Attention : la texture peut être NULL (par exemple si la fenêtre est minimisée).
+     *
+     * En mode headless, la cible hors écran remplace la swapchain : on attend seulement que
+     * le GPU ait terminé la frame qui occupait le même slot de frame en vol.
      */
     Uint32 swapchainTextureWidth = 0;
 	Uint32 swapchainTextureHeight = 0;
-    SDL_WaitAndAcquireGPUSwapchainTexture(
-        rc2d_engine_state.gpu_current_command_buffer,
-        rc2d_engine_state.window,
-        &rc2d_engine_state.gpu_current_swapchain_texture,
-        &swapchainTextureWidth,
-        &swapchainTextureHeight
-    );
+    RC2D_PROFILE_BEGIN("swapchain_wait");
+    if (rc2d_engine_state.config->headless)
+    {
+        rc2d_engine_state.gpu_current_swapchain_texture = rc2d_gpu_headlessAcquire(&swapchainTextureWidth, &swapchainTextureHeight);
+    }
+    else
+    {
+        SDL_WaitAndAcquireGPUSwapchainTexture(
+            rc2d_engine_state.gpu_current_command_buffer,
+            rc2d_engine_state.window,
+            &rc2d_engine_state.gpu_current_swapchain_texture,
+            &swapchainTextureWidth,
+            &swapchainTextureHeight
+        );
+    }
+    RC2D_PROFILE_END();
 
     /**
      * \brief Étape 3 : Vérification de la texture de swapchain
@@ -1381,7 +2082,7 @@ void rc2d_gpu_clear(void)
         rc2d_engine_state.skip_rendering = true;
         // On soumet le command buffer même s'il n'y a pas de swapchain texture, pour éviter les fuites de mémoire.
         SDL_SubmitGPUCommandBuffer(rc2d_engine_state.gpu_current_command_buffer);
-        return;
+        return false;
     }
     else
     {
@@ -1420,48 +2121,52 @@ void rc2d_gpu_clear(void)
     colorTargetInfo.layer_or_depth_plane = 0;
     colorTargetInfo.clear_color = (SDL_FColor){ 0.0f, 0.0f, 0.0f, 1.0f };
     colorTargetInfo.load_op = SDL_GPU_LOADOP_CLEAR;
-    colorTargetInfo.store_op = rc2d_engine_state.gpu_current_sample_count_supported > SDL_GPU_SAMPLECOUNT_1 ? SDL_GPU_STOREOP_RESOLVE : SDL_GPU_STOREOP_STORE; // Résolution si multisampling
+    colorTargetInfo.store_op = SDL_GPU_STOREOP_STORE;
     colorTargetInfo.resolve_texture = NULL;
     colorTargetInfo.resolve_mip_level = 0;
     colorTargetInfo.resolve_layer = 0;
     colorTargetInfo.cycle = true;
-    colorTargetInfo.cycle_resolve_texture = rc2d_engine_state.gpu_current_sample_count_supported > SDL_GPU_SAMPLECOUNT_1;
+    colorTargetInfo.cycle_resolve_texture = false;
     colorTargetInfo.padding1 = 0;
     colorTargetInfo.padding2 = 0;
 
-    // Créer une texture de résolution si multisampling
+    /**
+     * Avec le multisampling, le render pass dessine dans une cible multisample obtenue depuis le pool de cibles
+     * de rendu (réutilisée d'une frame à l'autre, recréée seulement si la swapchain change de taille), résolue dans
+     * la swapchain à la fin de chaque render pass. Le contenu multisample est aussi conservé (RESOLVE_AND_STORE) :
+     * le sprite batch reprend le render pass après sa copy pass.
+     */
+    rc2d_gpu_renderTargetPoolNewFrame(swapchainTextureWidth, swapchainTextureHeight);
     if (rc2d_engine_state.gpu_current_sample_count_supported > SDL_GPU_SAMPLECOUNT_1)
     {
-        SDL_GPUTextureCreateInfo resolve_texture_info = {
-            .type = SDL_GPU_TEXTURETYPE_2D,
-            .format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
-            .usage = SDL_GPU_TEXTUREUSAGE_COLOR_TARGET,
-            .width = swapchainTextureWidth,
-            .height = swapchainTextureHeight,
-            .layer_count_or_depth = 1,
-            .num_levels = 1,
-            .sample_count = SDL_GPU_SAMPLECOUNT_1, // La texture de résolution n'est pas multisample
-        };
-        rc2d_engine_state.gpu_current_resolve_texture = SDL_CreateGPUTexture(rc2d_engine_state.gpu_device, &resolve_texture_info);
+        rc2d_engine_state.gpu_current_msaa_texture = rc2d_gpu_acquireRenderTarget(
+            swapchainTextureWidth,
+            swapchainTextureHeight,
+            rc2d_gpu_getColorTargetFormat(),
+            rc2d_engine_state.gpu_current_sample_count_supported,
+            SDL_GPU_TEXTUREUSAGE_COLOR_TARGET
+        );
 
         /**
-         * Si la création de la texture de résolution échoue, on log l'erreur
-         * et on continue sans utiliser de texture de résolution.
-         * 
-         * Si cela marche, on l'assigne à colorTargetInfo.resolve_texture.
+         * Les pipelines sont créés avec ce nombre d'échantillons : sans cible multisample,
+         * la frame ne peut pas être rendue et elle est sautée.
          */
-        if (!rc2d_engine_state.gpu_current_resolve_texture) 
+        if (rc2d_engine_state.gpu_current_msaa_texture == NULL)
         {
-            RC2D_log(RC2D_LOG_ERROR, "Failed to create resolve texture: %s", SDL_GetError());
-            colorTargetInfo.store_op = SDL_GPU_STOREOP_STORE;
-            colorTargetInfo.cycle_resolve_texture = false;
-        }
-        else 
-        {
-            colorTargetInfo.resolve_texture = rc2d_engine_state.gpu_current_resolve_texture;
+            RC2D_log(RC2D_LOG_ERROR, "Failed to acquire MSAA render target, skipping frame rendering. SDL_Error: %s", SDL_GetError());
+            rc2d_engine_state.skip_rendering = true;
+            rc2d_gpu_submitCommandBuffer(rc2d_engine_state.gpu_current_command_buffer);
+            return false;
         }
+
+        colorTargetInfo.texture = rc2d_engine_state.gpu_current_msaa_texture;
+        colorTargetInfo.store_op = SDL_GPU_STOREOP_RESOLVE_AND_STORE;
+        colorTargetInfo.resolve_texture = rc2d_engine_state.gpu_current_swapchain_texture;
     }
 
+    // Conserver la cible pour pouvoir reprendre le render pass après une copy pass (sprite batch)
+    rc2d_engine_state.gpu_current_color_target = colorTargetInfo;
+
     /**
      * \brief Étape 5 : Début d’un Render Pass
      *
@@ -1487,10 +2192,50 @@ void rc2d_gpu_clear(void)
      */
     RC2D_assert_release(rc2d_engine_state.gpu_current_viewport != NULL, RC2D_LOG_CRITICAL, "No viewport set in rc2d_engine_state");
     SDL_SetGPUViewport(rc2d_engine_state.gpu_current_render_pass, rc2d_engine_state.gpu_current_viewport);
+    return true;
+}
+
+void rc2d_gpu_clear(void)
+{
+    /**
+     * \brief Étape 0 : Envoi des uploads en attente
+     *
+     * Toutes les textures/buffers téléversés depuis la frame précédente (par n'importe quel thread)
+     * sont envoyés dans une seule copy pass, soumise avant le command buffer de la frame.
+     */
+    rc2d_gpu_uploadRingNewFrame();
+    rc2d_gpu_spriteBatchNewFrame();
+    rc2d_gpu_imageCacheNewFrame();
+    rc2d_atlas_newFrame();
+
+    rc2d_gpu_beginFrame();
+}
+
+void rc2d_gpu_submitCommandBuffer(SDL_GPUCommandBuffer* commandBuffer)
+{
+    // Le command buffer de la frame est acquis par le thread principal (rc2d_gpu_beginFrame) : SDL_GPU impose
+    // qu'il soit encodé et soumis par ce même thread
+    RC2D_assert_release(SDL_IsMainThread(), RC2D_LOG_CRITICAL, "The frame command buffer must be submitted from the main thread");
+
+    if (rc2d_engine_state.config->headless)
+    {
+        rc2d_gpu_headlessSubmit(commandBuffer);
+    }
+    else
+    {
+        SDL_SubmitGPUCommandBuffer(commandBuffer);
+    }
 }
 
 void rc2d_gpu_present(void)
 {    
+    /**
+     * \brief Étape 0 : Dessiner les sprites en attente
+     *
+     * Les sprites de la frame sont triés puis dessinés en un minimum de draw calls.
+     */
+    rc2d_gpu_flushSprites();
+
     /**
      * \brief Étape 1 : Terminer le render pass
      *
@@ -1514,6 +2259,14 @@ void rc2d_gpu_present(void)
         //rc2d_letterbox_draw();
     }
 
+    /**
+     * Les uploads validés pendant la frame (par exemple une image chargée dans rc2d_draw) sont soumis avant
+     * le command buffer de la frame : le GPU les exécute avant les draw calls qui échantillonnent ces textures.
+     * La frame est soumise avant la fin de rc2d_gpu_present : les uploads de la frame suivante (rc2d_gpu_clear)
+     * partent toujours après elle.
+     */
+    rc2d_gpu_flushUploads();
+
     /**
      * \brief Étape 3 : Soumettre le command buffer
      *
@@ -1522,16 +2275,16 @@ void rc2d_gpu_present(void)
      */
     if (rc2d_engine_state.gpu_current_command_buffer && !rc2d_engine_state.skip_rendering)
     {
-        SDL_SubmitGPUCommandBuffer(rc2d_engine_state.gpu_current_command_buffer);
+        rc2d_gpu_submitCommandBuffer(rc2d_engine_state.gpu_current_command_buffer);
     }
 
     /**
-     * Libérer la texture de résolution si elle a été créée.
+     * Rendre la cible multisample au pool, elle sera réutilisée à la frame suivante.
      */
-    if (rc2d_engine_state.gpu_current_resolve_texture)
+    if (rc2d_engine_state.gpu_current_msaa_texture)
     {
-        SDL_ReleaseGPUTexture(rc2d_engine_state.gpu_device, rc2d_engine_state.gpu_current_resolve_texture);
-        rc2d_engine_state.gpu_current_resolve_texture = NULL;
+        rc2d_gpu_releaseRenderTarget(rc2d_engine_state.gpu_current_msaa_texture);
+        rc2d_engine_state.gpu_current_msaa_texture = NULL;
     }
 
     /**
@@ -1554,4 +2307,865 @@ void rc2d_gpu_present(void)
 void rc2d_gpu_setColor(RC2D_Color color) 
 {
     current_color = color;
-}
\ No newline at end of file
+}
+
+RC2D_Color rc2d_gpu_getColor(void)
+{
+    return current_color;
+}
+
+/**
+ * Commande d'upload en attente dans le ring, encodée dans la prochaine copy pass.
+ */
+typedef struct RC2D_GPUUploadCommand {
+    SDL_GPUTransferBuffer* transfer_buffer;
+    Uint32 offset;
+
+    // Destination texture (si texture != NULL)
+    SDL_GPUTextureRegion texture_region;
+    Uint32 pixels_per_row;
+    Uint32 rows_per_layer;
+
+    // Destination buffer (si texture_region.texture == NULL)
+    SDL_GPUBufferRegion buffer_region;
+
+    // Copie GPU d'une texture vers une autre, sans buffer de transfert (si transfer_buffer == NULL)
+    SDL_GPUTextureLocation copy_source;
+    SDL_GPUTextureLocation copy_destination;
+    Uint32 copy_width;
+    Uint32 copy_height;
+} RC2D_GPUUploadCommand;
+
+/**
+ * Segment du ring : un buffer de transfert protégé par la fence de la dernière soumission qui l'a lu.
+ *
+ * Les commandes validées sont rangées dans le segment qui contient leurs données : un segment plein
+ * (ou fermé par un envoi) part dès que ses propres écritures sont terminées, sans bloquer les réservations
+ * des autres segments.
+ */
+typedef struct RC2D_GPUUploadSegment {
+    SDL_GPUTransferBuffer* transfer_buffer;
+    SDL_GPUFence* fence;
+    Uint8* mapped;
+    Uint32 head;
+
+    // Réservations (dans le segment ou ses buffers dédiés) dont l'écriture n'est pas encore terminée
+    int writers;
+
+    // Fermé aux nouvelles réservations : envoyé par le thread principal dès que writers retombe à 0
+    bool retired;
+
+    // Un thread attend la fence du segment, mutex du ring relâché (voir rc2d_gpu_waitSegmentLocked)
+    bool waiting;
+
+    RC2D_GPUUploadCommand* commands;
+    Uint32 command_count;
+    Uint32 command_capacity;
+
+    // Buffers de transfert dédiés (réservations plus grandes qu'un segment, ou voie entièrement occupée)
+    SDL_GPUTransferBuffer** dedicated;
+    Uint32 dedicated_count;
+    Uint32 dedicated_capacity;
+} RC2D_GPUUploadSegment;
+
+/**
+ * Voie du ring : une suite de segments (frames en vol + 1) remplis et envoyés dans l'ordre.
+ */
+typedef struct RC2D_GPUUploadLane {
+    RC2D_GPUUploadSegment* segments;
+
+    // Segment qui reçoit les nouvelles réservations
+    Uint32 current;
+} RC2D_GPUUploadLane;
+
+/**
+ * Voies du ring : le thread principal a la sienne, pour qu'une écriture en cours sur un autre thread
+ * ne retarde jamais l'envoi de ses uploads avant le command buffer de la frame.
+ */
+#define RC2D_GPU_UPLOAD_LANE_MAIN 0
+#define RC2D_GPU_UPLOAD_LANE_THREADS 1
+#define RC2D_GPU_UPLOAD_LANE_COUNT 2
+
+/**
+ * État du ring d'upload partagé par tous les loaders (images, rres, buffers...).
+ */
+static struct {
+    SDL_Mutex* mutex;
+
+    // Signalée quand une attente de fence se termine (RC2D_GPUUploadSegment::waiting)
+    SDL_Condition* fence_signaled;
+
+    RC2D_GPUUploadLane lanes[RC2D_GPU_UPLOAD_LANE_COUNT];
+    Uint32 segment_count;
+    Uint32 segment_size;
+
+    RC2D_GPUUploadStats stats;
+    Uint64 bytes_this_frame;
+    Uint32 copy_passes_this_frame;
+} rc2d_gpu_upload_ring = {0};
+
+bool rc2d_gpu_uploadRingInit(Uint32 segmentSize, Uint32 segmentCount)
+{
+    RC2D_assert_release(segmentSize > 0 && segmentCount > 0, RC2D_LOG_CRITICAL, "Invalid upload ring size");
+
+    rc2d_gpu_upload_ring.mutex = SDL_CreateMutex();
+    rc2d_gpu_upload_ring.fence_signaled = SDL_CreateCondition();
+    bool allocated = (rc2d_gpu_upload_ring.mutex != NULL && rc2d_gpu_upload_ring.fence_signaled != NULL);
+    for (int i = 0; i < RC2D_GPU_UPLOAD_LANE_COUNT; i++)
+    {
+        rc2d_gpu_upload_ring.lanes[i].segments = RC2D_calloc(segmentCount, sizeof(RC2D_GPUUploadSegment));
+        allocated = allocated && (rc2d_gpu_upload_ring.lanes[i].segments != NULL);
+    }
+    if (!allocated)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "Failed to allocate GPU upload ring: %s", SDL_GetError());
+        rc2d_gpu_uploadRingQuit();
+        return false;
+    }
+
+    rc2d_gpu_upload_ring.segment_count = segmentCount;
+    rc2d_gpu_upload_ring.segment_size = segmentSize;
+
+    /**
+     * Les buffers de transfert de la voie du thread principal sont créés tout de suite.
+     * Ceux de la voie des autres threads le sont à leur première réservation.
+     */
+    for (Uint32 i = 0; i < segmentCount; i++)
+    {
+        rc2d_gpu_upload_ring.lanes[RC2D_GPU_UPLOAD_LANE_MAIN].segments[i].transfer_buffer = SDL_CreateGPUTransferBuffer(
+            rc2d_gpu_getDevice(),
+            &(SDL_GPUTransferBufferCreateInfo){
+                .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+                .size = segmentSize
+            }
+        );
+        if (!rc2d_gpu_upload_ring.lanes[RC2D_GPU_UPLOAD_LANE_MAIN].segments[i].transfer_buffer)
+        {
+            RC2D_log(RC2D_LOG_CRITICAL, "Failed to create GPU upload ring segment: %s", SDL_GetError());
+            rc2d_gpu_uploadRingQuit();
+            return false;
+        }
+    }
+
+    rc2d_gpu_upload_ring.stats.segment_size = segmentSize;
+    rc2d_gpu_upload_ring.stats.segment_count = segmentCount;
+
+    RC2D_log(RC2D_LOG_INFO, "GPU upload ring: %u segments de %u Ko par voie", segmentCount, segmentSize / 1024);
+    return true;
+}
+
+void rc2d_gpu_uploadRingQuit(void)
+{
+    for (int lane = 0; lane < RC2D_GPU_UPLOAD_LANE_COUNT; lane++)
+    {
+        RC2D_GPUUploadSegment* segments = rc2d_gpu_upload_ring.lanes[lane].segments;
+        if (segments == NULL) continue;
+
+        for (Uint32 i = 0; i < rc2d_gpu_upload_ring.segment_count; i++)
+        {
+            RC2D_GPUUploadSegment* segment = &segments[i];
+            if (segment->mapped) SDL_UnmapGPUTransferBuffer(rc2d_gpu_getDevice(), segment->transfer_buffer);
+            if (segment->fence) SDL_ReleaseGPUFence(rc2d_gpu_getDevice(), segment->fence);
+            if (segment->transfer_buffer) SDL_ReleaseGPUTransferBuffer(rc2d_gpu_getDevice(), segment->transfer_buffer);
+
+            for (Uint32 j = 0; j < segment->dedicated_count; j++)
+            {
+                SDL_UnmapGPUTransferBuffer(rc2d_gpu_getDevice(), segment->dedicated[j]);
+                SDL_ReleaseGPUTransferBuffer(rc2d_gpu_getDevice(), segment->dedicated[j]);
+            }
+
+            RC2D_safe_free(segment->commands);
+            RC2D_safe_free(segment->dedicated);
+        }
+
+        RC2D_safe_free(rc2d_gpu_upload_ring.lanes[lane].segments);
+    }
+
+    if (rc2d_gpu_upload_ring.fence_signaled) SDL_DestroyCondition(rc2d_gpu_upload_ring.fence_signaled);
+    if (rc2d_gpu_upload_ring.mutex) SDL_DestroyMutex(rc2d_gpu_upload_ring.mutex);
+
+    SDL_zero(rc2d_gpu_upload_ring);
+}
+
+/**
+ * Voie utilisée par le thread appelant.
+ */
+static RC2D_GPUUploadLane* rc2d_gpu_getUploadLane(void)
+{
+    return &rc2d_gpu_upload_ring.lanes[SDL_IsMainThread() ? RC2D_GPU_UPLOAD_LANE_MAIN : RC2D_GPU_UPLOAD_LANE_THREADS];
+}
+
+/**
+ * Attend que le GPU ait fini de lire le contenu précédent d'un segment. Le mutex du ring doit être verrouillé.
+ *
+ * Le mutex est relâché pendant l'attente : un worker qui attend un segment de sa voie ne bloque ni les réservations
+ * ni l'envoi de la voie du thread principal. Le segment est marqué en attente (les autres threads qui le visent
+ * attendent la même fence), et son contenu précédent reste protégé : il n'a plus de données (head == 0), un envoi
+ * pendant l'attente garde sa fence.
+ *
+ * 
+eturn {bool} true si le mutex a été relâché : l'état du ring a pu changer, l'appelant doit tout recalculer.
+ */
+static bool rc2d_gpu_waitSegmentLocked(RC2D_GPUUploadSegment* segment)
+{
+    if (segment->waiting)
+    {
+        while (segment->waiting) SDL_WaitCondition(rc2d_gpu_upload_ring.fence_signaled, rc2d_gpu_upload_ring.mutex);
+        return true;
+    }
+
+    if (segment->fence == NULL) return false;
+
+    bool released = false;
+    if (!SDL_QueryGPUFence(rc2d_gpu_getDevice(), segment->fence))
+    {
+        // Le GPU n'a pas encore consommé ce segment : le ring est trop petit pour le débit demandé
+        SDL_GPUFence* fence = segment->fence;
+        segment->waiting = true;
+        SDL_UnlockMutex(rc2d_gpu_upload_ring.mutex);
+
+        Uint64 start = SDL_GetPerformanceCounter();
+        SDL_WaitForGPUFences(rc2d_gpu_getDevice(), true, &fence, 1);
+        double stallTimeMs = (double)(SDL_GetPerformanceCounter() - start) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+
+        SDL_LockMutex(rc2d_gpu_upload_ring.mutex);
+        segment->waiting = false;
+        SDL_BroadcastCondition(rc2d_gpu_upload_ring.fence_signaled);
+        rc2d_gpu_upload_ring.stats.stall_count++;
+        rc2d_gpu_upload_ring.stats.stall_time_ms += stallTimeMs;
+        released = true;
+    }
+    SDL_ReleaseGPUFence(rc2d_gpu_getDevice(), segment->fence);
+    segment->fence = NULL;
+    return released;
+}
+
+/**
+ * Encode les commandes d'un segment dont toutes les écritures sont terminées dans une copy pass,
+ * et la soumet avec une fence qui protège le segment jusqu'à sa réutilisation.
+ *
+ * \note Le mutex du ring doit être verrouillé, sur le thread principal.
+ */
+static void rc2d_gpu_submitSegmentLocked(RC2D_GPUUploadSegment* segment)
+{
+    RC2D_assert_release(SDL_IsMainThread(), RC2D_LOG_CRITICAL, "Upload segments must be submitted on the main thread");
+
+    // Les buffers de transfert doivent être démappés avant d'encoder les uploads
+    if (segment->mapped)
+    {
+        SDL_UnmapGPUTransferBuffer(rc2d_gpu_getDevice(), segment->transfer_buffer);
+        segment->mapped = NULL;
+    }
+    for (Uint32 i = 0; i < segment->dedicated_count; i++)
+    {
+        SDL_UnmapGPUTransferBuffer(rc2d_gpu_getDevice(), segment->dedicated[i]);
+    }
+
+    SDL_GPUFence* fence = NULL;
+    if (segment->command_count > 0)
+    {
+        SDL_GPUCommandBuffer* commandBuffer = SDL_AcquireGPUCommandBuffer(rc2d_gpu_getDevice());
+        SDL_GPUCopyPass* copyPass = commandBuffer ? SDL_BeginGPUCopyPass(commandBuffer) : NULL;
+        if (!copyPass)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "Failed to begin upload copy pass, %u uploads dropped: %s", segment->command_count, SDL_GetError());
+            if (commandBuffer) SDL_CancelGPUCommandBuffer(commandBuffer);
+        }
+        else
+        {
+            for (Uint32 i = 0; i < segment->command_count; i++)
+            {
+                RC2D_GPUUploadCommand* command = &segment->commands[i];
+                if (command->transfer_buffer == NULL)
+                {
+                    SDL_CopyGPUTextureToTexture(copyPass, &command->copy_source, &command->copy_destination,
+                                                command->copy_width, command->copy_height, 1, false);
+                }
+                else if (command->texture_region.texture != NULL)
+                {
+                    SDL_GPUTextureTransferInfo source = {
+                        .transfer_buffer = command->transfer_buffer,
+                        .offset = command->offset,
+                        .pixels_per_row = command->pixels_per_row,
+                        .rows_per_layer = command->rows_per_layer
+                    };
+                    SDL_UploadToGPUTexture(copyPass, &source, &command->texture_region, false);
+                }
+                else
+                {
+                    SDL_GPUTransferBufferLocation source = {
+                        .transfer_buffer = command->transfer_buffer,
+                        .offset = command->offset
+                    };
+                    SDL_UploadToGPUBuffer(copyPass, &source, &command->buffer_region, false);
+                }
+            }
+
+            SDL_EndGPUCopyPass(copyPass);
+            fence = SDL_SubmitGPUCommandBufferAndAcquireFence(commandBuffer);
+            rc2d_gpu_upload_ring.stats.submit_count++;
+            rc2d_gpu_upload_ring.copy_passes_this_frame++;
+        }
+    }
+
+    /**
+     * Les buffers dédiés peuvent être libérés tout de suite : SDL les garde en vie
+     * jusqu'à la fin des commandes soumises qui les utilisent.
+     */
+    for (Uint32 i = 0; i < segment->dedicated_count; i++)
+    {
+        SDL_ReleaseGPUTransferBuffer(rc2d_gpu_getDevice(), segment->dedicated[i]);
+    }
+
+    /**
+     * Seuls des buffers dédiés ou des copies ont été utilisés : la mémoire du segment n'est pas lue par cette
+     * soumission, il garde la fence de son contenu précédent. Sinon, cette fence a déjà été attendue
+     * avant la première réservation dans le segment.
+     */
+    if (segment->head == 0)
+    {
+        if (fence) SDL_ReleaseGPUFence(rc2d_gpu_getDevice(), fence);
+    }
+    else
+    {
+        segment->fence = fence;
+    }
+
+    segment->head = 0;
+    segment->command_count = 0;
+    segment->dedicated_count = 0;
+    segment->retired = false;
+}
+
+/**
+ * Envoie les segments fermés d'une voie dans l'ordre où ils ont été remplis, en s'arrêtant au premier dont une
+ * écriture est encore en cours (les suivants partiront avec lui, pour que les uploads restent ordonnés), puis
+ * passe le segment courant au suivant s'il a été fermé ou envoyé.
+ *
+ * Seul le thread principal acquiert et soumet des command buffers : appelée depuis un autre thread, la fonction
+ * ne fait que passer au segment suivant, les segments fermés partent au prochain envoi du thread principal
+ * (début de frame, rc2d_gpu_present ou rc2d_gpu_flushUploads).
+ *
+ * N'attend jamais, ni la fin d'une écriture (le thread appelant peut lui-même garder des réservations ouvertes),
+ * ni une fence : le segment suivant est attendu à sa première réservation (rc2d_gpu_beginUpload).
+ *
+ * \note Le mutex du ring doit être verrouillé.
+ */
+static void rc2d_gpu_submitRetiredSegmentsLocked(RC2D_GPUUploadLane* lane)
+{
+    const Uint32 count = rc2d_gpu_upload_ring.segment_count;
+
+    // Du plus ancien (juste après le segment courant) au segment courant
+    for (Uint32 i = 1; SDL_IsMainThread() && i <= count; i++)
+    {
+        RC2D_GPUUploadSegment* segment = &lane->segments[(lane->current + i) % count];
+        if (!segment->retired) continue;
+        if (segment->writers > 0) break;
+        rc2d_gpu_submitSegmentLocked(segment);
+    }
+
+    RC2D_GPUUploadSegment* current = &lane->segments[lane->current];
+    if (!current->retired && current->fence == NULL) return;
+
+    /**
+     * Le segment suivant est encore fermé (en attente d'écritures) : la voie est entièrement occupée.
+     * On reste sur le segment courant ; les réservations passeront par des buffers dédiés s'il est fermé.
+     */
+    Uint32 nextIndex = (lane->current + 1) % count;
+    RC2D_GPUUploadSegment* next = &lane->segments[nextIndex];
+    if (next->retired) return;
+
+    lane->current = nextIndex;
+}
+
+/**
+ * Ferme le segment courant d'une voie s'il contient des uploads, puis envoie tout ce qui est prêt.
+ *
+ * \note Le mutex du ring doit être verrouillé.
+ */
+static void rc2d_gpu_flushUploadsLocked(RC2D_GPUUploadLane* lane)
+{
+    RC2D_GPUUploadSegment* current = &lane->segments[lane->current];
+
+    // Rien n'a été validé ni réservé (ou tout a été annulé) : le segment courant peut être réutilisé tel quel
+    if (current->writers == 0 && current->command_count == 0 && current->dedicated_count == 0)
+    {
+        current->head = 0;
+    }
+    else
+    {
+        current->retired = true;
+    }
+
+    rc2d_gpu_submitRetiredSegmentsLocked(lane);
+}
+
+/**
+ * Crée un buffer de transfert dédié, rattaché au segment courant de la voie (envoyé avec lui).
+ * Le mutex du ring doit être verrouillé.
+ */
+static bool rc2d_gpu_beginDedicatedUploadLocked(RC2D_GPUUploadLane* lane, Uint32 size, RC2D_GPUUploadAllocation* allocation)
+{
+    RC2D_GPUUploadSegment* segment = &lane->segments[lane->current];
+
+    SDL_GPUTransferBuffer* transferBuffer = SDL_CreateGPUTransferBuffer(
+        rc2d_gpu_getDevice(),
+        &(SDL_GPUTransferBufferCreateInfo){
+            .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+            .size = size
+        }
+    );
+    void* mapped = transferBuffer ? SDL_MapGPUTransferBuffer(rc2d_gpu_getDevice(), transferBuffer, false) : NULL;
+
+    if (mapped && segment->dedicated_count == segment->dedicated_capacity)
+    {
+        Uint32 capacity = segment->dedicated_capacity ? segment->dedicated_capacity * 2 : 8;
+        SDL_GPUTransferBuffer** dedicated = RC2D_realloc(segment->dedicated, capacity * sizeof(SDL_GPUTransferBuffer*));
+        if (dedicated)
+        {
+            segment->dedicated = dedicated;
+            segment->dedicated_capacity = capacity;
+        }
+        else
+        {
+            SDL_UnmapGPUTransferBuffer(rc2d_gpu_getDevice(), transferBuffer);
+            mapped = NULL;
+        }
+    }
+
+    if (!mapped)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to create dedicated upload buffer (%u bytes): %s", size, SDL_GetError());
+        if (transferBuffer) SDL_ReleaseGPUTransferBuffer(rc2d_gpu_getDevice(), transferBuffer);
+        return false;
+    }
+
+    segment->dedicated[segment->dedicated_count++] = transferBuffer;
+    segment->writers++;
+    rc2d_gpu_upload_ring.stats.dedicated_count++;
+
+    allocation->data = mapped;
+    allocation->transfer_buffer = transferBuffer;
+    allocation->offset = 0;
+    return true;
+}
+
+/**
+ * Réserve une zone dans le segment courant d'une voie, dont la fence a déjà été attendue
+ * (rc2d_gpu_waitSegmentLocked). Le mutex du ring doit être verrouillé.
+ */
+static bool rc2d_gpu_beginSegmentUploadLocked(RC2D_GPUUploadSegment* segment, Uint32 offset, Uint32 size, RC2D_GPUUploadAllocation* allocation)
+{
+    if (!segment->transfer_buffer)
+    {
+        segment->transfer_buffer = SDL_CreateGPUTransferBuffer(
+            rc2d_gpu_getDevice(),
+            &(SDL_GPUTransferBufferCreateInfo){
+                .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+                .size = rc2d_gpu_upload_ring.segment_size
+            }
+        );
+    }
+
+    if (segment->transfer_buffer && !segment->mapped)
+    {
+        // Pas de cycle : la fence du segment a déjà été attendue
+        segment->mapped = (Uint8*)SDL_MapGPUTransferBuffer(rc2d_gpu_getDevice(), segment->transfer_buffer, false);
+    }
+
+    if (!segment->mapped)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to map upload ring segment: %s", SDL_GetError());
+        return false;
+    }
+
+    segment->head = offset + size;
+    segment->writers++;
+
+    allocation->data = segment->mapped + offset;
+    allocation->transfer_buffer = segment->transfer_buffer;
+    allocation->offset = offset;
+    return true;
+}
+
+bool rc2d_gpu_beginUpload(Uint32 size, Uint32 alignment, RC2D_GPUUploadAllocation* allocation)
+{
+    RC2D_assert_release(allocation != NULL, RC2D_LOG_CRITICAL, "Upload allocation is NULL");
+    RC2D_assert_release(rc2d_gpu_upload_ring.mutex != NULL, RC2D_LOG_CRITICAL, "GPU upload ring is not initialized");
+
+    SDL_zerop(allocation);
+    if (size == 0) return false;
+    if (alignment == 0) alignment = 1;
+
+    SDL_LockMutex(rc2d_gpu_upload_ring.mutex);
+
+    const Uint32 segmentSize = rc2d_gpu_upload_ring.segment_size;
+    RC2D_GPUUploadLane* lane = rc2d_gpu_getUploadLane();
+    bool success;
+    for (;;)
+    {
+        RC2D_GPUUploadSegment* segment = &lane->segments[lane->current];
+        Uint32 offset = ((segment->head + alignment - 1) / alignment) * alignment;
+
+        // Plus de place dans le segment courant : il est fermé et part au premier envoi qui suit la fin de ses écritures
+        if (size <= segmentSize && (segment->retired || (Uint64)offset + size > segmentSize))
+        {
+            rc2d_gpu_flushUploadsLocked(lane);
+            segment = &lane->segments[lane->current];
+            offset = ((segment->head + alignment - 1) / alignment) * alignment;
+        }
+
+        if (size > segmentSize || segment->retired || (Uint64)offset + size > segmentSize)
+        {
+            /**
+             * Réservation plus grande qu'un segment, ou aucun segment libre sans attendre la fin d'écritures
+             * en cours : buffer de transfert dédié, envoyé avec le segment courant puis libéré.
+             */
+            success = rc2d_gpu_beginDedicatedUploadLocked(lane, size, allocation);
+            break;
+        }
+
+        /**
+         * Le segment a pu rester courant après un envoi : son contenu précédent doit avoir été lu par le GPU.
+         * Si l'attente a relâché le mutex, d'autres threads ont pu réserver ou envoyer entre-temps : on recommence.
+         */
+        if (rc2d_gpu_waitSegmentLocked(segment)) continue;
+
+        success = rc2d_gpu_beginSegmentUploadLocked(segment, offset, size, allocation);
+        break;
+    }
+
+    if (success)
+    {
+        allocation->size = size;
+        rc2d_gpu_upload_ring.bytes_this_frame += size;
+        rc2d_gpu_upload_ring.stats.bytes_total += size;
+    }
+
+    SDL_UnlockMutex(rc2d_gpu_upload_ring.mutex);
+    return success;
+}
+
+/**
+ * Ajoute une commande au segment qui contient ses données. Le mutex du ring doit être verrouillé.
+ */
+static void rc2d_gpu_pushUploadCommandLocked(RC2D_GPUUploadSegment* segment, const RC2D_GPUUploadCommand* command)
+{
+    if (segment->command_count == segment->command_capacity)
+    {
+        Uint32 capacity = segment->command_capacity ? segment->command_capacity * 2 : 64;
+        RC2D_GPUUploadCommand* commands = RC2D_realloc(segment->commands, capacity * sizeof(RC2D_GPUUploadCommand));
+        RC2D_assert_release(commands != NULL, RC2D_LOG_CRITICAL, "Failed to realloc upload commands");
+        segment->commands = commands;
+        segment->command_capacity = capacity;
+    }
+    segment->commands[segment->command_count++] = *command;
+}
+
+/**
+ * Retrouve la voie et le segment auxquels appartient le buffer de transfert d'une réservation.
+ * Le mutex du ring doit être verrouillé.
+ */
+static RC2D_GPUUploadSegment* rc2d_gpu_findUploadSegmentLocked(const SDL_GPUTransferBuffer* transferBuffer, RC2D_GPUUploadLane** outLane)
+{
+    for (int lane = 0; lane < RC2D_GPU_UPLOAD_LANE_COUNT; lane++)
+    {
+        for (Uint32 i = 0; i < rc2d_gpu_upload_ring.segment_count; i++)
+        {
+            RC2D_GPUUploadSegment* segment = &rc2d_gpu_upload_ring.lanes[lane].segments[i];
+            bool found = (segment->transfer_buffer == transferBuffer);
+            for (Uint32 j = 0; !found && j < segment->dedicated_count; j++)
+            {
+                found = (segment->dedicated[j] == transferBuffer);
+            }
+
+            if (found)
+            {
+                *outLane = &rc2d_gpu_upload_ring.lanes[lane];
+                return segment;
+            }
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Termine l'écriture d'une allocation et ajoute éventuellement sa commande d'upload.
+ */
+static void rc2d_gpu_endUpload(const RC2D_GPUUploadAllocation* allocation, const RC2D_GPUUploadCommand* command)
+{
+    SDL_LockMutex(rc2d_gpu_upload_ring.mutex);
+
+    RC2D_GPUUploadLane* lane = NULL;
+    RC2D_GPUUploadSegment* segment = rc2d_gpu_findUploadSegmentLocked(allocation->transfer_buffer, &lane);
+    RC2D_assert_release(segment != NULL && segment->writers > 0, RC2D_LOG_CRITICAL, "Upload allocation does not belong to the upload ring");
+
+    if (command != NULL)
+    {
+        rc2d_gpu_pushUploadCommandLocked(segment, command);
+    }
+
+    /**
+     * Dernière écriture d'un segment fermé : sur le thread principal, il part sans attendre le prochain envoi.
+     * Depuis un autre thread, il attend le prochain envoi du thread principal (aucun command buffer ici).
+     */
+    if (--segment->writers == 0 && segment->retired)
+    {
+        rc2d_gpu_submitRetiredSegmentsLocked(lane);
+    }
+
+    SDL_UnlockMutex(rc2d_gpu_upload_ring.mutex);
+}
+
+void rc2d_gpu_endUploadToTexture(const RC2D_GPUUploadAllocation* allocation, Uint32 offset, const SDL_GPUTextureRegion* destination, Uint32 pixelsPerRow, Uint32 rowsPerLayer)
+{
+    RC2D_assert_release(allocation != NULL && allocation->transfer_buffer != NULL, RC2D_LOG_CRITICAL, "Invalid upload allocation");
+    RC2D_assert_release(destination != NULL && destination->texture != NULL, RC2D_LOG_CRITICAL, "Upload destination texture is NULL");
+
+    RC2D_GPUUploadCommand command = {0};
+    command.transfer_buffer = allocation->transfer_buffer;
+    command.offset = allocation->offset + offset;
+    command.texture_region = *destination;
+    command.pixels_per_row = pixelsPerRow;
+    command.rows_per_layer = rowsPerLayer;
+
+    rc2d_gpu_endUpload(allocation, &command);
+}
+
+void rc2d_gpu_endUploadToBuffer(const RC2D_GPUUploadAllocation* allocation, Uint32 offset, SDL_GPUBuffer* buffer, Uint32 bufferOffset, Uint32 size)
+{
+    RC2D_assert_release(allocation != NULL && allocation->transfer_buffer != NULL, RC2D_LOG_CRITICAL, "Invalid upload allocation");
+    RC2D_assert_release(buffer != NULL, RC2D_LOG_CRITICAL, "Upload destination buffer is NULL");
+
+    RC2D_GPUUploadCommand command = {0};
+    command.transfer_buffer = allocation->transfer_buffer;
+    command.offset = allocation->offset + offset;
+    command.buffer_region.buffer = buffer;
+    command.buffer_region.offset = bufferOffset;
+    command.buffer_region.size = size;
+
+    rc2d_gpu_endUpload(allocation, &command);
+}
+
+void rc2d_gpu_cancelUpload(const RC2D_GPUUploadAllocation* allocation)
+{
+    RC2D_assert_release(allocation != NULL && allocation->transfer_buffer != NULL, RC2D_LOG_CRITICAL, "Invalid upload allocation");
+    rc2d_gpu_endUpload(allocation, NULL);
+}
+
+void rc2d_gpu_copyTextureRegion(const SDL_GPUTextureLocation* source, const SDL_GPUTextureLocation* destination, Uint32 width, Uint32 height)
+{
+    RC2D_assert_release(source != NULL && source->texture != NULL, RC2D_LOG_CRITICAL, "Copy source texture is NULL");
+    RC2D_assert_release(destination != NULL && destination->texture != NULL, RC2D_LOG_CRITICAL, "Copy destination texture is NULL");
+    RC2D_assert_release(rc2d_gpu_upload_ring.mutex != NULL, RC2D_LOG_CRITICAL, "GPU upload ring is not initialized");
+
+    RC2D_GPUUploadCommand command = {0};
+    command.copy_source = *source;
+    command.copy_destination = *destination;
+    command.copy_width = width;
+    command.copy_height = height;
+
+    // Rangée avec les uploads du segment courant de la voie : la copie reste ordonnée après eux
+    SDL_LockMutex(rc2d_gpu_upload_ring.mutex);
+    RC2D_GPUUploadLane* lane = rc2d_gpu_getUploadLane();
+    rc2d_gpu_pushUploadCommandLocked(&lane->segments[lane->current], &command);
+    SDL_UnlockMutex(rc2d_gpu_upload_ring.mutex);
+}
+
+void rc2d_gpu_flushUploads(void)
+{
+    if (rc2d_gpu_upload_ring.mutex == NULL) return;
+
+    SDL_LockMutex(rc2d_gpu_upload_ring.mutex);
+    for (int lane = 0; lane < RC2D_GPU_UPLOAD_LANE_COUNT; lane++)
+    {
+        rc2d_gpu_flushUploadsLocked(&rc2d_gpu_upload_ring.lanes[lane]);
+    }
+    SDL_UnlockMutex(rc2d_gpu_upload_ring.mutex);
+}
+
+void rc2d_gpu_uploadRingNewFrame(void)
+{
+    if (rc2d_gpu_upload_ring.mutex == NULL) return;
+
+    /**
+     * Le thread principal n'attend jamais les loaders : un segment encore en cours d'écriture
+     * sur un autre thread part au premier envoi qui suit sa dernière écriture.
+     */
+    rc2d_gpu_flushUploads();
+
+    SDL_LockMutex(rc2d_gpu_upload_ring.mutex);
+
+    RC2D_GPUUploadStats* stats = &rc2d_gpu_upload_ring.stats;
+    stats->bytes_last_frame = rc2d_gpu_upload_ring.bytes_this_frame;
+    stats->bytes_peak_frame = SDL_max(stats->bytes_peak_frame, rc2d_gpu_upload_ring.bytes_this_frame);
+    stats->copy_passes_last_frame = rc2d_gpu_upload_ring.copy_passes_this_frame;
+    rc2d_gpu_upload_ring.bytes_this_frame = 0;
+    rc2d_gpu_upload_ring.copy_passes_this_frame = 0;
+
+    SDL_UnlockMutex(rc2d_gpu_upload_ring.mutex);
+}
+
+void rc2d_gpu_getUploadStats(RC2D_GPUUploadStats* stats)
+{
+    RC2D_assert_release(stats != NULL, RC2D_LOG_CRITICAL, "Upload stats is NULL");
+
+    if (rc2d_gpu_upload_ring.mutex == NULL)
+    {
+        SDL_zerop(stats);
+        return;
+    }
+
+    SDL_LockMutex(rc2d_gpu_upload_ring.mutex);
+    *stats = rc2d_gpu_upload_ring.stats;
+    SDL_UnlockMutex(rc2d_gpu_upload_ring.mutex);
+}
+
+/**
+ * Entrée du pool de cibles de rendu, identifiée par (largeur, hauteur, format, échantillons, usage).
+ */
+typedef struct RC2D_GPURenderTargetEntry {
+    SDL_GPUTexture* texture;
+    Uint32 width;
+    Uint32 height;
+    SDL_GPUTextureFormat format;
+    SDL_GPUSampleCount sample_count;
+    SDL_GPUTextureUsageFlags usage;
+    bool in_use;
+} RC2D_GPURenderTargetEntry;
+
+/**
+ * Pool des cibles de rendu (texture de résolution MSAA, canvas offscreen...).
+ */
+static struct {
+    RC2D_GPURenderTargetEntry* entries;
+    int count;
+    int capacity;
+
+    // Taille de la swapchain lors de la dernière frame, pour détecter un redimensionnement
+    Uint32 swapchain_width;
+    Uint32 swapchain_height;
+} rc2d_gpu_render_target_pool = {0};
+
+SDL_GPUTexture* rc2d_gpu_acquireRenderTarget(Uint32 width, Uint32 height, SDL_GPUTextureFormat format, SDL_GPUSampleCount sampleCount, SDL_GPUTextureUsageFlags usage)
+{
+    RC2D_GPURenderTargetEntry* freeSlot = NULL;
+
+    for (int i = 0; i < rc2d_gpu_render_target_pool.count; i++)
+    {
+        RC2D_GPURenderTargetEntry* entry = &rc2d_gpu_render_target_pool.entries[i];
+
+        if (entry->texture == NULL)
+        {
+            if (freeSlot == NULL) freeSlot = entry;
+            continue;
+        }
+
+        if (!entry->in_use && entry->width == width && entry->height == height &&
+            entry->format == format && entry->sample_count == sampleCount && entry->usage == usage)
+        {
+            entry->in_use = true;
+            return entry->texture;
+        }
+    }
+
+    SDL_GPUTextureCreateInfo textureInfo = {
+        .type = SDL_GPU_TEXTURETYPE_2D,
+        .format = format,
+        .usage = usage,
+        .width = width,
+        .height = height,
+        .layer_count_or_depth = 1,
+        .num_levels = 1,
+        .sample_count = sampleCount
+    };
+    SDL_GPUTexture* texture = SDL_CreateGPUTexture(rc2d_gpu_getDevice(), &textureInfo);
+    if (texture == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to create render target %ux%u: %s", width, height, SDL_GetError());
+        return NULL;
+    }
+
+    if (freeSlot == NULL)
+    {
+        if (rc2d_gpu_render_target_pool.count == rc2d_gpu_render_target_pool.capacity)
+        {
+            int newCapacity = rc2d_gpu_render_target_pool.capacity ? rc2d_gpu_render_target_pool.capacity * 2 : 4;
+            RC2D_GPURenderTargetEntry* entries = RC2D_realloc(rc2d_gpu_render_target_pool.entries, newCapacity * sizeof(RC2D_GPURenderTargetEntry));
+            if (entries == NULL)
+            {
+                RC2D_log(RC2D_LOG_ERROR, "Failed to grow render target pool");
+                SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), texture);
+                return NULL;
+            }
+            rc2d_gpu_render_target_pool.entries = entries;
+            rc2d_gpu_render_target_pool.capacity = newCapacity;
+        }
+        freeSlot = &rc2d_gpu_render_target_pool.entries[rc2d_gpu_render_target_pool.count++];
+    }
+
+    freeSlot->texture = texture;
+    freeSlot->width = width;
+    freeSlot->height = height;
+    freeSlot->format = format;
+    freeSlot->sample_count = sampleCount;
+    freeSlot->usage = usage;
+    freeSlot->in_use = true;
+
+    return texture;
+}
+
+void rc2d_gpu_releaseRenderTarget(SDL_GPUTexture* texture)
+{
+    if (texture == NULL) return;
+
+    for (int i = 0; i < rc2d_gpu_render_target_pool.count; i++)
+    {
+        if (rc2d_gpu_render_target_pool.entries[i].texture == texture)
+        {
+            rc2d_gpu_render_target_pool.entries[i].in_use = false;
+            return;
+        }
+    }
+
+    RC2D_log(RC2D_LOG_WARN, "Texture %p does not belong to the render target pool", (void*)texture);
+}
+
+void rc2d_gpu_purgeRenderTargets(void)
+{
+    for (int i = 0; i < rc2d_gpu_render_target_pool.count; i++)
+    {
+        RC2D_GPURenderTargetEntry* entry = &rc2d_gpu_render_target_pool.entries[i];
+        if (entry->texture != NULL && !entry->in_use)
+        {
+            // SDL diffère la destruction réelle tant que le GPU utilise encore la texture
+            SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), entry->texture);
+            entry->texture = NULL;
+        }
+    }
+}
+
+void rc2d_gpu_renderTargetPoolNewFrame(Uint32 swapchainWidth, Uint32 swapchainHeight)
+{
+    // Les cibles à la taille de l'ancienne swapchain ne seront plus demandées : on les libère
+    if (swapchainWidth != rc2d_gpu_render_target_pool.swapchain_width || swapchainHeight != rc2d_gpu_render_target_pool.swapchain_height)
+    {
+        rc2d_gpu_purgeRenderTargets();
+        rc2d_gpu_render_target_pool.swapchain_width = swapchainWidth;
+        rc2d_gpu_render_target_pool.swapchain_height = swapchainHeight;
+    }
+}
+
+void rc2d_gpu_renderTargetPoolQuit(void)
+{
+    for (int i = 0; i < rc2d_gpu_render_target_pool.count; i++)
+    {
+        if (rc2d_gpu_render_target_pool.entries[i].texture != NULL)
+        {
+            SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), rc2d_gpu_render_target_pool.entries[i].texture);
+        }
+    }
+
+    RC2D_safe_free(rc2d_gpu_render_target_pool.entries);
+    SDL_zero(rc2d_gpu_render_target_pool);
+}
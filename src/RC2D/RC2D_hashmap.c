@@ -0,0 +1,274 @@
+#include <RC2D/RC2D_hashmap.h>
+#include <RC2D/RC2D_memory.h>
+#include <RC2D/RC2D_logger.h>
+
+#include <SDL3/SDL_atomic.h>
+
+/**
+ * Entrée de la table. Une entrée n'est jamais déplacée ni libérée avant rc2d_hashmap_destroy :
+ * un lecteur peut donc la consulter sans verrou une fois qu'elle est publiée dans un slot.
+ */
+typedef struct RC2D_HashMapEntry {
+    Uint64 hash;
+    char* key;      // Clé internée, NULL pour une clé 64 bits
+    void* value;    // Lue et écrite atomiquement (remplacement pendant un hot reload...)
+} RC2D_HashMapEntry;
+
+/**
+ * Tableau de slots (puissance de 2). Chaque slot contient un RC2D_HashMapEntry* publié atomiquement.
+ * Lors d'un agrandissement, l'ancien tableau est conservé jusqu'à la destruction de la table,
+ * car un lecteur peut encore être en train de le parcourir.
+ */
+typedef struct RC2D_HashMapTable {
+    void** slots;
+    Uint32 mask;
+    struct RC2D_HashMapTable* retired_next;
+} RC2D_HashMapTable;
+
+struct RC2D_HashMap {
+    // RC2D_HashMapTable* courant, lu atomiquement par les lecteurs
+    void* table;
+
+    // Tableaux remplacés lors des agrandissements
+    RC2D_HashMapTable* retired;
+
+    // Entrées dans l'ordre d'insertion (écrivain uniquement)
+    RC2D_HashMapEntry** entries;
+    Uint32 entry_capacity;
+    SDL_AtomicInt count;
+};
+
+Uint64 rc2d_hashmap_hashString(const char* key)
+{
+    Uint64 hash = 0xcbf29ce484222325ULL;
+    for (const unsigned char* p = (const unsigned char*)key; *p; p++)
+    {
+        hash ^= *p;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/**
+ * Mélange final (splitmix64) : les clés 64 bits (adresses...) ont des bits de poids faible peu variés.
+ */
+static Uint32 rc2d_hashmap_slotIndex(Uint64 hash, Uint32 mask)
+{
+    hash ^= hash >> 30;
+    hash *= 0xbf58476d1ce4e5b9ULL;
+    hash ^= hash >> 27;
+    hash *= 0x94d049bb133111ebULL;
+    hash ^= hash >> 31;
+    return (Uint32)hash & mask;
+}
+
+static RC2D_HashMapTable* rc2d_hashmap_createTable(Uint32 slotCount)
+{
+    RC2D_HashMapTable* table = RC2D_calloc(1, sizeof(RC2D_HashMapTable));
+    if (table == NULL) return NULL;
+
+    table->slots = RC2D_calloc(slotCount, sizeof(void*));
+    if (table->slots == NULL)
+    {
+        RC2D_free(table);
+        return NULL;
+    }
+    table->mask = slotCount - 1;
+    return table;
+}
+
+static void rc2d_hashmap_destroyTable(RC2D_HashMapTable* table)
+{
+    RC2D_safe_free(table->slots);
+    RC2D_free(table);
+}
+
+static RC2D_HashMapEntry* rc2d_hashmap_find(const RC2D_HashMap* map, Uint64 hash, const char* key)
+{
+    RC2D_HashMapTable* table = (RC2D_HashMapTable*)SDL_GetAtomicPointer((void**)&map->table);
+
+    // Sondage linéaire : le taux de remplissage reste sous 50 %, un slot vide termine toujours la recherche
+    for (Uint32 i = rc2d_hashmap_slotIndex(hash, table->mask); ; i = (i + 1) & table->mask)
+    {
+        RC2D_HashMapEntry* entry = (RC2D_HashMapEntry*)SDL_GetAtomicPointer(&table->slots[i]);
+        if (entry == NULL) return NULL;
+
+        if (entry->hash == hash)
+        {
+            if (key == NULL ? entry->key == NULL : (entry->key != NULL && SDL_strcmp(entry->key, key) == 0))
+            {
+                return entry;
+            }
+        }
+    }
+}
+
+static void rc2d_hashmap_publish(RC2D_HashMapTable* table, RC2D_HashMapEntry* entry)
+{
+    Uint32 i = rc2d_hashmap_slotIndex(entry->hash, table->mask);
+    while (table->slots[i] != NULL) i = (i + 1) & table->mask;
+
+    // Barrière complète : les champs de l'entrée sont visibles avant l'entrée elle-même
+    SDL_SetAtomicPointer(&table->slots[i], entry);
+}
+
+/**
+ * Double la taille du tableau de slots. Le nouveau tableau est entièrement rempli avant d'être publié.
+ */
+static bool rc2d_hashmap_grow(RC2D_HashMap* map)
+{
+    RC2D_HashMapTable* current = (RC2D_HashMapTable*)map->table;
+    RC2D_HashMapTable* table = rc2d_hashmap_createTable((current->mask + 1) * 2);
+    if (table == NULL) return false;
+
+    const Uint32 count = (Uint32)SDL_GetAtomicInt(&map->count);
+    for (Uint32 i = 0; i < count; i++)
+    {
+        rc2d_hashmap_publish(table, map->entries[i]);
+    }
+
+    SDL_SetAtomicPointer(&map->table, table);
+
+    current->retired_next = map->retired;
+    map->retired = current;
+    return true;
+}
+
+static bool rc2d_hashmap_insert(RC2D_HashMap* map, Uint64 hash, const char* key, void* value)
+{
+    RC2D_HashMapEntry* existing = rc2d_hashmap_find(map, hash, key);
+    if (existing != NULL)
+    {
+        SDL_SetAtomicPointer(&existing->value, value);
+        return true;
+    }
+
+    const Uint32 count = (Uint32)SDL_GetAtomicInt(&map->count);
+    RC2D_HashMapTable* table = (RC2D_HashMapTable*)map->table;
+    if ((count + 1) * 2 > table->mask + 1 && !rc2d_hashmap_grow(map))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to grow hash map to %u entries", count + 1);
+        return false;
+    }
+
+    if (count == map->entry_capacity)
+    {
+        Uint32 capacity = map->entry_capacity ? map->entry_capacity * 2 : 16;
+        RC2D_HashMapEntry** entries = RC2D_realloc(map->entries, capacity * sizeof(RC2D_HashMapEntry*));
+        if (entries == NULL) return false;
+        map->entries = entries;
+        map->entry_capacity = capacity;
+    }
+
+    RC2D_HashMapEntry* entry = RC2D_malloc(sizeof(RC2D_HashMapEntry));
+    if (entry == NULL) return false;
+
+    entry->hash = hash;
+    entry->key = NULL;
+    entry->value = value;
+    if (key != NULL)
+    {
+        entry->key = RC2D_strdup(key);
+        if (entry->key == NULL)
+        {
+            RC2D_free(entry);
+            return false;
+        }
+    }
+
+    map->entries[count] = entry;
+    rc2d_hashmap_publish((RC2D_HashMapTable*)map->table, entry);
+    SDL_SetAtomicInt(&map->count, (int)(count + 1));
+    return true;
+}
+
+RC2D_HashMap* rc2d_hashmap_create(Uint32 initialCapacity)
+{
+    // Au moins deux fois plus de slots que d'entrées attendues
+    Uint32 slotCount = 16;
+    while (slotCount < initialCapacity * 2) slotCount *= 2;
+
+    RC2D_HashMap* map = RC2D_calloc(1, sizeof(RC2D_HashMap));
+    if (map == NULL) return NULL;
+
+    map->table = rc2d_hashmap_createTable(slotCount);
+    if (map->table == NULL)
+    {
+        RC2D_free(map);
+        return NULL;
+    }
+
+    return map;
+}
+
+void rc2d_hashmap_destroy(RC2D_HashMap* map)
+{
+    if (map == NULL) return;
+
+    const Uint32 count = (Uint32)SDL_GetAtomicInt(&map->count);
+    for (Uint32 i = 0; i < count; i++)
+    {
+        RC2D_safe_free(map->entries[i]->key);
+        RC2D_free(map->entries[i]);
+    }
+    RC2D_safe_free(map->entries);
+
+    while (map->retired != NULL)
+    {
+        RC2D_HashMapTable* next = map->retired->retired_next;
+        rc2d_hashmap_destroyTable(map->retired);
+        map->retired = next;
+    }
+    rc2d_hashmap_destroyTable((RC2D_HashMapTable*)map->table);
+
+    RC2D_free(map);
+}
+
+void* rc2d_hashmap_get(const RC2D_HashMap* map, const char* key)
+{
+    if (map == NULL || key == NULL) return NULL;
+
+    RC2D_HashMapEntry* entry = rc2d_hashmap_find(map, rc2d_hashmap_hashString(key), key);
+    return entry ? SDL_GetAtomicPointer(&entry->value) : NULL;
+}
+
+bool rc2d_hashmap_put(RC2D_HashMap* map, const char* key, void* value)
+{
+    if (map == NULL || key == NULL || value == NULL) return false;
+
+    return rc2d_hashmap_insert(map, rc2d_hashmap_hashString(key), key, value);
+}
+
+void* rc2d_hashmap_getByHash(const RC2D_HashMap* map, Uint64 hash)
+{
+    if (map == NULL) return NULL;
+
+    RC2D_HashMapEntry* entry = rc2d_hashmap_find(map, hash, NULL);
+    return entry ? SDL_GetAtomicPointer(&entry->value) : NULL;
+}
+
+bool rc2d_hashmap_putByHash(RC2D_HashMap* map, Uint64 hash, void* value)
+{
+    if (map == NULL || value == NULL) return false;
+
+    return rc2d_hashmap_insert(map, hash, NULL, value);
+}
+
+Uint32 rc2d_hashmap_count(const RC2D_HashMap* map)
+{
+    if (map == NULL) return 0;
+
+    return (Uint32)SDL_GetAtomicInt((SDL_AtomicInt*)&map->count);
+}
+
+void rc2d_hashmap_forEach(const RC2D_HashMap* map, RC2D_HashMapIterator iterator, void* userdata)
+{
+    if (map == NULL || iterator == NULL) return;
+
+    const Uint32 count = rc2d_hashmap_count(map);
+    for (Uint32 i = 0; i < count; i++)
+    {
+        RC2D_HashMapEntry* entry = map->entries[i];
+        iterator(entry->key, entry->hash, SDL_GetAtomicPointer(&entry->value), userdata);
+    }
+}
@@ -0,0 +1,695 @@
+#include <RC2D/RC2D_gpu.h>
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_assert.h>
+#include <RC2D/RC2D_job.h>
+#include <RC2D/RC2D_logger.h>
+#include <RC2D/RC2D_memory.h>
+
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_filesystem.h>
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_gpu.h>
+#include <SDL3/SDL_surface.h>
+#include <SDL3_image/SDL_image.h>
+
+/**
+ * Chargement asynchrone (ou rechargement après éviction) : le worker décode le fichier, ou appelle la fonction de
+ * rechargement de l'entrée, puis le thread principal crée la texture et remplace le placeholder.
+ */
+typedef struct RC2D_ImageLoadRequest {
+    RC2D_Image* image;
+    char* path;
+
+    // Pixels décodés (SDL_PIXELFORMAT_RGBA32), NULL si le décodage a échoué
+    SDL_Surface* surface;
+
+    // Source autre qu'un fichier : données décodées par reload sur le worker, texture créée par upload
+    RC2D_ImageReloadFunction reload;
+    RC2D_ImageUploadFunction upload;
+    void* reload_data;
+    void* loaded;
+    SDL_GPUTexture* texture;
+    Uint32 width;
+    Uint32 height;
+    Uint64 bytes;
+} RC2D_ImageLoadRequest;
+
+/**
+ * État du chargeur d'images.
+ */
+static struct {
+    // Image grise 1x1 affichée pendant les chargements, créée par rc2d_gpu_imageCacheInit
+    RC2D_Image placeholder;
+
+    // Jobs de décodage et tâches d'upload en cours, attendus à la fermeture du moteur
+    RC2D_JobCounter pending;
+
+    // Images en chargement (rc2d_gpu_getPendingImageCount)
+    SDL_AtomicInt loading;
+
+    // Textures résidentes (sous gpu_image_cache_mutex : rc2d_gpu_newImage peut être appelée depuis un worker)
+    Uint64 resident_bytes;
+    Uint32 resident_count;
+
+    // Numéro de la frame courante, pour l'éviction LRU
+    Uint64 frame;
+
+    // Compteurs de la frame en cours, et statistiques de la frame écoulée
+    Uint32 hits;
+    Uint32 misses;
+    Uint32 evictions;
+    Uint32 reloads;
+    Uint64 evictions_total;
+    RC2D_GPUImageCacheStats last_frame;
+} rc2d_image = {0};
+
+/**
+ * Chemin complet d'une image, relatif au dossier de l'exécutable comme les shaders.
+ */
+static char* rc2d_image_getPath(const char* filename)
+{
+    const char* basePath = SDL_GetBasePath();
+    RC2D_assert_release(basePath != NULL, RC2D_LOG_CRITICAL, "SDL_GetBasePath() failed, SDL_Error: %s", SDL_GetError());
+
+    char path[512];
+    SDL_snprintf(path, sizeof(path), "%s%s", basePath, filename);
+    return RC2D_strdup(path);
+}
+
+/**
+ * Lit et décode un fichier image en pixels RGBA 8 bits. Sans accès au GPU : peut tourner sur un worker.
+ */
+static SDL_Surface* rc2d_image_decode(const char* path)
+{
+    SDL_Surface* loaded = IMG_Load(path);
+    if (loaded == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to load image %s: %s", path, SDL_GetError());
+        return NULL;
+    }
+
+    if (loaded->format == SDL_PIXELFORMAT_RGBA32) return loaded;
+
+    SDL_Surface* rgba = SDL_ConvertSurface(loaded, SDL_PIXELFORMAT_RGBA32);
+    SDL_DestroySurface(loaded);
+    if (rgba == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to convert image %s to RGBA: %s", path, SDL_GetError());
+    }
+    return rgba;
+}
+
+/**
+ * Crée une texture R8G8B8A8 et programme la copie de ses pixels via le ring d'upload. Thread principal uniquement.
+ */
+static SDL_GPUTexture* rc2d_image_createTexture(const void* pixels, int pitch, Uint32 width, Uint32 height)
+{
+    RC2D_assert_release(SDL_IsMainThread(), RC2D_LOG_CRITICAL, "Image textures must be created on the main thread");
+
+    SDL_GPUTextureCreateInfo createInfo = {
+        .type = SDL_GPU_TEXTURETYPE_2D,
+        .format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
+        .usage = SDL_GPU_TEXTUREUSAGE_SAMPLER,
+        .width = width,
+        .height = height,
+        .layer_count_or_depth = 1,
+        .num_levels = 1,
+        .sample_count = SDL_GPU_SAMPLECOUNT_1
+    };
+
+    SDL_GPUTexture* texture = SDL_CreateGPUTexture(rc2d_gpu_getDevice(), &createInfo);
+    if (texture == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to create image texture: %s", SDL_GetError());
+        return NULL;
+    }
+
+    const Uint32 rowSize = width * 4;
+    RC2D_GPUUploadAllocation allocation;
+    if (!rc2d_gpu_beginUpload(rowSize * height, 512, &allocation))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to reserve upload space for image texture");
+        SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), texture);
+        return NULL;
+    }
+
+    if ((Uint32)pitch == rowSize)
+    {
+        SDL_memcpy(allocation.data, pixels, (size_t)rowSize * height);
+    }
+    else
+    {
+        for (Uint32 y = 0; y < height; y++)
+        {
+            SDL_memcpy((Uint8*)allocation.data + (size_t)y * rowSize, (const Uint8*)pixels + (size_t)y * pitch, rowSize);
+        }
+    }
+
+    SDL_GPUTextureRegion region = { .texture = texture, .w = width, .h = height, .d = 1 };
+    rc2d_gpu_endUploadToTexture(&allocation, 0, &region, width, height);
+
+    return texture;
+}
+
+bool rc2d_gpu_imageCacheInit(void)
+{
+    const Uint8 grey[4] = { 0x80, 0x80, 0x80, 0xFF };
+    rc2d_image.placeholder.texture = rc2d_image_createTexture(grey, 4, 1, 1);
+    rc2d_image.placeholder.width = 1;
+    rc2d_image.placeholder.height = 1;
+    return rc2d_image.placeholder.texture != NULL;
+}
+
+/**
+ * Compte une texture devenue résidente (bytes > 0) ou libérée (bytes < 0).
+ */
+static void rc2d_image_addResident(Sint64 bytes)
+{
+    SDL_LockMutex(rc2d_engine_state.gpu_image_cache_mutex);
+    rc2d_image.resident_bytes = (Uint64)((Sint64)rc2d_image.resident_bytes + bytes);
+    if (bytes > 0) rc2d_image.resident_count++;
+    else rc2d_image.resident_count--;
+    SDL_UnlockMutex(rc2d_engine_state.gpu_image_cache_mutex);
+}
+
+/**
+ * Ajoute une image au cache et la publie dans l'index. Appelée avec gpu_image_cache_mutex verrouillé.
+ */
+static void rc2d_image_cacheInsert(const char* filename, RC2D_Image* image, RC2D_ImageReloadFunction reload,
+                                   RC2D_ImageUploadFunction upload, void* reloadData)
+{
+    RC2D_ImageEntry** newCache = RC2D_realloc(
+        rc2d_engine_state.gpu_image_cache,
+        (rc2d_engine_state.gpu_image_cache_count + 1) * sizeof(RC2D_ImageEntry*)
+    );
+    RC2D_assert_release(newCache != NULL, RC2D_LOG_CRITICAL, "Failed to realloc image cache");
+    rc2d_engine_state.gpu_image_cache = newCache;
+
+    RC2D_ImageEntry* entry = RC2D_calloc(1, sizeof(RC2D_ImageEntry));
+    RC2D_assert_release(entry != NULL, RC2D_LOG_CRITICAL, "Failed to allocate image cache entry");
+    entry->image = image;
+    entry->filename = RC2D_strdup(filename);
+    entry->reload = reload;
+    entry->upload = upload;
+    entry->reload_data = reloadData;
+    image->entry = entry;
+    image->last_used_frame = rc2d_image.frame;
+
+    if (image->bytes > 0)
+    {
+        rc2d_image.resident_bytes += image->bytes;
+        rc2d_image.resident_count++;
+    }
+
+    rc2d_engine_state.gpu_image_cache[rc2d_engine_state.gpu_image_cache_count++] = entry;
+    if (!rc2d_hashmap_put(rc2d_engine_state.gpu_image_cache_index, filename, entry))
+    {
+        RC2D_log(RC2D_LOG_WARN, "Failed to index image %s, it will be reloaded on next request", filename);
+    }
+}
+
+/**
+ * Libère la texture d'une image qui n'a pas été publiée dans le cache (zone de l'atlas ou texture propre).
+ */
+static void rc2d_image_releaseTexture(RC2D_Image* image)
+{
+    if (image->atlas_region != NULL) rc2d_atlas_removeImage(image);
+    else if (image->texture != NULL) SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), image->texture);
+}
+
+/**
+ * Publie une image prête dans le cache, ou renvoie celle qu'un autre thread a publiée entre-temps sous la même clé.
+ */
+static RC2D_Image* rc2d_image_publish(const char* key, RC2D_Image* image, RC2D_ImageReloadFunction reload,
+                                      RC2D_ImageUploadFunction upload, void* reloadData)
+{
+    SDL_LockMutex(rc2d_engine_state.gpu_image_cache_mutex);
+
+    // Un autre thread a pu charger la même image entre-temps : on garde la première
+    RC2D_ImageEntry* cachedEntry = rc2d_hashmap_get(rc2d_engine_state.gpu_image_cache_index, key);
+    if (cachedEntry != NULL)
+    {
+        SDL_UnlockMutex(rc2d_engine_state.gpu_image_cache_mutex);
+        rc2d_image_releaseTexture(image);
+        RC2D_free(image);
+        RC2D_safe_free(reloadData);
+        return cachedEntry->image;
+    }
+
+    rc2d_image_cacheInsert(key, image, reload, upload, reloadData);
+    SDL_UnlockMutex(rc2d_engine_state.gpu_image_cache_mutex);
+
+    RC2D_log(RC2D_LOG_INFO, "Image loaded and cached: %s (%ux%u%s)", key, image->width, image->height,
+             image->atlas_region != NULL ? ", atlas" : "");
+    return image;
+}
+
+RC2D_Image* rc2d_gpu_cacheImage(const char* key, SDL_GPUTexture* texture, Uint32 width, Uint32 height, Uint64 bytes,
+                                RC2D_ImageReloadFunction reload, RC2D_ImageUploadFunction upload, void* reloadData)
+{
+    RC2D_assert_release(key != NULL && texture != NULL, RC2D_LOG_CRITICAL, "key or texture is NULL");
+
+    RC2D_Image* image = RC2D_calloc(1, sizeof(RC2D_Image));
+    RC2D_assert_release(image != NULL, RC2D_LOG_CRITICAL, "Failed to allocate image");
+    image->texture = texture;
+    image->width = width;
+    image->height = height;
+    image->bytes = bytes;
+    image->state = RC2D_IMAGE_READY;
+
+    return rc2d_image_publish(key, image, reload, upload, reloadData);
+}
+
+/**
+ * Image décodée par rc2d_gpu_newImage, dont la texture est créée par le thread principal.
+ */
+typedef struct RC2D_ImageCreateTask {
+    const char* filename;
+    SDL_Surface* surface;
+    RC2D_Image* image;
+} RC2D_ImageCreateTask;
+
+/**
+ * Thread principal : range l'image décodée dans l'atlas ou dans sa propre texture, puis la publie dans le cache.
+ */
+static void rc2d_image_createTask(void* data)
+{
+    RC2D_ImageCreateTask* task = (RC2D_ImageCreateTask*)data;
+    SDL_Surface* surface = task->surface;
+    const Uint32 width = (Uint32)surface->w;
+    const Uint32 height = (Uint32)surface->h;
+
+    // Petite image : rangée dans une page partagée de l'atlas plutôt que dans sa propre texture
+    if (rc2d_atlas_isEligible(width, height))
+    {
+        RC2D_Image* image = RC2D_calloc(1, sizeof(RC2D_Image));
+        RC2D_assert_release(image != NULL, RC2D_LOG_CRITICAL, "Failed to allocate image");
+
+        if (rc2d_atlas_insertImage(image, surface->pixels, surface->pitch, width, height))
+        {
+            image->state = RC2D_IMAGE_READY;
+            task->image = rc2d_image_publish(task->filename, image, NULL, NULL, NULL);
+            return;
+        }
+        RC2D_free(image);
+    }
+
+    SDL_GPUTexture* texture = rc2d_image_createTexture(surface->pixels, surface->pitch, width, height);
+    if (texture == NULL) return;
+
+    task->image = rc2d_gpu_cacheImage(task->filename, texture, width, height, (Uint64)width * height * 4, NULL, NULL, NULL);
+}
+
+RC2D_Image* rc2d_gpu_newImage(const char* filename)
+{
+    RC2D_assert_release(filename != NULL, RC2D_LOG_CRITICAL, "filename is NULL");
+
+    // Image déjà chargée (ou en cours de chargement asynchrone), sans verrou
+    RC2D_ImageEntry* cachedEntry = rc2d_hashmap_get(rc2d_engine_state.gpu_image_cache_index, filename);
+    if (cachedEntry != NULL) return cachedEntry->image;
+
+    // Le décodage reste sur le thread appelant
+    char* path = rc2d_image_getPath(filename);
+    RC2D_ImageCreateTask task = { .filename = filename, .surface = rc2d_image_decode(path), .image = NULL };
+    RC2D_safe_free(path);
+    if (task.surface == NULL) return NULL;
+
+    // Création de la texture et upload sur le thread principal (exécutée directement si c'est le thread appelant)
+    RC2D_JobCounter created = {0};
+    rc2d_job_runOnMainThread(rc2d_image_createTask, &task, &created);
+    rc2d_job_wait(&created);
+
+    SDL_DestroySurface(task.surface);
+    return task.image;
+}
+
+/**
+ * Thread principal : crée la texture à partir des pixels (ou des données de rechargement) décodés, et remplace le placeholder.
+ */
+static void rc2d_image_uploadTask(void* data)
+{
+    RC2D_ImageLoadRequest* request = (RC2D_ImageLoadRequest*)data;
+    RC2D_Image* image = request->image;
+
+    // Source autre qu'un fichier : la fonction d'upload libère les données décodées, même en cas d'échec
+    if (request->upload != NULL)
+    {
+        request->texture = request->upload(request->reload_data, request->loaded, &request->width, &request->height, &request->bytes);
+        request->loaded = NULL;
+    }
+
+    // Petite image : rangée dans l'atlas, la texture de l'image devient sa page
+    bool inAtlas = request->texture == NULL && request->surface != NULL &&
+                   rc2d_atlas_isEligible((Uint32)request->surface->w, (Uint32)request->surface->h) &&
+                   rc2d_atlas_insertImage(image, request->surface->pixels, request->surface->pitch,
+                                          (Uint32)request->surface->w, (Uint32)request->surface->h);
+
+    if (!inAtlas && request->texture == NULL && request->surface != NULL)
+    {
+        request->width = (Uint32)request->surface->w;
+        request->height = (Uint32)request->surface->h;
+        request->bytes = (Uint64)request->width * request->height * 4;
+        request->texture = rc2d_image_createTexture(request->surface->pixels, request->surface->pitch, request->width, request->height);
+    }
+
+    if (inAtlas)
+    {
+        image->state = RC2D_IMAGE_READY;
+        image->last_used_frame = rc2d_image.frame;
+    }
+    else if (request->texture != NULL)
+    {
+        image->texture = request->texture;
+        image->width = request->width;
+        image->height = request->height;
+        image->bytes = request->bytes;
+        image->state = RC2D_IMAGE_READY;
+        image->last_used_frame = rc2d_image.frame;
+        rc2d_image_addResident((Sint64)request->bytes);
+    }
+    else
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Asynchronous image load failed: %s", image->entry->filename);
+        image->state = RC2D_IMAGE_FAILED;
+    }
+
+    if (request->surface != NULL) SDL_DestroySurface(request->surface);
+    RC2D_safe_free(request->path);
+    RC2D_free(request);
+
+    SDL_AddAtomicInt(&rc2d_image.loading, -1);
+}
+
+/**
+ * Worker : lit et décode le fichier (ou la source de l'entrée avec sa fonction de rechargement), puis confie
+ * la création de la texture au thread principal.
+ */
+static void rc2d_image_decodeJob(void* data)
+{
+    RC2D_ImageLoadRequest* request = (RC2D_ImageLoadRequest*)data;
+    if (request->reload != NULL)
+    {
+        request->loaded = request->reload(request->reload_data);
+    }
+    else
+    {
+        request->surface = rc2d_image_decode(request->path);
+    }
+    rc2d_job_runOnMainThread(rc2d_image_uploadTask, request, &rc2d_image.pending);
+}
+
+/**
+ * Lance le chargement en arrière-plan d'une image du cache, dont la texture est déjà le placeholder.
+ */
+static void rc2d_image_startLoad(RC2D_Image* image)
+{
+    RC2D_ImageLoadRequest* request = RC2D_calloc(1, sizeof(RC2D_ImageLoadRequest));
+    RC2D_assert_release(request != NULL, RC2D_LOG_CRITICAL, "Failed to allocate image load request");
+
+    request->image = image;
+    request->reload = image->entry->reload;
+    request->upload = image->entry->upload;
+    request->reload_data = image->entry->reload_data;
+    if (request->reload == NULL)
+    {
+        request->path = rc2d_image_getPath(image->entry->filename);
+    }
+
+    SDL_AddAtomicInt(&rc2d_image.loading, 1);
+    rc2d_job_run(rc2d_image_decodeJob, request, &rc2d_image.pending);
+}
+
+RC2D_Image* rc2d_gpu_loadImageAsync(const char* filename)
+{
+    RC2D_assert_release(filename != NULL, RC2D_LOG_CRITICAL, "filename is NULL");
+
+    RC2D_ImageEntry* cachedEntry = rc2d_hashmap_get(rc2d_engine_state.gpu_image_cache_index, filename);
+    if (cachedEntry != NULL) return cachedEntry->image;
+
+    RC2D_Image* image = RC2D_calloc(1, sizeof(RC2D_Image));
+    RC2D_assert_release(image != NULL, RC2D_LOG_CRITICAL, "Failed to allocate image");
+
+    SDL_LockMutex(rc2d_engine_state.gpu_image_cache_mutex);
+
+    cachedEntry = rc2d_hashmap_get(rc2d_engine_state.gpu_image_cache_index, filename);
+    if (cachedEntry != NULL)
+    {
+        SDL_UnlockMutex(rc2d_engine_state.gpu_image_cache_mutex);
+        RC2D_free(image);
+        return cachedEntry->image;
+    }
+
+    /**
+     * L'image est publiée tout de suite : les demandes suivantes du même fichier ne relancent pas de chargement.
+     * Ses dimensions ne sont pas encore connues : rc2d_gpu_drawImage dessine le placeholder étiré en
+     * RC2D_IMAGE_PLACEHOLDER_SIZE pixels de côté jusqu'à la fin du chargement.
+     */
+    image->texture = rc2d_image.placeholder.texture;
+    image->width = RC2D_IMAGE_PLACEHOLDER_SIZE;
+    image->height = RC2D_IMAGE_PLACEHOLDER_SIZE;
+    image->state = RC2D_IMAGE_LOADING;
+    rc2d_image_cacheInsert(filename, image, NULL, NULL, NULL);
+
+    SDL_UnlockMutex(rc2d_engine_state.gpu_image_cache_mutex);
+
+    rc2d_image_startLoad(image);
+    return image;
+}
+
+int rc2d_gpu_getPendingImageCount(void)
+{
+    return SDL_GetAtomicInt(&rc2d_image.loading);
+}
+
+void rc2d_gpu_useImage(RC2D_Image* image)
+{
+    image->last_used_frame = rc2d_image.frame;
+
+    if (image->state == RC2D_IMAGE_READY)
+    {
+        rc2d_image.hits++;
+        return;
+    }
+
+    rc2d_image.misses++;
+
+    // Texture évincée : le placeholder est dessiné pendant le rechargement
+    if (image->state == RC2D_IMAGE_EVICTED)
+    {
+        image->state = RC2D_IMAGE_LOADING;
+        rc2d_image.reloads++;
+        rc2d_image_startLoad(image);
+    }
+}
+
+static int SDLCALL rc2d_image_compareLastUsed(const void* a, const void* b)
+{
+    const RC2D_Image* imageA = *(RC2D_Image* const*)a;
+    const RC2D_Image* imageB = *(RC2D_Image* const*)b;
+    return (imageA->last_used_frame > imageB->last_used_frame) - (imageA->last_used_frame < imageB->last_used_frame);
+}
+
+Uint32 rc2d_gpu_selectImagesToEvict(RC2D_Image** images, Uint32 count, Uint64 frame, Uint64 residentBytes, Uint64 budget)
+{
+    Uint32 candidateCount = 0;
+    for (Uint32 i = 0; i < count; i++)
+    {
+        RC2D_Image* image = images[i];
+        // Les images de l'atlas partagent leur page : elles ne sont jamais évincées une par une
+        if (image->state == RC2D_IMAGE_READY && image->atlas_region == NULL &&
+            image->last_used_frame + RC2D_IMAGE_EVICTION_MIN_AGE < frame)
+        {
+            images[i] = images[candidateCount];
+            images[candidateCount++] = image;
+        }
+    }
+
+    SDL_qsort(images, candidateCount, sizeof(RC2D_Image*), rc2d_image_compareLastUsed);
+
+    Uint32 evictCount = 0;
+    while (evictCount < candidateCount && residentBytes > budget)
+    {
+        residentBytes -= SDL_min(images[evictCount]->bytes, residentBytes);
+        evictCount++;
+    }
+    return evictCount;
+}
+
+/**
+ * Libère les textures les moins récemment dessinées jusqu'à repasser sous le budget.
+ */
+static void rc2d_image_evict(Uint64 budget)
+{
+    SDL_LockMutex(rc2d_engine_state.gpu_image_cache_mutex);
+
+    const Uint32 count = rc2d_engine_state.gpu_image_cache_count;
+    RC2D_Image** candidates = count > 0 ? RC2D_malloc(count * sizeof(RC2D_Image*)) : NULL;
+    for (Uint32 i = 0; i < count && candidates != NULL; i++)
+    {
+        candidates[i] = rc2d_engine_state.gpu_image_cache[i]->image;
+    }
+
+    const Uint32 evictCount = candidates != NULL ?
+        rc2d_gpu_selectImagesToEvict(candidates, count, rc2d_image.frame, rc2d_image.resident_bytes, budget) : 0;
+
+    for (Uint32 i = 0; i < evictCount; i++)
+    {
+        RC2D_Image* image = candidates[i];
+
+        // Libérée par SDL_GPU une fois les command buffers déjà soumis terminés
+        SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), image->texture);
+        image->texture = rc2d_image.placeholder.texture;
+        image->state = RC2D_IMAGE_EVICTED;
+
+        rc2d_image.resident_bytes -= image->bytes;
+        rc2d_image.resident_count--;
+        image->bytes = 0;
+        rc2d_image.evictions++;
+    }
+
+    SDL_UnlockMutex(rc2d_engine_state.gpu_image_cache_mutex);
+    RC2D_safe_free(candidates);
+}
+
+void rc2d_gpu_imageCacheNewFrame(void)
+{
+    const Uint64 budget = rc2d_engine_state.config->gpuTextureBudget;
+    if (budget > 0 && rc2d_image.resident_bytes > budget)
+    {
+        rc2d_image_evict(budget);
+    }
+
+    RC2D_GPUImageCacheStats* stats = &rc2d_image.last_frame;
+    stats->hits_last_frame = rc2d_image.hits;
+    stats->misses_last_frame = rc2d_image.misses;
+    stats->hit_rate = rc2d_image.hits + rc2d_image.misses > 0 ? (float)rc2d_image.hits / (float)(rc2d_image.hits + rc2d_image.misses) : 1.0f;
+    stats->evictions_last_frame = rc2d_image.evictions;
+    stats->reloads_last_frame = rc2d_image.reloads;
+    rc2d_image.evictions_total += rc2d_image.evictions;
+
+    rc2d_image.hits = 0;
+    rc2d_image.misses = 0;
+    rc2d_image.evictions = 0;
+    rc2d_image.reloads = 0;
+    rc2d_image.frame++;
+}
+
+void rc2d_gpu_setImageCacheBudget(Uint64 bytes)
+{
+    rc2d_engine_state.config->gpuTextureBudget = bytes;
+}
+
+void rc2d_gpu_getImageCacheStats(RC2D_GPUImageCacheStats* stats)
+{
+    RC2D_assert_release(stats != NULL, RC2D_LOG_CRITICAL, "stats is NULL");
+
+    *stats = rc2d_image.last_frame;
+
+    SDL_LockMutex(rc2d_engine_state.gpu_image_cache_mutex);
+    stats->resident_bytes = rc2d_image.resident_bytes;
+    stats->resident_count = rc2d_image.resident_count;
+    stats->image_count = rc2d_engine_state.gpu_image_cache_count;
+    SDL_UnlockMutex(rc2d_engine_state.gpu_image_cache_mutex);
+
+    stats->budget_bytes = rc2d_engine_state.config->gpuTextureBudget;
+    stats->evictions_total = rc2d_image.evictions_total;
+}
+
+void rc2d_gpu_purgeImages(const char* keyPrefix)
+{
+    RC2D_assert_release(keyPrefix != NULL, RC2D_LOG_CRITICAL, "keyPrefix is NULL");
+
+    // Moteur non démarré (ou déjà arrêté) : pas de cache
+    if (rc2d_engine_state.gpu_image_cache_mutex == NULL) return;
+
+    // Un rechargement en cours peut encore lire la source d'une image purgée
+    rc2d_job_wait(&rc2d_image.pending);
+
+    const size_t prefixLength = SDL_strlen(keyPrefix);
+    Uint32 purged = 0;
+
+    SDL_LockMutex(rc2d_engine_state.gpu_image_cache_mutex);
+    for (Uint32 i = 0; i < rc2d_engine_state.gpu_image_cache_count; i++)
+    {
+        RC2D_ImageEntry* entry = rc2d_engine_state.gpu_image_cache[i];
+        if (SDL_strncmp(entry->filename, keyPrefix, prefixLength) != 0 || entry->reload_data == NULL) continue;
+
+        /**
+         * L'entrée reste dans l'index (lu sans verrou) et l'image reste un handle valide : seule sa texture est libérée.
+         * Libérée par SDL_GPU une fois les command buffers déjà soumis terminés.
+         */
+        RC2D_Image* image = entry->image;
+        if (image->texture != rc2d_image.placeholder.texture)
+        {
+            rc2d_image_releaseTexture(image);
+        }
+        image->texture = rc2d_image.placeholder.texture;
+        image->atlas_region = NULL;
+        image->state = RC2D_IMAGE_FAILED;
+        if (image->bytes > 0)
+        {
+            rc2d_image.resident_bytes -= image->bytes;
+            rc2d_image.resident_count--;
+            image->bytes = 0;
+        }
+
+        entry->reload = NULL;
+        entry->upload = NULL;
+        RC2D_safe_free(entry->reload_data);
+        purged++;
+    }
+    SDL_UnlockMutex(rc2d_engine_state.gpu_image_cache_mutex);
+
+    if (purged > 0)
+    {
+        RC2D_log(RC2D_LOG_INFO, "%u images purged from cache (%s)", purged, keyPrefix);
+    }
+}
+
+void rc2d_gpu_imageLoaderQuit(void)
+{
+    rc2d_job_wait(&rc2d_image.pending);
+}
+
+void rc2d_gpu_imageCacheQuit(void)
+{
+    if (rc2d_engine_state.gpu_image_cache_mutex == NULL) return;
+
+    SDL_LockMutex(rc2d_engine_state.gpu_image_cache_mutex);
+    for (Uint32 i = 0; i < rc2d_engine_state.gpu_image_cache_count; i++)
+    {
+        RC2D_ImageEntry* entry = rc2d_engine_state.gpu_image_cache[i];
+        if (entry->image != NULL)
+        {
+            /**
+             * Les images en échec ou évincées gardent le placeholder, libéré une seule fois plus bas.
+             * Les pages de l'atlas sont libérées par rc2d_atlas_quit.
+             */
+            if (entry->image->texture != NULL && entry->image->texture != rc2d_image.placeholder.texture &&
+                entry->image->atlas_region == NULL)
+            {
+                SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), entry->image->texture);
+            }
+            RC2D_safe_free(entry->image);
+        }
+        RC2D_safe_free(entry->reload_data);
+        RC2D_safe_free(entry->filename);
+        RC2D_safe_free(rc2d_engine_state.gpu_image_cache[i]);
+    }
+    RC2D_safe_free(rc2d_engine_state.gpu_image_cache);
+    rc2d_engine_state.gpu_image_cache_count = 0;
+    rc2d_hashmap_destroy(rc2d_engine_state.gpu_image_cache_index);
+    rc2d_engine_state.gpu_image_cache_index = NULL;
+
+    if (rc2d_image.placeholder.texture != NULL)
+    {
+        SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), rc2d_image.placeholder.texture);
+    }
+    SDL_zero(rc2d_image.placeholder);
+    rc2d_image.resident_bytes = 0;
+    rc2d_image.resident_count = 0;
+
+    SDL_UnlockMutex(rc2d_engine_state.gpu_image_cache_mutex);
+    SDL_DestroyMutex(rc2d_engine_state.gpu_image_cache_mutex);
+    rc2d_engine_state.gpu_image_cache_mutex = NULL;
+}
@@ -0,0 +1,762 @@
+// Requis pour : sched_setaffinity, CPU_SET (doit précéder tout en-tête système)
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include <RC2D/RC2D_job.h>
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_assert.h>
+#include <RC2D/RC2D_logger.h>
+#include <RC2D/RC2D_memory.h>
+#include <RC2D/RC2D_platform_defines.h>
+#include <RC2D/RC2D_thread.h>
+
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_cpuinfo.h>
+#include <SDL3/SDL_mutex.h>
+#include <SDL3/SDL_thread.h>
+#include <SDL3/SDL_timer.h>
+
+#if defined(RC2D_PLATFORM_WINDOWS)
+#include <windows.h>
+#elif defined(RC2D_PLATFORM_LINUX) || defined(RC2D_PLATFORM_ANDROID)
+#include <sched.h>
+#endif
+
+SDL_COMPILE_TIME_ASSERT(rc2d_job_queue_size_pow2, (RC2D_JOB_QUEUE_SIZE & (RC2D_JOB_QUEUE_SIZE - 1)) == 0);
+
+#define RC2D_JOB_QUEUE_MASK (RC2D_JOB_QUEUE_SIZE - 1)
+
+/**
+ * Nombre de tentatives (avec SDL_CPUPauseInstruction) avant qu'un worker sans travail ne s'endorme.
+ */
+#define RC2D_JOB_SPIN_COUNT 256
+
+/**
+ * Job : fonction simple (function) ou lot d'un parallel for (range_function sur [start, end[).
+ */
+typedef struct RC2D_Job {
+    RC2D_JobFunction function;
+    RC2D_JobRangeFunction range_function;
+    void* data;
+    Uint32 start;
+    Uint32 end;
+    RC2D_JobCounter* counter;
+
+    // Liste d'attente d'un compteur, ou file des jobs soumis par des threads extérieurs
+    struct RC2D_Job* next;
+
+    // Emplacement occupé dans le buffer circulaire du thread qui a créé le job
+    SDL_AtomicInt in_use;
+
+    // Alloué avec RC2D_malloc (job créé par un thread extérieur au système de jobs)
+    bool heap;
+} RC2D_Job;
+
+/**
+ * Thread du système de jobs (thread principal ou worker).
+ *
+ * La file est une deque de Chase-Lev de taille fixe : le propriétaire pousse et retire ses jobs en bas (LIFO,
+ * données encore chaudes dans le cache), les autres threads volent en haut (les jobs les plus anciens).
+ * Les index sont des compteurs 32 bits non signés comparés par différence, ils peuvent donc faire le tour.
+ */
+typedef struct RC2D_JobWorker {
+    SDL_AtomicU32 top;
+    Uint8 padding0[60]; // top (voleurs) et bottom (propriétaire) sur des lignes de cache différentes
+    SDL_AtomicU32 bottom;
+    Uint8 padding1[60];
+    void* slots[RC2D_JOB_QUEUE_SIZE];
+
+    // Jobs créés par ce thread (buffer circulaire)
+    RC2D_Job jobs[RC2D_JOB_QUEUE_SIZE];
+    Uint32 next_job;
+
+    // État xorshift pour choisir la première victime d'un vol
+    Uint32 random;
+
+    int index;
+    RC2D_Thread* thread;
+} RC2D_JobWorker;
+
+/**
+ * État du système de jobs.
+ */
+static struct {
+    bool initialized;
+    bool pin_workers;
+
+    // workers[0] est le thread qui a appelé rc2d_job_init, workers[1..worker_count] les workers
+    RC2D_JobWorker* workers;
+    int worker_count;
+
+    SDL_AtomicInt quit;
+
+    // Workers endormis, réveillés à chaque soumission
+    SDL_Semaphore* wake;
+    SDL_AtomicInt sleeping;
+
+    // Jobs soumis par des threads extérieurs au système de jobs (FIFO)
+    SDL_Mutex* external_mutex;
+    RC2D_Job* external_head;
+    RC2D_Job* external_tail;
+    SDL_AtomicInt external_count;
+} rc2d_job = {0};
+
+/**
+ * Tâche confiée au thread principal (nœud de la file MPSC).
+ */
+typedef struct RC2D_MainThreadTask {
+    RC2D_JobFunction function;
+    void* data;
+    RC2D_JobCounter* counter;
+
+    // RC2D_MainThreadTask* suivant, lu et écrit atomiquement
+    void* next;
+} RC2D_MainThreadTask;
+
+/**
+ * File des tâches du thread principal : file MPSC intrusive de Vyukov. Un producteur échange head avec son nœud
+ * puis relie l'ancien head à ce nœud, le thread principal consomme depuis tail. Le nœud stub évite le cas de la file vide.
+ */
+static RC2D_MainThreadTask rc2d_job_main_stub;
+
+static struct {
+    void* head;
+    RC2D_MainThreadTask* tail;
+    SDL_AtomicInt count;
+} rc2d_job_main = { &rc2d_job_main_stub, &rc2d_job_main_stub, {0} };
+
+// Thread courant -> RC2D_JobWorker* (NULL pour les threads extérieurs)
+static SDL_TLSID rc2d_job_tls;
+
+static RC2D_JobWorker* rc2d_job_currentWorker(void)
+{
+    return rc2d_job.initialized ? (RC2D_JobWorker*)SDL_GetTLS(&rc2d_job_tls) : NULL;
+}
+
+static bool rc2d_job_push(RC2D_JobWorker* worker, RC2D_Job* job)
+{
+    const Uint32 bottom = SDL_GetAtomicU32(&worker->bottom);
+    const Uint32 top = SDL_GetAtomicU32(&worker->top);
+    if (bottom - top >= RC2D_JOB_QUEUE_SIZE) return false;
+
+    SDL_SetAtomicPointer(&worker->slots[bottom & RC2D_JOB_QUEUE_MASK], job);
+    SDL_SetAtomicU32(&worker->bottom, bottom + 1);
+    return true;
+}
+
+static RC2D_Job* rc2d_job_pop(RC2D_JobWorker* worker)
+{
+    // Réserver le dernier job avant de lire top (barrière complète : SDL_SetAtomicU32 est un échange atomique)
+    const Uint32 bottom = SDL_GetAtomicU32(&worker->bottom) - 1;
+    SDL_SetAtomicU32(&worker->bottom, bottom);
+    const Uint32 top = SDL_GetAtomicU32(&worker->top);
+
+    if ((Sint32)(bottom - top) < 0)
+    {
+        // File vide
+        SDL_SetAtomicU32(&worker->bottom, top);
+        return NULL;
+    }
+
+    RC2D_Job* job = (RC2D_Job*)SDL_GetAtomicPointer(&worker->slots[bottom & RC2D_JOB_QUEUE_MASK]);
+    if (bottom != top) return job;
+
+    // Dernier job : un voleur peut le prendre en même temps, le premier à avancer top l'emporte
+    if (!SDL_CompareAndSwapAtomicU32(&worker->top, top, top + 1)) job = NULL;
+    SDL_SetAtomicU32(&worker->bottom, top + 1);
+    return job;
+}
+
+static RC2D_Job* rc2d_job_steal(RC2D_JobWorker* victim)
+{
+    const Uint32 top = SDL_GetAtomicU32(&victim->top);
+    const Uint32 bottom = SDL_GetAtomicU32(&victim->bottom);
+    if ((Sint32)(bottom - top) <= 0) return NULL;
+
+    RC2D_Job* job = (RC2D_Job*)SDL_GetAtomicPointer(&victim->slots[top & RC2D_JOB_QUEUE_MASK]);
+    if (!SDL_CompareAndSwapAtomicU32(&victim->top, top, top + 1)) return NULL;
+    return job;
+}
+
+static RC2D_Job* rc2d_job_takeExternal(void)
+{
+    if (SDL_GetAtomicInt(&rc2d_job.external_count) == 0) return NULL;
+
+    SDL_LockMutex(rc2d_job.external_mutex);
+    RC2D_Job* job = rc2d_job.external_head;
+    if (job != NULL)
+    {
+        rc2d_job.external_head = job->next;
+        if (rc2d_job.external_head == NULL) rc2d_job.external_tail = NULL;
+        job->next = NULL;
+        SDL_AddAtomicInt(&rc2d_job.external_count, -1);
+    }
+    SDL_UnlockMutex(rc2d_job.external_mutex);
+    return job;
+}
+
+/**
+ * Prochain job à exécuter : sa propre file, puis les jobs des threads extérieurs, puis un vol.
+ */
+static RC2D_Job* rc2d_job_next(RC2D_JobWorker* worker)
+{
+    RC2D_Job* job = worker != NULL ? rc2d_job_pop(worker) : NULL;
+    if (job != NULL) return job;
+
+    job = rc2d_job_takeExternal();
+    if (job != NULL) return job;
+
+    Uint32 random;
+    if (worker != NULL)
+    {
+        worker->random ^= worker->random << 13;
+        worker->random ^= worker->random >> 17;
+        worker->random ^= worker->random << 5;
+        random = worker->random;
+    }
+    else
+    {
+        random = (Uint32)SDL_GetCurrentThreadID();
+    }
+
+    const Uint32 count = (Uint32)rc2d_job.worker_count + 1;
+    for (Uint32 i = 0; i < count; i++)
+    {
+        RC2D_JobWorker* victim = &rc2d_job.workers[(random + i) % count];
+        if (victim == worker) continue;
+
+        job = rc2d_job_steal(victim);
+        if (job != NULL) return job;
+    }
+
+    return NULL;
+}
+
+/**
+ * Décrémente un compteur et démarre les jobs qui l'attendaient s'il revient à 0.
+ *
+ * Le verrou est pris même hors liste d'attente : rc2d_job_wait le reprend avant de rendre la main,
+ * le compteur (souvent sur la pile de l'appelant) n'est donc jamais détruit pendant son utilisation ici.
+ */
+static void rc2d_job_schedule(RC2D_Job* job);
+
+static void rc2d_job_decrement(RC2D_JobCounter* counter)
+{
+    RC2D_Job* waiting = NULL;
+
+    SDL_LockSpinlock(&counter->lock);
+    if (SDL_AddAtomicInt(&counter->value, -1) == 1)
+    {
+        waiting = counter->waiting;
+        counter->waiting = NULL;
+    }
+    SDL_UnlockSpinlock(&counter->lock);
+
+    while (waiting != NULL)
+    {
+        RC2D_Job* next = waiting->next;
+        waiting->next = NULL;
+        rc2d_job_schedule(waiting);
+        waiting = next;
+    }
+}
+
+static void rc2d_job_mainPush(RC2D_MainThreadTask* task)
+{
+    SDL_SetAtomicPointer(&task->next, NULL);
+    RC2D_MainThreadTask* previous = (RC2D_MainThreadTask*)SDL_SetAtomicPointer(&rc2d_job_main.head, task);
+    SDL_SetAtomicPointer(&previous->next, task);
+}
+
+/**
+ * Retire la tâche la plus ancienne (thread principal uniquement).
+ *
+ * Renvoie NULL si la file est vide, ou si un producteur a échangé head sans avoir encore relié son nœud :
+ * la tâche sera prise au prochain appel.
+ */
+static RC2D_MainThreadTask* rc2d_job_mainPop(void)
+{
+    RC2D_MainThreadTask* tail = rc2d_job_main.tail;
+    RC2D_MainThreadTask* next = (RC2D_MainThreadTask*)SDL_GetAtomicPointer(&tail->next);
+
+    if (tail == &rc2d_job_main_stub)
+    {
+        if (next == NULL) return NULL;
+        rc2d_job_main.tail = next;
+        tail = next;
+        next = (RC2D_MainThreadTask*)SDL_GetAtomicPointer(&next->next);
+    }
+
+    if (next != NULL)
+    {
+        rc2d_job_main.tail = next;
+        return tail;
+    }
+
+    if (tail != (RC2D_MainThreadTask*)SDL_GetAtomicPointer(&rc2d_job_main.head)) return NULL;
+
+    // Dernière tâche : remettre le stub derrière elle pour pouvoir la retirer
+    rc2d_job_mainPush(&rc2d_job_main_stub);
+    next = (RC2D_MainThreadTask*)SDL_GetAtomicPointer(&tail->next);
+    if (next == NULL) return NULL;
+
+    rc2d_job_main.tail = next;
+    return tail;
+}
+
+/**
+ * Exécute la plus ancienne tâche confiée au thread principal.
+ */
+static bool rc2d_job_runMainThreadTask(void)
+{
+    if (SDL_GetAtomicInt(&rc2d_job_main.count) == 0) return false;
+
+    RC2D_MainThreadTask* task = rc2d_job_mainPop();
+    if (task == NULL) return false;
+
+    SDL_AddAtomicInt(&rc2d_job_main.count, -1);
+
+    task->function(task->data);
+
+    RC2D_JobCounter* counter = task->counter;
+    RC2D_free(task);
+
+    if (counter != NULL)
+    {
+        rc2d_job_decrement(counter);
+    }
+    return true;
+}
+
+static void rc2d_job_execute(RC2D_Job* job)
+{
+    if (job->range_function != NULL)
+    {
+        job->range_function(job->start, job->end, job->data);
+    }
+    else
+    {
+        job->function(job->data);
+    }
+
+    RC2D_JobCounter* counter = job->counter;
+
+    if (job->heap)
+    {
+        RC2D_free(job);
+    }
+    else
+    {
+        SDL_SetAtomicInt(&job->in_use, 0);
+    }
+
+    if (counter != NULL)
+    {
+        rc2d_job_decrement(counter);
+    }
+}
+
+static void rc2d_job_schedule(RC2D_Job* job)
+{
+    RC2D_JobWorker* worker = rc2d_job_currentWorker();
+    if (worker != NULL)
+    {
+        // File pleine : exécuter le job tout de suite plutôt que de bloquer
+        if (!rc2d_job_push(worker, job))
+        {
+            rc2d_job_execute(job);
+            return;
+        }
+    }
+    else
+    {
+        SDL_LockMutex(rc2d_job.external_mutex);
+        if (rc2d_job.external_tail != NULL) rc2d_job.external_tail->next = job;
+        else rc2d_job.external_head = job;
+        rc2d_job.external_tail = job;
+        SDL_AddAtomicInt(&rc2d_job.external_count, 1);
+        SDL_UnlockMutex(rc2d_job.external_mutex);
+    }
+
+    if (SDL_GetAtomicInt(&rc2d_job.sleeping) > 0)
+    {
+        SDL_SignalSemaphore(rc2d_job.wake);
+    }
+}
+
+/**
+ * Crée un job dans le buffer circulaire du thread courant (ou sur le tas pour un thread extérieur).
+ * Si l'emplacement suivant est encore utilisé, le thread exécute des jobs jusqu'à ce qu'il se libère.
+ */
+static RC2D_Job* rc2d_job_create(RC2D_JobCounter* counter)
+{
+    RC2D_JobWorker* worker = rc2d_job_currentWorker();
+    RC2D_Job* job = NULL;
+
+    if (worker == NULL)
+    {
+        job = (RC2D_Job*)RC2D_calloc(1, sizeof(RC2D_Job));
+        RC2D_assert_release(job != NULL, RC2D_LOG_CRITICAL, "Failed to allocate job");
+        job->heap = true;
+    }
+    else
+    {
+        for (;;)
+        {
+            job = &worker->jobs[worker->next_job & RC2D_JOB_QUEUE_MASK];
+            if (SDL_GetAtomicInt(&job->in_use) == 0) break;
+
+            RC2D_Job* other = rc2d_job_next(worker);
+            if (other != NULL) rc2d_job_execute(other);
+            else SDL_CPUPauseInstruction();
+        }
+        worker->next_job++;
+
+        job->function = NULL;
+        job->range_function = NULL;
+        job->next = NULL;
+        job->heap = false;
+        SDL_SetAtomicInt(&job->in_use, 1);
+    }
+
+    job->counter = counter;
+    if (counter != NULL)
+    {
+        SDL_AddAtomicInt(&counter->value, 1);
+    }
+
+    return job;
+}
+
+/**
+ * Attache le thread courant à un cœur (les workers i sont placés sur les cœurs i, le cœur 0 reste au thread principal).
+ */
+static void rc2d_job_pinCurrentThread(int core)
+{
+#if defined(RC2D_PLATFORM_WINDOWS)
+    if (SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << (core % (int)(sizeof(DWORD_PTR) * 8))) == 0)
+    {
+        RC2D_log(RC2D_LOG_WARN, "Failed to pin job worker to core %d", core);
+    }
+#elif defined(RC2D_PLATFORM_LINUX) || defined(RC2D_PLATFORM_ANDROID)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0)
+    {
+        RC2D_log(RC2D_LOG_WARN, "Failed to pin job worker to core %d", core);
+    }
+#else
+    // Pas d'API d'affinité (macOS, iOS...) : l'OS place les threads
+    (void)core;
+#endif
+}
+
+static int rc2d_job_workerMain(void* data)
+{
+    RC2D_JobWorker* worker = (RC2D_JobWorker*)data;
+    SDL_SetTLS(&rc2d_job_tls, worker, NULL);
+
+    if (rc2d_job.pin_workers)
+    {
+        rc2d_job_pinCurrentThread(worker->index % SDL_max(SDL_GetNumLogicalCPUCores(), 1));
+    }
+
+    int idle = 0;
+    while (!SDL_GetAtomicInt(&rc2d_job.quit))
+    {
+        RC2D_Job* job = rc2d_job_next(worker);
+        if (job != NULL)
+        {
+            rc2d_job_execute(job);
+            idle = 0;
+            continue;
+        }
+
+        if (++idle < RC2D_JOB_SPIN_COUNT)
+        {
+            SDL_CPUPauseInstruction();
+            continue;
+        }
+
+        // Se déclarer endormi puis revérifier : un job soumis entre-temps réveille forcément ce worker
+        SDL_AddAtomicInt(&rc2d_job.sleeping, 1);
+        job = rc2d_job_next(worker);
+        if (job == NULL && !SDL_GetAtomicInt(&rc2d_job.quit))
+        {
+            SDL_WaitSemaphoreTimeout(rc2d_job.wake, 10);
+        }
+        SDL_AddAtomicInt(&rc2d_job.sleeping, -1);
+
+        if (job != NULL) rc2d_job_execute(job);
+        idle = 0;
+    }
+
+    return 0;
+}
+
+bool rc2d_job_init(int workerCount, bool pinWorkers)
+{
+    if (rc2d_job.initialized)
+    {
+        RC2D_log(RC2D_LOG_WARN, "Job system already initialized");
+        return true;
+    }
+
+    if (workerCount <= 0)
+    {
+        workerCount = SDL_GetNumLogicalCPUCores() - 1;
+    }
+    workerCount = SDL_clamp(workerCount, 0, RC2D_JOB_MAX_WORKERS);
+
+    rc2d_job.workers = (RC2D_JobWorker*)RC2D_calloc((size_t)workerCount + 1, sizeof(RC2D_JobWorker));
+    rc2d_job.wake = SDL_CreateSemaphore(0);
+    rc2d_job.external_mutex = SDL_CreateMutex();
+    if (rc2d_job.workers == NULL || rc2d_job.wake == NULL || rc2d_job.external_mutex == NULL)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "Failed to allocate job system: %s", SDL_GetError());
+        rc2d_job.initialized = true;
+        rc2d_job_quit();
+        return false;
+    }
+
+    for (int i = 0; i <= workerCount; i++)
+    {
+        rc2d_job.workers[i].index = i;
+        rc2d_job.workers[i].random = 0x9E3779B9u * (Uint32)(i + 1);
+    }
+
+    rc2d_job.worker_count = workerCount;
+    rc2d_job.pin_workers = pinWorkers;
+    SDL_SetAtomicInt(&rc2d_job.quit, 0);
+    SDL_SetTLS(&rc2d_job_tls, &rc2d_job.workers[0], NULL);
+    rc2d_job.initialized = true;
+
+    for (int i = 1; i <= workerCount; i++)
+    {
+        char name[32];
+        SDL_snprintf(name, sizeof(name), "RC2D_JobWorker_%d", i);
+
+        rc2d_job.workers[i].thread = rc2d_thread_new(rc2d_job_workerMain, name, &rc2d_job.workers[i]);
+        if (rc2d_job.workers[i].thread == NULL)
+        {
+            RC2D_log(RC2D_LOG_CRITICAL, "Failed to create job worker %d", i);
+            rc2d_job_quit();
+            return false;
+        }
+    }
+
+    RC2D_log(RC2D_LOG_INFO, "Systeme de jobs : %d workers%s", workerCount, pinWorkers ? " (attaches aux coeurs)" : "");
+    return true;
+}
+
+void rc2d_job_quit(void)
+{
+    if (!rc2d_job.initialized) return;
+
+    SDL_SetAtomicInt(&rc2d_job.quit, 1);
+    for (int i = 1; i <= rc2d_job.worker_count; i++)
+    {
+        if (rc2d_job.wake != NULL) SDL_SignalSemaphore(rc2d_job.wake);
+    }
+
+    /**
+     * Un worker en cours de job peut être bloqué dans rc2d_job_wait sur une tâche confiée au thread principal :
+     * depuis le thread principal, exécuter ces tâches (et les jobs restants) tant que les workers n'ont pas terminé.
+     */
+    const bool main_thread = SDL_IsMainThread();
+    for (int i = 1; i <= rc2d_job.worker_count; i++)
+    {
+        RC2D_Thread* thread = rc2d_job.workers[i].thread;
+        if (thread == NULL) continue;
+
+        while (main_thread && rc2d_thread_getState(thread) == RC2D_THREAD_STATE_ALIVE)
+        {
+            RC2D_Job* job = rc2d_job_next(rc2d_job_currentWorker());
+            if (job != NULL) rc2d_job_execute(job);
+            else if (!rc2d_job_runMainThreadTask()) SDL_DelayNS(0);
+        }
+        rc2d_thread_wait(thread, NULL);
+    }
+
+    // Jobs de threads extérieurs jamais exécutés
+    while (rc2d_job.external_head != NULL)
+    {
+        RC2D_Job* next = rc2d_job.external_head->next;
+        RC2D_free(rc2d_job.external_head);
+        rc2d_job.external_head = next;
+    }
+
+    SDL_SetTLS(&rc2d_job_tls, NULL, NULL);
+    if (rc2d_job.wake != NULL) SDL_DestroySemaphore(rc2d_job.wake);
+    if (rc2d_job.external_mutex != NULL) SDL_DestroyMutex(rc2d_job.external_mutex);
+    RC2D_safe_free(rc2d_job.workers);
+
+    SDL_zero(rc2d_job);
+}
+
+int rc2d_job_getWorkerCount(void)
+{
+    return rc2d_job.initialized ? rc2d_job.worker_count : 0;
+}
+
+void rc2d_job_run(RC2D_JobFunction function, void* data, RC2D_JobCounter* counter)
+{
+    rc2d_job_runAfter(function, data, counter, NULL);
+}
+
+void rc2d_job_runAfter(RC2D_JobFunction function, void* data, RC2D_JobCounter* counter, RC2D_JobCounter* dependency)
+{
+    RC2D_assert_release(function != NULL, RC2D_LOG_CRITICAL, "function is NULL");
+
+    // Sans système de jobs, tout job est terminé dès sa soumission : les dépendances sont donc déjà satisfaites
+    if (!rc2d_job.initialized)
+    {
+        function(data);
+        return;
+    }
+
+    RC2D_Job* job = rc2d_job_create(counter);
+    job->function = function;
+    job->data = data;
+
+    if (dependency != NULL)
+    {
+        SDL_LockSpinlock(&dependency->lock);
+        if (SDL_GetAtomicInt(&dependency->value) > 0)
+        {
+            job->next = dependency->waiting;
+            dependency->waiting = job;
+            SDL_UnlockSpinlock(&dependency->lock);
+            return;
+        }
+        SDL_UnlockSpinlock(&dependency->lock);
+    }
+
+    rc2d_job_schedule(job);
+}
+
+void rc2d_job_wait(RC2D_JobCounter* counter)
+{
+    RC2D_assert_release(counter != NULL, RC2D_LOG_CRITICAL, "counter is NULL");
+
+    RC2D_JobWorker* worker = rc2d_job_currentWorker();
+    const bool main_thread = SDL_IsMainThread();
+    int idle = 0;
+    while (SDL_GetAtomicInt(&counter->value) > 0)
+    {
+        RC2D_Job* job = rc2d_job.initialized ? rc2d_job_next(worker) : NULL;
+        if (job != NULL)
+        {
+            rc2d_job_execute(job);
+            idle = 0;
+        }
+        else if (main_thread && rc2d_job_runMainThreadTask())
+        {
+            // Le compteur peut attendre une tâche confiée au thread principal
+            idle = 0;
+        }
+        else if (++idle < RC2D_JOB_SPIN_COUNT)
+        {
+            SDL_CPUPauseInstruction();
+        }
+        else
+        {
+            // Le dernier job tourne sur un autre thread : céder le cœur
+            SDL_DelayNS(0);
+        }
+    }
+
+    // Le thread qui a terminé le dernier job peut encore tenir le verrou du compteur
+    SDL_LockSpinlock(&counter->lock);
+    SDL_UnlockSpinlock(&counter->lock);
+}
+
+bool rc2d_job_isDone(RC2D_JobCounter* counter)
+{
+    RC2D_assert_release(counter != NULL, RC2D_LOG_CRITICAL, "counter is NULL");
+    return SDL_GetAtomicInt(&counter->value) == 0;
+}
+
+void rc2d_job_parallelForAsync(Uint32 count, Uint32 batchSize, RC2D_JobRangeFunction function, void* data, RC2D_JobCounter* counter)
+{
+    RC2D_assert_release(function != NULL, RC2D_LOG_CRITICAL, "function is NULL");
+
+    if (count == 0) return;
+
+    if (!rc2d_job.initialized)
+    {
+        function(0, count, data);
+        return;
+    }
+
+    if (batchSize == 0)
+    {
+        const Uint32 batches = (Uint32)(rc2d_job.worker_count + 1) * 4;
+        batchSize = SDL_max((count + batches - 1) / batches, 1);
+    }
+
+    for (Uint32 start = 0; start < count;)
+    {
+        const Uint32 end = start + SDL_min(batchSize, count - start);
+
+        RC2D_Job* job = rc2d_job_create(counter);
+        job->range_function = function;
+        job->data = data;
+        job->start = start;
+        job->end = end;
+        rc2d_job_schedule(job);
+
+        start = end;
+    }
+}
+
+void rc2d_job_parallelFor(Uint32 count, Uint32 batchSize, RC2D_JobRangeFunction function, void* data)
+{
+    RC2D_JobCounter counter = {0};
+    rc2d_job_parallelForAsync(count, batchSize, function, data, &counter);
+    rc2d_job_wait(&counter);
+}
+
+void rc2d_job_runOnMainThread(RC2D_JobFunction function, void* data, RC2D_JobCounter* counter)
+{
+    RC2D_assert_release(function != NULL, RC2D_LOG_CRITICAL, "function is NULL");
+
+    if (SDL_IsMainThread())
+    {
+        function(data);
+        return;
+    }
+
+    RC2D_MainThreadTask* task = (RC2D_MainThreadTask*)RC2D_malloc(sizeof(RC2D_MainThreadTask));
+    RC2D_assert_release(task != NULL, RC2D_LOG_CRITICAL, "Failed to allocate main thread task");
+
+    task->function = function;
+    task->data = data;
+    task->counter = counter;
+    if (counter != NULL)
+    {
+        SDL_AddAtomicInt(&counter->value, 1);
+    }
+
+    SDL_AddAtomicInt(&rc2d_job_main.count, 1);
+    rc2d_job_mainPush(task);
+}
+
+int rc2d_job_getMainThreadTaskCount(void)
+{
+    return SDL_GetAtomicInt(&rc2d_job_main.count);
+}
+
+void rc2d_job_runMainThreadTasks(Uint64 budgetNS)
+{
+    if (SDL_GetAtomicInt(&rc2d_job_main.count) == 0) return;
+
+    // Au moins une tâche par appel, même si elle dépasse le budget à elle seule
+    const Uint64 start = SDL_GetTicksNS();
+    while (rc2d_job_runMainThreadTask())
+    {
+        if (budgetNS > 0 && SDL_GetTicksNS() - start >= budgetNS) break;
+    }
+}
@@ -0,0 +1,283 @@
+#include <RC2D/RC2D_profiler.h>
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_logger.h>
+#include <RC2D/RC2D_memory.h>
+
+#if RC2D_PROFILER_ENABLED
+
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_iostream.h>
+#include <SDL3/SDL_thread.h>
+#include <SDL3/SDL_timer.h>
+
+SDL_COMPILE_TIME_ASSERT(rc2d_profiler_ring_size_pow2, (RC2D_PROFILER_RING_SIZE & (RC2D_PROFILER_RING_SIZE - 1)) == 0);
+
+/**
+ * Profondeur maximale des zones imbriquées sur un thread. Au-delà, les zones ne sont plus enregistrées.
+ */
+#define RC2D_PROFILER_MAX_DEPTH 64
+
+typedef struct RC2D_ProfilerEvent {
+    const char* name;
+    Uint64 start;
+    Uint64 end;
+} RC2D_ProfilerEvent;
+
+/**
+ * Buffer d'un thread. Seul le thread propriétaire écrit : l'enregistrement d'une zone ne prend aucun verrou.
+ * Les buffers ne sont libérés qu'à la fermeture de RC2D, les événements d'un thread terminé restent exportables.
+ */
+typedef struct RC2D_ProfilerThread {
+    SDL_ThreadID thread_id;
+
+    // Nombre total d'événements écrits, publié après l'écriture de l'événement
+    SDL_AtomicInt written;
+    RC2D_ProfilerEvent events[RC2D_PROFILER_RING_SIZE];
+
+    // Zones ouvertes (thread propriétaire uniquement)
+    struct {
+        const char* name;
+        Uint64 start;
+    } stack[RC2D_PROFILER_MAX_DEPTH];
+    int depth;
+
+    struct RC2D_ProfilerThread* next;
+} RC2D_ProfilerThread;
+
+static struct {
+    SDL_TLSID tls;
+
+    // Liste des buffers de tous les threads (RC2D_ProfilerThread*), insertion sans verrou en tête
+    void* threads;
+
+    // Première mesure, origine des timestamps exportés
+    SDL_AtomicInt has_origin;
+    Uint64 origin;
+} rc2d_profiler = {0};
+
+static RC2D_ProfilerThread* rc2d_profiler_getThread(void)
+{
+    RC2D_ProfilerThread* thread = (RC2D_ProfilerThread*)SDL_GetTLS(&rc2d_profiler.tls);
+    if (thread != NULL) return thread;
+
+    thread = RC2D_calloc(1, sizeof(RC2D_ProfilerThread));
+    if (thread == NULL) return NULL;
+    thread->thread_id = SDL_GetCurrentThreadID();
+
+    if (SDL_CompareAndSwapAtomicInt(&rc2d_profiler.has_origin, 0, 1))
+    {
+        rc2d_profiler.origin = SDL_GetPerformanceCounter();
+    }
+
+    void* head;
+    do
+    {
+        head = SDL_GetAtomicPointer(&rc2d_profiler.threads);
+        thread->next = (RC2D_ProfilerThread*)head;
+    } while (!SDL_CompareAndSwapAtomicPointer(&rc2d_profiler.threads, head, thread));
+
+    SDL_SetTLS(&rc2d_profiler.tls, thread, NULL);
+    return thread;
+}
+
+void rc2d_profiler_beginZone(const char* name)
+{
+    RC2D_ProfilerThread* thread = rc2d_profiler_getThread();
+    if (thread == NULL) return;
+
+    if (thread->depth < RC2D_PROFILER_MAX_DEPTH)
+    {
+        thread->stack[thread->depth].name = name;
+        thread->stack[thread->depth].start = SDL_GetPerformanceCounter();
+    }
+    thread->depth++;
+}
+
+void rc2d_profiler_endZone(void)
+{
+    const Uint64 end = SDL_GetPerformanceCounter();
+
+    RC2D_ProfilerThread* thread = (RC2D_ProfilerThread*)SDL_GetTLS(&rc2d_profiler.tls);
+    if (thread == NULL || thread->depth == 0) return;
+
+    thread->depth--;
+    if (thread->depth >= RC2D_PROFILER_MAX_DEPTH) return;
+
+    const Uint32 written = (Uint32)SDL_GetAtomicInt(&thread->written);
+    RC2D_ProfilerEvent* event = &thread->events[written & (RC2D_PROFILER_RING_SIZE - 1)];
+    event->name = thread->stack[thread->depth].name;
+    event->start = thread->stack[thread->depth].start;
+    event->end = end;
+    SDL_SetAtomicInt(&thread->written, (int)(written + 1));
+}
+
+static int SDLCALL rc2d_profiler_compareDuration(const void* a, const void* b)
+{
+    const Uint64 da = *(const Uint64*)a;
+    const Uint64 db = *(const Uint64*)b;
+    return (da > db) - (da < db);
+}
+
+bool rc2d_profiler_getZoneStats(const char* name, RC2D_ProfilerZoneStats* stats)
+{
+    if (name == NULL || stats == NULL) return false;
+    SDL_zerop(stats);
+
+    Uint64 durations[RC2D_PROFILER_STATS_WINDOW];
+    Uint32 count = 0;
+
+    // Parcourir les événements du plus récent au plus ancien, sur tous les threads
+    for (RC2D_ProfilerThread* thread = (RC2D_ProfilerThread*)SDL_GetAtomicPointer(&rc2d_profiler.threads);
+         thread != NULL && count < RC2D_PROFILER_STATS_WINDOW;
+         thread = thread->next)
+    {
+        const Uint32 written = (Uint32)SDL_GetAtomicInt(&thread->written);
+        const Uint32 available = SDL_min(written, (Uint32)RC2D_PROFILER_RING_SIZE);
+        for (Uint32 i = 1; i <= available && count < RC2D_PROFILER_STATS_WINDOW; i++)
+        {
+            const RC2D_ProfilerEvent* event = &thread->events[(written - i) & (RC2D_PROFILER_RING_SIZE - 1)];
+            if (event->name == name || SDL_strcmp(event->name, name) == 0)
+            {
+                durations[count++] = event->end - event->start;
+            }
+        }
+    }
+
+    if (count == 0) return false;
+
+    SDL_qsort(durations, count, sizeof(Uint64), rc2d_profiler_compareDuration);
+
+    Uint64 total = 0;
+    for (Uint32 i = 0; i < count; i++) total += durations[i];
+
+    const double toMs = 1000.0 / (double)SDL_GetPerformanceFrequency();
+    const Uint32 p99Index = (Uint32)SDL_ceil(count * 0.99) - 1;
+    stats->samples = count;
+    stats->min_ms = (double)durations[0] * toMs;
+    stats->avg_ms = (double)total / (double)count * toMs;
+    stats->p99_ms = (double)durations[p99Index] * toMs;
+    stats->max_ms = (double)durations[count - 1] * toMs;
+    return true;
+}
+
+/**
+ * Écrit une chaîne JSON (les noms de zones sont des littéraux, seuls les guillemets et antislashs sont échappés).
+ */
+static void rc2d_profiler_writeJSONString(SDL_IOStream* io, const char* text)
+{
+    SDL_WriteU8(io, '"');
+    for (const char* p = text; *p; p++)
+    {
+        if (*p == '"' || *p == '\\') SDL_WriteU8(io, '\\');
+        SDL_WriteU8(io, (Uint8)*p);
+    }
+    SDL_WriteU8(io, '"');
+}
+
+bool rc2d_profiler_exportChromeTrace(const char* path)
+{
+    if (path == NULL) return false;
+
+    SDL_IOStream* io = SDL_IOFromFile(path, "w");
+    if (io == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to open profiler trace file %s: %s", path, SDL_GetError());
+        return false;
+    }
+
+    // Les timestamps Chrome sont en microsecondes
+    const double toUs = 1000000.0 / (double)SDL_GetPerformanceFrequency();
+    bool first = true;
+    Uint32 exported = 0;
+
+    SDL_IOprintf(io, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    for (RC2D_ProfilerThread* thread = (RC2D_ProfilerThread*)SDL_GetAtomicPointer(&rc2d_profiler.threads);
+         thread != NULL;
+         thread = thread->next)
+    {
+        const Uint32 written = (Uint32)SDL_GetAtomicInt(&thread->written);
+        const Uint32 available = SDL_min(written, (Uint32)RC2D_PROFILER_RING_SIZE);
+        for (Uint32 i = written - available; i != written; i++)
+        {
+            const RC2D_ProfilerEvent* event = &thread->events[i & (RC2D_PROFILER_RING_SIZE - 1)];
+
+            SDL_IOprintf(io, first ? "\n{\"name\":" : ",\n{\"name\":");
+            rc2d_profiler_writeJSONString(io, event->name);
+            SDL_IOprintf(io, ",\"cat\":\"rc2d\",\"ph\":\"X\",\"pid\":1,\"tid\":%llu,\"ts\":%.3f,\"dur\":%.3f}",
+                (unsigned long long)thread->thread_id,
+                (double)(event->start - rc2d_profiler.origin) * toUs,
+                (double)(event->end - event->start) * toUs);
+            first = false;
+            exported++;
+        }
+    }
+    SDL_IOprintf(io, "\n]}\n");
+
+    if (!SDL_CloseIO(io))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to write profiler trace file %s: %s", path, SDL_GetError());
+        return false;
+    }
+
+    RC2D_log(RC2D_LOG_INFO, "Profiler trace exported (%u events): %s", exported, path);
+    return true;
+}
+
+void rc2d_profiler_reset(void)
+{
+    for (RC2D_ProfilerThread* thread = (RC2D_ProfilerThread*)SDL_GetAtomicPointer(&rc2d_profiler.threads);
+         thread != NULL;
+         thread = thread->next)
+    {
+        SDL_SetAtomicInt(&thread->written, 0);
+    }
+}
+
+void rc2d_profiler_quit(void)
+{
+    RC2D_ProfilerThread* thread = (RC2D_ProfilerThread*)SDL_GetAtomicPointer(&rc2d_profiler.threads);
+    SDL_SetAtomicPointer(&rc2d_profiler.threads, NULL);
+    SDL_SetTLS(&rc2d_profiler.tls, NULL, NULL);
+
+    while (thread != NULL)
+    {
+        RC2D_ProfilerThread* next = thread->next;
+        RC2D_free(thread);
+        thread = next;
+    }
+}
+
+#else
+
+void rc2d_profiler_beginZone(const char* name)
+{
+    (void)name;
+}
+
+void rc2d_profiler_endZone(void)
+{
+}
+
+bool rc2d_profiler_getZoneStats(const char* name, RC2D_ProfilerZoneStats* stats)
+{
+    (void)name;
+    if (stats != NULL) SDL_zerop(stats);
+    return false;
+}
+
+bool rc2d_profiler_exportChromeTrace(const char* path)
+{
+    (void)path;
+    RC2D_log(RC2D_LOG_WARN, "Profiler is disabled, rebuild with RC2D_PROFILER_ENABLED=ON to export a trace");
+    return false;
+}
+
+void rc2d_profiler_reset(void)
+{
+}
+
+void rc2d_profiler_quit(void)
+{
+}
+
+#endif
@@ -4,6 +4,8 @@
 #include <RC2D/RC2D_logger.h>
 #include <RC2D/RC2D_internal.h>
 #include <RC2D/RC2D_memory.h>
+#include <RC2D/RC2D_platform_defines.h>
+#include <RC2D/RC2D_job.h>
 
 #include <SDL3/SDL_stdinc.h>
 #include <SDL3/SDL_iostream.h>
@@ -15,6 +17,18 @@
 #include <lz4/lz4.h> // Compression algorithm: LZ4
 #include <monocypher/monocypher.h> // Encryption algorithm: XChaCha20-Poly1305
 #include <aes/aes.h> // Encryption algorithm: AES 
+#if RC2D_DATA_MODULE_ENABLED
+#include <openssl/evp.h> // Encryption algorithm: AES (accélération matérielle AES-NI / ARMv8 via EVP)
+#endif
+
+#if defined(RC2D_PLATFORM_WIN32)
+#include <windows.h>
+#elif defined(RC2D_PLATFORM_UNIX) || defined(RC2D_PLATFORM_APPLE)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 /**
  * Password pointer, managed by user libraries
@@ -33,134 +47,311 @@ static char rc2d_rres_passwordBuffer[16];
 static const char *passwordDefaultInRrespacker = "password12345";
 
 /**
- * Calcule le hachage MD5 pour une séquence de données.
- *
- * Cette fonction prend en entrée une séquence de données et sa taille, puis calcule
- * et retourne le hachage MD5 de ces données. Le hachage MD5 est un hachage de 128 bits
- * (16 octets) utilisé pour vérifier l'intégrité des données.
- *
- * La fonction utilise une série de transformations et opérations bit à bit sur les données
- * d'entrée pour produire le hachage final. Le résultat est un tableau statique de 4 entiers
- * non signés (représentant les 128 bits du hachage MD5) qui doit être utilisé immédiatement
- * ou copié ailleurs car il sera écrasé lors du prochain appel à cette fonction.
- *
- * @param data Pointeur vers les données à hacher.
- * @param size Taille des données en octets.
- * @return Un pointeur vers un tableau statique de 4 entiers non signés représentant le hachage MD5.
+ * Configuration Argon2i utilisée par l'outil rrespacker pour dériver la clé de chiffrement.
+ * Le nombre de blocs (1 bloc = 1 Ko) définit la taille de la zone de travail (16 Mo).
+ */
+#define RC2D_RRES_ARGON2_NB_BLOCKS 16384
+#define RC2D_RRES_ARGON2_NB_PASSES 3
+
+/**
+ * Nombre maximum de clés dérivées conservées dans le cache (une entrée par couple mot de passe/sel).
+ * Au-delà, les entrées les plus anciennes sont remplacées (tourniquet).
+ */
+#define RC2D_RRES_KEY_CACHE_CAPACITY 64
+
+/**
+ * Entrée du cache de dérivation de clés : une clé Argon2i (256 bits) pour un couple (mot de passe, sel).
+ */
+typedef struct RC2D_RresKeyCacheEntry {
+    uint8_t pass[16];
+    uint8_t salt[16];
+    uint8_t key[32];
+    bool used;
+} RC2D_RresKeyCacheEntry;
+
+/**
+ * Cache des clés dérivées, protégé par rc2d_rres_keyCacheMutex.
+ * 
+ * La dérivation Argon2i (16 Mo, 3 passes) est de loin l'étape la plus coûteuse du déchiffrement :
+ * sans cache, un pack de N chunks chiffrés coûte N dérivations.
+ */
+static RC2D_RresKeyCacheEntry rc2d_rres_keyCache[RC2D_RRES_KEY_CACHE_CAPACITY];
+static int rc2d_rres_keyCacheNext = 0;
+
+/**
+ * Entrée réservée au mode "sel au niveau du pack" : elle n'est jamais évincée par le tourniquet.
+ */
+static RC2D_RresKeyCacheEntry rc2d_rres_packKey;
+static bool rc2d_rres_packSaltModeEnabled = false;
+
+/**
+ * Statistiques du cache (succès / dérivations), remises à zéro par rc2d_rres_cleanKeyCache.
+ */
+static RC2D_RresKeyCacheStats rc2d_rres_keyCacheStats;
+
+/**
+ * Mutex du cache, créé paresseusement sous la protection d'un spinlock pour que
+ * rc2d_rres_unpackResourceChunk reste utilisable sans initialisation préalable du moteur.
  */
-static unsigned int *ComputeMD5(const unsigned char *data, int size)
+static SDL_Mutex *rc2d_rres_keyCacheMutex = NULL;
+static SDL_SpinLock rc2d_rres_keyCacheMutexLock = 0;
+
+static SDL_Mutex *rc2d_rres_getKeyCacheMutex(void)
 {
-#define LEFTROTATE(x, c) (((x) << (c)) | ((x) >> (32 - (c))))
+    SDL_LockSpinlock(&rc2d_rres_keyCacheMutexLock);
+    if (rc2d_rres_keyCacheMutex == NULL)
+    {
+        rc2d_rres_keyCacheMutex = SDL_CreateMutex();
+        if (rc2d_rres_keyCacheMutex == NULL)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "RRES: Impossible de créer le mutex du cache de clés : %s", SDL_GetError());
+        }
+    }
+    SDL_UnlockSpinlock(&rc2d_rres_keyCacheMutexLock);
 
-    static unsigned int hash[4] = { 0 };
+    return rc2d_rres_keyCacheMutex;
+}
 
-    // NOTE: All variables are unsigned 32 bit and wrap modulo 2^32 when calculating
+// r specifies the per-round shift amounts
+static const unsigned int rc2d_rres_md5Shifts[64] = {
+    7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+    5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
+    4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+    6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
+};
+
+// Use binary integer part of the sines of integers (in radians) as constants
+static const unsigned int rc2d_rres_md5Constants[64] = {
+    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
+    0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+    0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
+    0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+    0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
+    0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
+    0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+    0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
+    0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+    0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
+    0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
+    0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+    0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
+    0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+};
+
+#define RC2D_RRES_MD5_LEFTROTATE(x, c) (((x) << (c)) | ((x) >> (32 - (c))))
 
-    // r specifies the per-round shift amounts
-    unsigned int r[] = {
-        7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
-        5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
-        4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
-        6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
-    };
+/**
+ * Traite un bloc de 512 bits (64 octets). Les mots sont lus en little-endian octet par octet :
+ * aucun accès non aligné, aucune copie du message.
+ */
+static void rc2d_rres_md5Transform(unsigned int state[4], const unsigned char *block)
+{
+    // Break chunk into sixteen 32-bit words w[j], 0 <= j <= 15
+    unsigned int w[16];
+    for (int j = 0; j < 16; j++)
+    {
+        w[j] = (unsigned int)block[j*4] | ((unsigned int)block[j*4 + 1] << 8) |
+               ((unsigned int)block[j*4 + 2] << 16) | ((unsigned int)block[j*4 + 3] << 24);
+    }
 
-    // Use binary integer part of the sines of integers (in radians) as constants// Initialize variables:
-    unsigned int k[] = {
-        0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
-        0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
-        0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
-        0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
-        0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
-        0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
-        0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
-        0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
-        0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
-        0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
-        0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
-        0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
-        0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
-        0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
-        0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
-        0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
-    };
+    // Initialize hash value for this chunk
+    unsigned int a = state[0];
+    unsigned int b = state[1];
+    unsigned int c = state[2];
+    unsigned int d = state[3];
 
-    hash[0] = 0x67452301;
-    hash[1] = 0xefcdab89;
-    hash[2] = 0x98badcfe;
-    hash[3] = 0x10325476;
+    for (int i = 0; i < 64; i++)
+    {
+        unsigned int f, g;
 
-    // Pre-processing: adding a single 1 bit
-    // Append '1' bit to message
-    // NOTE: The input bytes are considered as bits strings,
-    // where the first bit is the most significant bit of the byte
+        if (i < 16)
+        {
+            f = (b & c) | ((~b) & d);
+            g = i;
+        }
+        else if (i < 32)
+        {
+            f = (d & b) | ((~d) & c);
+            g = (5*i + 1)%16;
+        }
+        else if (i < 48)
+        {
+            f = b ^ c ^ d;
+            g = (3*i + 5)%16;
+        }
+        else
+        {
+            f = c ^ (b | (~d));
+            g = (7*i)%16;
+        }
 
-    // Pre-processing: padding with zeros
-    // Append '0' bit until message length in bit 448 (mod 512)
-    // Append length mod (2 pow 64) to message
+        unsigned int temp = d;
+        d = c;
+        c = b;
+        b = b + RC2D_RRES_MD5_LEFTROTATE((a + f + rc2d_rres_md5Constants[i] + w[g]), rc2d_rres_md5Shifts[i]);
+        a = temp;
+    }
 
-    int newDataSize = ((((size + 8)/64) + 1)*64) - 8;
+    // Add chunk's hash to result so far
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+}
 
-    unsigned char *msg = (unsigned char *)RC2D_calloc(newDataSize + 64, 1);   // Also appends "0" bits (we alloc also 64 extra bytes...)
-    SDL_memcpy(msg, data, size);
-    msg[size] = 128;                 // Write the "1" bit
+void rc2d_rres_md5Init(RC2D_RresMD5Context *ctx)
+{
+    ctx->state[0] = 0x67452301;
+    ctx->state[1] = 0xefcdab89;
+    ctx->state[2] = 0x98badcfe;
+    ctx->state[3] = 0x10325476;
+    ctx->size = 0;
+}
 
-    unsigned int bitsLen = 8*size;
-    SDL_memcpy(msg + newDataSize, &bitsLen, 4);  // We append the len in bits at the end of the buffer
+void rc2d_rres_md5Update(RC2D_RresMD5Context *ctx, const void *data, size_t size)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+    size_t buffered = (size_t)(ctx->size % 64);
+    ctx->size += size;
 
-    // Process the message in successive 512-bit chunks for each 512-bit chunk of message
-    for (int offset = 0; offset < newDataSize; offset += (512/8))
+    // Complète le bloc partiel d'un appel précédent
+    if (buffered > 0)
     {
-        // Break chunk into sixteen 32-bit words w[j], 0 <= j <= 15
-        unsigned int *w = (unsigned int *)(msg + offset);
+        size_t fill = SDL_min(64 - buffered, size);
+        SDL_memcpy(ctx->buffer + buffered, bytes, fill);
+        bytes += fill;
+        size -= fill;
 
-        // Initialize hash value for this chunk
-        unsigned int a = hash[0];
-        unsigned int b = hash[1];
-        unsigned int c = hash[2];
-        unsigned int d = hash[3];
+        if (buffered + fill < 64) return;
+        rc2d_rres_md5Transform(ctx->state, ctx->buffer);
+    }
 
-        for (int i = 0; i < 64; i++)
-        {
-            unsigned int f, g;
+    // Les blocs complets sont traités directement depuis les données de l'appelant
+    while (size >= 64)
+    {
+        rc2d_rres_md5Transform(ctx->state, bytes);
+        bytes += 64;
+        size -= 64;
+    }
 
-            if (i < 16)
-            {
-                f = (b & c) | ((~b) & d);
-                g = i;
-            }
-            else if (i < 32)
-            {
-                f = (d & b) | ((~d) & c);
-                g = (5*i + 1)%16;
-            }
-            else if (i < 48)
-            {
-                f = b ^ c ^ d;
-                g = (3*i + 5)%16;
-            }
-            else
-            {
-                f = c ^ (b | (~d));
-                g = (7*i)%16;
-            }
+    if (size > 0) SDL_memcpy(ctx->buffer, bytes, size);
+}
+
+void rc2d_rres_md5Final(RC2D_RresMD5Context *ctx, unsigned int hash[4])
+{
+    /**
+     * Pre-processing : ajout du bit "1", puis de zéros jusqu'à 448 bits (mod 512), puis de la longueur.
+     * Seul le dernier bloc (ou les deux derniers) est complété.
+     *
+     * NOTE: Comme l'outil rrespacker, la longueur en bits est écrite sur 32 bits (les 32 bits de poids
+     * fort restent à zéro) : les empreintes sont identiques au MD5 standard pour des données < 512 Mo.
+     */
+    size_t buffered = (size_t)(ctx->size % 64);
+    unsigned int bitsLen = (unsigned int)(ctx->size*8);
+
+    ctx->buffer[buffered++] = 128;     // Write the "1" bit
+    if (buffered > 56)
+    {
+        SDL_memset(ctx->buffer + buffered, 0, 64 - buffered);
+        rc2d_rres_md5Transform(ctx->state, ctx->buffer);
+        buffered = 0;
+    }
+
+    SDL_memset(ctx->buffer + buffered, 0, 64 - buffered);
+    ctx->buffer[56] = (unsigned char)(bitsLen);
+    ctx->buffer[57] = (unsigned char)(bitsLen >> 8);
+    ctx->buffer[58] = (unsigned char)(bitsLen >> 16);
+    ctx->buffer[59] = (unsigned char)(bitsLen >> 24);
+    rc2d_rres_md5Transform(ctx->state, ctx->buffer);
+
+    for (int i = 0; i < 4; i++) hash[i] = ctx->state[i];
+
+    SDL_memset(ctx, 0, sizeof(RC2D_RresMD5Context));
+}
+
+void rc2d_rres_computeMD5(const void *data, size_t size, unsigned int hash[4])
+{
+    RC2D_RresMD5Context ctx;
+    rc2d_rres_md5Init(&ctx);
+    rc2d_rres_md5Update(&ctx, data, size);
+    rc2d_rres_md5Final(&ctx, hash);
+}
+
+#if RC2D_DATA_MODULE_ENABLED
+/**
+ * Chiffre/déchiffre en AES-256-CTR via OpenSSL EVP (AES-NI / ARMv8 Crypto lorsque disponibles).
+ * Le compteur démarre à zéro et s'incrémente sur 128 bits en big-endian, comme tiny-AES.
+ *
+ * @return 1 en cas de succès, 0 si EVP n'a pas pu être initialisé (données intactes),
+ *         -1 si une erreur est survenue pendant le traitement (données partiellement traitées).
+ */
+static int rc2d_rres_aesCtrXcryptEVP(const unsigned char *key, unsigned char *data, size_t size)
+{
+    EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+    if (ctx == NULL) return 0;
+
+    const unsigned char iv[16] = { 0 };
+    if (EVP_DecryptInit_ex(ctx, EVP_aes_256_ctr(), NULL, key, iv) != 1)
+    {
+        EVP_CIPHER_CTX_free(ctx);
+        return 0;
+    }
 
-            unsigned int temp = d;
-            d = c;
-            c = b;
-            b = b + LEFTROTATE((a + f + k[i] + w[g]), r[i]);
-            a = temp;
+    // EVP travaille en int : les très gros buffers sont traités par tranches (multiples de 16 octets)
+    int result = 1;
+    while (size > 0)
+    {
+        int len = (int)SDL_min(size, (size_t)0x40000000);
+        int outLen = 0;
+        if (EVP_DecryptUpdate(ctx, data, &outLen, data, len) != 1 || outLen != len)
+        {
+            result = -1;
+            break;
         }
+        data += len;
+        size -= len;
+    }
+
+    EVP_CIPHER_CTX_free(ctx);
+    return result;
+}
+#endif // RC2D_DATA_MODULE_ENABLED
 
-        // Add chunk's hash to result so far
-        hash[0] += a;
-        hash[1] += b;
-        hash[2] += c;
-        hash[3] += d;
+bool rc2d_rres_aesCtrXcrypt(const unsigned char key[32], unsigned char *data, size_t size, RC2D_RresAESBackend backend)
+{
+    if (key == NULL || (data == NULL && size > 0)) return false;
+
+#if !RC2D_DATA_MODULE_ENABLED
+    // OpenSSL n'est lié qu'avec le module RC2D_data : tiny-AES seul
+    if (backend == RC2D_RRES_AES_BACKEND_OPENSSL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RRES: AES-CTR OpenSSL EVP unsupported (RC2D_DATA_MODULE_ENABLED=OFF)\n");
+        return false;
+    }
+#else
+    if (backend != RC2D_RRES_AES_BACKEND_TINYAES)
+    {
+        int result = rc2d_rres_aesCtrXcryptEVP(key, data, size);
+        if (result == 1) return true;
+
+        // Le repli n'est possible que si EVP n'a encore rien écrit
+        if (result == -1 || backend == RC2D_RRES_AES_BACKEND_OPENSSL)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "RRES: AES-CTR OpenSSL EVP failed\n");
+            return false;
+        }
+        RC2D_log(RC2D_LOG_WARN, "RRES: AES-CTR OpenSSL EVP indisponible, repli sur tiny-AES\n");
     }
+#endif
 
-    RC2D_safe_free(msg);
+    struct AES_ctx ctx = { 0 };
+    AES_init_ctx(&ctx, key);
+    AES_CTR_xcrypt_buffer(&ctx, (uint8_t *)data, size);
+    crypto_wipe(&ctx, sizeof(ctx));
 
-    return hash;
+    return true;
 }
 
 void rc2d_rres_setCipherPassword(const char *pass)
@@ -202,6 +393,177 @@ void rc2d_rres_cleanCipherPassword(void)
     // Efface le mot de passe
     SDL_memset(rc2d_rres_passwordBuffer, 0, sizeof(rc2d_rres_passwordBuffer));
     rc2d_rres_password = NULL;
+
+    // Les clés dérivées de ce mot de passe ne doivent pas lui survivre
+    rc2d_rres_cleanKeyCache();
+}
+
+/**
+ * Cherche la clé d'un couple (mot de passe, sel) dans le cache. Le mutex du cache doit être verrouillé.
+ */
+static bool rc2d_rres_findCachedKeyLocked(const uint8_t *pass, const uint8_t *salt, uint8_t *key)
+{
+    // Mode sel au niveau du pack : la clé épinglée est testée en premier
+    if (rc2d_rres_packSaltModeEnabled && rc2d_rres_packKey.used &&
+        SDL_memcmp(rc2d_rres_packKey.pass, pass, 16) == 0 &&
+        SDL_memcmp(rc2d_rres_packKey.salt, salt, 16) == 0)
+    {
+        SDL_memcpy(key, rc2d_rres_packKey.key, 32);
+        return true;
+    }
+
+    for (int i = 0; i < RC2D_RRES_KEY_CACHE_CAPACITY; i++)
+    {
+        RC2D_RresKeyCacheEntry *entry = &rc2d_rres_keyCache[i];
+        if (entry->used && SDL_memcmp(entry->pass, pass, 16) == 0 && SDL_memcmp(entry->salt, salt, 16) == 0)
+        {
+            SDL_memcpy(key, entry->key, 32);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Dérive la clé de chiffrement (Argon2i, 256 bits) pour le mot de passe courant et le sel donné.
+ *
+ * Les clés sont mises en cache par couple (mot de passe, sel) : seul le premier chunk d'un sel
+ * donné paie le coût de l'étirement de clé, les suivants récupèrent directement la clé.
+ * Le mutex du cache n'est pas tenu pendant l'étirement : chaque appel alloue sa propre zone de travail
+ * de 16 Mo, ce qui permet aux workers de rc2d_rres_unpackBatch de dériver des sels différents en parallèle.
+ *
+ * @param salt Sel de 16 octets lu à la fin des données empaquetées du chunk.
+ * @param key Buffer de 32 octets qui reçoit la clé dérivée.
+ * @return true si la clé a été obtenue, false en cas d'échec d'allocation.
+ */
+static bool rc2d_rres_deriveKey(const uint8_t *salt, uint8_t *key)
+{
+    /**
+     * Le mot de passe est toujours transmis à Argon2i sur 16 octets (complété par des zéros),
+     * comme le fait l'outil rrespacker.
+     */
+    uint8_t pass[16] = { 0 };
+    const char *password = rc2d_rres_getCipherPassword();
+    SDL_memcpy(pass, password, SDL_min(SDL_strlen(password), sizeof(pass)));
+
+    SDL_Mutex *mutex = rc2d_rres_getKeyCacheMutex();
+    SDL_LockMutex(mutex);
+    bool found = rc2d_rres_findCachedKeyLocked(pass, salt, key);
+    if (found)
+    {
+        rc2d_rres_keyCacheStats.hits++;
+    }
+    else if (rc2d_rres_packSaltModeEnabled && rc2d_rres_packKey.used)
+    {
+        RC2D_log(RC2D_LOG_WARN, "RRES: Le sel du chunk diffère du sel du pack, dérivation d'une nouvelle clé\n");
+    }
+    SDL_UnlockMutex(mutex);
+
+    if (found)
+    {
+        crypto_wipe(pass, 16);
+        return true;
+    }
+
+    // Clé absente du cache : étirement de clé hors du verrou, avec une zone de travail propre à cet appel
+    const size_t workAreaSize = (size_t)RC2D_RRES_ARGON2_NB_BLOCKS * 1024;
+    void *workArea = RC2D_malloc(workAreaSize);
+    if (workArea == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RRES: Échec de l'allocation de la zone de travail Argon2i\n");
+        crypto_wipe(pass, 16);
+        return false;
+    }
+
+    // Key stretching configuration
+    crypto_argon2_config config;
+    config.algorithm = CRYPTO_ARGON2_I; // Algorithm: Argon2i
+    config.nb_blocks = RC2D_RRES_ARGON2_NB_BLOCKS; // Blocks: 16 MB
+    config.nb_passes = RC2D_RRES_ARGON2_NB_PASSES; // Iterations
+    config.nb_lanes = 1; // Single-threaded
+
+    crypto_argon2_inputs inputs;
+    inputs.pass = pass; // User password
+    inputs.pass_size = 16; // Password length
+    inputs.salt = salt; // Salt for the password
+    inputs.salt_size = 16;
+
+    crypto_argon2_extras extras = { 0 };
+
+    // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
+    crypto_argon2(key, 32, workArea, config, inputs, extras);
+
+    // La zone de travail contient des secrets intermédiaires : on l'efface avant de la libérer
+    crypto_wipe(workArea, workAreaSize);
+    RC2D_free(workArea);
+
+    SDL_LockMutex(mutex);
+    rc2d_rres_keyCacheStats.misses++;
+
+    // Un autre thread a pu dériver la même clé pendant l'étirement : on ne l'enregistre qu'une fois
+    uint8_t cached[32];
+    if (!rc2d_rres_findCachedKeyLocked(pass, salt, cached))
+    {
+        // Enregistre la clé : la première clé du pack est épinglée si le mode sel au niveau du pack est actif
+        RC2D_RresKeyCacheEntry *entry = NULL;
+        if (rc2d_rres_packSaltModeEnabled && !rc2d_rres_packKey.used)
+        {
+            entry = &rc2d_rres_packKey;
+        }
+        else
+        {
+            entry = &rc2d_rres_keyCache[rc2d_rres_keyCacheNext];
+            rc2d_rres_keyCacheNext = (rc2d_rres_keyCacheNext + 1) % RC2D_RRES_KEY_CACHE_CAPACITY;
+        }
+
+        SDL_memcpy(entry->pass, pass, 16);
+        SDL_memcpy(entry->salt, salt, 16);
+        SDL_memcpy(entry->key, key, 32);
+        entry->used = true;
+    }
+    SDL_UnlockMutex(mutex);
+
+    crypto_wipe(cached, 32);
+    crypto_wipe(pass, 16);
+
+    return true;
+}
+
+void rc2d_rres_setPackSaltMode(bool enabled)
+{
+    SDL_Mutex *mutex = rc2d_rres_getKeyCacheMutex();
+    SDL_LockMutex(mutex);
+
+    // Changer de mode invalide la clé épinglée du pack précédent
+    crypto_wipe(&rc2d_rres_packKey, sizeof(rc2d_rres_packKey));
+    rc2d_rres_packSaltModeEnabled = enabled;
+
+    SDL_UnlockMutex(mutex);
+}
+
+void rc2d_rres_cleanKeyCache(void)
+{
+    SDL_Mutex *mutex = rc2d_rres_getKeyCacheMutex();
+    SDL_LockMutex(mutex);
+
+    // Efface toutes les clés dérivées, y compris la clé épinglée du pack
+    crypto_wipe(rc2d_rres_keyCache, sizeof(rc2d_rres_keyCache));
+    crypto_wipe(&rc2d_rres_packKey, sizeof(rc2d_rres_packKey));
+    rc2d_rres_keyCacheNext = 0;
+    SDL_zero(rc2d_rres_keyCacheStats);
+
+    SDL_UnlockMutex(mutex);
+}
+
+void rc2d_rres_getKeyCacheStats(RC2D_RresKeyCacheStats *stats)
+{
+    if (stats == NULL) return;
+
+    SDL_Mutex *mutex = rc2d_rres_getKeyCacheMutex();
+    SDL_LockMutex(mutex);
+    *stats = rc2d_rres_keyCacheStats;
+    SDL_UnlockMutex(mutex);
 }
 
 void *rc2d_rres_loadDataRawFromChunk(rresResourceChunk chunk, unsigned int *size)
@@ -289,109 +651,385 @@ void freeImage(Image *image)
     }
 }
 
-Image rc2d_rres_loadImageFromChunk(rresResourceChunk chunk)
+/**
+ * Disposition du buffer de transfert d'une image décodée à la volée : les pixels commencent à
+ * RC2D_RRES_TRANSFER_PIXELS_OFFSET (alignement de 512 octets requis par Direct3D 12 pour les copies
+ * vers une texture), l'en-tête du chunk (propCount + props[4]) est écrit juste avant.
+ */
+#define RC2D_RRES_TRANSFER_PIXELS_OFFSET 512
+
+/**
+ * Taille des tuiles utilisées pour déchiffrer en AES vers le buffer de transfert : chaque tuile est
+ * déchiffrée et hachée dans une mémoire en cache, puis écrite une seule fois dans la projection.
+ */
+#define RC2D_RRES_AES_TILE_SIZE (64*1024)
+
+/**
+ * Flux AES-256-CTR (IV nul) pouvant être alimenté par tranches successives multiples de 16 octets.
+ * OpenSSL EVP avec le module RC2D_data, tiny-AES sinon (ou si EVP n'a pas pu être initialisé).
+ */
+typedef struct RC2D_RresAESStream {
+#if RC2D_DATA_MODULE_ENABLED
+    EVP_CIPHER_CTX *evp;
+#endif
+    struct AES_ctx tiny;
+} RC2D_RresAESStream;
+
+static void rc2d_rres_aesStreamInit(RC2D_RresAESStream *stream, const unsigned char *key)
 {
-    Image image = { 0 };
+    SDL_zerop(stream);
 
-    // Vérifier que le chunk est de type RRES_DATA_IMAGE
-    if (rresGetDataType(chunk.info.type) != RRES_DATA_IMAGE)
+#if RC2D_DATA_MODULE_ENABLED
+    const unsigned char iv[16] = { 0 };
+    stream->evp = EVP_CIPHER_CTX_new();
+    if (stream->evp != NULL && EVP_DecryptInit_ex(stream->evp, EVP_aes_256_ctr(), NULL, key, iv) == 1) return;
+
+    // Repli tiny-AES
+    if (stream->evp != NULL) EVP_CIPHER_CTX_free(stream->evp);
+    stream->evp = NULL;
+#endif
+
+    AES_init_ctx(&stream->tiny, key);
+}
+
+static bool rc2d_rres_aesStreamXcrypt(RC2D_RresAESStream *stream, unsigned char *data, size_t size)
+{
+#if RC2D_DATA_MODULE_ENABLED
+    if (stream->evp != NULL)
     {
-        RC2D_log(RC2D_LOG_ERROR, "Le chunk n'est pas de type RRES_DATA_IMAGE\n");
-        return image;
+        int outLen = 0;
+        return (EVP_DecryptUpdate(stream->evp, data, &outLen, data, (int)size) == 1) && (outLen == (int)size);
     }
+#endif
 
-    // Si les données ne sont pas compressées/chiffrées, elles peuvent être utilisées directement
-    if ((chunk.info.compType != RRES_COMP_NONE) || (chunk.info.cipherType != RRES_CIPHER_NONE))
+    AES_CTR_xcrypt_buffer(&stream->tiny, (uint8_t *)data, size);
+    return true;
+}
+
+static void rc2d_rres_aesStreamClose(RC2D_RresAESStream *stream)
+{
+#if RC2D_DATA_MODULE_ENABLED
+    if (stream->evp != NULL) EVP_CIPHER_CTX_free(stream->evp);
+#endif
+    crypto_wipe(stream, sizeof(RC2D_RresAESStream));
+}
+
+/**
+ * Vérifie les algorithmes et la taille d'un chunk image empaqueté, et renvoie la taille des données chiffrées
+ * (sans le sel, le nonce, le MAC ou le MD5 ajoutés par rrespacker).
+ */
+static bool rc2d_rres_getPackedImageCipherSize(const rresResourceChunk *chunk, unsigned int *outCipherSize)
+{
+    const unsigned char *packed = (const unsigned char *)chunk->data.raw;
+    unsigned int baseSize = chunk->info.baseSize;
+    unsigned int cipherSize = chunk->info.packedSize;
+
+    if (packed == NULL || baseSize <= RC2D_RRES_IMAGE_HEADER_SIZE)
     {
-        RC2D_log(RC2D_LOG_ERROR, "Les données doivent être non compressées et non chiffrées. Appelez rc2d_rres_unpackResourceChunk.\n");
-        return image;
+        RC2D_log(RC2D_LOG_ERROR, "RRES: Données d'image invalides\n");
+        return false;
     }
 
-    // Extraire les dimensions de l'image
-    Uint32 width = chunk.data.props[0];
-    Uint32 height = chunk.data.props[1];
-    int format = chunk.data.props[2];
-
-    // Mapper rresPixelFormat à SDL_GPUTextureFormat
-    SDL_GPUTextureFormat gpuFormat = SDL_GPU_TEXTUREFORMAT_INVALID;
-    switch (format)
+    // Taille des données chiffrées, sans les éléments ajoutés par rrespacker
+    switch (chunk->info.cipherType)
     {
-        case RRES_PIXELFORMAT_UNCOMP_GRAYSCALE:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_R8_UNORM; // 8 bits, niveaux de gris
-            break;
-        case RRES_PIXELFORMAT_UNCOMP_GRAY_ALPHA:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_R8G8_UNORM; // 16 bits, gris + alpha
-            break;
-        case RRES_PIXELFORMAT_UNCOMP_R5G6B5:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_B5G6R5_UNORM; // 5 bits rouge, 6 vert, 5 bleu
-            break;
-        case RRES_PIXELFORMAT_UNCOMP_R8G8B8:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM; // RGB 8 bits par canal, alpha inutilisé
-            break;
-        case RRES_PIXELFORMAT_UNCOMP_R5G5B5A1:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_B5G5R5A1_UNORM; // RGBA avec 1 bit alpha
-            break;
-        case RRES_PIXELFORMAT_UNCOMP_R4G4B4A4:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_B4G4R4A4_UNORM; // RGBA 4 bits chacun
-            break;
-        case RRES_PIXELFORMAT_UNCOMP_R8G8B8A8:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM; // RGBA 8 bits par canal
-            break;
-        case RRES_PIXELFORMAT_UNCOMP_R32:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_R32_FLOAT; // 32 bits flottant, canal unique
-            break;
-        case RRES_PIXELFORMAT_UNCOMP_R32G32B32:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_R32G32B32A32_FLOAT; // RGB flottant, alpha inutilisé
-            break;
-        case RRES_PIXELFORMAT_UNCOMP_R32G32B32A32:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_R32G32B32A32_FLOAT; // RGBA 32 bits flottant
-            break;
-        case RRES_PIXELFORMAT_COMP_DXT1_RGB:
-        case RRES_PIXELFORMAT_COMP_DXT1_RGBA:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_BC1_RGBA_UNORM; // DXT1, alpha binaire
-            break;
-        case RRES_PIXELFORMAT_COMP_DXT3_RGBA:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_BC2_RGBA_UNORM; // DXT3
-            break;
-        case RRES_PIXELFORMAT_COMP_DXT5_RGBA:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_BC3_RGBA_UNORM; // DXT5
-            break;
-        case RRES_PIXELFORMAT_COMP_ASTC_4x4_RGBA:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_ASTC_4x4_UNORM; // ASTC 4x4
-            break;
-        case RRES_PIXELFORMAT_COMP_ASTC_8x8_RGBA:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_ASTC_8x8_UNORM; // ASTC 8x8
-            break;
-        case RRES_PIXELFORMAT_COMP_ETC1_RGB:
-        case RRES_PIXELFORMAT_COMP_ETC2_RGB:
-        case RRES_PIXELFORMAT_COMP_ETC2_EAC_RGBA:
-        case RRES_PIXELFORMAT_COMP_PVRT_RGB:
-        case RRES_PIXELFORMAT_COMP_PVRT_RGBA:
-            RC2D_log(RC2D_LOG_ERROR, "Format compressé %d (ETC/PVRTC) non supporté par SDL3 GPU\n", format);
-            return image;
+        case RRES_CIPHER_NONE: break;
+        case RRES_CIPHER_AES: cipherSize = (cipherSize >= 16 + 16) ? cipherSize - 16 - 16 : 0; break;
+        case RRES_CIPHER_XCHACHA20_POLY1305: cipherSize = (cipherSize >= 16 + 24 + 16) ? cipherSize - 16 - 24 - 16 : 0; break;
         default:
-            RC2D_log(RC2D_LOG_ERROR, "Format de pixel RRES inconnu %d\n", format);
-            return image;
+            RC2D_log(RC2D_LOG_ERROR, "RRES: %c%c%c%c: Chunk data encryption algorithm not supported\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+            return false;
     }
 
-    // Vérifier si le format est supporté par le matériel
-    if (!SDL_GPUTextureSupportsFormat(rc2d_gpu_getDevice(), gpuFormat, SDL_GPU_TEXTURETYPE_2D, SDL_GPU_TEXTUREUSAGE_SAMPLER))
+    if (chunk->info.compType != RRES_COMP_NONE && chunk->info.compType != RRES_COMP_LZ4)
     {
-        RC2D_log(RC2D_LOG_ERROR, "Format GPU %d non supporté par le matériel\n", gpuFormat);
-        return image;
+        RC2D_log(RC2D_LOG_ERROR, "RRES: %c%c%c%c: Chunk data compression algorithm not supported\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+        return false;
     }
 
-    // Calculer la taille des données en fonction du format
-    Uint32 dataSize;
-    if (format >= RRES_PIXELFORMAT_COMP_DXT1_RGB && format <= RRES_PIXELFORMAT_COMP_ASTC_8x8_RGBA)
+    if (cipherSize == 0 || (chunk->info.compType == RRES_COMP_NONE && cipherSize != baseSize))
     {
-        // Formats compressés : calculer la taille en fonction des blocs
-        Uint32 blockWidth = (width + 3) / 4; // Blocs de 4x4 pixels
-        Uint32 blockHeight = (height + 3) / 4;
-        Uint32 blockSize;
-        if (format == RRES_PIXELFORMAT_COMP_DXT1_RGB || format == RRES_PIXELFORMAT_COMP_DXT1_RGBA)
-            blockSize = 8; // BC1: 8 octets par bloc
-        else if (format == RRES_PIXELFORMAT_COMP_DXT3_RGBA || format == RRES_PIXELFORMAT_COMP_DXT5_RGBA)
+        RC2D_log(RC2D_LOG_ERROR, "RRES: %c%c%c%c: Taille des données empaquetées incohérente\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+        return false;
+    }
+
+    *outCipherSize = cipherSize;
+    return true;
+}
+
+bool rc2d_rres_decodeImageChunk(const rresResourceChunk *chunk, void *buffer, unsigned int bufferSize, unsigned int props[3])
+{
+    unsigned int cipherSize = 0;
+    if (chunk == NULL || buffer == NULL || props == NULL || !rc2d_rres_getPackedImageCipherSize(chunk, &cipherSize))
+    {
+        return false;
+    }
+
+    const unsigned char *packed = (const unsigned char *)chunk->data.raw;
+    unsigned int baseSize = chunk->info.baseSize;
+    if (bufferSize < baseSize)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RRES: Buffer de sortie trop petit (%u octets, %u requis)\n", bufferSize, baseSize);
+        return false;
+    }
+
+    unsigned char *destination = (unsigned char *)buffer;
+    bool success = true;
+
+    // STEP 1. Data decryption (vers la destination si les données ne sont pas compressées)
+    //-------------------------------------------------------------------------------------
+    unsigned char *compressedData = NULL;
+    const unsigned char *lz4Source = packed;
+
+    if (chunk->info.cipherType == RRES_CIPHER_NONE && chunk->info.compType == RRES_COMP_NONE)
+    {
+        SDL_memcpy(destination, packed, baseSize);
+    }
+    else if (chunk->info.cipherType != RRES_CIPHER_NONE)
+    {
+        unsigned char *output = destination;
+        if (chunk->info.compType != RRES_COMP_NONE)
+        {
+            compressedData = (unsigned char *)RC2D_malloc(cipherSize);
+            output = compressedData;
+            lz4Source = compressedData;
+        }
+
+        uint8_t key[32] = { 0 };
+        uint8_t salt[16] = { 0 };
+        SDL_memcpy(salt, packed + cipherSize, 16);
+
+        if (output == NULL || !rc2d_rres_deriveKey(salt, key))
+        {
+            success = false;
+        }
+        else if (chunk->info.cipherType == RRES_CIPHER_AES)
+        {
+            unsigned int md5[4] = { 0 };
+            unsigned int decryptMD5[4] = { 0 };
+            SDL_memcpy(md5, packed + cipherSize + 16, sizeof(md5));
+
+            RC2D_RresAESStream stream;
+            RC2D_RresMD5Context md5Context;
+            rc2d_rres_aesStreamInit(&stream, key);
+            rc2d_rres_md5Init(&md5Context);
+
+            if (output == compressedData)
+            {
+                // Mémoire ordinaire : déchiffrement et hachage en place
+                SDL_memcpy(output, packed, cipherSize);
+                success = rc2d_rres_aesStreamXcrypt(&stream, output, cipherSize);
+                rc2d_rres_md5Update(&md5Context, output, cipherSize);
+            }
+            else
+            {
+                /**
+                 * Projection GPU (souvent en écriture combinée) : on ne la relit jamais.
+                 * Chaque tuile est déchiffrée et hachée dans un buffer en cache, puis écrite une seule fois.
+                 */
+                unsigned char *tile = (unsigned char *)RC2D_malloc(RC2D_RRES_AES_TILE_SIZE);
+                success = (tile != NULL);
+                for (unsigned int offset = 0; success && offset < cipherSize; offset += RC2D_RRES_AES_TILE_SIZE)
+                {
+                    unsigned int len = SDL_min(cipherSize - offset, RC2D_RRES_AES_TILE_SIZE);
+                    SDL_memcpy(tile, packed + offset, len);
+                    success = rc2d_rres_aesStreamXcrypt(&stream, tile, len);
+                    rc2d_rres_md5Update(&md5Context, tile, len);
+                    SDL_memcpy(output + offset, tile, len);
+                }
+                if (tile != NULL) crypto_wipe(tile, RC2D_RRES_AES_TILE_SIZE);
+                RC2D_safe_free(tile);
+            }
+
+            rc2d_rres_aesStreamClose(&stream);
+            rc2d_rres_md5Final(&md5Context, decryptMD5);
+
+            if (success && SDL_memcmp(decryptMD5, md5, sizeof(md5)) != 0)
+            {
+                success = false;
+                RC2D_log(RC2D_LOG_WARN, "RRES: %c%c%c%c: Data decryption failed, wrong password or corrupted data\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+            }
+        }
+        else
+        {
+            uint8_t nonce[24] = { 0 };
+            uint8_t mac[16] = { 0 };
+            SDL_memcpy(nonce, packed + cipherSize + 16, 24);
+            SDL_memcpy(mac, packed + cipherSize + 16 + 24, 16);
+
+            // Le MAC est vérifié avant que le texte clair ne soit écrit dans la sortie
+            if (crypto_aead_unlock(output, mac, key, nonce, NULL, 0, packed, cipherSize) != 0)
+            {
+                success = false;
+                RC2D_log(RC2D_LOG_WARN, "RRES: %c%c%c%c: Data decryption failed, wrong password or corrupted data\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+            }
+            crypto_wipe(nonce, 24);
+        }
+
+        crypto_wipe(salt, 16);
+        crypto_wipe(key, 32);
+    }
+
+    // STEP 2: Data decompression (directement dans la projection)
+    //-------------------------------------------------------------------------------------
+    if (success && chunk->info.compType == RRES_COMP_LZ4)
+    {
+        int uncompDataSize = LZ4_decompress_safe((const char *)lz4Source, (char *)destination, cipherSize, baseSize);
+        if (uncompDataSize != (int)baseSize)
+        {
+            success = false;
+            RC2D_log(RC2D_LOG_WARN, "RRES: %c%c%c%c: Chunk data decompression failed\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+        }
+    }
+
+    RC2D_safe_free(compressedData);
+
+    // Lecture de l'en-tête décodé : propCount (4 pour une image) + width, height, format, mipmaps
+    if (success)
+    {
+        unsigned int header[5] = { 0 };
+        SDL_memcpy(header, destination, sizeof(header));
+
+        if (header[0] != 4)
+        {
+            success = false;
+            RC2D_log(RC2D_LOG_ERROR, "RRES: En-tête d'image inattendu (propCount = %u)\n", header[0]);
+        }
+        else
+        {
+            props[0] = header[1];
+            props[1] = header[2];
+            props[2] = header[3];
+        }
+    }
+
+    return success;
+}
+
+/**
+ * Décode un chunk image compressé et/ou chiffré directement dans le ring d'upload GPU.
+ *
+ * - Sans compression, le déchiffrement écrit directement dans la projection du buffer de transfert.
+ * - Avec LZ4, la décompression écrit directement dans la projection ; seules les données compressées
+ *   (plus petites que l'image) transitent par un buffer temporaire lorsqu'elles sont chiffrées.
+ *
+ * @param chunk Le chunk empaqueté (ses données ne sont pas modifiées).
+ * @param allocation Reçoit la zone réservée dans le ring (pixels à RC2D_RRES_TRANSFER_PIXELS_OFFSET),
+ * à valider par l'appelant avec rc2d_gpu_endUploadToTexture ou rc2d_gpu_cancelUpload.
+ * @param props Reçoit largeur, hauteur et format lus dans l'en-tête décodé.
+ * @param pixelBytes Reçoit la taille des pixels décodés.
+ * @return true en cas de succès.
+ */
+static bool rc2d_rres_decodeImageChunkToUploadRing(const rresResourceChunk *chunk, RC2D_GPUUploadAllocation *allocation, Uint32 props[3], Uint32 *pixelBytes)
+{
+    unsigned int cipherSize = 0;
+    if (!rc2d_rres_getPackedImageCipherSize(chunk, &cipherSize))
+    {
+        return false;
+    }
+
+    const Uint32 headerOffset = RC2D_RRES_TRANSFER_PIXELS_OFFSET - RC2D_RRES_IMAGE_HEADER_SIZE;
+    if (!rc2d_gpu_beginUpload(headerOffset + chunk->info.baseSize, RC2D_RRES_TRANSFER_PIXELS_OFFSET, allocation))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Échec de la réservation dans le ring d'upload GPU\n");
+        return false;
+    }
+
+    if (!rc2d_rres_decodeImageChunk(chunk, (unsigned char *)allocation->data + headerOffset, chunk->info.baseSize, props))
+    {
+        rc2d_gpu_cancelUpload(allocation);
+        return false;
+    }
+
+    *pixelBytes = chunk->info.baseSize - RC2D_RRES_IMAGE_HEADER_SIZE;
+    return true;
+}
+
+/**
+ * Associe un format de pixel RRES au format de texture SDL3 GPU et calcule la taille des pixels.
+ */
+static bool rc2d_rres_getImageGPUFormat(int format, Uint32 width, Uint32 height, SDL_GPUTextureFormat *outFormat, Uint32 *outDataSize)
+{
+    // Mapper rresPixelFormat à SDL_GPUTextureFormat
+    SDL_GPUTextureFormat gpuFormat = SDL_GPU_TEXTUREFORMAT_INVALID;
+    switch (format)
+    {
+        case RRES_PIXELFORMAT_UNCOMP_GRAYSCALE:
+            gpuFormat = SDL_GPU_TEXTUREFORMAT_R8_UNORM; // 8 bits, niveaux de gris
+            break;
+        case RRES_PIXELFORMAT_UNCOMP_GRAY_ALPHA:
+            gpuFormat = SDL_GPU_TEXTUREFORMAT_R8G8_UNORM; // 16 bits, gris + alpha
+            break;
+        case RRES_PIXELFORMAT_UNCOMP_R5G6B5:
+            gpuFormat = SDL_GPU_TEXTUREFORMAT_B5G6R5_UNORM; // 5 bits rouge, 6 vert, 5 bleu
+            break;
+        case RRES_PIXELFORMAT_UNCOMP_R8G8B8:
+            gpuFormat = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM; // RGB 8 bits par canal, alpha inutilisé
+            break;
+        case RRES_PIXELFORMAT_UNCOMP_R5G5B5A1:
+            gpuFormat = SDL_GPU_TEXTUREFORMAT_B5G5R5A1_UNORM; // RGBA avec 1 bit alpha
+            break;
+        case RRES_PIXELFORMAT_UNCOMP_R4G4B4A4:
+            gpuFormat = SDL_GPU_TEXTUREFORMAT_B4G4R4A4_UNORM; // RGBA 4 bits chacun
+            break;
+        case RRES_PIXELFORMAT_UNCOMP_R8G8B8A8:
+            gpuFormat = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM; // RGBA 8 bits par canal
+            break;
+        case RRES_PIXELFORMAT_UNCOMP_R32:
+            gpuFormat = SDL_GPU_TEXTUREFORMAT_R32_FLOAT; // 32 bits flottant, canal unique
+            break;
+        case RRES_PIXELFORMAT_UNCOMP_R32G32B32:
+            gpuFormat = SDL_GPU_TEXTUREFORMAT_R32G32B32A32_FLOAT; // RGB flottant, alpha inutilisé
+            break;
+        case RRES_PIXELFORMAT_UNCOMP_R32G32B32A32:
+            gpuFormat = SDL_GPU_TEXTUREFORMAT_R32G32B32A32_FLOAT; // RGBA 32 bits flottant
+            break;
+        case RRES_PIXELFORMAT_COMP_DXT1_RGB:
+        case RRES_PIXELFORMAT_COMP_DXT1_RGBA:
+            gpuFormat = SDL_GPU_TEXTUREFORMAT_BC1_RGBA_UNORM; // DXT1, alpha binaire
+            break;
+        case RRES_PIXELFORMAT_COMP_DXT3_RGBA:
+            gpuFormat = SDL_GPU_TEXTUREFORMAT_BC2_RGBA_UNORM; // DXT3
+            break;
+        case RRES_PIXELFORMAT_COMP_DXT5_RGBA:
+            gpuFormat = SDL_GPU_TEXTUREFORMAT_BC3_RGBA_UNORM; // DXT5
+            break;
+        case RRES_PIXELFORMAT_COMP_ASTC_4x4_RGBA:
+            gpuFormat = SDL_GPU_TEXTUREFORMAT_ASTC_4x4_UNORM; // ASTC 4x4
+            break;
+        case RRES_PIXELFORMAT_COMP_ASTC_8x8_RGBA:
+            gpuFormat = SDL_GPU_TEXTUREFORMAT_ASTC_8x8_UNORM; // ASTC 8x8
+            break;
+        case RRES_PIXELFORMAT_COMP_ETC1_RGB:
+        case RRES_PIXELFORMAT_COMP_ETC2_RGB:
+        case RRES_PIXELFORMAT_COMP_ETC2_EAC_RGBA:
+        case RRES_PIXELFORMAT_COMP_PVRT_RGB:
+        case RRES_PIXELFORMAT_COMP_PVRT_RGBA:
+            RC2D_log(RC2D_LOG_ERROR, "Format compressé %d (ETC/PVRTC) non supporté par SDL3 GPU\n", format);
+            return false;
+        default:
+            RC2D_log(RC2D_LOG_ERROR, "Format de pixel RRES inconnu %d\n", format);
+            return false;
+    }
+
+    // Vérifier si le format est supporté par le matériel
+    if (!SDL_GPUTextureSupportsFormat(rc2d_gpu_getDevice(), gpuFormat, SDL_GPU_TEXTURETYPE_2D, SDL_GPU_TEXTUREUSAGE_SAMPLER))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Format GPU %d non supporté par le matériel\n", gpuFormat);
+        return false;
+    }
+
+    // Calculer la taille des données en fonction du format
+    Uint32 dataSize;
+    if (format >= RRES_PIXELFORMAT_COMP_DXT1_RGB && format <= RRES_PIXELFORMAT_COMP_ASTC_8x8_RGBA)
+    {
+        // Formats compressés : calculer la taille en fonction des blocs
+        Uint32 blockWidth = (width + 3) / 4; // Blocs de 4x4 pixels
+        Uint32 blockHeight = (height + 3) / 4;
+        Uint32 blockSize = 16;
+        if (format == RRES_PIXELFORMAT_COMP_DXT1_RGB || format == RRES_PIXELFORMAT_COMP_DXT1_RGBA)
+            blockSize = 8; // BC1: 8 octets par bloc
+        else if (format == RRES_PIXELFORMAT_COMP_DXT3_RGBA || format == RRES_PIXELFORMAT_COMP_DXT5_RGBA)
             blockSize = 16; // BC2/BC3: 16 octets par bloc
         else if (format == RRES_PIXELFORMAT_COMP_ASTC_4x4_RGBA)
             blockSize = 16; // ASTC 4x4: 16 octets par bloc
@@ -418,6 +1056,78 @@ Image rc2d_rres_loadImageFromChunk(rresResourceChunk chunk)
         dataSize = width * height * bytesPerPixel;
     }
 
+    *outFormat = gpuFormat;
+    *outDataSize = dataSize;
+    return true;
+}
+
+/**
+ * Crée la texture d'un chunk image et programme l'upload de ses pixels. Renvoie aussi ses dimensions et sa taille
+ * en mémoire vidéo (format compressé compris), utilisées par le cache d'images.
+ */
+static SDL_GPUTexture *rc2d_rres_createImageTexture(rresResourceChunk chunk, Uint32 *outWidth, Uint32 *outHeight, Uint64 *outBytes)
+{
+    // Vérifier que le chunk est de type RRES_DATA_IMAGE
+    if (rresGetDataType(chunk.info.type) != RRES_DATA_IMAGE)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Le chunk n'est pas de type RRES_DATA_IMAGE\n");
+        return NULL;
+    }
+
+    RC2D_GPUUploadAllocation allocation = { 0 };
+    Uint32 transferOffset = 0;
+    Uint32 pixelBytes = 0;
+    Uint32 props[3] = { 0 };
+
+    if ((chunk.info.compType != RRES_COMP_NONE) || (chunk.info.cipherType != RRES_CIPHER_NONE))
+    {
+        /**
+         * Données compressées/chiffrées : elles sont décodées directement dans le ring d'upload,
+         * sans buffer intermédiaire de la taille de l'image ni copie supplémentaire des pixels.
+         */
+        if (!rc2d_rres_decodeImageChunkToUploadRing(&chunk, &allocation, props, &pixelBytes))
+        {
+            return NULL;
+        }
+        transferOffset = RC2D_RRES_TRANSFER_PIXELS_OFFSET;
+    }
+    else
+    {
+        // Si les données ne sont pas compressées/chiffrées, elles peuvent être utilisées directement
+        if (chunk.data.props == NULL || chunk.data.propCount < 3 || chunk.data.raw == NULL)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "Propriétés de l'image manquantes\n");
+            return NULL;
+        }
+
+        props[0] = chunk.data.props[0];
+        props[1] = chunk.data.props[1];
+        props[2] = chunk.data.props[2];
+        pixelBytes = chunk.info.baseSize - sizeof(int) - chunk.data.propCount*sizeof(int);
+    }
+
+    // Extraire les dimensions de l'image
+    Uint32 width = props[0];
+    Uint32 height = props[1];
+    int format = (int)props[2];
+
+    // Format GPU et taille des données
+    SDL_GPUTextureFormat gpuFormat = SDL_GPU_TEXTUREFORMAT_INVALID;
+    Uint32 dataSize = 0;
+    if (!rc2d_rres_getImageGPUFormat(format, width, height, &gpuFormat, &dataSize))
+    {
+        if (allocation.transfer_buffer) rc2d_gpu_cancelUpload(&allocation);
+        return NULL;
+    }
+
+    // Les pixels du chunk doivent couvrir toute la texture
+    if (dataSize > pixelBytes)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Données d'image insuffisantes (%u octets attendus, %u disponibles)\n", dataSize, pixelBytes);
+        if (allocation.transfer_buffer) rc2d_gpu_cancelUpload(&allocation);
+        return NULL;
+    }
+
     // Créer la texture GPU
     SDL_GPUTextureCreateInfo createInfo = {
         .type = SDL_GPU_TEXTURETYPE_2D,
@@ -435,65 +1145,23 @@ Image rc2d_rres_loadImageFromChunk(rresResourceChunk chunk)
     if (!texture)
     {
         RC2D_log(RC2D_LOG_ERROR, "Échec de la création de la texture GPU: %s\n", SDL_GetError());
-        return image;
-    }
-
-    // Créer un buffer de transfert
-    SDL_GPUTransferBuffer *transferBuffer = SDL_CreateGPUTransferBuffer(
-        rc2d_gpu_getDevice(),
-        &(SDL_GPUTransferBufferCreateInfo){
-            .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
-            .size = dataSize
-        }
-    );
-    if (!transferBuffer)
-    {
-        RC2D_log(RC2D_LOG_ERROR, "Échec de la création du buffer de transfert: %s\n", SDL_GetError());
-        SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), texture);
-        return image;
+        if (allocation.transfer_buffer) rc2d_gpu_cancelUpload(&allocation);
+        return NULL;
     }
 
-    // Mapper le buffer de transfert et copier les données
-    void *mappedData = SDL_MapGPUTransferBuffer(rc2d_gpu_getDevice(), transferBuffer, false);
-    if (!mappedData)
+    if (allocation.transfer_buffer == NULL)
     {
-        RC2D_log(RC2D_LOG_ERROR, "Échec du mappage du buffer de transfert: %s\n", SDL_GetError());
-        SDL_ReleaseGPUTransferBuffer(rc2d_gpu_getDevice(), transferBuffer);
-        SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), texture);
-        return image;
-    }
-
-    SDL_memcpy(mappedData, chunk.data.raw, dataSize);
-    SDL_UnmapGPUTransferBuffer(rc2d_gpu_getDevice(), transferBuffer);
-
-    // Créer un copy pass pour le téléversement
-    SDL_GPUCommandBuffer *commandBuffer = SDL_AcquireGPUCommandBuffer(rc2d_gpu_getDevice());
-    if (!commandBuffer)
-    {
-        RC2D_log(RC2D_LOG_ERROR, "Échec de l'acquisition du buffer de commandes: %s\n", SDL_GetError());
-        SDL_ReleaseGPUTransferBuffer(rc2d_gpu_getDevice(), transferBuffer);
-        SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), texture);
-        return image;
-    }
+        // Réserver une zone dans le ring d'upload et copier les données
+        if (!rc2d_gpu_beginUpload(dataSize, RC2D_RRES_TRANSFER_PIXELS_OFFSET, &allocation))
+        {
+            RC2D_log(RC2D_LOG_ERROR, "Échec de la réservation dans le ring d'upload GPU\n");
+            SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), texture);
+            return NULL;
+        }
 
-    SDL_GPUCopyPass *copyPass = SDL_BeginGPUCopyPass(commandBuffer);
-    if (!copyPass)
-    {
-        RC2D_log(RC2D_LOG_ERROR, "Échec du démarrage du copy pass: %s\n", SDL_GetError());
-        SDL_ReleaseGPUTransferBuffer(rc2d_gpu_getDevice(), transferBuffer);
-        SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), texture);
-        SDL_ReleaseGPUCommandBuffer(commandBuffer);
-        return image;
+        SDL_memcpy(allocation.data, chunk.data.raw, dataSize);
     }
 
-    // Configurer les informations de transfert
-    SDL_GPUTextureTransferInfo source = {
-        .transfer_buffer = transferBuffer,
-        .offset = 0, // Offset aligné à 512 octets pour Direct3D 12
-        .pixels_per_row = width, // Données compactes
-        .rows_per_layer = height
-    };
-
     SDL_GPUTextureRegion destination = {
         .texture = texture,
         .mip_level = 0,
@@ -506,21 +1174,24 @@ Image rc2d_rres_loadImageFromChunk(rresResourceChunk chunk)
         .d = 1
     };
 
-    // Téléverser les données
-    SDL_UploadToGPUTexture(copyPass, &source, &destination, false);
+    /**
+     * Programmer l'upload : il est regroupé avec ceux des autres loaders dans une seule
+     * copy pass, soumise au début de la prochaine frame (ou via rc2d_gpu_flushUploads).
+     * L'offset des pixels est aligné à 512 octets pour Direct3D 12.
+     */
+    rc2d_gpu_endUploadToTexture(&allocation, transferOffset, &destination, width, height);
 
-    // Terminer le copy pass
-    SDL_EndGPUCopyPass(copyPass);
+    if (outWidth) *outWidth = width;
+    if (outHeight) *outHeight = height;
+    if (outBytes) *outBytes = dataSize;
 
-    // Soumettre le buffer de commandes
-    SDL_SubmitGPUCommandBuffer(commandBuffer);
-
-    // Libérer le buffer de transfert
-    SDL_ReleaseGPUTransferBuffer(rc2d_gpu_getDevice(), transferBuffer);
-
-    // Assigner la texture à la structure Image
-    image.texture = texture;
+    return texture;
+}
 
+Image rc2d_rres_loadImageFromChunk(rresResourceChunk chunk)
+{
+    Image image = { 0 };
+    image.texture = rc2d_rres_createImageTexture(chunk, NULL, NULL, NULL);
     return image;
 }
 
@@ -657,6 +1328,7 @@ int rc2d_rres_unpackResourceChunk(rresResourceChunk *chunk)
     //  2 - Invalid password on decryption
     //  3 - Compression algorithm not supported
     //  4 - Error on data decompression
+    //  5 - Error on key derivation (out of memory)
 
     // NOTE 1: If data is compressed/encrypted the properties are not loaded by rres.h because
     // it's up to the user to process the data; *chunk must be properly updated by this function
@@ -687,30 +1359,20 @@ int rc2d_rres_unpackResourceChunk(rresResourceChunk *chunk)
             // Retrieve salt from chunk packed data
             // salt is stored at the end of packed data, before nonce and MAC: salt[16] + MD5[16]
             SDL_memcpy(salt, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16 - 16), 16);
-            
-            // Key stretching configuration
-            crypto_argon2_config config;
-            config.algorithm = CRYPTO_ARGON2_I; // Algorithm: Argon2i
-            config.nb_blocks = 16384; // Blocks: 16 MB
-            config.nb_passes = 3; // Iterations
-            config.nb_lanes = 1; // Single-threaded
-
-            crypto_argon2_inputs inputs;
-            inputs.pass = (const uint8_t *)rc2d_rres_getCipherPassword(); // User password
-            inputs.pass_size = 16; // Password length
-            inputs.salt = salt; // Salt for the password
-            inputs.salt_size = 16;
 
-            crypto_argon2_extras extras = { 0 };  
-
-            void *workArea = RC2D_malloc(config.nb_blocks*1024);    // Key stretching work area
-
-            // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
-            crypto_argon2(key, 32, workArea, config, inputs, extras);
+            // Generate strong encryption key from user password (Argon2i, cached per password/salt)
+            bool keyDerived = rc2d_rres_deriveKey(salt, key);
 
             // Wipe key generation secrets, they are no longer needed
             crypto_wipe(salt, 16);
-            RC2D_safe_free(workArea);
+
+            if (!keyDerived || (decryptedData == NULL))
+            {
+                result = 5;    // Key derivation or output allocation failed, the password was never checked
+                RC2D_log(RC2D_LOG_ERROR, "RRES: %c%c%c%c: Data decryption failed, out of memory\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+                crypto_wipe(key, 32);
+                break;
+            }
 
             // Required variables for decryption and message authentication
             unsigned int md5[4] = { 0 };                // Message Authentication Code generated on encryption
@@ -719,15 +1381,12 @@ int rc2d_rres_unpackResourceChunk(rresResourceChunk *chunk)
             // NOTE: MD5 is stored at the end of packed data, after salt: salt[16] + MD5[16]
             SDL_memcpy(md5, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16), 4*sizeof(unsigned int));
 
-            // Message decryption, requires key
-            struct AES_ctx ctx = { 0 };
-            AES_init_ctx(&ctx, key);
-            AES_CTR_xcrypt_buffer(&ctx, (uint8_t *)decryptedData, chunk->info.packedSize - 16 - 16);   // AES Counter mode, stream cipher
+            // Message decryption, requires key (AES Counter mode, stream cipher)
+            rc2d_rres_aesCtrXcrypt(key, decryptedData, chunk->info.packedSize - 16 - 16, RC2D_RRES_AES_BACKEND_AUTO);
 
             // Verify MD5 to check if data decryption worked
             unsigned int decryptMD5[4] = { 0 };
-            unsigned int *md5Ptr = ComputeMD5(decryptedData, chunk->info.packedSize - 16 - 16);
-            for (int i = 0; i < 4; i++) decryptMD5[i] = md5Ptr[i];
+            rc2d_rres_computeMD5(decryptedData, chunk->info.packedSize - 16 - 16, decryptMD5);
 
             // Wipe secrets if they are no longer needed
             crypto_wipe(key, 32);
@@ -760,30 +1419,20 @@ int rc2d_rres_unpackResourceChunk(rresResourceChunk *chunk)
             // Retrieve salt from chunk packed data
             // salt is stored at the end of packed data, before nonce and MAC: salt[16] + nonce[24] + MAC[16]
             SDL_memcpy(salt, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16 - 24 - 16), 16);
-            
-            // Key stretching configuration
-            crypto_argon2_config config;
-            config.algorithm = CRYPTO_ARGON2_I; // Algorithm: Argon2i
-            config.nb_blocks = 16384; // Blocks: 16 MB
-            config.nb_passes = 3; // Iterations
-            config.nb_lanes = 1; // Single-threaded
-
-            crypto_argon2_inputs inputs;
-            inputs.pass = (const uint8_t *)rc2d_rres_getCipherPassword(); // User password
-            inputs.pass_size = 16; // Password length
-            inputs.salt = salt; // Salt for the password
-            inputs.salt_size = 16;
-
-            crypto_argon2_extras extras = { 0 };  
-
-            void *workArea = RC2D_malloc(config.nb_blocks*1024);    // Key stretching work area
 
-            // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
-            crypto_argon2(key, 32, workArea, config, inputs, extras);
+            // Generate strong encryption key from user password (Argon2i, cached per password/salt)
+            bool keyDerived = rc2d_rres_deriveKey(salt, key);
 
             // Wipe key generation secrets, they are no longer needed
             crypto_wipe(salt, 16);
-            RC2D_safe_free(workArea);
+
+            if (!keyDerived || (decryptedData == NULL))
+            {
+                result = 5;    // Key derivation or output allocation failed, the password was never checked
+                RC2D_log(RC2D_LOG_ERROR, "RRES: %c%c%c%c: Data decryption failed, out of memory\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
+                crypto_wipe(key, 32);
+                break;
+            }
 
             // Required variables for decryption and message authentication
             uint8_t nonce[24] = { 0 };                  // nonce used on encryption, unique to processed file
@@ -871,6 +1520,12 @@ int rc2d_rres_unpackResourceChunk(rresResourceChunk *chunk)
         updateProps = true;
     }
 
+    // Le buffer déchiffré intermédiaire n'est plus utile une fois décompressé (ou en cas d'échec)
+    if ((decryptedData != NULL) && (decryptedData != (unsigned char *)chunk->data.raw) && (decryptedData != unpackedData))
+    {
+        RC2D_safe_free(decryptedData);
+    }
+
     // Update chunk->data.propCount and chunk->data.props if required
     if (updateProps && (unpackedData != NULL))
     {
@@ -893,4 +1548,771 @@ int rc2d_rres_unpackResourceChunk(rresResourceChunk *chunk)
     }
 
     return result;
-}
\ No newline at end of file
+}
+
+/**
+ * Emplacement de l'index d'un pack : identifiant de ressource -> offset du premier chunk dans le fichier.
+ * Un offset nul marque un emplacement libre (l'offset 0 correspond à l'en-tête du fichier).
+ */
+typedef struct RC2D_RresPackSlot {
+    unsigned int id;
+    unsigned int offset;
+} RC2D_RresPackSlot;
+
+struct RC2D_RresPack {
+    /**
+     * Contenu complet du fichier .rres (projection mémoire, ou copie via SDL_LoadFile
+     * lorsque la plateforme ne permet pas la projection).
+     */
+    const unsigned char *data;
+    size_t size;
+    bool mapped;
+
+#if defined(RC2D_PLATFORM_WIN32)
+    HANDLE file;
+    HANDLE mapping;
+#endif
+
+    /**
+     * Index à adressage ouvert (sondage linéaire), capacité puissance de 2.
+     */
+    RC2D_RresPackSlot *slots;
+    unsigned int slotCapacity;
+
+    /**
+     * Répertoire central (nom de fichier -> identifiant), vide si le pack n'en contient pas.
+     */
+    rresCentralDir dir;
+
+    /**
+     * Identifiant unique du pack, utilisé dans les clés du cache d'images : une adresse peut être réutilisée
+     * par un autre pack après rc2d_rres_closePack, un identifiant jamais.
+     */
+    Uint32 id;
+
+    /**
+     * Nombre d'images du pack ajoutées au cache d'images (rc2d_rres_newImageFromPack).
+     */
+    SDL_AtomicInt cachedImages;
+};
+
+static SDL_AtomicInt rc2d_rres_nextPackId = { 0 };
+
+static bool rc2d_rres_mapPackFile(RC2D_RresPack *pack, const char *fileName)
+{
+#if defined(RC2D_PLATFORM_WIN32)
+    wchar_t fileNameW[1024];
+    MultiByteToWideChar(CP_UTF8, 0, fileName, -1, fileNameW, 1024);
+
+    pack->file = CreateFileW(fileNameW, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (pack->file != INVALID_HANDLE_VALUE)
+    {
+        LARGE_INTEGER fileSize;
+        if (GetFileSizeEx(pack->file, &fileSize) && fileSize.QuadPart > 0)
+        {
+            pack->mapping = CreateFileMappingW(pack->file, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (pack->mapping != NULL)
+            {
+                pack->data = (const unsigned char *)MapViewOfFile(pack->mapping, FILE_MAP_READ, 0, 0, 0);
+                if (pack->data != NULL)
+                {
+                    pack->size = (size_t)fileSize.QuadPart;
+                    pack->mapped = true;
+                    return true;
+                }
+                CloseHandle(pack->mapping);
+                pack->mapping = NULL;
+            }
+        }
+        CloseHandle(pack->file);
+        pack->file = NULL;
+    }
+#elif defined(RC2D_PLATFORM_UNIX) || defined(RC2D_PLATFORM_APPLE)
+    int fd = open(fileName, O_RDONLY);
+    if (fd != -1)
+    {
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0)
+        {
+            void *addr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr != MAP_FAILED)
+            {
+                // Le descripteur n'est plus nécessaire une fois la projection établie
+                close(fd);
+                pack->data = (const unsigned char *)addr;
+                pack->size = (size_t)st.st_size;
+                pack->mapped = true;
+                return true;
+            }
+        }
+        close(fd);
+    }
+#endif
+
+    /**
+     * Repli : chargement complet du fichier en mémoire (ex: assets d'un APK Android,
+     * plateformes sans projection mémoire). Le fichier n'est lu qu'une seule fois.
+     */
+    size_t size = 0;
+    void *data = SDL_LoadFile(fileName, &size);
+    if (data == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RRES: [%s] rres file could not be opened: %s\n", fileName, SDL_GetError());
+        return false;
+    }
+
+    pack->data = (const unsigned char *)data;
+    pack->size = size;
+    pack->mapped = false;
+    return true;
+}
+
+static void rc2d_rres_unmapPackFile(RC2D_RresPack *pack)
+{
+    if (pack->data == NULL) return;
+
+    if (pack->mapped)
+    {
+#if defined(RC2D_PLATFORM_WIN32)
+        UnmapViewOfFile(pack->data);
+        CloseHandle(pack->mapping);
+        CloseHandle(pack->file);
+#elif defined(RC2D_PLATFORM_UNIX) || defined(RC2D_PLATFORM_APPLE)
+        munmap((void *)pack->data, pack->size);
+#endif
+    }
+    else
+    {
+        SDL_free((void *)pack->data);
+    }
+
+    pack->data = NULL;
+    pack->size = 0;
+}
+
+/**
+ * Lit l'en-tête d'un chunk à l'offset donné (copie pour éviter les accès non alignés).
+ */
+static bool rc2d_rres_readPackChunkInfo(const RC2D_RresPack *pack, size_t offset, rresResourceChunkInfo *info)
+{
+    if (offset > pack->size || pack->size - offset < sizeof(rresResourceChunkInfo)) return false;
+
+    SDL_memcpy(info, pack->data + offset, sizeof(rresResourceChunkInfo));
+
+    // Comparaison sur la taille restante : packedSize vient du fichier et ne doit pas faire déborder l'addition
+    return info->packedSize <= pack->size - offset - sizeof(rresResourceChunkInfo);
+}
+
+static void rc2d_rres_insertPackSlot(RC2D_RresPack *pack, unsigned int id, unsigned int offset)
+{
+    unsigned int mask = pack->slotCapacity - 1;
+    unsigned int i = id & mask;
+
+    while (pack->slots[i].offset != 0)
+    {
+        // Chunks liés : seul le premier chunk d'une ressource est indexé
+        if (pack->slots[i].id == id) return;
+        i = (i + 1) & mask;
+    }
+
+    pack->slots[i].id = id;
+    pack->slots[i].offset = offset;
+}
+
+static unsigned int rc2d_rres_findPackSlot(const RC2D_RresPack *pack, unsigned int id)
+{
+    unsigned int mask = pack->slotCapacity - 1;
+    unsigned int i = id & mask;
+
+    while (pack->slots[i].offset != 0)
+    {
+        if (pack->slots[i].id == id) return pack->slots[i].offset;
+        i = (i + 1) & mask;
+    }
+
+    return 0;
+}
+
+/**
+ * Lit le répertoire central directement depuis la projection et indexe ses entrées.
+ * Retourne false si le répertoire est absent ou incohérent (l'appelant parcourt alors les chunks).
+ */
+static bool rc2d_rres_indexPackFromCentralDir(RC2D_RresPack *pack, const rresFileHeader *header)
+{
+    rresResourceChunkInfo info = { 0 };
+    if (header->cdOffset == 0 || !rc2d_rres_readPackChunkInfo(pack, header->cdOffset, &info)) return false;
+    if (SDL_memcmp(info.type, "CDIR", 4) != 0 || info.compType != RRES_COMP_NONE || info.cipherType != RRES_CIPHER_NONE) return false;
+
+    const unsigned char *cdir = pack->data + header->cdOffset + sizeof(rresResourceChunkInfo);
+
+    /**
+     * Données du chunk CDIR : propCount, props[propCount] (props[0] = nombre d'entrées), puis les entrées.
+     * Tout vient du fichier : les tailles sont vérifiées sur les octets restants avant toute allocation.
+     */
+    unsigned int propCount = 0;
+    unsigned int count = 0;
+    if (info.packedSize < 8) return false;
+    SDL_memcpy(&propCount, cdir, 4);
+    SDL_memcpy(&count, cdir + 4, 4);
+    if (propCount == 0 || propCount > (info.packedSize - 4)/4) return false;
+
+    size_t remaining = info.packedSize - 4 - (size_t)propCount*4;
+    const unsigned char *ptr = cdir + 4 + (size_t)propCount*4;
+
+    // Une entrée occupe au moins 16 octets, et l'index (dimensionné sur chunkCount) doit garder des emplacements libres
+    if (count > remaining/16 || count > header->chunkCount) return false;
+
+    pack->dir.entries = (rresDirEntry *)RC2D_calloc(SDL_max(count, 1), sizeof(rresDirEntry));
+    if (pack->dir.entries == NULL) return false;
+    pack->dir.count = count;
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        unsigned int fields[4] = { 0 };
+        if (remaining < 16) return false;
+        SDL_memcpy(fields, ptr, 16);
+        if (fields[3] > remaining - 16) return false;
+
+        rresDirEntry *entry = &pack->dir.entries[i];
+        entry->id = fields[0];
+        entry->offset = fields[1];
+        entry->fileNameSize = SDL_min(fields[3], RRES_MAX_FILENAME_SIZE - 1);
+        SDL_memcpy(entry->fileName, ptr + 16, entry->fileNameSize);
+        ptr += 16 + (size_t)fields[3];
+        remaining -= 16 + (size_t)fields[3];
+
+        // L'offset du répertoire doit pointer sur le chunk annoncé
+        rresResourceChunkInfo entryInfo = { 0 };
+        if (entry->offset < sizeof(rresFileHeader)) return false;
+        if (!rc2d_rres_readPackChunkInfo(pack, entry->offset, &entryInfo) || entryInfo.id != entry->id) return false;
+
+        rc2d_rres_insertPackSlot(pack, entry->id, entry->offset);
+    }
+
+    return true;
+}
+
+RC2D_RresPack *rc2d_rres_openPack(const char *fileName)
+{
+    if (fileName == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RRES: rc2d_rres_openPack: fileName is NULL\n");
+        return NULL;
+    }
+
+    RC2D_RresPack *pack = (RC2D_RresPack *)RC2D_calloc(1, sizeof(RC2D_RresPack));
+    if (pack == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RRES: Échec de l'allocation mémoire du pack\n");
+        return NULL;
+    }
+
+    if (!rc2d_rres_mapPackFile(pack, fileName))
+    {
+        RC2D_safe_free(pack);
+        return NULL;
+    }
+    pack->id = (Uint32)SDL_AddAtomicInt(&rc2d_rres_nextPackId, 1) + 1;
+
+    rresFileHeader header = { 0 };
+    if (pack->size < sizeof(rresFileHeader))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RRES: [%s] Failed to read file header\n", fileName);
+        rc2d_rres_closePack(pack);
+        return NULL;
+    }
+    SDL_memcpy(&header, pack->data, sizeof(rresFileHeader));
+
+    if (SDL_memcmp(header.id, "rres", 4) != 0 || header.version != 100)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RRES: [%s] The provided file is not a valid rres file, file signature or version not valid\n", fileName);
+        rc2d_rres_closePack(pack);
+        return NULL;
+    }
+
+    // Capacité de l'index : puissance de 2 au moins deux fois supérieure au nombre de chunks
+    pack->slotCapacity = 16;
+    while (pack->slotCapacity < (unsigned int)header.chunkCount*2) pack->slotCapacity *= 2;
+
+    pack->slots = (RC2D_RresPackSlot *)RC2D_calloc(pack->slotCapacity, sizeof(RC2D_RresPackSlot));
+    if (pack->slots == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RRES: Échec de l'allocation mémoire de l'index du pack\n");
+        rc2d_rres_closePack(pack);
+        return NULL;
+    }
+
+    if (!rc2d_rres_indexPackFromCentralDir(pack, &header))
+    {
+        /**
+         * Pas de répertoire central exploitable : on parcourt les en-têtes de chunks.
+         * Le parcours se fait dans la projection, sans aucun appel système.
+         */
+        SDL_memset(pack->slots, 0, pack->slotCapacity*sizeof(RC2D_RresPackSlot));
+        RC2D_safe_free(pack->dir.entries);
+        pack->dir.count = 0;
+
+        // Les packs de rc2d_rrespack commencent chaque chunk à un multiple de rresFileHeader::reserved
+        const size_t alignment = (header.reserved > 1 && (header.reserved & (header.reserved - 1)) == 0) ? header.reserved : 1;
+
+        size_t offset = sizeof(rresFileHeader);
+        for (int i = 0; i < header.chunkCount; i++)
+        {
+            offset = (offset + alignment - 1) & ~(alignment - 1);
+
+            rresResourceChunkInfo info = { 0 };
+            if (!rc2d_rres_readPackChunkInfo(pack, offset, &info))
+            {
+                RC2D_log(RC2D_LOG_WARN, "RRES: [%s] Truncated chunk at offset %zu\n", fileName, offset);
+                break;
+            }
+
+            if (SDL_memcmp(info.type, "CDIR", 4) != 0) rc2d_rres_insertPackSlot(pack, info.id, (unsigned int)offset);
+            offset += sizeof(rresResourceChunkInfo) + info.packedSize;
+        }
+    }
+
+    RC2D_log(RC2D_LOG_INFO, "RRES: Pack opened: %s (%u chunks, %s)\n", fileName, header.chunkCount, pack->mapped ? "memory-mapped" : "loaded");
+
+    return pack;
+}
+
+/**
+ * Préfixe des clés du cache d'images pour les images d'un pack.
+ */
+static void rc2d_rres_getImageKeyPrefix(const RC2D_RresPack *pack, char *prefix, size_t size)
+{
+    SDL_snprintf(prefix, size, "rres:%u/", pack->id);
+}
+
+void rc2d_rres_closePack(RC2D_RresPack *pack)
+{
+    if (pack == NULL) return;
+
+    // Les images du pack ne peuvent plus être rechargées : leurs textures sont libérées (après les rechargements en cours)
+    if (SDL_GetAtomicInt(&pack->cachedImages) > 0)
+    {
+        char prefix[32];
+        rc2d_rres_getImageKeyPrefix(pack, prefix, sizeof(prefix));
+        rc2d_gpu_purgeImages(prefix);
+    }
+
+    rc2d_rres_unmapPackFile(pack);
+
+    // Les entrées du répertoire sont allouées par rc2d_rres_indexPackFromCentralDir (RC2D_calloc), pas par rres.h
+    RC2D_safe_free(pack->dir.entries);
+    RC2D_safe_free(pack->slots);
+    RC2D_safe_free(pack);
+}
+
+int rc2d_rres_getResourceIdFromPack(const RC2D_RresPack *pack, const char *fileName)
+{
+    if (pack == NULL || fileName == NULL) return 0;
+
+    return rresGetResourceId(pack->dir, fileName);
+}
+
+rresResourceChunk rc2d_rres_loadChunkFromPack(const RC2D_RresPack *pack, unsigned int id)
+{
+    rresResourceChunk chunk = { 0 };
+
+    if (pack == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RRES: rc2d_rres_loadChunkFromPack: pack is NULL\n");
+        return chunk;
+    }
+
+    unsigned int offset = rc2d_rres_findPackSlot(pack, id);
+    if (offset == 0)
+    {
+        RC2D_log(RC2D_LOG_WARN, "RRES: Requested resource not found: 0x%08x\n", id);
+        return chunk;
+    }
+
+    rresResourceChunkInfo info = { 0 };
+    if (!rc2d_rres_readPackChunkInfo(pack, offset, &info))
+    {
+        RC2D_log(RC2D_LOG_WARN, "RRES: [ID %u] Truncated chunk at offset %u\n", id, offset);
+        return chunk;
+    }
+    const unsigned char *packed = pack->data + offset + sizeof(rresResourceChunkInfo);
+
+    if (rresComputeCRC32((unsigned char *)packed, info.packedSize) != info.crc32)
+    {
+        RC2D_log(RC2D_LOG_WARN, "RRES: [ID %u] CRC32 does not match, data can be corrupted\n", info.id);
+        return chunk;
+    }
+
+    if (info.compType == RRES_COMP_NONE && info.cipherType == RRES_CIPHER_NONE)
+    {
+        /**
+         * Vue sans copie : chunk.data.raw pointe directement dans la projection.
+         * Seules les propriétés (quelques entiers) sont copiées pour garantir leur alignement.
+         * propCount et baseSize viennent du fichier : tout est borné par packedSize, lui-même borné par la projection.
+         */
+        unsigned int propCount = 0;
+        if (info.packedSize < sizeof(unsigned int) || info.baseSize != info.packedSize)
+        {
+            RC2D_log(RC2D_LOG_WARN, "RRES: [ID %u] Invalid chunk size (packed %u, base %u)\n", info.id, info.packedSize, info.baseSize);
+            return chunk;
+        }
+
+        SDL_memcpy(&propCount, packed, sizeof(unsigned int));
+        if (propCount > (info.packedSize - sizeof(unsigned int))/sizeof(unsigned int))
+        {
+            RC2D_log(RC2D_LOG_WARN, "RRES: [ID %u] Property count out of the chunk (%u)\n", info.id, propCount);
+            return chunk;
+        }
+
+        const size_t headerSize = sizeof(unsigned int) + (size_t)propCount*sizeof(unsigned int);
+        if (propCount > 0)
+        {
+            chunk.data.props = (unsigned int *)RC2D_calloc(propCount, sizeof(unsigned int));
+            if (chunk.data.props == NULL) return chunk;
+            SDL_memcpy(chunk.data.props, packed + sizeof(unsigned int), propCount*sizeof(unsigned int));
+        }
+        chunk.data.propCount = propCount;
+
+        /**
+         * Données brutes : le reste du chunk (packedSize - headerSize octets). Sans données, raw pointe sur le début
+         * du chunk plutôt qu'après lui : la vue reste dans la projection (rc2d_rres_isChunkViewOfPack).
+         */
+        chunk.data.raw = (void *)(headerSize < info.packedSize ? packed + headerSize : packed);
+    }
+    else
+    {
+        /**
+         * Données compressées/chiffrées : rc2d_rres_unpackResourceChunk remplace chunk.data.raw,
+         * il faut donc lui fournir une copie qui lui appartient.
+         */
+        chunk.data.raw = RC2D_malloc(info.packedSize);
+        if (chunk.data.raw != NULL) SDL_memcpy(chunk.data.raw, packed, info.packedSize);
+    }
+
+    chunk.info = info;
+    return chunk;
+}
+
+bool rc2d_rres_isChunkViewOfPack(const RC2D_RresPack *pack, const rresResourceChunk *chunk)
+{
+    if (pack == NULL || chunk == NULL || chunk->data.raw == NULL) return false;
+
+    const unsigned char *raw = (const unsigned char *)chunk->data.raw;
+    return (raw >= pack->data) && (raw < pack->data + pack->size);
+}
+
+void rc2d_rres_unloadChunkFromPack(const RC2D_RresPack *pack, rresResourceChunk *chunk)
+{
+    if (chunk == NULL) return;
+
+    RC2D_safe_free(chunk->data.props);
+
+    // Une vue appartient au pack : seul le pointeur est oublié
+    if (rc2d_rres_isChunkViewOfPack(pack, chunk)) chunk->data.raw = NULL;
+    else RC2D_safe_free(chunk->data.raw);
+
+    chunk->data.propCount = 0;
+}
+
+/**
+ * Source d'une image du cache chargée depuis un pack : permet de recréer sa texture après une éviction.
+ * Le pointeur reste valide : rc2d_rres_closePack purge les images du pack après les rechargements en cours.
+ */
+typedef struct RC2D_RresImageSource {
+    const RC2D_RresPack *pack;
+    unsigned int id;
+} RC2D_RresImageSource;
+
+/**
+ * Worker : copie le chunk et le décode (déchiffrement, décompression). Aucun appel SDL_GPU.
+ */
+static void *rc2d_rres_reloadImage(void *data)
+{
+    const RC2D_RresImageSource *source = (const RC2D_RresImageSource *)data;
+
+    rresResourceChunk *chunk = (rresResourceChunk *)RC2D_malloc(sizeof(rresResourceChunk));
+    if (chunk == NULL) return NULL;
+
+    *chunk = rc2d_rres_loadChunkFromPack(source->pack, source->id);
+    bool loaded = chunk->data.raw != NULL;
+    if (loaded && ((chunk->info.compType != RRES_COMP_NONE) || (chunk->info.cipherType != RRES_CIPHER_NONE)))
+    {
+        loaded = rc2d_rres_unpackResourceChunk(chunk) == 0;
+    }
+
+    if (!loaded)
+    {
+        rc2d_rres_unloadChunkFromPack(source->pack, chunk);
+        RC2D_free(chunk);
+        return NULL;
+    }
+    return chunk;
+}
+
+/**
+ * Thread principal : crée la texture du chunk décodé par rc2d_rres_reloadImage, puis libère le chunk.
+ */
+static SDL_GPUTexture *rc2d_rres_uploadImage(void *data, void *loaded, Uint32 *width, Uint32 *height, Uint64 *bytes)
+{
+    const RC2D_RresImageSource *source = (const RC2D_RresImageSource *)data;
+    rresResourceChunk *chunk = (rresResourceChunk *)loaded;
+    if (chunk == NULL) return NULL;
+
+    SDL_GPUTexture *texture = rc2d_rres_createImageTexture(*chunk, width, height, bytes);
+    rc2d_rres_unloadChunkFromPack(source->pack, chunk);
+    RC2D_free(chunk);
+    return texture;
+}
+
+/**
+ * Création de la première texture d'une image de pack, confiée au thread principal par rc2d_rres_newImageFromPack.
+ */
+typedef struct RC2D_RresImageUpload {
+    RC2D_RresImageSource *source;
+    void *loaded;
+    SDL_GPUTexture *texture;
+    Uint32 width;
+    Uint32 height;
+    Uint64 bytes;
+} RC2D_RresImageUpload;
+
+static void rc2d_rres_uploadImageTask(void *data)
+{
+    RC2D_RresImageUpload *upload = (RC2D_RresImageUpload *)data;
+    upload->texture = rc2d_rres_uploadImage(upload->source, upload->loaded, &upload->width, &upload->height, &upload->bytes);
+}
+
+RC2D_Image *rc2d_rres_newImageFromPack(const RC2D_RresPack *pack, const char *fileName)
+{
+    if (pack == NULL || fileName == NULL) return NULL;
+
+    // Clé propre au pack : deux packs peuvent contenir un fichier du même nom
+    char key[512];
+    rc2d_rres_getImageKeyPrefix(pack, key, sizeof(key));
+    SDL_strlcat(key, fileName, sizeof(key));
+
+    RC2D_ImageEntry *cachedEntry = rc2d_hashmap_get(rc2d_engine_state.gpu_image_cache_index, key);
+    if (cachedEntry != NULL) return cachedEntry->image;
+
+    int id = rc2d_rres_getResourceIdFromPack(pack, fileName);
+    if (id == 0)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Image %s introuvable dans le pack\n", fileName);
+        return NULL;
+    }
+
+    RC2D_RresImageSource *source = RC2D_malloc(sizeof(RC2D_RresImageSource));
+    if (source == NULL) return NULL;
+    source->pack = pack;
+    source->id = (unsigned int)id;
+
+    // Décodage sur le thread appelant, création de la texture sur le thread principal (directement si c'est lui)
+    RC2D_RresImageUpload upload = { .source = source, .loaded = rc2d_rres_reloadImage(source) };
+    RC2D_JobCounter created = { 0 };
+    rc2d_job_runOnMainThread(rc2d_rres_uploadImageTask, &upload, &created);
+    rc2d_job_wait(&created);
+
+    if (upload.texture == NULL)
+    {
+        RC2D_free(source);
+        return NULL;
+    }
+
+    // Le pack devra purger ses images du cache à sa fermeture
+    SDL_AddAtomicInt(&((RC2D_RresPack *)pack)->cachedImages, 1);
+
+    return rc2d_gpu_cacheImage(key, upload.texture, upload.width, upload.height, upload.bytes,
+                               rc2d_rres_reloadImage, rc2d_rres_uploadImage, source);
+}
+
+/**
+ * Lot de décodage parallèle : des jobs du système de jobs se partagent la liste d'identifiants via un index
+ * atomique et publient les chunks décodés dans une file de complétion vidée par le thread appelant.
+ */
+struct RC2D_RresBatch {
+    const RC2D_RresPack *pack;
+    unsigned int *ids;
+    int count;
+
+    /**
+     * Prochain identifiant à traiter (partagé entre les workers).
+     */
+    SDL_AtomicInt nextIndex;
+
+    /**
+     * File de complétion : `completed[0..completedCount[` est rempli par les workers,
+     * `consumedCount` n'est lu et écrit que par le thread qui vide la file.
+     */
+    RC2D_RresBatchResult *completed;
+    int completedCount;
+    int consumedCount;
+    SDL_Mutex *mutex;
+    SDL_Condition *condition;
+
+    /**
+     * Jobs de décodage du lot, attendus par rc2d_rres_destroyBatch.
+     */
+    RC2D_JobCounter jobs;
+};
+
+/**
+ * Décode le prochain identifiant non distribué du lot.
+ * Retourne false quand tous les identifiants ont été distribués.
+ */
+static bool rc2d_rres_decodeNextInBatch(RC2D_RresBatch *batch)
+{
+    int index = SDL_AddAtomicInt(&batch->nextIndex, 1);
+    if (index >= batch->count) return false;
+
+    RC2D_RresBatchResult result = { 0 };
+    result.id = batch->ids[index];
+    result.chunk = rc2d_rres_loadChunkFromPack(batch->pack, result.id);
+
+    if (result.chunk.data.raw == NULL)
+    {
+        result.result = -1;
+    }
+    else
+    {
+        // Déchiffrement, vérification et décompression sur ce worker
+        result.result = rc2d_rres_unpackResourceChunk(&result.chunk);
+    }
+
+    SDL_LockMutex(batch->mutex);
+    batch->completed[batch->completedCount++] = result;
+    SDL_SignalCondition(batch->condition);
+    SDL_UnlockMutex(batch->mutex);
+
+    return true;
+}
+
+static void rc2d_rres_batchJob(void *data)
+{
+    RC2D_RresBatch *batch = (RC2D_RresBatch *)data;
+    while (rc2d_rres_decodeNextInBatch(batch)) {}
+}
+
+RC2D_RresBatch *rc2d_rres_unpackBatch(const RC2D_RresPack *pack, const unsigned int *ids, int count)
+{
+    if (pack == NULL || ids == NULL || count <= 0)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RRES: rc2d_rres_unpackBatch: invalid parameters\n");
+        return NULL;
+    }
+
+    RC2D_RresBatch *batch = (RC2D_RresBatch *)RC2D_calloc(1, sizeof(RC2D_RresBatch));
+    if (batch == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RRES: Échec de l'allocation mémoire du lot\n");
+        return NULL;
+    }
+
+    batch->pack = pack;
+    batch->count = count;
+    batch->ids = (unsigned int *)RC2D_malloc(count*sizeof(unsigned int));
+    batch->completed = (RC2D_RresBatchResult *)RC2D_calloc(count, sizeof(RC2D_RresBatchResult));
+    batch->mutex = SDL_CreateMutex();
+    batch->condition = SDL_CreateCondition();
+
+    if (batch->ids == NULL || batch->completed == NULL || batch->mutex == NULL || batch->condition == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RRES: Échec de l'initialisation du lot\n");
+        rc2d_rres_destroyBatch(batch);
+        return NULL;
+    }
+
+    SDL_memcpy(batch->ids, ids, count*sizeof(unsigned int));
+    SDL_SetAtomicInt(&batch->nextIndex, 0);
+
+    /**
+     * Un job par worker du pool, sans dépasser le nombre de chunks à traiter. Chaque job décode des chunks
+     * jusqu'à épuisement de la liste. Sans système de jobs démarré, rc2d_job_run décode le lot sur le thread appelant.
+     */
+    int jobCount = SDL_clamp(rc2d_job_getWorkerCount(), 1, count);
+    for (int i = 0; i < jobCount; i++)
+    {
+        rc2d_job_run(rc2d_rres_batchJob, batch, &batch->jobs);
+    }
+
+    return batch;
+}
+
+static bool rc2d_rres_popBatchResult(RC2D_RresBatch *batch, RC2D_RresBatchResult *result, bool wait)
+{
+    if (batch == NULL || result == NULL) return false;
+
+    SDL_LockMutex(batch->mutex);
+
+    while (wait && batch->consumedCount == batch->completedCount && batch->consumedCount < batch->count)
+    {
+        /**
+         * Rien de prêt : le thread appelant décode lui-même un chunk pas encore distribué plutôt que d'attendre
+         * les workers (tous occupés, ou aucun si le pool n'a pas de worker). Il n'attend que les chunks en cours.
+         */
+        SDL_UnlockMutex(batch->mutex);
+        bool decoded = rc2d_rres_decodeNextInBatch(batch);
+        SDL_LockMutex(batch->mutex);
+
+        if (!decoded && batch->consumedCount == batch->completedCount)
+        {
+            SDL_WaitCondition(batch->condition, batch->mutex);
+        }
+    }
+
+    bool available = batch->consumedCount < batch->completedCount;
+    if (available)
+    {
+        *result = batch->completed[batch->consumedCount];
+        SDL_zero(batch->completed[batch->consumedCount]);
+        batch->consumedCount++;
+    }
+
+    SDL_UnlockMutex(batch->mutex);
+
+    return available;
+}
+
+bool rc2d_rres_pollBatch(RC2D_RresBatch *batch, RC2D_RresBatchResult *result)
+{
+    return rc2d_rres_popBatchResult(batch, result, false);
+}
+
+bool rc2d_rres_waitBatch(RC2D_RresBatch *batch, RC2D_RresBatchResult *result)
+{
+    return rc2d_rres_popBatchResult(batch, result, true);
+}
+
+bool rc2d_rres_isBatchDone(RC2D_RresBatch *batch)
+{
+    if (batch == NULL) return true;
+
+    SDL_LockMutex(batch->mutex);
+    bool done = batch->consumedCount == batch->count;
+    SDL_UnlockMutex(batch->mutex);
+
+    return done;
+}
+
+void rc2d_rres_destroyBatch(RC2D_RresBatch *batch)
+{
+    if (batch == NULL) return;
+
+    // Les jobs en cours terminent leur chunk : on arrête de distribuer de nouveaux chunks
+    SDL_SetAtomicInt(&batch->nextIndex, batch->count);
+    rc2d_job_wait(&batch->jobs);
+
+    // Libère les chunks décodés qui n'ont pas été récupérés
+    if (batch->completed != NULL)
+    {
+        for (int i = batch->consumedCount; i < batch->completedCount; i++)
+        {
+            rc2d_rres_unloadChunkFromPack(batch->pack, &batch->completed[i].chunk);
+        }
+    }
+
+    if (batch->condition != NULL) SDL_DestroyCondition(batch->condition);
+    if (batch->mutex != NULL) SDL_DestroyMutex(batch->mutex);
+    RC2D_safe_free(batch->completed);
+    RC2D_safe_free(batch->ids);
+    RC2D_safe_free(batch);
+}
@@ -0,0 +1,314 @@
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_platform_defines.h>
+#include <RC2D/RC2D_hashmap.h>
+#include <RC2D/RC2D_logger.h>
+#include <RC2D/RC2D_memory.h>
+
+#if RC2D_GPU_SHADER_HOT_RELOAD_ENABLED
+
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_filesystem.h>
+#include <SDL3/SDL_mutex.h>
+#include <SDL3/SDL_thread.h>
+#include <SDL3/SDL_timer.h>
+
+#if defined(RC2D_PLATFORM_LINUX)
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+/**
+ * Intervalle de scan du dossier des sources HLSL lorsque inotify n'est pas disponible.
+ */
+#define RC2D_SHADERWATCHER_POLL_INTERVAL_MS 250
+
+/**
+ * État du watcher : un thread surveille `shaders/src/` et pousse les noms des shaders modifiés
+ * (ex: "test.vertex") dans une file. Le thread principal ne fait aucun accès disque tant que la file est vide.
+ */
+static struct {
+    SDL_Thread* thread;
+    SDL_Semaphore* quit;
+    SDL_AtomicInt running;
+    char directory[512];
+
+    // File des shaders modifiés (thread du watcher -> thread principal)
+    SDL_Mutex* mutex;
+    char** pending;
+    int pending_count;
+    int pending_capacity;
+    SDL_AtomicInt has_pending;
+
+    // Shaders modifiés pris en compte pendant la frame courante
+    char** frame;
+    int frame_count;
+
+#if defined(RC2D_PLATFORM_LINUX)
+    int inotify_fd;
+#endif
+} rc2d_shaderwatcher = {0};
+
+/**
+ * Ajoute un shader modifié à la file (sans doublon).
+ *
+ * @param {const char*} fileName - Nom du fichier dans `shaders/src/` (ex: "test.vertex.hlsl").
+ */
+static void rc2d_shaderwatcher_push(const char* fileName)
+{
+    const size_t length = SDL_strlen(fileName);
+    const size_t suffixLength = sizeof(".hlsl") - 1;
+    if (length <= suffixLength || SDL_strcmp(fileName + length - suffixLength, ".hlsl") != 0) return;
+
+    SDL_LockMutex(rc2d_shaderwatcher.mutex);
+
+    for (int i = 0; i < rc2d_shaderwatcher.pending_count; i++)
+    {
+        if (SDL_strncmp(rc2d_shaderwatcher.pending[i], fileName, length - suffixLength) == 0 &&
+            rc2d_shaderwatcher.pending[i][length - suffixLength] == '\0')
+        {
+            SDL_UnlockMutex(rc2d_shaderwatcher.mutex);
+            return;
+        }
+    }
+
+    if (rc2d_shaderwatcher.pending_count == rc2d_shaderwatcher.pending_capacity)
+    {
+        int capacity = rc2d_shaderwatcher.pending_capacity ? rc2d_shaderwatcher.pending_capacity * 2 : 8;
+        char** pending = RC2D_realloc(rc2d_shaderwatcher.pending, capacity * sizeof(char*));
+        if (pending == NULL)
+        {
+            SDL_UnlockMutex(rc2d_shaderwatcher.mutex);
+            return;
+        }
+        rc2d_shaderwatcher.pending = pending;
+        rc2d_shaderwatcher.pending_capacity = capacity;
+    }
+
+    char* name = RC2D_strndup(fileName, length - suffixLength);
+    if (name != NULL)
+    {
+        rc2d_shaderwatcher.pending[rc2d_shaderwatcher.pending_count++] = name;
+        SDL_SetAtomicInt(&rc2d_shaderwatcher.has_pending, 1);
+        RC2D_log(RC2D_LOG_DEBUG, "Shader source changed: %s", name);
+    }
+
+    SDL_UnlockMutex(rc2d_shaderwatcher.mutex);
+}
+
+#if defined(RC2D_PLATFORM_LINUX)
+/**
+ * Boucle inotify : attend les fichiers fermés après écriture ou renommés dans le dossier
+ * (les éditeurs qui sauvegardent via un fichier temporaire puis un renommage).
+ */
+static void rc2d_shaderwatcher_runInotify(void)
+{
+    char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    struct pollfd pfd = { rc2d_shaderwatcher.inotify_fd, POLLIN, 0 };
+
+    while (SDL_GetAtomicInt(&rc2d_shaderwatcher.running))
+    {
+        // Timeout court pour pouvoir s'arrêter sans signal dédié
+        int ready = poll(&pfd, 1, 100);
+        if (ready <= 0) continue;
+
+        ssize_t length = read(rc2d_shaderwatcher.inotify_fd, buffer, sizeof(buffer));
+        if (length <= 0)
+        {
+            if (length < 0 && errno == EINTR) continue;
+            break;
+        }
+
+        for (char* ptr = buffer; ptr < buffer + length; )
+        {
+            const struct inotify_event* event = (const struct inotify_event*)ptr;
+            if (event->len > 0 && (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)))
+            {
+                rc2d_shaderwatcher_push(event->name);
+            }
+            ptr += sizeof(struct inotify_event) + event->len;
+        }
+    }
+}
+#endif
+
+/**
+ * Collecte la date de modification de chaque fichier du dossier (callback de SDL_EnumerateDirectory).
+ */
+static SDL_EnumerationResult SDLCALL rc2d_shaderwatcher_scanFile(void* userdata, const char* dirname, const char* fname)
+{
+    RC2D_HashMap* times = (RC2D_HashMap*)userdata;
+
+    char path[768];
+    SDL_snprintf(path, sizeof(path), "%s%s", dirname, fname);
+
+    SDL_PathInfo info;
+    if (!SDL_GetPathInfo(path, &info) || info.type != SDL_PATHTYPE_FILE) return SDL_ENUM_CONTINUE;
+
+    SDL_Time* knownTime = (SDL_Time*)rc2d_hashmap_get(times, fname);
+    if (knownTime == NULL)
+    {
+        knownTime = RC2D_malloc(sizeof(SDL_Time));
+        if (knownTime == NULL) return SDL_ENUM_CONTINUE;
+        *knownTime = info.modify_time;
+        if (!rc2d_hashmap_put(times, fname, knownTime)) RC2D_free(knownTime);
+
+        // Un nouveau fichier n'est signalé qu'après le premier scan (état initial)
+        if (SDL_GetAtomicInt(&rc2d_shaderwatcher.running) == 2) rc2d_shaderwatcher_push(fname);
+    }
+    else if (info.modify_time != *knownTime)
+    {
+        *knownTime = info.modify_time;
+        rc2d_shaderwatcher_push(fname);
+    }
+
+    return SDL_ENUM_CONTINUE;
+}
+
+static void rc2d_shaderwatcher_freeTime(const char* key, Uint64 hash, void* value, void* userdata)
+{
+    (void)key;
+    (void)hash;
+    (void)userdata;
+    RC2D_free(value);
+}
+
+/**
+ * Boucle de repli : scan du dossier toutes les RC2D_SHADERWATCHER_POLL_INTERVAL_MS millisecondes,
+ * sur le thread du watcher uniquement.
+ */
+static void rc2d_shaderwatcher_runPolling(void)
+{
+    RC2D_HashMap* times = rc2d_hashmap_create(128);
+    if (times == NULL) return;
+
+    // Premier scan : mémorise l'état initial sans rien signaler
+    SDL_EnumerateDirectory(rc2d_shaderwatcher.directory, rc2d_shaderwatcher_scanFile, times);
+    SDL_SetAtomicInt(&rc2d_shaderwatcher.running, 2);
+
+    while (!SDL_WaitSemaphoreTimeout(rc2d_shaderwatcher.quit, RC2D_SHADERWATCHER_POLL_INTERVAL_MS))
+    {
+        SDL_EnumerateDirectory(rc2d_shaderwatcher.directory, rc2d_shaderwatcher_scanFile, times);
+    }
+
+    rc2d_hashmap_forEach(times, rc2d_shaderwatcher_freeTime, NULL);
+    rc2d_hashmap_destroy(times);
+}
+
+static int SDLCALL rc2d_shaderwatcher_threadMain(void* data)
+{
+    (void)data;
+
+#if defined(RC2D_PLATFORM_LINUX)
+    if (rc2d_shaderwatcher.inotify_fd >= 0)
+    {
+        rc2d_shaderwatcher_runInotify();
+        return 0;
+    }
+#endif
+
+    rc2d_shaderwatcher_runPolling();
+    return 0;
+}
+
+bool rc2d_gpu_shaderWatcherInit(void)
+{
+    const char* basePath = SDL_GetBasePath();
+    if (basePath == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Shader watcher disabled, SDL_GetBasePath() failed: %s", SDL_GetError());
+        return false;
+    }
+    SDL_snprintf(rc2d_shaderwatcher.directory, sizeof(rc2d_shaderwatcher.directory), "%sshaders/src/", basePath);
+
+    rc2d_shaderwatcher.mutex = SDL_CreateMutex();
+    rc2d_shaderwatcher.quit = SDL_CreateSemaphore(0);
+    if (rc2d_shaderwatcher.mutex == NULL || rc2d_shaderwatcher.quit == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to create shader watcher synchronization objects: %s", SDL_GetError());
+        rc2d_gpu_shaderWatcherQuit();
+        return false;
+    }
+
+#if defined(RC2D_PLATFORM_LINUX)
+    rc2d_shaderwatcher.inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (rc2d_shaderwatcher.inotify_fd >= 0 &&
+        inotify_add_watch(rc2d_shaderwatcher.inotify_fd, rc2d_shaderwatcher.directory, IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+    {
+        RC2D_log(RC2D_LOG_WARN, "inotify unavailable for %s, falling back to polling", rc2d_shaderwatcher.directory);
+        close(rc2d_shaderwatcher.inotify_fd);
+        rc2d_shaderwatcher.inotify_fd = -1;
+    }
+#endif
+
+    SDL_SetAtomicInt(&rc2d_shaderwatcher.running, 1);
+    rc2d_shaderwatcher.thread = SDL_CreateThread(rc2d_shaderwatcher_threadMain, "RC2D_ShaderWatcher", NULL);
+    if (rc2d_shaderwatcher.thread == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to create shader watcher thread: %s", SDL_GetError());
+        rc2d_gpu_shaderWatcherQuit();
+        return false;
+    }
+
+    RC2D_log(RC2D_LOG_INFO, "Shader watcher started on %s", rc2d_shaderwatcher.directory);
+    return true;
+}
+
+void rc2d_gpu_shaderWatcherQuit(void)
+{
+    SDL_SetAtomicInt(&rc2d_shaderwatcher.running, 0);
+    if (rc2d_shaderwatcher.thread != NULL)
+    {
+        SDL_SignalSemaphore(rc2d_shaderwatcher.quit);
+        SDL_WaitThread(rc2d_shaderwatcher.thread, NULL);
+    }
+
+#if defined(RC2D_PLATFORM_LINUX)
+    if (rc2d_shaderwatcher.inotify_fd > 0) close(rc2d_shaderwatcher.inotify_fd);
+#endif
+
+    rc2d_gpu_shaderWatcherEndFrame();
+    for (int i = 0; i < rc2d_shaderwatcher.pending_count; i++) RC2D_safe_free(rc2d_shaderwatcher.pending[i]);
+    RC2D_safe_free(rc2d_shaderwatcher.pending);
+
+    if (rc2d_shaderwatcher.quit) SDL_DestroySemaphore(rc2d_shaderwatcher.quit);
+    if (rc2d_shaderwatcher.mutex) SDL_DestroyMutex(rc2d_shaderwatcher.mutex);
+
+    SDL_zero(rc2d_shaderwatcher);
+}
+
+bool rc2d_gpu_shaderWatcherBeginFrame(void)
+{
+    // Cas courant : aucun changement, aucune attente de verrou ni accès disque
+    if (!SDL_GetAtomicInt(&rc2d_shaderwatcher.has_pending)) return false;
+
+    SDL_LockMutex(rc2d_shaderwatcher.mutex);
+    rc2d_shaderwatcher.frame = rc2d_shaderwatcher.pending;
+    rc2d_shaderwatcher.frame_count = rc2d_shaderwatcher.pending_count;
+    rc2d_shaderwatcher.pending = NULL;
+    rc2d_shaderwatcher.pending_count = 0;
+    rc2d_shaderwatcher.pending_capacity = 0;
+    SDL_SetAtomicInt(&rc2d_shaderwatcher.has_pending, 0);
+    SDL_UnlockMutex(rc2d_shaderwatcher.mutex);
+
+    return rc2d_shaderwatcher.frame_count > 0;
+}
+
+bool rc2d_gpu_shaderWatcherIsChanged(const char* filename)
+{
+    for (int i = 0; i < rc2d_shaderwatcher.frame_count; i++)
+    {
+        if (SDL_strcmp(rc2d_shaderwatcher.frame[i], filename) == 0) return true;
+    }
+    return false;
+}
+
+void rc2d_gpu_shaderWatcherEndFrame(void)
+{
+    for (int i = 0; i < rc2d_shaderwatcher.frame_count; i++) RC2D_safe_free(rc2d_shaderwatcher.frame[i]);
+    RC2D_safe_free(rc2d_shaderwatcher.frame);
+    rc2d_shaderwatcher.frame_count = 0;
+}
+
+#endif // RC2D_GPU_SHADER_HOT_RELOAD_ENABLED
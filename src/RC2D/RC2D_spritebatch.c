@@ -0,0 +1,650 @@
+#include <RC2D/RC2D_gpu.h>
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_assert.h>
+#include <RC2D/RC2D_logger.h>
+#include <RC2D/RC2D_memory.h>
+
+#include <SDL3/SDL_gpu.h>
+#include <SDL3/SDL_stdinc.h>
+
+/**
+ * Capacité initiale du batch (en sprites), doublée à chaque dépassement.
+ */
+#define RC2D_SPRITEBATCH_INITIAL_CAPACITY 1024
+
+/**
+ * Sprite en attente : état de rendu (clé de tri) + ordre d'ajout.
+ * Les 4 vertices du sprite sont stockés à l'index `seq` du tableau de vertices.
+ */
+typedef struct RC2D_SpriteBatchItem {
+    int layer;
+    Uint32 seq;
+    RC2D_GPUGraphicsPipeline* pipeline;
+    SDL_GPUTexture* texture;
+    SDL_GPUSampler* sampler;
+} RC2D_SpriteBatchItem;
+
+/**
+ * Liste de commandes de dessin d'une frame : sprites enregistrés pendant rc2d_draw, traduits en appels
+ * SDL_GPU par rc2d_gpu_flushSprites.
+ */
+typedef struct RC2D_SpriteBatchList {
+    RC2D_SpriteBatchItem* items;
+    RC2D_GPUSpriteVertex* vertices;
+    Uint32 count;
+    Uint32 capacity;
+    bool needs_sort;
+
+    // Statistiques de l'encodage de la liste
+    RC2D_GPUBatchStats stats;
+} RC2D_SpriteBatchList;
+
+/**
+ * État du sprite batch de la frame.
+ */
+static struct {
+    RC2D_SpriteBatchList list;
+
+    // Nombre de sprites en cours d'encodage (entre rc2d_gpu_spriteBatchBeginEncode et rc2d_gpu_spriteBatchEndEncode)
+    Uint32 encode_count;
+
+    // État courant des prochains sprites
+    int layer;
+    RC2D_GPUGraphicsPipeline* pipeline;
+
+    // Ressources GPU, agrandies à la demande
+    SDL_GPUBuffer* vertex_buffer;
+    SDL_GPUBuffer* index_buffer;
+    SDL_GPUTransferBuffer* transfer_buffer;
+    Uint32 gpu_capacity;
+
+    // Ressources par défaut
+    RC2D_GPUGraphicsPipeline default_pipeline;
+    SDL_GPUColorTargetDescription default_color_target;
+    SDL_GPUVertexBufferDescription default_vertex_buffer;
+    SDL_GPUVertexAttribute default_vertex_attributes[3];
+    bool default_pipeline_failed;
+    SDL_GPUSampler* default_sampler;
+    RC2D_Image white_image;
+
+    // Statistiques de la dernière liste encodée
+    RC2D_GPUBatchStats last_stats;
+} rc2d_spritebatch = {0};
+
+/**
+ * Ordre de dessin : layer, puis ordre d'ajout. L'état de rendu n'entre pas dans le tri : réordonner des sprites
+ * de textures différentes qui se chevauchent changerait l'image (ordre du peintre). Seules les suites de sprites
+ * consécutifs de même état sont regroupées dans une draw call.
+ */
+static int rc2d_spritebatch_compareItems(const void* a, const void* b)
+{
+    const RC2D_SpriteBatchItem* itemA = (const RC2D_SpriteBatchItem*)a;
+    const RC2D_SpriteBatchItem* itemB = (const RC2D_SpriteBatchItem*)b;
+
+    if (itemA->layer != itemB->layer) return itemA->layer < itemB->layer ? -1 : 1;
+    return itemA->seq < itemB->seq ? -1 : (itemA->seq > itemB->seq ? 1 : 0);
+}
+
+static bool rc2d_spritebatch_sameState(const RC2D_SpriteBatchItem* a, const RC2D_SpriteBatchItem* b)
+{
+    return a->pipeline == b->pipeline && a->texture == b->texture && a->sampler == b->sampler;
+}
+
+/**
+ * Sampler par défaut : nearest en mode pixel art, linéaire sinon.
+ */
+static SDL_GPUSampler* rc2d_spritebatch_getDefaultSampler(void)
+{
+    if (rc2d_spritebatch.default_sampler == NULL)
+    {
+        SDL_GPUFilter filter = rc2d_engine_state.config->pixelartMode ? SDL_GPU_FILTER_NEAREST : SDL_GPU_FILTER_LINEAR;
+        SDL_GPUSamplerCreateInfo samplerInfo = {
+            .min_filter = filter,
+            .mag_filter = filter,
+            .mipmap_mode = SDL_GPU_SAMPLERMIPMAPMODE_NEAREST,
+            .address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+            .address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+            .address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE
+        };
+        rc2d_spritebatch.default_sampler = SDL_CreateGPUSampler(rc2d_gpu_getDevice(), &samplerInfo);
+        if (rc2d_spritebatch.default_sampler == NULL)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "Failed to create default sprite sampler: %s", SDL_GetError());
+        }
+    }
+
+    return rc2d_spritebatch.default_sampler;
+}
+
+/**
+ * Texture blanche 1x1, utilisée pour les formes pleines (rc2d_gpu_drawRectangle).
+ */
+static RC2D_Image* rc2d_spritebatch_getWhiteImage(void)
+{
+    if (rc2d_spritebatch.white_image.texture == NULL)
+    {
+        SDL_GPUTextureCreateInfo textureInfo = {
+            .type = SDL_GPU_TEXTURETYPE_2D,
+            .format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
+            .usage = SDL_GPU_TEXTUREUSAGE_SAMPLER,
+            .width = 1,
+            .height = 1,
+            .layer_count_or_depth = 1,
+            .num_levels = 1,
+            .sample_count = SDL_GPU_SAMPLECOUNT_1
+        };
+        SDL_GPUTexture* texture = SDL_CreateGPUTexture(rc2d_gpu_getDevice(), &textureInfo);
+        if (texture == NULL)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "Failed to create white texture: %s", SDL_GetError());
+            return NULL;
+        }
+
+        RC2D_GPUUploadAllocation allocation;
+        if (!rc2d_gpu_beginUpload(4, 512, &allocation))
+        {
+            SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), texture);
+            return NULL;
+        }
+        SDL_memset(allocation.data, 0xFF, 4);
+
+        SDL_GPUTextureRegion region = { .texture = texture, .w = 1, .h = 1, .d = 1 };
+        rc2d_gpu_endUploadToTexture(&allocation, 0, &region, 1, 1);
+
+        rc2d_spritebatch.white_image.texture = texture;
+        rc2d_spritebatch.white_image.width = 1;
+        rc2d_spritebatch.white_image.height = 1;
+    }
+
+    return &rc2d_spritebatch.white_image;
+}
+
+/**
+ * Pipeline par défaut (shaders rc2d_sprite.vertex / rc2d_sprite.fragment, blending alpha).
+ * Il est enregistré comme les pipelines utilisateur, il profite donc du rechargement à chaud.
+ */
+static RC2D_GPUGraphicsPipeline* rc2d_spritebatch_getDefaultPipeline(void)
+{
+    if (rc2d_spritebatch.default_pipeline.pipeline != NULL) return &rc2d_spritebatch.default_pipeline;
+    if (rc2d_spritebatch.default_pipeline_failed) return NULL;
+
+    RC2D_GPUShader* vertexShader = rc2d_gpu_loadGraphicsShader("rc2d_sprite.vertex");
+    RC2D_GPUShader* fragmentShader = rc2d_gpu_loadGraphicsShader("rc2d_sprite.fragment");
+    if (vertexShader == NULL || fragmentShader == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to load default sprite shaders, sprites without a custom pipeline will be skipped");
+        rc2d_spritebatch.default_pipeline_failed = true;
+        return NULL;
+    }
+
+    rc2d_spritebatch.default_vertex_buffer = (SDL_GPUVertexBufferDescription){
+        .slot = 0,
+        .pitch = sizeof(RC2D_GPUSpriteVertex),
+        .input_rate = SDL_GPU_VERTEXINPUTRATE_VERTEX,
+        .instance_step_rate = 0
+    };
+
+    rc2d_spritebatch.default_vertex_attributes[0] = (SDL_GPUVertexAttribute){ 0, 0, SDL_GPU_VERTEXELEMENTFORMAT_FLOAT2, offsetof(RC2D_GPUSpriteVertex, x) };
+    rc2d_spritebatch.default_vertex_attributes[1] = (SDL_GPUVertexAttribute){ 1, 0, SDL_GPU_VERTEXELEMENTFORMAT_FLOAT2, offsetof(RC2D_GPUSpriteVertex, u) };
+    rc2d_spritebatch.default_vertex_attributes[2] = (SDL_GPUVertexAttribute){ 2, 0, SDL_GPU_VERTEXELEMENTFORMAT_UBYTE4_NORM, offsetof(RC2D_GPUSpriteVertex, color) };
+
+    rc2d_spritebatch.default_color_target = (SDL_GPUColorTargetDescription){
+        .format = rc2d_gpu_getColorTargetFormat(),
+        .blend_state = {
+            .src_color_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA,
+            .dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+            .color_blend_op = SDL_GPU_BLENDOP_ADD,
+            .src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE,
+            .dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+            .alpha_blend_op = SDL_GPU_BLENDOP_ADD,
+            .enable_blend = true
+        }
+    };
+
+    rc2d_spritebatch.default_pipeline.create_info = (SDL_GPUGraphicsPipelineCreateInfo){
+        .vertex_shader = vertexShader,
+        .fragment_shader = fragmentShader,
+        .vertex_input_state = {
+            .vertex_buffer_descriptions = &rc2d_spritebatch.default_vertex_buffer,
+            .num_vertex_buffers = 1,
+            .vertex_attributes = rc2d_spritebatch.default_vertex_attributes,
+            .num_vertex_attributes = 3
+        },
+        .primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+        .rasterizer_state = {
+            .fill_mode = SDL_GPU_FILLMODE_FILL,
+            .cull_mode = SDL_GPU_CULLMODE_NONE,
+            .front_face = SDL_GPU_FRONTFACE_COUNTER_CLOCKWISE
+        },
+        .multisample_state = {
+            // Même nombre d'échantillons que la cible du render pass de la frame (MSAA)
+            .sample_count = rc2d_gpu_getSampleCount()
+        },
+        .target_info = {
+            .color_target_descriptions = &rc2d_spritebatch.default_color_target,
+            .num_color_targets = 1,
+            .has_depth_stencil_target = false
+        }
+    };
+    rc2d_spritebatch.default_pipeline.debug_name = "RC2D_SpriteBatchPipeline";
+    rc2d_spritebatch.default_pipeline.vertex_shader_filename = "rc2d_sprite.vertex";
+    rc2d_spritebatch.default_pipeline.fragment_shader_filename = "rc2d_sprite.fragment";
+
+    if (!rc2d_gpu_createGraphicsPipeline(&rc2d_spritebatch.default_pipeline))
+    {
+        rc2d_spritebatch.default_pipeline_failed = true;
+        return NULL;
+    }
+
+    return &rc2d_spritebatch.default_pipeline;
+}
+
+/**
+ * Agrandit les tableaux CPU d'une liste si nécessaire.
+ */
+static bool rc2d_spritebatch_reserve(RC2D_SpriteBatchList* list, Uint32 count)
+{
+    if (count <= list->capacity) return true;
+
+    Uint32 capacity = list->capacity ? list->capacity : RC2D_SPRITEBATCH_INITIAL_CAPACITY;
+    while (capacity < count) capacity *= 2;
+
+    RC2D_SpriteBatchItem* items = RC2D_realloc(list->items, capacity * sizeof(RC2D_SpriteBatchItem));
+    if (items == NULL) return false;
+    list->items = items;
+
+    RC2D_GPUSpriteVertex* vertices = RC2D_realloc(list->vertices, capacity * 4 * sizeof(RC2D_GPUSpriteVertex));
+    if (vertices == NULL) return false;
+    list->vertices = vertices;
+
+    list->capacity = capacity;
+    return true;
+}
+
+/**
+ * Agrandit le vertex buffer, l'index buffer et le buffer de transfert GPU si nécessaire.
+ * Les indices (statiques) sont envoyés via le ring d'upload.
+ */
+static bool rc2d_spritebatch_reserveGPU(Uint32 count)
+{
+    if (count <= rc2d_spritebatch.gpu_capacity) return true;
+
+    Uint32 capacity = rc2d_spritebatch.gpu_capacity ? rc2d_spritebatch.gpu_capacity : RC2D_SPRITEBATCH_INITIAL_CAPACITY;
+    while (capacity < count) capacity *= 2;
+
+    const Uint32 vertexSize = capacity * 4 * sizeof(RC2D_GPUSpriteVertex);
+    const Uint32 indexSize = capacity * 6 * sizeof(Uint32);
+
+    SDL_GPUBuffer* vertexBuffer = SDL_CreateGPUBuffer(rc2d_gpu_getDevice(), &(SDL_GPUBufferCreateInfo){
+        .usage = SDL_GPU_BUFFERUSAGE_VERTEX,
+        .size = vertexSize
+    });
+    SDL_GPUBuffer* indexBuffer = SDL_CreateGPUBuffer(rc2d_gpu_getDevice(), &(SDL_GPUBufferCreateInfo){
+        .usage = SDL_GPU_BUFFERUSAGE_INDEX,
+        .size = indexSize
+    });
+    SDL_GPUTransferBuffer* transferBuffer = SDL_CreateGPUTransferBuffer(rc2d_gpu_getDevice(), &(SDL_GPUTransferBufferCreateInfo){
+        .usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+        .size = vertexSize
+    });
+
+    RC2D_GPUUploadAllocation allocation;
+    if (!vertexBuffer || !indexBuffer || !transferBuffer || !rc2d_gpu_beginUpload(indexSize, 4, &allocation))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to grow sprite batch GPU buffers to %u sprites: %s", capacity, SDL_GetError());
+        if (vertexBuffer) SDL_ReleaseGPUBuffer(rc2d_gpu_getDevice(), vertexBuffer);
+        if (indexBuffer) SDL_ReleaseGPUBuffer(rc2d_gpu_getDevice(), indexBuffer);
+        if (transferBuffer) SDL_ReleaseGPUTransferBuffer(rc2d_gpu_getDevice(), transferBuffer);
+        return false;
+    }
+
+    // Deux triangles par quad : (0, 1, 2) et (2, 1, 3)
+    Uint32* indices = (Uint32*)allocation.data;
+    for (Uint32 i = 0; i < capacity; i++)
+    {
+        indices[i * 6 + 0] = i * 4 + 0;
+        indices[i * 6 + 1] = i * 4 + 1;
+        indices[i * 6 + 2] = i * 4 + 2;
+        indices[i * 6 + 3] = i * 4 + 2;
+        indices[i * 6 + 4] = i * 4 + 1;
+        indices[i * 6 + 5] = i * 4 + 3;
+    }
+    rc2d_gpu_endUploadToBuffer(&allocation, 0, indexBuffer, 0, indexSize);
+
+    // Les indices doivent être disponibles pour le command buffer de cette frame
+    rc2d_gpu_flushUploads();
+
+    // SDL garde les anciens buffers en vie jusqu'à la fin des commandes qui les utilisent
+    if (rc2d_spritebatch.vertex_buffer) SDL_ReleaseGPUBuffer(rc2d_gpu_getDevice(), rc2d_spritebatch.vertex_buffer);
+    if (rc2d_spritebatch.index_buffer) SDL_ReleaseGPUBuffer(rc2d_gpu_getDevice(), rc2d_spritebatch.index_buffer);
+    if (rc2d_spritebatch.transfer_buffer) SDL_ReleaseGPUTransferBuffer(rc2d_gpu_getDevice(), rc2d_spritebatch.transfer_buffer);
+
+    rc2d_spritebatch.vertex_buffer = vertexBuffer;
+    rc2d_spritebatch.index_buffer = indexBuffer;
+    rc2d_spritebatch.transfer_buffer = transferBuffer;
+    rc2d_spritebatch.gpu_capacity = capacity;
+    return true;
+}
+
+void rc2d_gpu_setLayer(int layer)
+{
+    rc2d_spritebatch.layer = layer;
+}
+
+void rc2d_gpu_setSpritePipeline(RC2D_GPUGraphicsPipeline* graphicsPipeline)
+{
+    rc2d_spritebatch.pipeline = graphicsPipeline;
+}
+
+void rc2d_gpu_drawQuad(RC2D_Image* image, float x, float y, float width, float height, float u0, float v0, float u1, float v1)
+{
+    RC2D_assert_release(image != NULL, RC2D_LOG_CRITICAL, "image is NULL");
+
+    if (rc2d_engine_state.skip_rendering) return;
+
+    // Images du cache : dates d'utilisation pour l'éviction LRU, et rechargement si la texture a été évincée
+    if (image->entry != NULL) rc2d_gpu_useImage(image);
+
+    if (image->texture == NULL) return;
+
+    // Image de l'atlas : les UV de l'image sont ramenées à sa zone dans la page
+    const RC2D_AtlasRegion* region = image->atlas_region;
+    if (region != NULL)
+    {
+        const float regionWidth = region->u1 - region->u0;
+        const float regionHeight = region->v1 - region->v0;
+        u0 = region->u0 + u0 * regionWidth;
+        u1 = region->u0 + u1 * regionWidth;
+        v0 = region->v0 + v0 * regionHeight;
+        v1 = region->v0 + v1 * regionHeight;
+    }
+
+    RC2D_SpriteBatchList* list = &rc2d_spritebatch.list;
+    if (!rc2d_spritebatch_reserve(list, list->count + 1))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to grow sprite batch, sprite skipped");
+        return;
+    }
+
+    Uint32 seq = list->count++;
+
+    RC2D_SpriteBatchItem* item = &list->items[seq];
+    item->layer = rc2d_spritebatch.layer;
+    item->seq = seq;
+    item->pipeline = rc2d_spritebatch.pipeline;
+    item->texture = image->texture;
+    item->sampler = image->sampler;
+
+    // Le tri n'est nécessaire que si un sprite est ajouté dans un layer inférieur au précédent
+    if (seq > 0 && rc2d_spritebatch_compareItems(&list->items[seq - 1], item) > 0)
+    {
+        list->needs_sort = true;
+    }
+
+    RC2D_Color color = rc2d_gpu_getColor();
+    RC2D_GPUSpriteVertex* vertices = &list->vertices[seq * 4];
+    vertices[0] = (RC2D_GPUSpriteVertex){ x,         y,          u0, v0, color };
+    vertices[1] = (RC2D_GPUSpriteVertex){ x + width, y,          u1, v0, color };
+    vertices[2] = (RC2D_GPUSpriteVertex){ x,         y + height, u0, v1, color };
+    vertices[3] = (RC2D_GPUSpriteVertex){ x + width, y + height, u1, v1, color };
+}
+
+void rc2d_gpu_drawImage(RC2D_Image* image, float x, float y)
+{
+    RC2D_assert_release(image != NULL, RC2D_LOG_CRITICAL, "image is NULL");
+    rc2d_gpu_drawQuad(image, x, y, (float)image->width, (float)image->height, 0.0f, 0.0f, 1.0f, 1.0f);
+}
+
+void rc2d_gpu_drawRectangle(RC2D_DrawMode mode, float x, float y, float width, float height)
+{
+    RC2D_Image* white = rc2d_spritebatch_getWhiteImage();
+    if (white == NULL) return;
+
+    if (mode == RC2D_DRAWMODE_FILL)
+    {
+        rc2d_gpu_drawQuad(white, x, y, width, height, 0.0f, 0.0f, 1.0f, 1.0f);
+    }
+    else
+    {
+        // Contour de 1 pixel : 4 quads fins, regroupés dans la même draw call
+        rc2d_gpu_drawQuad(white, x, y, width, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f);
+        rc2d_gpu_drawQuad(white, x, y + height - 1.0f, width, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f);
+        rc2d_gpu_drawQuad(white, x, y + 1.0f, 1.0f, height - 2.0f, 0.0f, 0.0f, 1.0f, 1.0f);
+        rc2d_gpu_drawQuad(white, x + width - 1.0f, y + 1.0f, 1.0f, height - 2.0f, 0.0f, 0.0f, 1.0f, 1.0f);
+    }
+}
+
+/**
+ * Crée les ressources par défaut utilisées par la liste (sampler, pipeline). Thread principal uniquement :
+ * la création d'un pipeline l'enregistre pour le rechargement à chaud.
+ */
+static void rc2d_spritebatch_prepare(const RC2D_SpriteBatchList* list)
+{
+    rc2d_spritebatch_getDefaultSampler();
+    for (Uint32 i = 0; i < list->count; i++)
+    {
+        if (list->items[i].pipeline == NULL)
+        {
+            rc2d_spritebatch_getDefaultPipeline();
+            break;
+        }
+    }
+}
+
+void rc2d_gpu_flushSprites(void)
+{
+    RC2D_SpriteBatchList* list = &rc2d_spritebatch.list;
+    if (list->count == 0) return;
+
+    if (rc2d_engine_state.skip_rendering || rc2d_engine_state.gpu_current_command_buffer == NULL || rc2d_engine_state.gpu_current_render_pass == NULL)
+    {
+        list->count = 0;
+        list->needs_sort = false;
+        return;
+    }
+
+    RC2D_GPUSpriteVertex* vertices = rc2d_gpu_spriteBatchBeginEncode();
+    if (vertices == NULL) return;
+
+    rc2d_gpu_spriteBatchBuild(vertices);
+    rc2d_gpu_spriteBatchEndEncode(
+        rc2d_engine_state.gpu_current_command_buffer,
+        &rc2d_engine_state.gpu_current_render_pass,
+        &rc2d_engine_state.gpu_current_color_target,
+        rc2d_engine_state.gpu_current_viewport
+    );
+}
+
+RC2D_GPUSpriteVertex* rc2d_gpu_spriteBatchBeginEncode(void)
+{
+    RC2D_SpriteBatchList* list = &rc2d_spritebatch.list;
+    const Uint32 count = list->count;
+    if (count == 0) return NULL;
+
+    rc2d_spritebatch_prepare(list);
+
+    if (!rc2d_spritebatch_reserveGPU(count) || rc2d_spritebatch.default_sampler == NULL)
+    {
+        list->count = 0;
+        list->needs_sort = false;
+        return NULL;
+    }
+
+    /**
+     * Le buffer de transfert est cyclé : SDL en fournit un nouveau si le GPU lit encore celui de la frame précédente.
+     */
+    RC2D_GPUSpriteVertex* mapped = (RC2D_GPUSpriteVertex*)SDL_MapGPUTransferBuffer(rc2d_gpu_getDevice(), rc2d_spritebatch.transfer_buffer, true);
+    if (mapped == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to map sprite batch transfer buffer: %s", SDL_GetError());
+        list->count = 0;
+        list->needs_sort = false;
+        return NULL;
+    }
+
+    rc2d_spritebatch.encode_count = count;
+    return mapped;
+}
+
+void rc2d_gpu_spriteBatchBuild(RC2D_GPUSpriteVertex* vertices)
+{
+    RC2D_SpriteBatchList* list = &rc2d_spritebatch.list;
+    const Uint32 count = rc2d_spritebatch.encode_count;
+
+    /**
+     * \brief Étape 1 : Tri des sprites par (layer, ordre d'ajout)
+     */
+    if (list->needs_sort && count > 1)
+    {
+        SDL_qsort(list->items, count, sizeof(RC2D_SpriteBatchItem), rc2d_spritebatch_compareItems);
+    }
+    list->needs_sort = false;
+
+    /**
+     * \brief Étape 2 : Écriture des vertices dans l'ordre de dessin
+     */
+    for (Uint32 i = 0; i < count; i++)
+    {
+        SDL_memcpy(&vertices[i * 4], &list->vertices[list->items[i].seq * 4], 4 * sizeof(RC2D_GPUSpriteVertex));
+    }
+}
+
+void rc2d_gpu_spriteBatchEndEncode(SDL_GPUCommandBuffer* commandBuffer, SDL_GPURenderPass** renderPass,
+                                   const SDL_GPUColorTargetInfo* colorTarget, const SDL_GPUViewport* viewport)
+{
+    RC2D_SpriteBatchList* list = &rc2d_spritebatch.list;
+    const Uint32 count = rc2d_spritebatch.encode_count;
+    if (count == 0) return;
+
+    SDL_UnmapGPUTransferBuffer(rc2d_gpu_getDevice(), rc2d_spritebatch.transfer_buffer);
+    rc2d_spritebatch.encode_count = 0;
+    list->count = 0;
+
+    // Frame sautée : les vertices écrits sont abandonnés
+    if (commandBuffer == NULL || renderPass == NULL || *renderPass == NULL) return;
+
+    // Ressources par défaut déjà créées par rc2d_gpu_spriteBatchBeginEncode
+    RC2D_GPUGraphicsPipeline* defaultPipeline = rc2d_spritebatch.default_pipeline.pipeline ? &rc2d_spritebatch.default_pipeline : NULL;
+    SDL_GPUSampler* defaultSampler = rc2d_spritebatch.default_sampler;
+
+    /**
+     * \brief Étape 3 : Copie vers le vertex buffer
+     *
+     * Une copy pass ne peut pas être encodée dans un render pass : on termine le render pass courant,
+     * puis on le reprend en conservant son contenu (LOADOP_LOAD, sans cycle).
+     */
+    SDL_EndGPURenderPass(*renderPass);
+    *renderPass = NULL;
+
+    SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(commandBuffer);
+    SDL_UploadToGPUBuffer(
+        copyPass,
+        &(SDL_GPUTransferBufferLocation){ .transfer_buffer = rc2d_spritebatch.transfer_buffer, .offset = 0 },
+        &(SDL_GPUBufferRegion){ .buffer = rc2d_spritebatch.vertex_buffer, .offset = 0, .size = count * 4 * sizeof(RC2D_GPUSpriteVertex) },
+        true
+    );
+    SDL_EndGPUCopyPass(copyPass);
+
+    SDL_GPUColorTargetInfo colorTargetInfo = *colorTarget;
+    colorTargetInfo.load_op = SDL_GPU_LOADOP_LOAD;
+    colorTargetInfo.cycle = false;
+    colorTargetInfo.cycle_resolve_texture = false;
+
+    *renderPass = SDL_BeginGPURenderPass(commandBuffer, &colorTargetInfo, 1, NULL);
+    RC2D_assert_release(*renderPass != NULL, RC2D_LOG_CRITICAL, "Failed to resume GPU render pass");
+    SDL_SetGPUViewport(*renderPass, viewport);
+
+    /**
+     * \brief Étape 4 : Une draw call par suite de sprites partageant le même état
+     */
+    SDL_BindGPUVertexBuffers(*renderPass, 0, &(SDL_GPUBufferBinding){ .buffer = rc2d_spritebatch.vertex_buffer, .offset = 0 }, 1);
+    SDL_BindGPUIndexBuffer(*renderPass, &(SDL_GPUBufferBinding){ .buffer = rc2d_spritebatch.index_buffer, .offset = 0 }, SDL_GPU_INDEXELEMENTSIZE_32BIT);
+
+    // Pixels logiques (origine en haut à gauche) vers NDC
+    const float transform[4] = {
+        2.0f / (float)rc2d_engine_state.config->logicalWidth,
+        -2.0f / (float)rc2d_engine_state.config->logicalHeight,
+        -1.0f,
+        1.0f
+    };
+
+    SDL_GPUGraphicsPipeline* boundPipeline = NULL;
+    Uint32 runStart = 0;
+    while (runStart < count)
+    {
+        const RC2D_SpriteBatchItem* first = &list->items[runStart];
+        Uint32 runEnd = runStart + 1;
+        while (runEnd < count && rc2d_spritebatch_sameState(first, &list->items[runEnd])) runEnd++;
+
+        RC2D_GPUGraphicsPipeline* pipeline = first->pipeline ? first->pipeline : defaultPipeline;
+        if (pipeline != NULL && pipeline->pipeline != NULL)
+        {
+            if (pipeline->pipeline != boundPipeline)
+            {
+                SDL_BindGPUGraphicsPipeline(*renderPass, pipeline->pipeline);
+                SDL_PushGPUVertexUniformData(commandBuffer, 0, transform, sizeof(transform));
+                boundPipeline = pipeline->pipeline;
+                list->stats.pipeline_bind_count++;
+            }
+
+            SDL_GPUTextureSamplerBinding binding = {
+                .texture = first->texture,
+                .sampler = first->sampler ? first->sampler : defaultSampler
+            };
+            SDL_BindGPUFragmentSamplers(*renderPass, 0, &binding, 1);
+
+            SDL_DrawGPUIndexedPrimitives(*renderPass, (runEnd - runStart) * 6, 1, runStart * 6, 0, 0);
+            list->stats.draw_call_count++;
+            list->stats.sprite_count += runEnd - runStart;
+        }
+
+        runStart = runEnd;
+    }
+
+    list->stats.flush_count++;
+}
+
+void rc2d_gpu_getBatchStats(RC2D_GPUBatchStats* stats)
+{
+    RC2D_assert_release(stats != NULL, RC2D_LOG_CRITICAL, "stats is NULL");
+    *stats = rc2d_spritebatch.last_stats;
+}
+
+void rc2d_gpu_spriteBatchNewFrame(void)
+{
+    RC2D_SpriteBatchList* list = &rc2d_spritebatch.list;
+    rc2d_spritebatch.last_stats = list->stats;
+    SDL_zero(list->stats);
+
+    // Les sprites d'une frame sautée (fenêtre minimisée) sont abandonnés
+    list->count = 0;
+    list->needs_sort = false;
+    rc2d_spritebatch.layer = 0;
+}
+
+void rc2d_gpu_spriteBatchQuit(void)
+{
+    if (rc2d_spritebatch.vertex_buffer) SDL_ReleaseGPUBuffer(rc2d_gpu_getDevice(), rc2d_spritebatch.vertex_buffer);
+    if (rc2d_spritebatch.index_buffer) SDL_ReleaseGPUBuffer(rc2d_gpu_getDevice(), rc2d_spritebatch.index_buffer);
+    if (rc2d_spritebatch.transfer_buffer) SDL_ReleaseGPUTransferBuffer(rc2d_gpu_getDevice(), rc2d_spritebatch.transfer_buffer);
+    if (rc2d_spritebatch.default_sampler) SDL_ReleaseGPUSampler(rc2d_gpu_getDevice(), rc2d_spritebatch.default_sampler);
+    if (rc2d_spritebatch.white_image.texture) SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), rc2d_spritebatch.white_image.texture);
+
+    if (rc2d_spritebatch.default_pipeline.pipeline)
+    {
+        SDL_ReleaseGPUGraphicsPipeline(rc2d_gpu_getDevice(), rc2d_spritebatch.default_pipeline.pipeline);
+    }
+    if (rc2d_spritebatch.default_pipeline.create_info.vertex_shader)
+    {
+        SDL_ReleaseGPUShader(rc2d_gpu_getDevice(), rc2d_spritebatch.default_pipeline.create_info.vertex_shader);
+    }
+    if (rc2d_spritebatch.default_pipeline.create_info.fragment_shader)
+    {
+        SDL_ReleaseGPUShader(rc2d_gpu_getDevice(), rc2d_spritebatch.default_pipeline.create_info.fragment_shader);
+    }
+
+    RC2D_safe_free(rc2d_spritebatch.list.items);
+    RC2D_safe_free(rc2d_spritebatch.list.vertices);
+
+    SDL_zero(rc2d_spritebatch);
+}
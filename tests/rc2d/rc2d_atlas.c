@@ -0,0 +1,115 @@
+#include <RC2D/RC2D_atlas.h>
+#include <criterion/criterion.h>
+
+#define RC2D_TEST_ATLAS_MAX_RECTS 1024
+
+static bool rc2d_test_atlas_overlap(const RC2D_AtlasRect* a, const RC2D_AtlasRect* b)
+{
+    return a->x < b->x + b->width && b->x < a->x + a->width &&
+           a->y < b->y + b->height && b->y < a->y + a->height;
+}
+
+Test(rc2d_atlas, packsWithoutOverlapInsideBounds) {
+    RC2D_AtlasPacker* packer = rc2d_atlas_createPacker(1024, 1024);
+    cr_assert_not_null(packer);
+
+    static RC2D_AtlasRect rects[RC2D_TEST_ATLAS_MAX_RECTS];
+    int count = 0;
+    Uint64 area = 0;
+    Uint32 seed = 1234;
+
+    // Tailles pseudo-aléatoires jusqu'au premier échec
+    while (count < RC2D_TEST_ATLAS_MAX_RECTS)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        Uint32 width = 8 + (seed >> 8) % 120;
+        Uint32 height = 8 + (seed >> 20) % 120;
+        if (!rc2d_atlas_packerInsert(packer, width, height, &rects[count])) break;
+
+        cr_assert_eq(rects[count].width, width);
+        cr_assert_eq(rects[count].height, height);
+        area += (Uint64)width * height;
+        count++;
+    }
+
+    cr_assert_gt(count, 50);
+    cr_assert_eq(rc2d_atlas_getPackerUsedArea(packer), area);
+
+    for (int i = 0; i < count; i++)
+    {
+        cr_assert_leq(rects[i].x + rects[i].width, 1024);
+        cr_assert_leq(rects[i].y + rects[i].height, 1024);
+        for (int j = i + 1; j < count; j++)
+        {
+            cr_assert_not(rc2d_test_atlas_overlap(&rects[i], &rects[j]), "rects %d and %d overlap", i, j);
+        }
+    }
+
+    rc2d_atlas_destroyPacker(packer);
+}
+
+Test(rc2d_atlas, removedSpaceIsReused) {
+    RC2D_AtlasPacker* packer = rc2d_atlas_createPacker(256, 256);
+    cr_assert_not_null(packer);
+
+    RC2D_AtlasRect rects[16];
+    for (int i = 0; i < 16; i++)
+    {
+        cr_assert(rc2d_atlas_packerInsert(packer, 64, 64, &rects[i]));
+    }
+
+    RC2D_AtlasRect extra;
+    cr_assert_not(rc2d_atlas_packerInsert(packer, 64, 64, &extra));
+
+    rc2d_atlas_packerRemove(packer, &rects[5]);
+    cr_assert(rc2d_atlas_packerInsert(packer, 64, 64, &extra));
+    cr_assert_eq(extra.x, rects[5].x);
+    cr_assert_eq(extra.y, rects[5].y);
+
+    // Page entièrement libérée : elle redevient un seul rectangle libre
+    rects[5] = extra;
+    for (int i = 0; i < 16; i++)
+    {
+        rc2d_atlas_packerRemove(packer, &rects[i]);
+    }
+    cr_assert_eq(rc2d_atlas_getPackerUsedArea(packer), 0);
+    cr_assert(rc2d_atlas_packerInsert(packer, 256, 256, &extra));
+
+    rc2d_atlas_destroyPacker(packer);
+}
+
+Test(rc2d_atlas, mergesFreedNeighbours) {
+    RC2D_AtlasPacker* packer = rc2d_atlas_createPacker(128, 128);
+    cr_assert_not_null(packer);
+
+    RC2D_AtlasRect rects[4];
+    for (int i = 0; i < 4; i++)
+    {
+        cr_assert(rc2d_atlas_packerInsert(packer, 64, 64, &rects[i]));
+    }
+
+    // Libère deux zones voisines sur la même rangée : une zone deux fois plus large doit tenir
+    int first = -1, second = -1;
+    for (int i = 0; i < 4 && second < 0; i++)
+    {
+        for (int j = i + 1; j < 4; j++)
+        {
+            if (rects[i].y == rects[j].y)
+            {
+                first = i;
+                second = j;
+                break;
+            }
+        }
+    }
+    cr_assert_geq(first, 0);
+
+    rc2d_atlas_packerRemove(packer, &rects[first]);
+    rc2d_atlas_packerRemove(packer, &rects[second]);
+
+    RC2D_AtlasRect wide;
+    cr_assert(rc2d_atlas_packerInsert(packer, 128, 64, &wide));
+    cr_assert_eq(wide.y, rects[first].y);
+
+    rc2d_atlas_destroyPacker(packer);
+}
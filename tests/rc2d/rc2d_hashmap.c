@@ -0,0 +1,120 @@
+#include <RC2D/RC2D_hashmap.h>
+#include <criterion/criterion.h>
+#include <criterion/logging.h>
+
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_thread.h>
+#include <SDL3/SDL_timer.h>
+
+#define RC2D_TEST_HASHMAP_KEY_COUNT 4000
+
+static void rc2d_test_hashmap_makeKey(char *buffer, size_t size, int i)
+{
+    SDL_snprintf(buffer, size, "shaders/src/shader_%d.fragment", i);
+}
+
+Test(rc2d_hashmap, putGetAndGrow) {
+    RC2D_HashMap *map = rc2d_hashmap_create(4);
+    cr_assert_not_null(map);
+
+    char key[64];
+    for (int i = 0; i < RC2D_TEST_HASHMAP_KEY_COUNT; i++)
+    {
+        rc2d_test_hashmap_makeKey(key, sizeof(key), i);
+        cr_assert(rc2d_hashmap_put(map, key, (void *)(uintptr_t)(i + 1)));
+    }
+    cr_assert_eq(rc2d_hashmap_count(map), RC2D_TEST_HASHMAP_KEY_COUNT);
+
+    for (int i = 0; i < RC2D_TEST_HASHMAP_KEY_COUNT; i++)
+    {
+        rc2d_test_hashmap_makeKey(key, sizeof(key), i);
+        cr_assert_eq((uintptr_t)rc2d_hashmap_get(map, key), (uintptr_t)(i + 1));
+    }
+    cr_assert_null(rc2d_hashmap_get(map, "shaders/src/missing.vertex"));
+
+    // Remplacement : pas de nouvelle entrée
+    cr_assert(rc2d_hashmap_put(map, "shaders/src/shader_7.fragment", (void *)(uintptr_t)42));
+    cr_assert_eq((uintptr_t)rc2d_hashmap_get(map, "shaders/src/shader_7.fragment"), 42);
+    cr_assert_eq(rc2d_hashmap_count(map), RC2D_TEST_HASHMAP_KEY_COUNT);
+
+    rc2d_hashmap_destroy(map);
+}
+
+Test(rc2d_hashmap, hashKeysAreSeparateFromStringKeys) {
+    RC2D_HashMap *map = rc2d_hashmap_create(0);
+    cr_assert_not_null(map);
+
+    const char *key = "test.vertex";
+    Uint64 hash = rc2d_hashmap_hashString(key);
+
+    cr_assert(rc2d_hashmap_putByHash(map, hash, (void *)(uintptr_t)1));
+    cr_assert_null(rc2d_hashmap_get(map, key));
+
+    cr_assert(rc2d_hashmap_put(map, key, (void *)(uintptr_t)2));
+    cr_assert_eq((uintptr_t)rc2d_hashmap_getByHash(map, hash), 1);
+    cr_assert_eq((uintptr_t)rc2d_hashmap_get(map, key), 2);
+
+    rc2d_hashmap_destroy(map);
+}
+
+typedef struct RC2D_TestHashMapReader {
+    RC2D_HashMap *map;
+    SDL_AtomicInt *published;
+    SDL_AtomicInt *done;
+    int errors;
+} RC2D_TestHashMapReader;
+
+/**
+ * Lit sans verrou toutes les clés déjà publiées pendant que le thread principal insère (et agrandit la table).
+ */
+static int SDLCALL rc2d_test_hashmap_reader(void *data)
+{
+    RC2D_TestHashMapReader *reader = (RC2D_TestHashMapReader *)data;
+    char key[64];
+
+    while (!SDL_GetAtomicInt(reader->done))
+    {
+        int published = SDL_GetAtomicInt(reader->published);
+        for (int i = 0; i < published; i++)
+        {
+            rc2d_test_hashmap_makeKey(key, sizeof(key), i);
+            if ((uintptr_t)rc2d_hashmap_get(reader->map, key) != (uintptr_t)(i + 1)) reader->errors++;
+        }
+    }
+
+    return 0;
+}
+
+Test(rc2d_hashmap, lockFreeReadsDuringInsert) {
+    RC2D_HashMap *map = rc2d_hashmap_create(0);
+    cr_assert_not_null(map);
+
+    SDL_AtomicInt published = { 0 };
+    SDL_AtomicInt done = { 0 };
+    RC2D_TestHashMapReader readers[4];
+    SDL_Thread *threads[4];
+
+    for (int t = 0; t < 4; t++)
+    {
+        readers[t] = (RC2D_TestHashMapReader){ map, &published, &done, 0 };
+        threads[t] = SDL_CreateThread(rc2d_test_hashmap_reader, "rc2d_hashmap_reader", &readers[t]);
+        cr_assert_not_null(threads[t]);
+    }
+
+    char key[64];
+    for (int i = 0; i < RC2D_TEST_HASHMAP_KEY_COUNT; i++)
+    {
+        rc2d_test_hashmap_makeKey(key, sizeof(key), i);
+        cr_assert(rc2d_hashmap_put(map, key, (void *)(uintptr_t)(i + 1)));
+        SDL_SetAtomicInt(&published, i + 1);
+    }
+    SDL_SetAtomicInt(&done, 1);
+
+    for (int t = 0; t < 4; t++)
+    {
+        SDL_WaitThread(threads[t], NULL);
+        cr_assert_eq(readers[t].errors, 0);
+    }
+
+    rc2d_hashmap_destroy(map);
+}
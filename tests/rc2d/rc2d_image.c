@@ -0,0 +1,86 @@
+#include <RC2D/RC2D_internal.h>
+#include <criterion/criterion.h>
+
+#define RC2D_TEST_IMAGE_COUNT 8
+#define RC2D_TEST_IMAGE_BYTES 1024
+
+/**
+ * Images du cache sans texture : rc2d_gpu_selectImagesToEvict ne lit que leur état, leur âge et leur taille.
+ */
+static RC2D_Image rc2d_test_images[RC2D_TEST_IMAGE_COUNT];
+static RC2D_Image* rc2d_test_image_list[RC2D_TEST_IMAGE_COUNT];
+
+static void rc2d_test_image_setup(Uint64 lastUsed[RC2D_TEST_IMAGE_COUNT])
+{
+    for (int i = 0; i < RC2D_TEST_IMAGE_COUNT; i++)
+    {
+        rc2d_test_images[i] = (RC2D_Image){ 0 };
+        rc2d_test_images[i].state = RC2D_IMAGE_READY;
+        rc2d_test_images[i].bytes = RC2D_TEST_IMAGE_BYTES;
+        rc2d_test_images[i].last_used_frame = lastUsed[i];
+        rc2d_test_image_list[i] = &rc2d_test_images[i];
+    }
+}
+
+Test(rc2d_image, evictsLeastRecentlyUsedFirst) {
+    Uint64 lastUsed[RC2D_TEST_IMAGE_COUNT] = { 50, 10, 70, 30, 20, 60, 40, 0 };
+    rc2d_test_image_setup(lastUsed);
+
+    // Tout est candidat à la frame 100 : il faut libérer 3 images pour repasser sous le budget
+    const Uint64 resident = (Uint64)RC2D_TEST_IMAGE_COUNT * RC2D_TEST_IMAGE_BYTES;
+    const Uint32 count = rc2d_gpu_selectImagesToEvict(rc2d_test_image_list, RC2D_TEST_IMAGE_COUNT, 100,
+                                                      resident, resident - 3 * RC2D_TEST_IMAGE_BYTES);
+    cr_assert_eq(count, 3);
+    cr_assert_eq(rc2d_test_image_list[0], &rc2d_test_images[7]);
+    cr_assert_eq(rc2d_test_image_list[1], &rc2d_test_images[1]);
+    cr_assert_eq(rc2d_test_image_list[2], &rc2d_test_images[4]);
+
+    // Les candidates sont toutes rangées de la plus ancienne à la plus récente
+    for (int i = 1; i < RC2D_TEST_IMAGE_COUNT; i++)
+    {
+        cr_assert_leq(rc2d_test_image_list[i - 1]->last_used_frame, rc2d_test_image_list[i]->last_used_frame);
+    }
+}
+
+Test(rc2d_image, neverEvictsUnderBudget) {
+    Uint64 lastUsed[RC2D_TEST_IMAGE_COUNT] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    rc2d_test_image_setup(lastUsed);
+
+    const Uint64 resident = (Uint64)RC2D_TEST_IMAGE_COUNT * RC2D_TEST_IMAGE_BYTES;
+    cr_assert_eq(rc2d_gpu_selectImagesToEvict(rc2d_test_image_list, RC2D_TEST_IMAGE_COUNT, 100, resident, resident), 0);
+}
+
+Test(rc2d_image, keepsRecentlyDrawnImages) {
+    const Uint64 frame = 100;
+    Uint64 lastUsed[RC2D_TEST_IMAGE_COUNT] = {
+        frame, frame - 1, frame - RC2D_IMAGE_EVICTION_MIN_AGE, frame - RC2D_IMAGE_EVICTION_MIN_AGE - 1,
+        frame, frame - 1, frame - RC2D_IMAGE_EVICTION_MIN_AGE, frame - RC2D_IMAGE_EVICTION_MIN_AGE - 5
+    };
+    rc2d_test_image_setup(lastUsed);
+
+    // Budget nul : seules les images plus anciennes que RC2D_IMAGE_EVICTION_MIN_AGE frames sont évincées
+    const Uint64 resident = (Uint64)RC2D_TEST_IMAGE_COUNT * RC2D_TEST_IMAGE_BYTES;
+    const Uint32 count = rc2d_gpu_selectImagesToEvict(rc2d_test_image_list, RC2D_TEST_IMAGE_COUNT, frame, resident, 0);
+    cr_assert_eq(count, 2);
+    cr_assert_eq(rc2d_test_image_list[0], &rc2d_test_images[7]);
+    cr_assert_eq(rc2d_test_image_list[1], &rc2d_test_images[3]);
+}
+
+Test(rc2d_image, skipsImagesNotResidentOrInAtlas) {
+    Uint64 lastUsed[RC2D_TEST_IMAGE_COUNT] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    rc2d_test_image_setup(lastUsed);
+
+    RC2D_AtlasRegion region = { 0 };
+    rc2d_test_images[0].state = RC2D_IMAGE_LOADING;
+    rc2d_test_images[1].state = RC2D_IMAGE_EVICTED;
+    rc2d_test_images[2].state = RC2D_IMAGE_FAILED;
+    rc2d_test_images[3].atlas_region = &region;
+
+    const Uint64 resident = (Uint64)RC2D_TEST_IMAGE_COUNT * RC2D_TEST_IMAGE_BYTES;
+    const Uint32 count = rc2d_gpu_selectImagesToEvict(rc2d_test_image_list, RC2D_TEST_IMAGE_COUNT, 100, resident, 0);
+    cr_assert_eq(count, 4);
+    for (Uint32 i = 0; i < count; i++)
+    {
+        cr_assert_geq(rc2d_test_image_list[i] - rc2d_test_images, 4);
+    }
+}
@@ -0,0 +1,279 @@
+#include <RC2D/RC2D_job.h>
+#include <criterion/criterion.h>
+#include <criterion/logging.h>
+
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_init.h>
+#include <SDL3/SDL_thread.h>
+#include <SDL3/SDL_timer.h>
+
+#define RC2D_TEST_JOB_COUNT 1000
+#define RC2D_TEST_JOB_RANGE 100000
+
+static void rc2d_test_job_setup(void)
+{
+    cr_assert(rc2d_job_init(3, false));
+}
+
+static void rc2d_test_job_teardown(void)
+{
+    rc2d_job_quit();
+}
+
+static void rc2d_test_job_increment(void *data)
+{
+    SDL_AddAtomicInt((SDL_AtomicInt *)data, 1);
+}
+
+Test(rc2d_job, runAndWaitCounter, .init = rc2d_test_job_setup, .fini = rc2d_test_job_teardown) {
+    cr_assert_eq(rc2d_job_getWorkerCount(), 3);
+
+    SDL_AtomicInt done = {0};
+    RC2D_JobCounter counter = {0};
+    for (int i = 0; i < RC2D_TEST_JOB_COUNT; i++)
+    {
+        rc2d_job_run(rc2d_test_job_increment, &done, &counter);
+    }
+    rc2d_job_wait(&counter);
+
+    cr_assert(rc2d_job_isDone(&counter));
+    cr_assert_eq(SDL_GetAtomicInt(&done), RC2D_TEST_JOB_COUNT);
+}
+
+typedef struct RC2D_TestJobChain {
+    int steps[3];
+    SDL_AtomicInt order;
+} RC2D_TestJobChain;
+
+static RC2D_TestJobChain rc2d_test_job_chain;
+
+static void rc2d_test_job_recordOrder(void *data)
+{
+    int *slot = (int *)data;
+    *slot = SDL_AddAtomicInt(&rc2d_test_job_chain.order, 1);
+}
+
+Test(rc2d_job, runAfterDependencyChain, .init = rc2d_test_job_setup, .fini = rc2d_test_job_teardown) {
+    SDL_zero(rc2d_test_job_chain);
+
+    RC2D_JobCounter first = {0};
+    RC2D_JobCounter second = {0};
+    RC2D_JobCounter third = {0};
+
+    // Chaque étape ne démarre qu'une fois la précédente terminée, quel que soit le worker qui l'exécute
+    rc2d_job_run(rc2d_test_job_recordOrder, &rc2d_test_job_chain.steps[0], &first);
+    rc2d_job_runAfter(rc2d_test_job_recordOrder, &rc2d_test_job_chain.steps[1], &second, &first);
+    rc2d_job_runAfter(rc2d_test_job_recordOrder, &rc2d_test_job_chain.steps[2], &third, &second);
+    rc2d_job_wait(&third);
+
+    cr_assert(rc2d_job_isDone(&first));
+    cr_assert(rc2d_job_isDone(&second));
+
+    cr_assert_eq(rc2d_test_job_chain.steps[0], 0);
+    cr_assert_eq(rc2d_test_job_chain.steps[1], 1);
+    cr_assert_eq(rc2d_test_job_chain.steps[2], 2);
+}
+
+static void rc2d_test_job_sumRange(Uint32 start, Uint32 end, void *data)
+{
+    int sum = 0;
+    for (Uint32 i = start; i < end; i++)
+    {
+        sum += (int)i;
+    }
+    SDL_AddAtomicInt((SDL_AtomicInt *)data, sum);
+}
+
+static void rc2d_test_job_markRange(Uint32 start, Uint32 end, void *data)
+{
+    Uint8 *marks = (Uint8 *)data;
+    for (Uint32 i = start; i < end; i++)
+    {
+        marks[i]++;
+    }
+}
+
+Test(rc2d_job, parallelForCoversEveryIndexOnce, .init = rc2d_test_job_setup, .fini = rc2d_test_job_teardown) {
+    static Uint8 marks[RC2D_TEST_JOB_RANGE];
+    SDL_zeroa(marks);
+
+    rc2d_job_parallelFor(RC2D_TEST_JOB_RANGE, 0, rc2d_test_job_markRange, marks);
+    for (Uint32 i = 0; i < RC2D_TEST_JOB_RANGE; i++)
+    {
+        cr_assert_eq(marks[i], 1, "index %u executed %u times", i, marks[i]);
+    }
+
+    // Lots de taille imposée, dernier lot incomplet
+    SDL_zeroa(marks);
+    rc2d_job_parallelFor(RC2D_TEST_JOB_RANGE, 333, rc2d_test_job_markRange, marks);
+    for (Uint32 i = 0; i < RC2D_TEST_JOB_RANGE; i++)
+    {
+        cr_assert_eq(marks[i], 1, "index %u executed %u times", i, marks[i]);
+    }
+}
+
+static void rc2d_test_job_nested(void *data)
+{
+    SDL_AtomicInt *total = (SDL_AtomicInt *)data;
+    SDL_AtomicInt local = {0};
+
+    // parallelFor depuis un job : le worker exécute des lots pendant l'attente au lieu de bloquer
+    rc2d_job_parallelFor(1000, 10, rc2d_test_job_sumRange, &local);
+    SDL_AddAtomicInt(total, SDL_GetAtomicInt(&local));
+}
+
+Test(rc2d_job, nestedParallelForInsideJobs, .init = rc2d_test_job_setup, .fini = rc2d_test_job_teardown) {
+    SDL_AtomicInt total = {0};
+    RC2D_JobCounter counter = {0};
+    for (int i = 0; i < 64; i++)
+    {
+        rc2d_job_run(rc2d_test_job_nested, &total, &counter);
+    }
+    rc2d_job_wait(&counter);
+
+    // Somme de 0 à 999 = 499500, par job
+    cr_assert_eq(SDL_GetAtomicInt(&total), 64 * 499500);
+}
+
+static int SDLCALL rc2d_test_job_externalThread(void *data)
+{
+    SDL_AtomicInt *done = (SDL_AtomicInt *)data;
+    RC2D_JobCounter counter = {0};
+    for (int i = 0; i < RC2D_TEST_JOB_COUNT; i++)
+    {
+        rc2d_job_run(rc2d_test_job_increment, done, &counter);
+    }
+    rc2d_job_wait(&counter);
+    return 0;
+}
+
+Test(rc2d_job, submitFromExternalThread, .init = rc2d_test_job_setup, .fini = rc2d_test_job_teardown) {
+    SDL_AtomicInt done = {0};
+
+    SDL_Thread *threads[2];
+    for (int i = 0; i < 2; i++)
+    {
+        threads[i] = SDL_CreateThread(rc2d_test_job_externalThread, "rc2d_test_job", &done);
+        cr_assert_not_null(threads[i]);
+    }
+    for (int i = 0; i < 2; i++)
+    {
+        SDL_WaitThread(threads[i], NULL);
+    }
+
+    cr_assert_eq(SDL_GetAtomicInt(&done), 2 * RC2D_TEST_JOB_COUNT);
+}
+
+Test(rc2d_job, runsInlineWithoutInit) {
+    cr_assert_eq(rc2d_job_getWorkerCount(), 0);
+
+    SDL_AtomicInt done = {0};
+    RC2D_JobCounter counter = {0};
+    rc2d_job_run(rc2d_test_job_increment, &done, &counter);
+    cr_assert_eq(SDL_GetAtomicInt(&done), 1);
+    cr_assert(rc2d_job_isDone(&counter));
+
+    Uint8 marks[64];
+    SDL_zeroa(marks);
+    rc2d_job_parallelFor(64, 0, rc2d_test_job_markRange, marks);
+    for (Uint32 i = 0; i < 64; i++)
+    {
+        cr_assert_eq(marks[i], 1);
+    }
+}
+
+typedef struct RC2D_TestJobMainThread {
+    SDL_ThreadID main_thread;
+    SDL_AtomicInt on_main_thread;
+    SDL_AtomicInt on_other_thread;
+} RC2D_TestJobMainThread;
+
+static RC2D_TestJobMainThread rc2d_test_job_main;
+
+static void rc2d_test_job_recordMainThread(void *data)
+{
+    (void)data;
+    if (SDL_GetCurrentThreadID() == rc2d_test_job_main.main_thread)
+    {
+        SDL_AddAtomicInt(&rc2d_test_job_main.on_main_thread, 1);
+    }
+    else
+    {
+        SDL_AddAtomicInt(&rc2d_test_job_main.on_other_thread, 1);
+    }
+}
+
+static void rc2d_test_job_submitToMainThread(void *data)
+{
+    rc2d_job_runOnMainThread(rc2d_test_job_recordMainThread, NULL, (RC2D_JobCounter *)data);
+}
+
+static void rc2d_test_job_mainThreadSetup(void)
+{
+    // SDL_Init enregistre le thread principal (SDL_IsMainThread)
+    cr_assert(SDL_Init(0));
+    rc2d_test_job_setup();
+}
+
+static void rc2d_test_job_mainThreadTeardown(void)
+{
+    rc2d_test_job_teardown();
+    SDL_Quit();
+}
+
+Test(rc2d_job, runOnMainThreadFromWorkers, .init = rc2d_test_job_mainThreadSetup, .fini = rc2d_test_job_mainThreadTeardown) {
+    SDL_zero(rc2d_test_job_main);
+    rc2d_test_job_main.main_thread = SDL_GetCurrentThreadID();
+
+    // Les jobs confient leur tâche au thread principal, qui l'exécute pendant rc2d_job_wait
+    RC2D_JobCounter jobs = {0};
+    RC2D_JobCounter tasks = {0};
+    for (int i = 0; i < RC2D_TEST_JOB_COUNT; i++)
+    {
+        rc2d_job_run(rc2d_test_job_submitToMainThread, &tasks, &jobs);
+    }
+    rc2d_job_wait(&jobs);
+    rc2d_job_wait(&tasks);
+
+    cr_assert_eq(rc2d_job_getMainThreadTaskCount(), 0);
+    cr_assert_eq(SDL_GetAtomicInt(&rc2d_test_job_main.on_other_thread), 0);
+    cr_assert_eq(SDL_GetAtomicInt(&rc2d_test_job_main.on_main_thread), RC2D_TEST_JOB_COUNT);
+}
+
+static void rc2d_test_job_waitOnMainThread(void *data)
+{
+    // Le worker attend une tâche du thread principal alors que celui-ci est déjà dans rc2d_job_quit
+    RC2D_JobCounter task = {0};
+    rc2d_job_runOnMainThread(rc2d_test_job_recordMainThread, NULL, &task);
+    rc2d_job_wait(&task);
+    SDL_AddAtomicInt((SDL_AtomicInt *)data, 1);
+}
+
+Test(rc2d_job, quitRunsMainThreadTasksOfWaitingWorkers) {
+    cr_assert(SDL_Init(0));
+    cr_assert(rc2d_job_init(3, false));
+
+    SDL_zero(rc2d_test_job_main);
+    rc2d_test_job_main.main_thread = SDL_GetCurrentThreadID();
+
+    SDL_AtomicInt done = {0};
+    RC2D_JobCounter jobs = {0};
+    for (int i = 0; i < 3; i++)
+    {
+        rc2d_job_run(rc2d_test_job_waitOnMainThread, &done, &jobs);
+    }
+
+    // Attendre que les jobs aient démarré sur les workers, sans exécuter les tâches du thread principal
+    while (rc2d_job_getMainThreadTaskCount() + SDL_GetAtomicInt(&done) < 3)
+    {
+        SDL_DelayNS(SDL_NS_PER_MS);
+    }
+
+    rc2d_job_quit();
+
+    cr_assert_eq(SDL_GetAtomicInt(&done), 3);
+    cr_assert_eq(rc2d_job_getMainThreadTaskCount(), 0);
+    cr_assert_eq(SDL_GetAtomicInt(&rc2d_test_job_main.on_other_thread), 0);
+    cr_assert_eq(SDL_GetAtomicInt(&rc2d_test_job_main.on_main_thread), 3);
+    SDL_Quit();
+}
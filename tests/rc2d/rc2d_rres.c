@@ -0,0 +1,664 @@
+#include <RC2D/RC2D_rres.h>
+#include <RC2D/RC2D_memory.h>
+#include <RC2D/RC2D_job.h>
+#include <criterion/criterion.h>
+#include <monocypher/monocypher.h>
+#include <lz4/lz4.h>
+
+#define RC2D_TEST_RRES_PAYLOAD_SIZE 1024
+#define RC2D_TEST_RRES_HEADER_SIZE 20 // propCount + props[4]
+
+static const uint8_t rc2d_test_rres_salt[16] = {
+    0x52, 0x43, 0x32, 0x44, 0x2d, 0x72, 0x72, 0x65,
+    0x73, 0x2d, 0x62, 0x65, 0x6e, 0x63, 0x68, 0x00
+};
+
+/**
+ * Dérive la clé du pack synthétique comme le fait rrespacker (Argon2i, 16 Mo, 3 passes).
+ */
+static void rc2d_test_rres_deriveKey(uint8_t key[32])
+{
+    uint8_t pass[16] = { 0 };
+    const char *password = rc2d_rres_getCipherPassword();
+    SDL_memcpy(pass, password, SDL_strlen(password));
+
+    crypto_argon2_config config = { CRYPTO_ARGON2_I, 16384, 3, 1 };
+    crypto_argon2_inputs inputs = { pass, rc2d_test_rres_salt, 16, 16 };
+    crypto_argon2_extras extras = { 0 };
+
+    void *workArea = SDL_malloc(16384 * 1024);
+    cr_assert_not_null(workArea);
+    crypto_argon2(key, 32, workArea, config, inputs, extras);
+    SDL_free(workArea);
+}
+
+/**
+ * Construit un chunk RAWD chiffré XChaCha20-Poly1305 au format rrespacker :
+ * data + salt[16] + nonce[24] + MAC[16].
+ */
+static rresResourceChunk rc2d_test_rres_makeChunk(const uint8_t key[32], unsigned int id)
+{
+    const unsigned int baseSize = RC2D_TEST_RRES_HEADER_SIZE + RC2D_TEST_RRES_PAYLOAD_SIZE;
+
+    uint8_t plain[RC2D_TEST_RRES_HEADER_SIZE + RC2D_TEST_RRES_PAYLOAD_SIZE] = { 0 };
+    unsigned int props[5] = { 4, RC2D_TEST_RRES_PAYLOAD_SIZE, 0, 0, 0 };
+    SDL_memcpy(plain, props, sizeof(props));
+    for (unsigned int i = 0; i < RC2D_TEST_RRES_PAYLOAD_SIZE; i++) plain[RC2D_TEST_RRES_HEADER_SIZE + i] = (uint8_t)(i + id);
+
+    rresResourceChunk chunk = { 0 };
+    SDL_memcpy(chunk.info.type, "RAWD", 4);
+    chunk.info.id = id;
+    chunk.info.compType = RRES_COMP_NONE;
+    chunk.info.cipherType = RRES_CIPHER_XCHACHA20_POLY1305;
+    chunk.info.baseSize = baseSize;
+    chunk.info.packedSize = baseSize + 16 + 24 + 16;
+
+    uint8_t *packed = (uint8_t *)RC2D_malloc(chunk.info.packedSize);
+    cr_assert_not_null(packed);
+
+    uint8_t nonce[24] = { 0 };
+    SDL_memcpy(nonce, &id, sizeof(id));
+
+    SDL_memcpy(packed + baseSize, rc2d_test_rres_salt, 16);
+    SDL_memcpy(packed + baseSize + 16, nonce, 24);
+    crypto_aead_lock(packed, packed + baseSize + 16 + 24, key, nonce, NULL, 0, plain, baseSize);
+
+    chunk.data.raw = packed;
+    return chunk;
+}
+
+Test(rc2d_rres, unpackXChaCha20_wrongPassword) {
+    uint8_t key[32] = { 0 };
+    rc2d_test_rres_deriveKey(key);
+    rresResourceChunk chunk = rc2d_test_rres_makeChunk(key, 0);
+
+    rc2d_rres_setCipherPassword("wrongpassword");
+    cr_assert_eq(rc2d_rres_unpackResourceChunk(&chunk), 2);
+    rc2d_rres_cleanCipherPassword();
+
+    RC2D_safe_free(chunk.data.raw);
+}
+
+Test(rc2d_rres, keyCache_hitsAndMisses) {
+    uint8_t key[32] = { 0 };
+    rc2d_test_rres_deriveKey(key);
+    rc2d_rres_cleanKeyCache();
+
+    // Trois chunks avec le même sel : un seul étirement de clé
+    for (unsigned int i = 0; i < 3; i++)
+    {
+        rresResourceChunk chunk = rc2d_test_rres_makeChunk(key, i);
+        cr_assert_eq(rc2d_rres_unpackResourceChunk(&chunk), 0);
+        cr_assert_eq(((uint8_t *)chunk.data.raw)[7], (uint8_t)(7 + i));
+
+        RC2D_safe_free(chunk.data.props);
+        RC2D_safe_free(chunk.data.raw);
+    }
+
+    RC2D_RresKeyCacheStats stats;
+    rc2d_rres_getKeyCacheStats(&stats);
+    cr_assert_eq(stats.misses, 1);
+    cr_assert_eq(stats.hits, 2);
+
+    // Changer de mot de passe vide le cache : la clé du nouveau mot de passe est dérivée
+    rresResourceChunk chunk = rc2d_test_rres_makeChunk(key, 3);
+    rc2d_rres_setCipherPassword("wrongpassword");
+    cr_assert_eq(rc2d_rres_unpackResourceChunk(&chunk), 2);
+    rc2d_rres_getKeyCacheStats(&stats);
+    cr_assert_eq(stats.misses, 1);
+    cr_assert_eq(stats.hits, 0);
+    rc2d_rres_cleanCipherPassword();
+
+    rc2d_rres_getKeyCacheStats(&stats);
+    cr_assert_eq(stats.misses, 0);
+    RC2D_safe_free(chunk.data.raw);
+}
+
+/**
+ * Écrit un pack minimal (sans répertoire central) contenant deux chunks RAWD non compressés.
+ */
+static void rc2d_test_rres_writePack(const char *fileName)
+{
+    SDL_IOStream *io = SDL_IOFromFile(fileName, "wb");
+    cr_assert_not_null(io);
+
+    rresFileHeader header = { { 'r', 'r', 'e', 's' }, 100, 2, 0, 0 };
+    SDL_WriteIO(io, &header, sizeof(header));
+
+    for (unsigned int id = 1; id <= 2; id++)
+    {
+        unsigned char data[4 + 4 + 8] = { 0 };
+        unsigned int props[2] = { 1, 8 };
+        SDL_memcpy(data, props, sizeof(props));
+        SDL_memset(data + 8, (int)id, 8);
+
+        rresResourceChunkInfo info = { 0 };
+        SDL_memcpy(info.type, "RAWD", 4);
+        info.id = 0x1000 + id;
+        info.packedSize = info.baseSize = sizeof(data);
+        info.crc32 = rresComputeCRC32(data, sizeof(data));
+
+        SDL_WriteIO(io, &info, sizeof(info));
+        SDL_WriteIO(io, data, sizeof(data));
+    }
+
+    SDL_CloseIO(io);
+}
+
+Test(rc2d_rres, openPack_zeroCopyView) {
+    const char *fileName = "rc2d_test_pack.rres";
+    rc2d_test_rres_writePack(fileName);
+
+    RC2D_RresPack *pack = rc2d_rres_openPack(fileName);
+    cr_assert_not_null(pack);
+
+    rresResourceChunk chunk = rc2d_rres_loadChunkFromPack(pack, 0x1002);
+    cr_assert_not_null(chunk.data.raw);
+    cr_assert(rc2d_rres_isChunkViewOfPack(pack, &chunk));
+    cr_assert_eq(chunk.data.propCount, 1);
+    cr_assert_eq(chunk.data.props[0], 8);
+    cr_assert_eq(((unsigned char *)chunk.data.raw)[0], 2);
+
+    rresResourceChunk missing = rc2d_rres_loadChunkFromPack(pack, 0x2000);
+    cr_assert_null(missing.data.raw);
+
+    rc2d_rres_unloadChunkFromPack(pack, &chunk);
+    cr_assert_null(chunk.data.raw);
+
+    rc2d_rres_closePack(pack);
+    SDL_RemovePath(fileName);
+}
+
+/**
+ * Écrit un pack avec répertoire central : deux chunks RAWD ("a.bin", "b.bin") puis le chunk CDIR.
+ * cdirPropCount et cdirCount permettent d'écrire un répertoire corrompu.
+ */
+static void rc2d_test_rres_writePackWithCentralDir(const char *fileName, unsigned int cdirPropCount, unsigned int cdirCount)
+{
+    SDL_IOStream *io = SDL_IOFromFile(fileName, "wb");
+    cr_assert_not_null(io);
+
+    const unsigned int chunkSize = sizeof(rresResourceChunkInfo) + 16;
+    rresFileHeader header = { { 'r', 'r', 'e', 's' }, 100, 3, sizeof(rresFileHeader) + 2*chunkSize, 0 };
+    SDL_WriteIO(io, &header, sizeof(header));
+
+    for (unsigned int id = 1; id <= 2; id++)
+    {
+        unsigned char data[4 + 4 + 8] = { 0 };
+        unsigned int props[2] = { 1, 8 };
+        SDL_memcpy(data, props, sizeof(props));
+        SDL_memset(data + 8, (int)id, 8);
+
+        rresResourceChunkInfo info = { 0 };
+        SDL_memcpy(info.type, "RAWD", 4);
+        info.id = 0x1000 + id;
+        info.packedSize = info.baseSize = sizeof(data);
+        info.crc32 = rresComputeCRC32(data, sizeof(data));
+
+        SDL_WriteIO(io, &info, sizeof(info));
+        SDL_WriteIO(io, data, sizeof(data));
+    }
+
+    // propCount, props[0] = nombre d'entrées, puis { id, offset, reserved, fileNameSize, fileName (paddé à 4) }
+    unsigned int cdir[2 + 2*(4 + 2)] = { cdirPropCount, cdirCount };
+    for (unsigned int i = 0; i < 2; i++)
+    {
+        unsigned int *entry = &cdir[2 + i*6];
+        entry[0] = 0x1001 + i;
+        entry[1] = sizeof(rresFileHeader) + i*chunkSize;
+        entry[2] = 0;
+        entry[3] = 8;
+        SDL_memcpy(&entry[4], i == 0 ? "a.bin" : "b.bin", 6);
+    }
+
+    rresResourceChunkInfo info = { 0 };
+    SDL_memcpy(info.type, "CDIR", 4);
+    info.packedSize = info.baseSize = sizeof(cdir);
+    info.crc32 = rresComputeCRC32((unsigned char *)cdir, sizeof(cdir));
+    SDL_WriteIO(io, &info, sizeof(info));
+    SDL_WriteIO(io, cdir, sizeof(cdir));
+
+    SDL_CloseIO(io);
+}
+
+Test(rc2d_rres, openPack_centralDirectory) {
+    const char *fileName = "rc2d_test_cdir.rres";
+    rc2d_test_rres_writePackWithCentralDir(fileName, 1, 2);
+
+    RC2D_RresPack *pack = rc2d_rres_openPack(fileName);
+    cr_assert_not_null(pack);
+    cr_assert_eq(rc2d_rres_getResourceIdFromPack(pack, "a.bin"), 0x1001);
+    cr_assert_eq(rc2d_rres_getResourceIdFromPack(pack, "b.bin"), 0x1002);
+
+    rresResourceChunk chunk = rc2d_rres_loadChunkFromPack(pack, 0x1002);
+    cr_assert_not_null(chunk.data.raw);
+    cr_assert_eq(((unsigned char *)chunk.data.raw)[0], 2);
+    rc2d_rres_unloadChunkFromPack(pack, &chunk);
+
+    rc2d_rres_closePack(pack);
+    SDL_RemovePath(fileName);
+}
+
+Test(rc2d_rres, openPack_corruptCentralDirectoryFallsBack) {
+    const char *fileName = "rc2d_test_cdir_corrupt.rres";
+
+    // propCount hors du chunk, puis nombre d'entrées démesuré : le répertoire est ignoré, les chunks restent lisibles
+    const unsigned int corrupt[2][2] = { { 0x40000000u, 2 }, { 1, 0xFFFFFFF0u } };
+    for (int i = 0; i < 2; i++)
+    {
+        rc2d_test_rres_writePackWithCentralDir(fileName, corrupt[i][0], corrupt[i][1]);
+
+        RC2D_RresPack *pack = rc2d_rres_openPack(fileName);
+        cr_assert_not_null(pack);
+        cr_assert_eq(rc2d_rres_getResourceIdFromPack(pack, "a.bin"), 0);
+
+        rresResourceChunk chunk = rc2d_rres_loadChunkFromPack(pack, 0x1001);
+        cr_assert_not_null(chunk.data.raw);
+        cr_assert_eq(((unsigned char *)chunk.data.raw)[0], 1);
+        rc2d_rres_unloadChunkFromPack(pack, &chunk);
+
+        rc2d_rres_closePack(pack);
+    }
+
+    SDL_RemovePath(fileName);
+}
+
+/**
+ * Écrit un pack d'un seul chunk RAWD non compressé dont le contenu (propCount, props, données) est fourni tel quel.
+ * Le CRC32 est valide : seule la validation des tailles peut rejeter le chunk.
+ */
+static void rc2d_test_rres_writeRawChunkPack(const char *fileName, const unsigned char *data, unsigned int size)
+{
+    SDL_IOStream *io = SDL_IOFromFile(fileName, "wb");
+    cr_assert_not_null(io);
+
+    rresFileHeader header = { { 'r', 'r', 'e', 's' }, 100, 1, 0, 0 };
+    SDL_WriteIO(io, &header, sizeof(header));
+
+    rresResourceChunkInfo info = { 0 };
+    SDL_memcpy(info.type, "RAWD", 4);
+    info.id = 0x1001;
+    info.packedSize = info.baseSize = size;
+    info.crc32 = rresComputeCRC32((unsigned char *)data, (int)size);
+
+    SDL_WriteIO(io, &info, sizeof(info));
+    SDL_WriteIO(io, data, size);
+
+    SDL_CloseIO(io);
+}
+
+Test(rc2d_rres, loadChunkFromPack_rejectsOutOfBoundsProperties) {
+    const char *fileName = "rc2d_test_props.rres";
+
+    // propCount démesuré : ni allocation ni lecture hors de la projection
+    unsigned int oversized[3] = { 0x40000000u, 1, 2 };
+    rc2d_test_rres_writeRawChunkPack(fileName, (const unsigned char *)oversized, sizeof(oversized));
+    RC2D_RresPack *pack = rc2d_rres_openPack(fileName);
+    cr_assert_not_null(pack);
+    rresResourceChunk chunk = rc2d_rres_loadChunkFromPack(pack, 0x1001);
+    cr_assert_null(chunk.data.raw);
+    cr_assert_null(chunk.data.props);
+    rc2d_rres_closePack(pack);
+
+    // Une propriété de trop d'un seul entier
+    unsigned int oneTooMany[3] = { 3, 1, 2 };
+    rc2d_test_rres_writeRawChunkPack(fileName, (const unsigned char *)oneTooMany, sizeof(oneTooMany));
+    pack = rc2d_rres_openPack(fileName);
+    cr_assert_not_null(pack);
+    chunk = rc2d_rres_loadChunkFromPack(pack, 0x1001);
+    cr_assert_null(chunk.data.raw);
+    rc2d_rres_closePack(pack);
+
+    // Chunk trop court pour contenir propCount
+    const unsigned char truncated[2] = { 1, 0 };
+    rc2d_test_rres_writeRawChunkPack(fileName, truncated, sizeof(truncated));
+    pack = rc2d_rres_openPack(fileName);
+    cr_assert_not_null(pack);
+    chunk = rc2d_rres_loadChunkFromPack(pack, 0x1001);
+    cr_assert_null(chunk.data.raw);
+    rc2d_rres_closePack(pack);
+
+    // Propriétés exactement jusqu'à la fin du chunk, sans données : la vue reste dans la projection
+    unsigned int exact[3] = { 2, 7, 9 };
+    rc2d_test_rres_writeRawChunkPack(fileName, (const unsigned char *)exact, sizeof(exact));
+    pack = rc2d_rres_openPack(fileName);
+    cr_assert_not_null(pack);
+    chunk = rc2d_rres_loadChunkFromPack(pack, 0x1001);
+    cr_assert_not_null(chunk.data.raw);
+    cr_assert(rc2d_rres_isChunkViewOfPack(pack, &chunk));
+    cr_assert_eq(chunk.data.propCount, 2);
+    cr_assert_eq(chunk.data.props[1], 9);
+    rc2d_rres_unloadChunkFromPack(pack, &chunk);
+    rc2d_rres_closePack(pack);
+
+    SDL_RemovePath(fileName);
+}
+
+/**
+ * Écrit un pack sans répertoire central comme rc2d_rrespack : chaque chunk RAWD commence à un multiple de
+ * alignment (rresFileHeader::reserved), l'espace entre deux chunks est rempli de zéros.
+ */
+static void rc2d_test_rres_writeAlignedPack(const char *fileName, unsigned int alignment)
+{
+    SDL_IOStream *io = SDL_IOFromFile(fileName, "wb");
+    cr_assert_not_null(io);
+
+    rresFileHeader header = { { 'r', 'r', 'e', 's' }, 100, 3, 0, alignment };
+    SDL_WriteIO(io, &header, sizeof(header));
+
+    for (unsigned int id = 1; id <= 3; id++)
+    {
+        const Sint64 position = SDL_TellIO(io);
+        const Sint64 aligned = (position + alignment - 1) / alignment * alignment;
+        for (Sint64 i = position; i < aligned; i++) SDL_WriteU8(io, 0);
+
+        // Tailles différentes : l'offset du chunk suivant n'est pas déjà aligné
+        unsigned char data[4 + 4 + 24] = { 0 };
+        unsigned int props[2] = { 1, 8*id };
+        SDL_memcpy(data, props, sizeof(props));
+        SDL_memset(data + 8, (int)id, 8*id);
+
+        rresResourceChunkInfo info = { 0 };
+        SDL_memcpy(info.type, "RAWD", 4);
+        info.id = 0x1000 + id;
+        info.packedSize = info.baseSize = 8 + 8*id;
+        info.crc32 = rresComputeCRC32(data, (int)info.packedSize);
+
+        SDL_WriteIO(io, &info, sizeof(info));
+        SDL_WriteIO(io, data, info.packedSize);
+    }
+
+    SDL_CloseIO(io);
+}
+
+Test(rc2d_rres, openPack_alignedChunksWithoutCentralDirectory) {
+    const char *fileName = "rc2d_test_aligned.rres";
+    const unsigned int alignment = 4096;
+    rc2d_test_rres_writeAlignedPack(fileName, alignment);
+
+    RC2D_RresPack *pack = rc2d_rres_openPack(fileName);
+    cr_assert_not_null(pack);
+
+    // Le parcours saute le remplissage : sans l'alignement, il lirait des zéros à la place du chunk suivant
+    for (unsigned int id = 1; id <= 3; id++)
+    {
+        rresResourceChunk chunk = rc2d_rres_loadChunkFromPack(pack, 0x1000 + id);
+        cr_assert_not_null(chunk.data.raw);
+        cr_assert_eq(chunk.data.propCount, 1);
+        cr_assert_eq(chunk.data.props[0], 8*id);
+        cr_assert_eq(((unsigned char *)chunk.data.raw)[0], id);
+        cr_assert_eq(((unsigned char *)chunk.data.raw)[8*id - 1], id);
+        rc2d_rres_unloadChunkFromPack(pack, &chunk);
+    }
+
+    rc2d_rres_closePack(pack);
+    SDL_RemovePath(fileName);
+}
+
+static void rc2d_test_rres_unpackBatch(const char *fileName)
+{
+    rc2d_test_rres_writePack(fileName);
+
+    RC2D_RresPack *pack = rc2d_rres_openPack(fileName);
+    cr_assert_not_null(pack);
+
+    unsigned int ids[3] = { 0x1001, 0x1002, 0x2000 };
+    RC2D_RresBatch *batch = rc2d_rres_unpackBatch(pack, ids, 3);
+    cr_assert_not_null(batch);
+
+    int succeeded = 0;
+    int missing = 0;
+    RC2D_RresBatchResult result;
+    while (rc2d_rres_waitBatch(batch, &result))
+    {
+        if (result.result == 0)
+        {
+            succeeded++;
+            cr_assert_eq(((unsigned char *)result.chunk.data.raw)[0], (unsigned char)(result.id - 0x1000));
+        }
+        else
+        {
+            missing++;
+        }
+        rc2d_rres_unloadChunkFromPack(pack, &result.chunk);
+    }
+
+    cr_assert_eq(succeeded, 2);
+    cr_assert_eq(missing, 1);
+    cr_assert(rc2d_rres_isBatchDone(batch));
+
+    rc2d_rres_destroyBatch(batch);
+    rc2d_rres_closePack(pack);
+    SDL_RemovePath(fileName);
+}
+
+Test(rc2d_rres, unpackBatch_completionQueue) {
+    // Sans système de jobs : le lot est décodé sur le thread appelant
+    rc2d_test_rres_unpackBatch("rc2d_test_batch.rres");
+}
+
+Test(rc2d_rres, unpackBatch_jobSystem) {
+    cr_assert(rc2d_job_init(3, false));
+    rc2d_test_rres_unpackBatch("rc2d_test_batch_jobs.rres");
+    rc2d_job_quit();
+}
+
+/**
+ * Calcule le MD5 de `text` par morceaux de `step` octets et l'écrit en hexadécimal (ordre des octets du RFC 1321).
+ */
+static void rc2d_test_rres_md5Hex(const char *text, size_t step, char hex[33])
+{
+    const size_t size = SDL_strlen(text);
+
+    RC2D_RresMD5Context ctx;
+    rc2d_rres_md5Init(&ctx);
+    for (size_t offset = 0; offset < size; offset += step)
+    {
+        rc2d_rres_md5Update(&ctx, text + offset, SDL_min(step, size - offset));
+    }
+
+    unsigned int hash[4] = { 0 };
+    rc2d_rres_md5Final(&ctx, hash);
+
+    for (int i = 0; i < 16; i++)
+    {
+        SDL_snprintf(hex + i*2, 3, "%02x", (hash[i/4] >> (8*(i%4))) & 0xff);
+    }
+}
+
+Test(rc2d_rres, md5_rfc1321TestSuite) {
+    // Suite de test de l'annexe A.5 du RFC 1321
+    static const char *vectors[7][2] = {
+        { "", "d41d8cd98f00b204e9800998ecf8427e" },
+        { "a", "0cc175b9c0f1b6a831c399e269772661" },
+        { "abc", "900150983cd24fb0d6963f7d28e17f72" },
+        { "message digest", "f96b697d7cb7938d525a2f31aaf161d0" },
+        { "abcdefghijklmnopqrstuvwxyz", "c3fcd3d76192e4007dfb496cca67e13b" },
+        { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", "d174ab98d277d9f5a5611c2c9f419d9f" },
+        { "12345678901234567890123456789012345678901234567890123456789012345678901234567890", "57edf4a22be3c955ac49da2e2107b67a" }
+    };
+
+    for (int i = 0; i < 7; i++)
+    {
+        // En un seul appel, octet par octet, puis par morceaux qui chevauchent les blocs de 64 octets
+        const size_t steps[3] = { SDL_max(SDL_strlen(vectors[i][0]), 1), 1, 7 };
+        for (int j = 0; j < 3; j++)
+        {
+            char hex[33] = { 0 };
+            rc2d_test_rres_md5Hex(vectors[i][0], steps[j], hex);
+            cr_assert_str_eq(hex, vectors[i][1], "MD5(\"%s\") by %zu-byte updates", vectors[i][0], steps[j]);
+        }
+    }
+
+    // rc2d_rres_computeMD5 donne le même résultat que l'API incrémentale
+    unsigned int hash[4] = { 0 };
+    unsigned int streamed[4] = { 0 };
+    RC2D_RresMD5Context ctx;
+    rc2d_rres_computeMD5("message digest", 14, hash);
+    rc2d_rres_md5Init(&ctx);
+    rc2d_rres_md5Update(&ctx, "message digest", 14);
+    rc2d_rres_md5Final(&ctx, streamed);
+    cr_assert_arr_eq(hash, streamed, sizeof(hash));
+}
+
+Test(rc2d_rres, aesCtr_openSSLMatchesTinyAES) {
+    unsigned char key[32];
+    for (int i = 0; i < 32; i++) key[i] = (unsigned char)(i*3 + 1);
+
+#if !RC2D_DATA_MODULE_ENABLED
+    // OpenSSL n'est lié qu'avec le module RC2D_data : le backend est refusé, AUTO passe par tiny-AES
+    unsigned char data[32] = { 0 };
+    cr_assert_not(rc2d_rres_aesCtrXcrypt(key, data, sizeof(data), RC2D_RRES_AES_BACKEND_OPENSSL));
+    cr_assert(rc2d_rres_aesCtrXcrypt(key, data, sizeof(data), RC2D_RRES_AES_BACKEND_AUTO));
+#else
+    unsigned char evp[1000];
+    unsigned char tiny[1000];
+
+    // Tailles non multiples de 16 pour vérifier aussi le dernier bloc partiel
+    for (size_t size = 0; size <= sizeof(evp); size += 37)
+    {
+        for (size_t i = 0; i < size; i++) evp[i] = tiny[i] = (unsigned char)(i*13 + 5);
+
+        cr_assert(rc2d_rres_aesCtrXcrypt(key, evp, size, RC2D_RRES_AES_BACKEND_OPENSSL));
+        cr_assert(rc2d_rres_aesCtrXcrypt(key, tiny, size, RC2D_RRES_AES_BACKEND_TINYAES));
+        cr_assert_arr_eq(evp, tiny, size);
+    }
+#endif
+}
+
+#define RC2D_TEST_RRES_IMAGE_WIDTH 160
+#define RC2D_TEST_RRES_IMAGE_HEIGHT 128
+#define RC2D_TEST_RRES_IMAGE_PIXEL_SIZE (RC2D_TEST_RRES_IMAGE_WIDTH*RC2D_TEST_RRES_IMAGE_HEIGHT*4)
+
+/**
+ * Construit un chunk IMGE RGBA8 au format rrespacker : compression LZ4 éventuelle, puis chiffrement
+ * (AES : data + salt[16] + MD5[16], XChaCha20-Poly1305 : data + salt[16] + nonce[24] + MAC[16]).
+ * L'image (160x128, plus de 64 Ko) couvre plusieurs tuiles du déchiffrement AES.
+ */
+static rresResourceChunk rc2d_test_rres_makeImageChunk(const uint8_t key[32], unsigned int compType, unsigned int cipherType, uint8_t *plain)
+{
+    const unsigned int baseSize = RC2D_RRES_IMAGE_HEADER_SIZE + RC2D_TEST_RRES_IMAGE_PIXEL_SIZE;
+    unsigned int props[5] = { 4, RC2D_TEST_RRES_IMAGE_WIDTH, RC2D_TEST_RRES_IMAGE_HEIGHT, RRES_PIXELFORMAT_UNCOMP_R8G8B8A8, 1 };
+    SDL_memcpy(plain, props, sizeof(props));
+    for (unsigned int i = 0; i < RC2D_TEST_RRES_IMAGE_PIXEL_SIZE; i++) plain[RC2D_RRES_IMAGE_HEADER_SIZE + i] = (uint8_t)((i/7) ^ (i >> 9));
+
+    rresResourceChunk chunk = { 0 };
+    SDL_memcpy(chunk.info.type, "IMGE", 4);
+    chunk.info.compType = compType;
+    chunk.info.cipherType = cipherType;
+    chunk.info.baseSize = baseSize;
+
+    // Compression
+    unsigned int dataSize = baseSize;
+    uint8_t *data = (uint8_t *)RC2D_malloc(LZ4_compressBound(baseSize) + 16 + 24 + 16);
+    cr_assert_not_null(data);
+    if (compType == RRES_COMP_LZ4)
+    {
+        int compressedSize = LZ4_compress_default((const char *)plain, (char *)data, baseSize, LZ4_compressBound(baseSize));
+        cr_assert_gt(compressedSize, 0);
+        dataSize = (unsigned int)compressedSize;
+    }
+    else
+    {
+        SDL_memcpy(data, plain, baseSize);
+    }
+
+    // Chiffrement
+    if (cipherType == RRES_CIPHER_AES)
+    {
+        unsigned int md5[4] = { 0 };
+        rc2d_rres_computeMD5(data, dataSize, md5);
+        cr_assert(rc2d_rres_aesCtrXcrypt(key, data, dataSize, RC2D_RRES_AES_BACKEND_TINYAES));
+        SDL_memcpy(data + dataSize, rc2d_test_rres_salt, 16);
+        SDL_memcpy(data + dataSize + 16, md5, 16);
+        chunk.info.packedSize = dataSize + 16 + 16;
+    }
+    else if (cipherType == RRES_CIPHER_XCHACHA20_POLY1305)
+    {
+        uint8_t nonce[24] = { 1, 2, 3 };
+        SDL_memcpy(data + dataSize, rc2d_test_rres_salt, 16);
+        SDL_memcpy(data + dataSize + 16, nonce, 24);
+        crypto_aead_lock(data, data + dataSize + 16 + 24, key, nonce, NULL, 0, data, dataSize);
+        chunk.info.packedSize = dataSize + 16 + 24 + 16;
+    }
+    else
+    {
+        chunk.info.packedSize = dataSize;
+    }
+
+    chunk.data.raw = data;
+    return chunk;
+}
+
+Test(rc2d_rres, decodeImageChunk_compressedAndEncrypted) {
+    uint8_t key[32] = { 0 };
+    rc2d_test_rres_deriveKey(key);
+
+    const unsigned int baseSize = RC2D_RRES_IMAGE_HEADER_SIZE + RC2D_TEST_RRES_IMAGE_PIXEL_SIZE;
+    uint8_t *plain = (uint8_t *)RC2D_malloc(baseSize);
+    uint8_t *output = (uint8_t *)RC2D_malloc(baseSize);
+    cr_assert_not_null(plain);
+    cr_assert_not_null(output);
+
+    const unsigned int modes[][2] = {
+        { RRES_COMP_LZ4, RRES_CIPHER_NONE },
+        { RRES_COMP_NONE, RRES_CIPHER_AES },
+        { RRES_COMP_LZ4, RRES_CIPHER_AES },
+        { RRES_COMP_NONE, RRES_CIPHER_XCHACHA20_POLY1305 },
+        { RRES_COMP_LZ4, RRES_CIPHER_XCHACHA20_POLY1305 }
+    };
+
+    for (size_t i = 0; i < SDL_arraysize(modes); i++)
+    {
+        rresResourceChunk chunk = rc2d_test_rres_makeImageChunk(key, modes[i][0], modes[i][1], plain);
+        unsigned int props[3] = { 0 };
+        SDL_memset(output, 0, baseSize);
+
+        cr_assert(rc2d_rres_decodeImageChunk(&chunk, output, baseSize, props), "mode %zu", i);
+        cr_assert_eq(props[0], RC2D_TEST_RRES_IMAGE_WIDTH);
+        cr_assert_eq(props[1], RC2D_TEST_RRES_IMAGE_HEIGHT);
+        cr_assert_eq(props[2], RRES_PIXELFORMAT_UNCOMP_R8G8B8A8);
+        cr_assert_arr_eq(output, plain, baseSize, "mode %zu", i);
+
+        // Buffer de sortie trop petit
+        cr_assert_not(rc2d_rres_decodeImageChunk(&chunk, output, baseSize - 1, props));
+
+        RC2D_safe_free(chunk.data.raw);
+    }
+
+    RC2D_safe_free(output);
+    RC2D_safe_free(plain);
+}
+
+Test(rc2d_rres, decodeImageChunk_rejectsCorruptedData) {
+    uint8_t key[32] = { 0 };
+    rc2d_test_rres_deriveKey(key);
+
+    const unsigned int baseSize = RC2D_RRES_IMAGE_HEADER_SIZE + RC2D_TEST_RRES_IMAGE_PIXEL_SIZE;
+    uint8_t *plain = (uint8_t *)RC2D_malloc(baseSize);
+    uint8_t *output = (uint8_t *)RC2D_malloc(baseSize);
+    cr_assert_not_null(plain);
+    cr_assert_not_null(output);
+    unsigned int props[3] = { 0 };
+
+    // AES : le MD5 ne correspond plus
+    rresResourceChunk chunk = rc2d_test_rres_makeImageChunk(key, RRES_COMP_LZ4, RRES_CIPHER_AES, plain);
+    ((uint8_t *)chunk.data.raw)[5] ^= 0x80;
+    cr_assert_not(rc2d_rres_decodeImageChunk(&chunk, output, baseSize, props));
+    RC2D_safe_free(chunk.data.raw);
+
+    // XChaCha20-Poly1305 : le MAC est rejeté
+    chunk = rc2d_test_rres_makeImageChunk(key, RRES_COMP_NONE, RRES_CIPHER_XCHACHA20_POLY1305, plain);
+    ((uint8_t *)chunk.data.raw)[baseSize - 1] ^= 0x01;
+    cr_assert_not(rc2d_rres_decodeImageChunk(&chunk, output, baseSize, props));
+    RC2D_safe_free(chunk.data.raw);
+
+    // Taille empaquetée incohérente sans compression
+    chunk = rc2d_test_rres_makeImageChunk(key, RRES_COMP_NONE, RRES_CIPHER_AES, plain);
+    chunk.info.packedSize -= 4;
+    cr_assert_not(rc2d_rres_decodeImageChunk(&chunk, output, baseSize, props));
+    RC2D_safe_free(chunk.data.raw);
+
+    RC2D_safe_free(output);
+    RC2D_safe_free(plain);
+}
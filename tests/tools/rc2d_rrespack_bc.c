@@ -0,0 +1,213 @@
+#include <rc2d_rrespack_encode.h>
+#include <criterion/criterion.h>
+
+/**
+ * Décode un bloc couleur BC1 en mode 4 couleurs (color0 > color1), comme le GPU, en RGB 0..255.
+ */
+static void rc2d_test_bc_decodeColorBlock(const Uint8 in[8], int rgb[16][3])
+{
+    const Uint16 color0 = (Uint16)(in[0] | (in[1] << 8));
+    const Uint16 color1 = (Uint16)(in[2] | (in[3] << 8));
+    const Uint32 indices = (Uint32)in[4] | ((Uint32)in[5] << 8) | ((Uint32)in[6] << 16) | ((Uint32)in[7] << 24);
+
+    int palette[4][3];
+    rc2d_rrespack_unpackColor565(color0, palette[0]);
+    rc2d_rrespack_unpackColor565(color1, palette[1]);
+    for (int c = 0; c < 3; c++)
+    {
+        palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+        palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+    }
+
+    for (int i = 0; i < 16; i++)
+    {
+        const Uint32 index = (indices >> (2 * i)) & 3;
+        for (int c = 0; c < 3; c++) rgb[i][c] = palette[index][c];
+    }
+}
+
+/**
+ * Décode un bloc alpha BC3 (extrémités puis 16 index de 3 bits).
+ */
+static void rc2d_test_bc_decodeAlphaBlock(const Uint8 in[8], int alpha[16])
+{
+    int palette[8];
+    palette[0] = in[0];
+    palette[1] = in[1];
+    for (int p = 2; p < 8; p++)
+    {
+        palette[p] = in[0] > in[1] ? ((8 - p) * in[0] + (p - 1) * in[1]) / 7 : (p < 6 ? ((6 - p) * in[0] + (p - 1) * in[1]) / 5 : (p == 6 ? 0 : 255));
+    }
+
+    Uint64 indices = 0;
+    for (int i = 0; i < 6; i++) indices |= (Uint64)in[2 + i] << (8 * i);
+    for (int i = 0; i < 16; i++) alpha[i] = palette[(indices >> (3 * i)) & 7];
+}
+
+Test(rc2d_rrespack_bc, color565_roundTripsEndpoints) {
+    // Les valeurs extrêmes et les couleurs primaires sont exactes en RGB565
+    const float colors[5][3] = { { 0, 0, 0 }, { 255, 255, 255 }, { 255, 0, 0 }, { 0, 255, 0 }, { 0, 0, 255 } };
+    const Uint16 packed[5] = { 0x0000, 0xFFFF, 0xF800, 0x07E0, 0x001F };
+    for (int i = 0; i < 5; i++)
+    {
+        cr_assert_eq(rc2d_rrespack_packColor565(colors[i]), packed[i]);
+
+        int rgb[3];
+        rc2d_rrespack_unpackColor565(packed[i], rgb);
+        for (int c = 0; c < 3; c++) cr_assert_eq(rgb[c], (int)colors[i][c]);
+    }
+
+    // Hors bornes : les composantes sont ramenées dans 0..255
+    const float outOfRange[3] = { -40.0f, 300.0f, 128.0f };
+    int rgb[3];
+    rc2d_rrespack_unpackColor565(rc2d_rrespack_packColor565(outOfRange), rgb);
+    cr_assert_eq(rgb[0], 0);
+    cr_assert_eq(rgb[1], 255);
+    cr_assert_leq(SDL_abs(rgb[2] - 128), 4);
+}
+
+Test(rc2d_rrespack_bc, colorBlock_solidColorIsExact) {
+    Uint8 block[64];
+    for (int i = 0; i < 16; i++)
+    {
+        block[i * 4 + 0] = 255;
+        block[i * 4 + 1] = 0;
+        block[i * 4 + 2] = 255;
+        block[i * 4 + 3] = 255;
+    }
+
+    Uint8 out[8];
+    rc2d_rrespack_encodeColorBlock(block, out);
+
+    int rgb[16][3];
+    rc2d_test_bc_decodeColorBlock(out, rgb);
+    for (int i = 0; i < 16; i++)
+    {
+        cr_assert_eq(rgb[i][0], 255);
+        cr_assert_eq(rgb[i][1], 0);
+        cr_assert_eq(rgb[i][2], 255);
+    }
+}
+
+Test(rc2d_rrespack_bc, colorBlock_twoColorsUseFourColorMode) {
+    // Damier noir et blanc : les extrémités sont les deux couleurs, chaque pixel retombe exactement sur la sienne
+    Uint8 block[64];
+    for (int i = 0; i < 16; i++)
+    {
+        const Uint8 value = ((i + i / 4) & 1) ? 255 : 0;
+        block[i * 4 + 0] = value;
+        block[i * 4 + 1] = value;
+        block[i * 4 + 2] = value;
+        block[i * 4 + 3] = 255;
+    }
+
+    Uint8 out[8];
+    rc2d_rrespack_encodeColorBlock(block, out);
+
+    // color0 > color1 : jamais le mode 3 couleurs + transparent de BC1
+    const Uint16 color0 = (Uint16)(out[0] | (out[1] << 8));
+    const Uint16 color1 = (Uint16)(out[2] | (out[3] << 8));
+    cr_assert_eq(color0, 0xFFFF);
+    cr_assert_eq(color1, 0x0000);
+
+    int rgb[16][3];
+    rc2d_test_bc_decodeColorBlock(out, rgb);
+    for (int i = 0; i < 16; i++)
+    {
+        for (int c = 0; c < 3; c++) cr_assert_eq(rgb[i][c], block[i * 4 + c]);
+    }
+}
+
+Test(rc2d_rrespack_bc, colorBlock_gradientStaysClose) {
+    Uint8 block[64];
+    for (int i = 0; i < 16; i++)
+    {
+        block[i * 4 + 0] = (Uint8)(i * 16);
+        block[i * 4 + 1] = (Uint8)(255 - i * 16);
+        block[i * 4 + 2] = 64;
+        block[i * 4 + 3] = 255;
+    }
+
+    Uint8 out[8];
+    rc2d_rrespack_encodeColorBlock(block, out);
+
+    // 4 couleurs pour 16 valeurs réparties sur l'axe : l'erreur reste sous un sixième de l'étendue
+    int rgb[16][3];
+    rc2d_test_bc_decodeColorBlock(out, rgb);
+    for (int i = 0; i < 16; i++)
+    {
+        for (int c = 0; c < 3; c++) cr_assert_leq(SDL_abs(rgb[i][c] - block[i * 4 + c]), 40);
+    }
+}
+
+Test(rc2d_rrespack_bc, alphaBlock_endpointsAndIndices) {
+    Uint8 block[64] = { 0 };
+    for (int i = 0; i < 16; i++) block[i * 4 + 3] = (Uint8)(i * 17);
+
+    Uint8 out[8];
+    rc2d_rrespack_encodeAlphaBlock(block, out);
+
+    // alpha0 > alpha1 : mode 8 valeurs, extrémités au min et au max du bloc
+    cr_assert_eq(out[0], 255);
+    cr_assert_eq(out[1], 0);
+
+    int alpha[16];
+    rc2d_test_bc_decodeAlphaBlock(out, alpha);
+    cr_assert_eq(alpha[0], 0);
+    cr_assert_eq(alpha[15], 255);
+    for (int i = 0; i < 16; i++) cr_assert_leq(SDL_abs(alpha[i] - block[i * 4 + 3]), 255 / 14 + 1);
+}
+
+Test(rc2d_rrespack_bc, alphaBlock_uniformAlpha) {
+    Uint8 block[64] = { 0 };
+    for (int i = 0; i < 16; i++) block[i * 4 + 3] = 128;
+
+    Uint8 out[8];
+    rc2d_rrespack_encodeAlphaBlock(block, out);
+    cr_assert_eq(out[0], 128);
+    cr_assert_eq(out[1], 128);
+
+    int alpha[16];
+    rc2d_test_bc_decodeAlphaBlock(out, alpha);
+    for (int i = 0; i < 16; i++) cr_assert_eq(alpha[i], 128);
+}
+
+Test(rc2d_rrespack_bc, encodeBC_blockLayout) {
+    // 8x4 pixels : un bloc rouge opaque à gauche, un bloc bleu semi-transparent à droite
+    SDL_Surface* surface = SDL_CreateSurface(8, 4, SDL_PIXELFORMAT_RGBA32);
+    cr_assert_not_null(surface);
+    for (int y = 0; y < 4; y++)
+    {
+        Uint8* row = (Uint8*)surface->pixels + (size_t)y * surface->pitch;
+        for (int x = 0; x < 8; x++)
+        {
+            row[x * 4 + 0] = x < 4 ? 255 : 0;
+            row[x * 4 + 1] = 0;
+            row[x * 4 + 2] = x < 4 ? 0 : 255;
+            row[x * 4 + 3] = x < 4 ? 255 : 128;
+        }
+    }
+    cr_assert_not(rc2d_rrespack_isOpaque(surface));
+
+    // BC1 : 8 octets par bloc, blocs rangés ligne par ligne
+    Uint32 size = 0;
+    Uint8* bc1 = rc2d_rrespack_encodeBC(surface, true, &size);
+    cr_assert_not_null(bc1);
+    cr_assert_eq(size, 16);
+    cr_assert_eq(bc1[0] | (bc1[1] << 8), 0xF800);
+    cr_assert_eq(bc1[8] | (bc1[9] << 8), 0x001F);
+    SDL_free(bc1);
+
+    // BC3 : 16 octets par bloc, le bloc alpha avant le bloc couleur
+    Uint8* bc3 = rc2d_rrespack_encodeBC(surface, false, &size);
+    cr_assert_not_null(bc3);
+    cr_assert_eq(size, 32);
+    cr_assert_eq(bc3[0], 255);
+    cr_assert_eq(bc3[8] | (bc3[9] << 8), 0xF800);
+    cr_assert_eq(bc3[16], 128);
+    cr_assert_eq(bc3[17], 128);
+    cr_assert_eq(bc3[24] | (bc3[25] << 8), 0x001F);
+    SDL_free(bc3);
+
+    SDL_DestroySurface(surface);
+}
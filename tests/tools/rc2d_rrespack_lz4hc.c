@@ -0,0 +1,96 @@
+#include <rc2d_rrespack_encode.h>
+#include <criterion/criterion.h>
+#include <lz4/lz4.h>
+
+/**
+ * Compresse puis décompresse avec LZ4_decompress_safe (le décodeur du moteur) et vérifie l'aller-retour.
+ * Retourne la taille compressée.
+ */
+static int rc2d_test_lz4hc_roundTrip(const Uint8 *data, int size, int level)
+{
+    const int bound = LZ4_compressBound(size);
+    Uint8 *compressed = (Uint8 *)SDL_malloc((size_t)bound);
+    Uint8 *decompressed = (Uint8 *)SDL_malloc((size_t)size + 1);
+    cr_assert_not_null(compressed);
+    cr_assert_not_null(decompressed);
+
+    const int compressedSize = rc2d_rrespack_compressLZ4HC(data, compressed, size, bound, level);
+    cr_assert_gt(compressedSize, 0);
+    cr_assert_eq(LZ4_decompress_safe((const char *)compressed, (char *)decompressed, compressedSize, size), size);
+    cr_assert_arr_eq(decompressed, data, (size_t)size);
+
+    SDL_free(compressed);
+    SDL_free(decompressed);
+    return compressedSize;
+}
+
+Test(rc2d_rrespack_lz4hc, roundTripsSmallInputs) {
+    // Autour des limites du format : aucune correspondance sous 13 octets, 5 littéraux en fin de bloc
+    Uint8 data[300];
+    for (int i = 0; i < 300; i++) data[i] = (Uint8)((i * 7) % 3);
+
+    for (int size = 0; size <= 300; size++)
+    {
+        rc2d_test_lz4hc_roundTrip(data, size, RC2D_RRESPACK_LZ4HC_LEVEL_MIN);
+        rc2d_test_lz4hc_roundTrip(data, size, RC2D_RRESPACK_LZ4HC_LEVEL_MAX);
+    }
+}
+
+Test(rc2d_rrespack_lz4hc, beatsFastModeOnRepetitiveData) {
+    // Texte pseudo-aléatoire à partir d'un petit vocabulaire : beaucoup de correspondances à des distances variées
+    const char *words[8] = { "atlas ", "page ", "chunk ", "image ", "rres ", "pack ", "texture ", "index " };
+    const int size = 256 * 1024;
+    Uint8 *data = (Uint8 *)SDL_malloc((size_t)size);
+    cr_assert_not_null(data);
+
+    Uint32 seed = 12345;
+    int length = 0;
+    while (length < size)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        const char *word = words[seed >> 29];
+        for (size_t i = 0; word[i] != '\0' && length < size; i++) data[length++] = (Uint8)word[i];
+    }
+
+    const int bound = LZ4_compressBound(size);
+    char *fast = (char *)SDL_malloc((size_t)bound);
+    cr_assert_not_null(fast);
+    const int fastSize = LZ4_compress_default((const char *)data, fast, size, bound);
+    SDL_free(fast);
+
+    const int hcSize = rc2d_test_lz4hc_roundTrip(data, size, RC2D_RRESPACK_LZ4HC_LEVEL_DEFAULT);
+    cr_assert_lt(hcSize, fastSize);
+
+    // Un niveau plus élevé examine plus de candidats : jamais moins bon sur ces données
+    cr_assert_leq(rc2d_test_lz4hc_roundTrip(data, size, RC2D_RRESPACK_LZ4HC_LEVEL_MAX), hcSize);
+
+    SDL_free(data);
+}
+
+Test(rc2d_rrespack_lz4hc, roundTripsIncompressibleAndUniformData) {
+    const int size = 128 * 1024;
+    Uint8 *data = (Uint8 *)SDL_malloc((size_t)size);
+    cr_assert_not_null(data);
+
+    Uint32 seed = 1;
+    for (int i = 0; i < size; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        data[i] = (Uint8)(seed >> 24);
+    }
+    cr_assert_leq(rc2d_test_lz4hc_roundTrip(data, size, 0), LZ4_compressBound(size));
+
+    // Correspondances plus longues que la fenêtre et chevauchantes (offset 1)
+    SDL_memset(data, 0xAB, (size_t)size);
+    cr_assert_lt(rc2d_test_lz4hc_roundTrip(data, size, 0), size / 200);
+
+    SDL_free(data);
+}
+
+Test(rc2d_rrespack_lz4hc, failsWhenOutputIsTooSmall) {
+    Uint8 data[64];
+    for (int i = 0; i < 64; i++) data[i] = (Uint8)(i * 37);
+
+    Uint8 output[32];
+    cr_assert_eq(rc2d_rrespack_compressLZ4HC(data, output, sizeof(data), sizeof(output), 0), 0);
+}
@@ -0,0 +1,1500 @@
+#include <RC2D/RC2D.h>
+#include <RC2D/RC2D_rres.h>
+
+#include <SDL3/SDL_filesystem.h>
+#include <SDL3/SDL_iostream.h>
+#include <SDL3/SDL_process.h>
+#include <SDL3/SDL_timer.h>
+#include <SDL3_image/SDL_image.h>
+
+#include <lz4/lz4.h> // Compression algorithm: LZ4
+
+#include "rc2d_rrespack_encode.h" // Encodeurs BC1/BC3 et LZ4 haute compression
+
+#include <stdlib.h> // Required for: exit, EXIT_SUCCESS, EXIT_FAILURE
+
+/**
+ * Packer de ressources hors ligne de RC2D.
+ *
+ * Range les PNG d'un dossier (sous-dossiers compris) dans un pack .rres lu par rc2d_rres_openPack :
+ * - les images dont les côtés ne dépassent pas --max-image-size sont regroupées dans des pages d'atlas (packer MaxRects
+ *   de RC2D_atlas), entourées d'une bordure de --padding pixels qui répète leurs bords. Chaque page est un chunk IMGE
+ *   "<atlas>_<n>.png", réduite à la zone réellement occupée ;
+ * - les autres images ont chacune leur chunk IMGE, nommé par leur chemin relatif (ex : "ui/title.png") ;
+ * - le chunk RAWD "<atlas>.index" décrit la place de chaque image dans les pages (voir plus bas) ;
+ * - un répertoire central (CDIR) permet de retrouver les chunks par nom (rc2d_rres_newImageFromPack).
+ *
+ * Formats (--target) :
+ * - desktop : BC3 (DXT5), ou BC1 (DXT1) quand l'image ou toutes les images de la page sont opaques, encodés par l'outil ;
+ * - mobile : ASTC 4x4, encodé par l'outil externe astcenc (--astcenc, cherché dans le PATH par défaut).
+ *   Sans astcenc, les images restent en RGBA8 (avec un avertissement) ;
+ * - rgba : RGBA8 non compressé.
+ * BC7 n'a pas de format de pixel rres (rresPixelFormat) : il n'est pas proposé. Les formats par blocs demandent des
+ * dimensions multiples de 4 (Direct3D 12) : dans les pages, chaque zone est arrondie à 4 pixels (aucun bloc n'est partagé
+ * entre deux images) ; une image isolée dont les dimensions ne sont pas multiples de 4 reste en RGBA8.
+ *
+ * Chaque chunk est compressé en LZ4 haute compression (chaînes de hachage, niveau --level de 1 à 12) quand il y gagne,
+ * puis commence à un offset multiple de --align (4096 par défaut, une page mémoire) : dans le pack projeté en mémoire,
+ * aucune page n'est partagée entre deux chunks. L'alignement est écrit dans rresFileHeader::reserved.
+ *
+ * Les PNG sont hachés (MD5), décodés, encodés et compressés en parallèle par le système de jobs (--jobs). Les chunks
+ * encodés sont gardés dans un dossier de cache (--cache, "<sortie>.cache" par défaut) sous une empreinte de leur contenu
+ * (images, placement et options) : seuls les chunks dont une image a changé sont réencodés, et le pack n'est pas
+ * réécrit quand rien n'a changé. Le PNG d'une image inchangée n'est même pas décodé.
+ *
+ * Index de l'atlas (chunk RAWD) : propCount = 2, props[0] = taille des entrées en octets, props[1] = nombre d'entrées,
+ * puis pour chaque image (Uint32) : id du chunk de la page, x, y, largeur, hauteur (en pixels dans la page, bordure
+ * non comprise), taille du nom ('\0' et alignement sur 4 octets compris) et le nom (chemin relatif du PNG).
+ *
+ * Usage : rc2d_rrespack --input dossier --output pack.rres [--target desktop|mobile|rgba] [--page-size N]
+ *                       [--max-image-size N] [--padding N] [--align N] [--compress 0|1] [--level N] [--jobs N]
+ *                       [--cache dossier] [--astcenc chemin] [--atlas nom]
+ *
+ * Tout le travail est fait dans rc2d_engine_setup, avant l'initialisation du moteur : ni fenêtre ni GPU ne sont nécessaires.
+ *
+ * Exemple :
+ *   ./rc2d_rrespack --input assets/sprites --output assets/sprites.rres --target desktop
+ */
+
+/**
+ * Version du cache : à incrémenter quand le contenu d'un chunk change pour les mêmes entrées (encodeur, format...).
+ */
+#define RC2D_RRESPACK_CACHE_VERSION 2
+
+/**
+ * En-tête des données d'un chunk IMGE : propCount (4) + width, height, format, mipmaps.
+ */
+#define RC2D_RRESPACK_IMAGE_HEADER_SIZE 20
+
+typedef enum RC2D_RrespackTarget {
+    RC2D_RRESPACK_TARGET_DESKTOP, // BC1/BC3
+    RC2D_RRESPACK_TARGET_MOBILE,  // ASTC 4x4 (astcenc)
+    RC2D_RRESPACK_TARGET_RGBA     // RGBA8 non compressé
+} RC2D_RrespackTarget;
+
+typedef struct RC2D_RrespackInput {
+    // Chemin relatif au dossier d'entrée (séparateur '/')
+    char* name;
+
+    // MD5 du fichier PNG
+    unsigned int hash[4];
+
+    Uint32 width;
+    Uint32 height;
+
+    // Pixels RGBA32, décodés seulement quand le chunk de l'image doit être encodé
+    SDL_Surface* surface;
+
+    // Page d'atlas et zone réservée (bordure et arrondi compris), ou -1 pour une image dans son propre chunk
+    int page;
+    RC2D_AtlasRect cell;
+
+    bool failed;
+} RC2D_RrespackInput;
+
+typedef struct RC2D_RrespackPage {
+    RC2D_AtlasPacker* packer;
+
+    // Dimensions finales : zone occupée par les images
+    Uint32 width;
+    Uint32 height;
+} RC2D_RrespackPage;
+
+typedef struct RC2D_RrespackChunk {
+    char* name;
+    unsigned int id;
+
+    // Page d'atlas, ou image isolée (-1 si le chunk n'est ni l'un ni l'autre)
+    int page;
+    int input;
+
+    // Empreinte du contenu du chunk : nom du fichier dans le cache
+    unsigned int key[4];
+    char keyHex[33];
+
+    // rresResourceChunkInfo suivi des données empaquetées, écrit tel quel dans le pack
+    unsigned char* blob;
+    size_t blobSize;
+
+    // cached : retrouvé dans le cache ; cacheable : à garder dans le cache une fois encodé
+    bool cached;
+    bool cacheable;
+    bool failed;
+} RC2D_RrespackChunk;
+
+typedef struct RC2D_RrespackManifestEntry {
+    char* name;
+    unsigned int hash[4];
+    Uint32 width;
+    Uint32 height;
+} RC2D_RrespackManifestEntry;
+
+static struct {
+    const char* input;
+    const char* output;
+    const char* cache;
+    const char* astcenc;
+    const char* atlas;
+    RC2D_RrespackTarget target;
+    Uint32 page_size;
+    Uint32 max_image_size;
+    Uint32 padding;
+    Uint32 align;
+    bool compress;
+    int level;
+    int jobs;
+
+    char* cache_dir;
+
+    /**
+     * Les tableaux sont alloués avec RC2D_malloc sur le thread principal. Tout ce qui est alloué par les jobs
+     * (fichiers, surfaces, données encodées) passe par SDL_malloc : le suivi de RC2D_malloc (RC2D_MEMORY_DEBUG_ENABLED)
+     * n'est pas protégé contre les accès concurrents.
+     */
+    RC2D_RrespackInput* inputs;
+    Uint32 input_count;
+
+    RC2D_RrespackPage* pages;
+    Uint32 page_count;
+
+    RC2D_RrespackChunk* chunks;
+    Uint32 chunk_count;
+
+    // Manifeste du passage précédent : empreinte et dimensions de chaque PNG, empreinte du pack écrit
+    RC2D_RrespackManifestEntry* manifest;
+    Uint32 manifest_count;
+    unsigned int manifest_pack[4];
+    bool manifest_has_pack;
+
+    SDL_AtomicInt decoded;
+    SDL_AtomicInt astcenc_missing;
+} rc2d_rrespack = {
+    .target = RC2D_RRESPACK_TARGET_DESKTOP,
+    .astcenc = "astcenc",
+    .atlas = "atlas",
+    .page_size = 2048,
+    .max_image_size = 256,
+    .padding = 1,
+    .align = 4096,
+    .compress = true,
+    .level = RC2D_RRESPACK_LZ4HC_LEVEL_DEFAULT,
+    .jobs = 0
+};
+
+static bool rc2d_rrespack_isPowerOfTwo(Uint32 value)
+{
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+static bool rc2d_rrespack_parseTarget(const char* name)
+{
+    if (SDL_strcmp(name, "desktop") == 0) rc2d_rrespack.target = RC2D_RRESPACK_TARGET_DESKTOP;
+    else if (SDL_strcmp(name, "mobile") == 0) rc2d_rrespack.target = RC2D_RRESPACK_TARGET_MOBILE;
+    else if (SDL_strcmp(name, "rgba") == 0) rc2d_rrespack.target = RC2D_RRESPACK_TARGET_RGBA;
+    else return false;
+
+    return true;
+}
+
+static bool rc2d_rrespack_parseArgs(int argc, char* argv[])
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (value == NULL)
+        {
+            RC2D_log(RC2D_LOG_CRITICAL, "Missing value for argument %s", arg);
+            return false;
+        }
+
+        if (SDL_strcmp(arg, "--target") == 0)
+        {
+            if (!rc2d_rrespack_parseTarget(value))
+            {
+                RC2D_log(RC2D_LOG_CRITICAL, "Unknown target %s (expected desktop, mobile or rgba)", value);
+                return false;
+            }
+        }
+        else if (SDL_strcmp(arg, "--input") == 0) rc2d_rrespack.input = value;
+        else if (SDL_strcmp(arg, "--output") == 0) rc2d_rrespack.output = value;
+        else if (SDL_strcmp(arg, "--cache") == 0) rc2d_rrespack.cache = value;
+        else if (SDL_strcmp(arg, "--astcenc") == 0) rc2d_rrespack.astcenc = value;
+        else if (SDL_strcmp(arg, "--atlas") == 0) rc2d_rrespack.atlas = value;
+        else if (SDL_strcmp(arg, "--page-size") == 0) rc2d_rrespack.page_size = (Uint32)SDL_strtoul(value, NULL, 10);
+        else if (SDL_strcmp(arg, "--max-image-size") == 0) rc2d_rrespack.max_image_size = (Uint32)SDL_strtoul(value, NULL, 10);
+        else if (SDL_strcmp(arg, "--padding") == 0) rc2d_rrespack.padding = (Uint32)SDL_strtoul(value, NULL, 10);
+        else if (SDL_strcmp(arg, "--align") == 0) rc2d_rrespack.align = (Uint32)SDL_strtoul(value, NULL, 10);
+        else if (SDL_strcmp(arg, "--compress") == 0) rc2d_rrespack.compress = SDL_atoi(value) != 0;
+        else if (SDL_strcmp(arg, "--level") == 0) rc2d_rrespack.level = SDL_atoi(value);
+        else if (SDL_strcmp(arg, "--jobs") == 0) rc2d_rrespack.jobs = SDL_atoi(value);
+        else
+        {
+            RC2D_log(RC2D_LOG_CRITICAL, "Unknown argument %s", arg);
+            return false;
+        }
+        i++;
+    }
+
+    if (rc2d_rrespack.input == NULL || rc2d_rrespack.output == NULL)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "--input and --output are required");
+        return false;
+    }
+
+    if (!rc2d_rrespack_isPowerOfTwo(rc2d_rrespack.page_size) || rc2d_rrespack.page_size < 64 || rc2d_rrespack.page_size > 16384)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "--page-size must be a power of two between 64 and 16384");
+        return false;
+    }
+
+    if (rc2d_rrespack.padding > 16 || rc2d_rrespack.max_image_size + 2 * rc2d_rrespack.padding > rc2d_rrespack.page_size)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "--padding must be at most 16 and --max-image-size plus padding must fit in a page");
+        return false;
+    }
+
+    if (rc2d_rrespack.align > 1048576 || (rc2d_rrespack.align > 1 && !rc2d_rrespack_isPowerOfTwo(rc2d_rrespack.align)))
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "--align must be 0, 1 or a power of two up to 1048576");
+        return false;
+    }
+
+    if (rc2d_rrespack.jobs < 0)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "--jobs must be 0 (logical cores - 1) or greater");
+        return false;
+    }
+
+    return true;
+}
+
+static void rc2d_rrespack_hashToHex(const unsigned int hash[4], char hex[33])
+{
+    SDL_snprintf(hex, 33, "%08x%08x%08x%08x", hash[0], hash[1], hash[2], hash[3]);
+}
+
+static bool rc2d_rrespack_hexToHash(const char* hex, unsigned int hash[4])
+{
+    for (int i = 0; i < 4; i++)
+    {
+        unsigned int value = 0;
+        for (int j = 0; j < 8; j++)
+        {
+            const char c = hex[i * 8 + j];
+            unsigned int digit;
+            if (c >= '0' && c <= '9') digit = (unsigned int)(c - '0');
+            else if (c >= 'a' && c <= 'f') digit = (unsigned int)(c - 'a' + 10);
+            else return false;
+            value = (value << 4) | digit;
+        }
+        hash[i] = value;
+    }
+
+    return true;
+}
+
+static int SDLCALL rc2d_rrespack_compareStrings(const void* a, const void* b)
+{
+    return SDL_strcmp(*(const char* const*)a, *(const char* const*)b);
+}
+
+static int SDLCALL rc2d_rrespack_compareManifestEntries(const void* a, const void* b)
+{
+    return SDL_strcmp(((const RC2D_RrespackManifestEntry*)a)->name, ((const RC2D_RrespackManifestEntry*)b)->name);
+}
+
+static void rc2d_rrespack_hashUint32(RC2D_RresMD5Context* ctx, Uint32 value)
+{
+    rc2d_rres_md5Update(ctx, &value, sizeof(value));
+}
+
+/* --------------------------------------------------------------------------------------------------------------- */
+/* Manifeste du cache                                                                                               */
+/* --------------------------------------------------------------------------------------------------------------- */
+
+static char* rc2d_rrespack_getCachePath(const char* fileName)
+{
+    char* path = NULL;
+    if (SDL_asprintf(&path, "%s/%s", rc2d_rrespack.cache_dir, fileName) < 0) return NULL;
+    return path;
+}
+
+/**
+ * Lit le manifeste du passage précédent. Un manifeste absent ou d'une autre version est ignoré : tout est réencodé.
+ */
+static void rc2d_rrespack_loadManifest(void)
+{
+    char* path = rc2d_rrespack_getCachePath("manifest.txt");
+    if (path == NULL) return;
+
+    size_t size = 0;
+    char* text = (char*)SDL_LoadFile(path, &size);
+    SDL_free(path);
+    if (text == NULL) return;
+
+    // Une entrée par ligne au plus
+    Uint32 capacity = 1;
+    for (size_t i = 0; i < size; i++) capacity += text[i] == '\n';
+    rc2d_rrespack.manifest = RC2D_calloc(capacity, sizeof(RC2D_RrespackManifestEntry));
+
+    bool versionMatches = false;
+    char* line = text;
+    while (rc2d_rrespack.manifest != NULL && line != NULL && *line != '\0')
+    {
+        char* next = SDL_strchr(line, '\n');
+        if (next != NULL) *next++ = '\0';
+        const size_t length = SDL_strlen(line);
+        if (length > 0 && line[length - 1] == '\r') line[length - 1] = '\0';
+
+        if (!versionMatches)
+        {
+            // La première ligne donne la version du cache
+            if (SDL_strncmp(line, "rc2d_rrespack ", 14) != 0 || SDL_atoi(line + 14) != RC2D_RRESPACK_CACHE_VERSION) break;
+            versionMatches = true;
+        }
+        else if (SDL_strncmp(line, "pack ", 5) == 0 && SDL_strlen(line) >= 5 + 32)
+        {
+            rc2d_rrespack.manifest_has_pack = rc2d_rrespack_hexToHash(line + 5, rc2d_rrespack.manifest_pack);
+        }
+        else if (SDL_strncmp(line, "input ", 6) == 0 && SDL_strlen(line) > 6 + 32)
+        {
+            // input <md5> <largeur> <hauteur> <nom>
+            RC2D_RrespackManifestEntry* entry = &rc2d_rrespack.manifest[rc2d_rrespack.manifest_count];
+            char* cursor = line + 6 + 32;
+            if (rc2d_rrespack_hexToHash(line + 6, entry->hash) && *cursor == ' ')
+            {
+                entry->width = (Uint32)SDL_strtoul(cursor + 1, &cursor, 10);
+                entry->height = (Uint32)SDL_strtoul(cursor, &cursor, 10);
+                if (*cursor == ' ' && cursor[1] != '\0')
+                {
+                    entry->name = SDL_strdup(cursor + 1);
+                    if (entry->name != NULL) rc2d_rrespack.manifest_count++;
+                }
+            }
+        }
+
+        line = next;
+    }
+
+    SDL_free(text);
+
+    if (rc2d_rrespack.manifest_count > 1)
+    {
+        SDL_qsort(rc2d_rrespack.manifest, rc2d_rrespack.manifest_count, sizeof(RC2D_RrespackManifestEntry), rc2d_rrespack_compareManifestEntries);
+    }
+}
+
+static const RC2D_RrespackManifestEntry* rc2d_rrespack_findManifestEntry(const char* name)
+{
+    if (rc2d_rrespack.manifest_count == 0) return NULL;
+
+    RC2D_RrespackManifestEntry key = { 0 };
+    key.name = (char*)name;
+    return (const RC2D_RrespackManifestEntry*)SDL_bsearch(&key, rc2d_rrespack.manifest, rc2d_rrespack.manifest_count,
+        sizeof(RC2D_RrespackManifestEntry), rc2d_rrespack_compareManifestEntries);
+}
+
+static bool rc2d_rrespack_saveManifest(const unsigned int packKey[4])
+{
+    char* path = rc2d_rrespack_getCachePath("manifest.txt");
+    if (path == NULL) return false;
+
+    SDL_IOStream* io = SDL_IOFromFile(path, "w");
+    SDL_free(path);
+    if (io == NULL)
+    {
+        RC2D_log(RC2D_LOG_WARN, "Failed to write the cache manifest: %s", SDL_GetError());
+        return false;
+    }
+
+    char hex[33];
+    rc2d_rrespack_hashToHex(packKey, hex);
+    SDL_IOprintf(io, "rc2d_rrespack %d\n", RC2D_RRESPACK_CACHE_VERSION);
+    SDL_IOprintf(io, "pack %s\n", hex);
+
+    for (Uint32 i = 0; i < rc2d_rrespack.input_count; i++)
+    {
+        const RC2D_RrespackInput* input = &rc2d_rrespack.inputs[i];
+        rc2d_rrespack_hashToHex(input->hash, hex);
+        SDL_IOprintf(io, "input %s %u %u %s\n", hex, input->width, input->height, input->name);
+    }
+
+    return SDL_CloseIO(io);
+}
+
+/* --------------------------------------------------------------------------------------------------------------- */
+/* Entrées : liste, empreintes et décodage                                                                          */
+/* --------------------------------------------------------------------------------------------------------------- */
+
+static bool rc2d_rrespack_listInputs(void)
+{
+    int count = 0;
+    char** files = SDL_GlobDirectory(rc2d_rrespack.input, NULL, 0, &count);
+    if (files == NULL)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "Failed to list %s: %s", rc2d_rrespack.input, SDL_GetError());
+        return false;
+    }
+
+    // Ordre stable d'un passage à l'autre : le placement dans l'atlas et l'empreinte du pack en dépendent
+    SDL_qsort(files, (size_t)count, sizeof(char*), rc2d_rrespack_compareStrings);
+
+    rc2d_rrespack.inputs = RC2D_calloc((size_t)SDL_max(count, 1), sizeof(RC2D_RrespackInput));
+    if (rc2d_rrespack.inputs == NULL)
+    {
+        SDL_free(files);
+        return false;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        const size_t length = SDL_strlen(files[i]);
+        if (length < 4 || SDL_strcasecmp(files[i] + length - 4, ".png") != 0) continue;
+
+        if (length >= RRES_MAX_FILENAME_SIZE - 4)
+        {
+            RC2D_log(RC2D_LOG_WARN, "Skipping %s: name longer than %d characters", files[i], RRES_MAX_FILENAME_SIZE - 4);
+            continue;
+        }
+
+        RC2D_RrespackInput* input = &rc2d_rrespack.inputs[rc2d_rrespack.input_count];
+        input->name = SDL_strdup(files[i]);
+        input->page = -1;
+        if (input->name != NULL) rc2d_rrespack.input_count++;
+    }
+
+    SDL_free(files);
+    return true;
+}
+
+/**
+ * Décode le PNG d'une entrée en RGBA32, depuis `data` s'il est fourni, sinon depuis le fichier.
+ */
+static bool rc2d_rrespack_decodeInput(RC2D_RrespackInput* input, const void* data, size_t size)
+{
+    SDL_Surface* loaded = NULL;
+    if (data != NULL)
+    {
+        loaded = IMG_Load_IO(SDL_IOFromConstMem(data, size), true);
+    }
+    else
+    {
+        char* path = NULL;
+        if (SDL_asprintf(&path, "%s/%s", rc2d_rrespack.input, input->name) < 0) return false;
+        loaded = IMG_Load(path);
+        SDL_free(path);
+    }
+
+    if (loaded == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to decode %s: %s", input->name, SDL_GetError());
+        return false;
+    }
+
+    SDL_Surface* surface = SDL_ConvertSurface(loaded, SDL_PIXELFORMAT_RGBA32);
+    SDL_DestroySurface(loaded);
+    if (surface == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to convert %s to RGBA32: %s", input->name, SDL_GetError());
+        return false;
+    }
+
+    // Les dimensions viennent du manifeste : le fichier ne doit pas avoir changé entre temps
+    if (input->width != 0 && ((Uint32)surface->w != input->width || (Uint32)surface->h != input->height))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "%s changed while packing", input->name);
+        SDL_DestroySurface(surface);
+        return false;
+    }
+
+    input->width = (Uint32)surface->w;
+    input->height = (Uint32)surface->h;
+    input->surface = surface;
+    SDL_AddAtomicInt(&rc2d_rrespack.decoded, 1);
+    return true;
+}
+
+/**
+ * Job : empreinte MD5 de chaque PNG. Les dimensions d'un PNG inchangé viennent du manifeste ; les autres sont décodés.
+ */
+static void rc2d_rrespack_hashInputs(Uint32 start, Uint32 end, void* data)
+{
+    (void)data;
+
+    for (Uint32 i = start; i < end; i++)
+    {
+        RC2D_RrespackInput* input = &rc2d_rrespack.inputs[i];
+
+        char* path = NULL;
+        size_t size = 0;
+        void* bytes = NULL;
+        if (SDL_asprintf(&path, "%s/%s", rc2d_rrespack.input, input->name) >= 0)
+        {
+            bytes = SDL_LoadFile(path, &size);
+            SDL_free(path);
+        }
+
+        if (bytes == NULL)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "Failed to read %s: %s", input->name, SDL_GetError());
+            input->failed = true;
+            continue;
+        }
+
+        rc2d_rres_computeMD5(bytes, size, input->hash);
+
+        const RC2D_RrespackManifestEntry* entry = rc2d_rrespack_findManifestEntry(input->name);
+        if (entry != NULL && SDL_memcmp(entry->hash, input->hash, sizeof(input->hash)) == 0 && entry->width > 0 && entry->height > 0)
+        {
+            input->width = entry->width;
+            input->height = entry->height;
+        }
+        else if (!rc2d_rrespack_decodeInput(input, bytes, size))
+        {
+            input->failed = true;
+        }
+
+        SDL_free(bytes);
+    }
+}
+
+/* --------------------------------------------------------------------------------------------------------------- */
+/* Atlas                                                                                                            */
+/* --------------------------------------------------------------------------------------------------------------- */
+
+static bool rc2d_rrespack_isBlockTarget(void)
+{
+    return rc2d_rrespack.target != RC2D_RRESPACK_TARGET_RGBA;
+}
+
+static int SDLCALL rc2d_rrespack_compareCells(const void* a, const void* b)
+{
+    const RC2D_RrespackInput* ia = &rc2d_rrespack.inputs[*(const Uint32*)a];
+    const RC2D_RrespackInput* ib = &rc2d_rrespack.inputs[*(const Uint32*)b];
+
+    // Les plus hautes d'abord, puis les plus larges : moins de place perdue avec MaxRects
+    if (ia->cell.height != ib->cell.height) return ia->cell.height > ib->cell.height ? -1 : 1;
+    if (ia->cell.width != ib->cell.width) return ia->cell.width > ib->cell.width ? -1 : 1;
+    return SDL_strcmp(ia->name, ib->name);
+}
+
+static bool rc2d_rrespack_packAtlas(void)
+{
+    if (rc2d_rrespack.max_image_size == 0 || rc2d_rrespack.input_count == 0) return true;
+
+    Uint32* order = RC2D_malloc(rc2d_rrespack.input_count * sizeof(Uint32));
+    if (order == NULL) return false;
+
+    const bool blocks = rc2d_rrespack_isBlockTarget();
+    Uint32 count = 0;
+    for (Uint32 i = 0; i < rc2d_rrespack.input_count; i++)
+    {
+        RC2D_RrespackInput* input = &rc2d_rrespack.inputs[i];
+        if (input->width > rc2d_rrespack.max_image_size || input->height > rc2d_rrespack.max_image_size) continue;
+
+        // Zones arrondies à 4 pixels pour les formats par blocs : toutes les positions restent alignées sur les blocs
+        input->cell.width = input->width + 2 * rc2d_rrespack.padding;
+        input->cell.height = input->height + 2 * rc2d_rrespack.padding;
+        if (blocks)
+        {
+            input->cell.width = (input->cell.width + 3) & ~3u;
+            input->cell.height = (input->cell.height + 3) & ~3u;
+        }
+        order[count++] = i;
+    }
+
+    SDL_qsort(order, count, sizeof(Uint32), rc2d_rrespack_compareCells);
+
+    bool success = true;
+    for (Uint32 i = 0; i < count && success; i++)
+    {
+        RC2D_RrespackInput* input = &rc2d_rrespack.inputs[order[i]];
+
+        Uint32 page = 0;
+        while (page < rc2d_rrespack.page_count &&
+               !rc2d_atlas_packerInsert(rc2d_rrespack.pages[page].packer, input->cell.width, input->cell.height, &input->cell))
+        {
+            page++;
+        }
+
+        if (page == rc2d_rrespack.page_count)
+        {
+            RC2D_RrespackPage* pages = RC2D_realloc(rc2d_rrespack.pages, (page + 1) * sizeof(RC2D_RrespackPage));
+            if (pages == NULL)
+            {
+                success = false;
+                break;
+            }
+            rc2d_rrespack.pages = pages;
+            SDL_zero(pages[page]);
+            rc2d_rrespack.page_count++;
+
+            pages[page].packer = rc2d_atlas_createPacker(rc2d_rrespack.page_size, rc2d_rrespack.page_size);
+            success = pages[page].packer != NULL &&
+                      rc2d_atlas_packerInsert(pages[page].packer, input->cell.width, input->cell.height, &input->cell);
+        }
+
+        input->page = (int)page;
+
+        // La page est réduite à la zone occupée (multiple de 4 pour les formats par blocs, comme les zones)
+        RC2D_RrespackPage* target = &rc2d_rrespack.pages[page];
+        target->width = SDL_max(target->width, input->cell.x + input->cell.width);
+        target->height = SDL_max(target->height, input->cell.y + input->cell.height);
+    }
+
+    RC2D_free(order);
+    return success;
+}
+
+/* --------------------------------------------------------------------------------------------------------------- */
+/* Encodeurs                                                                                                        */
+/* --------------------------------------------------------------------------------------------------------------- */
+
+/**
+ * Encode une image en ASTC 4x4 avec astcenc (un thread par appel : les chunks sont déjà encodés en parallèle).
+ * Retourne NULL si astcenc est absent ou a échoué.
+ */
+static Uint8* rc2d_rrespack_encodeASTC(const RC2D_RrespackChunk* chunk, SDL_Surface* surface, Uint32* size)
+{
+    if (SDL_GetAtomicInt(&rc2d_rrespack.astcenc_missing) != 0) return NULL;
+
+    char* source = NULL;
+    char* destination = NULL;
+    if (SDL_asprintf(&source, "%s/%s.png", rc2d_rrespack.cache_dir, chunk->keyHex) < 0) return NULL;
+    if (SDL_asprintf(&destination, "%s/%s.astc", rc2d_rrespack.cache_dir, chunk->keyHex) < 0)
+    {
+        SDL_free(source);
+        return NULL;
+    }
+
+    Uint8* data = NULL;
+    if (!IMG_SavePNG(surface, source))
+    {
+        RC2D_log(RC2D_LOG_WARN, "%s: failed to write the astcenc input: %s", chunk->name, SDL_GetError());
+    }
+    else
+    {
+        const char* args[] = { rc2d_rrespack.astcenc, "-cl", source, destination, "4x4", "-medium", "-j", "1", "-silent", NULL };
+        SDL_Process* process = SDL_CreateProcess(args, false);
+        int exitCode = -1;
+        if (process == NULL)
+        {
+            if (SDL_CompareAndSwapAtomicInt(&rc2d_rrespack.astcenc_missing, 0, 1))
+            {
+                RC2D_log(RC2D_LOG_WARN, "Failed to run %s (%s): images are kept as RGBA8", rc2d_rrespack.astcenc, SDL_GetError());
+            }
+        }
+        else
+        {
+            SDL_WaitProcess(process, true, &exitCode);
+            SDL_DestroyProcess(process);
+        }
+
+        size_t fileSize = 0;
+        Uint8* file = exitCode == 0 ? (Uint8*)SDL_LoadFile(destination, &fileSize) : NULL;
+
+        // En-tête .astc : magic 0x5CA1AB13, dimensions des blocs (x, y, z), puis dimensions de l'image sur 3 octets
+        const Uint32 blocks = (((Uint32)surface->w + 3) / 4) * (((Uint32)surface->h + 3) / 4);
+        if (file != NULL && fileSize == 16 + (size_t)blocks * 16 &&
+            file[0] == 0x13 && file[1] == 0xAB && file[2] == 0xA1 && file[3] == 0x5C &&
+            file[4] == 4 && file[5] == 4 && file[6] == 1 &&
+            (Uint32)(file[7] | (file[8] << 8) | (file[9] << 16)) == (Uint32)surface->w &&
+            (Uint32)(file[10] | (file[11] << 8) | (file[12] << 16)) == (Uint32)surface->h)
+        {
+            SDL_memmove(file, file + 16, (size_t)blocks * 16);
+            *size = blocks * 16;
+            data = file;
+        }
+        else
+        {
+            if (process != NULL) RC2D_log(RC2D_LOG_WARN, "%s: astcenc failed (exit code %d), kept as RGBA8", chunk->name, exitCode);
+            SDL_free(file);
+        }
+    }
+
+    SDL_RemovePath(source);
+    SDL_RemovePath(destination);
+    SDL_free(source);
+    SDL_free(destination);
+    return data;
+}
+
+static Uint8* rc2d_rrespack_copyRGBA(const SDL_Surface* surface, Uint32* size)
+{
+    const size_t rowSize = (size_t)surface->w * 4;
+    *size = (Uint32)(rowSize * (size_t)surface->h);
+
+    Uint8* data = (Uint8*)SDL_malloc(*size);
+    if (data == NULL) return NULL;
+
+    for (int y = 0; y < surface->h; y++)
+    {
+        SDL_memcpy(data + (size_t)y * rowSize, (const Uint8*)surface->pixels + (size_t)y * surface->pitch, rowSize);
+    }
+
+    return data;
+}
+
+/* --------------------------------------------------------------------------------------------------------------- */
+/* Chunks                                                                                                           */
+/* --------------------------------------------------------------------------------------------------------------- */
+
+/**
+ * Construit le blob d'un chunk (rresResourceChunkInfo + données empaquetées) à partir de ses données brutes
+ * (propCount, props, puis contenu). Les données sont compressées en LZ4 seulement si elles y gagnent.
+ */
+static bool rc2d_rrespack_buildChunkBlob(RC2D_RrespackChunk* chunk, const char type[4], const Uint8* raw, Uint32 rawSize, bool compress)
+{
+    const int bound = compress ? LZ4_compressBound((int)rawSize) : 0;
+    const size_t capacity = sizeof(rresResourceChunkInfo) + SDL_max((size_t)rawSize, (size_t)bound);
+
+    Uint8* blob = (Uint8*)SDL_malloc(capacity);
+    if (blob == NULL) return false;
+
+    rresResourceChunkInfo info;
+    SDL_zero(info);
+    SDL_memcpy(info.type, type, 4);
+    info.id = chunk->id;
+    info.compType = RRES_COMP_NONE;
+    info.cipherType = RRES_CIPHER_NONE;
+    info.baseSize = rawSize;
+    info.packedSize = rawSize;
+
+    Uint8* packed = blob + sizeof(rresResourceChunkInfo);
+    const int compressedSize = compress ? rc2d_rrespack_compressLZ4HC(raw, packed, (int)rawSize, bound, rc2d_rrespack.level) : 0;
+    if (compressedSize > 0 && (Uint32)compressedSize < rawSize)
+    {
+        info.compType = RRES_COMP_LZ4;
+        info.packedSize = (unsigned int)compressedSize;
+    }
+    else
+    {
+        SDL_memcpy(packed, raw, rawSize);
+    }
+
+    info.crc32 = rresComputeCRC32(packed, (int)info.packedSize);
+    SDL_memcpy(blob, &info, sizeof(info));
+
+    chunk->blob = blob;
+    chunk->blobSize = sizeof(rresResourceChunkInfo) + info.packedSize;
+    return true;
+}
+
+static bool rc2d_rrespack_buildImageChunk(RC2D_RrespackChunk* chunk, Uint32 width, Uint32 height, int format, const Uint8* pixels, Uint32 size)
+{
+    const Uint32 rawSize = RC2D_RRESPACK_IMAGE_HEADER_SIZE + size;
+    Uint8* raw = (Uint8*)SDL_malloc(rawSize);
+    if (raw == NULL) return false;
+
+    // propCount, width, height, format, mipmaps
+    const unsigned int header[5] = { 4, width, height, (unsigned int)format, 1 };
+    SDL_memcpy(raw, header, sizeof(header));
+    SDL_memcpy(raw + RC2D_RRESPACK_IMAGE_HEADER_SIZE, pixels, size);
+
+    const bool success = rc2d_rrespack_buildChunkBlob(chunk, "IMGE", raw, rawSize, rc2d_rrespack.compress);
+    SDL_free(raw);
+    return success;
+}
+
+/**
+ * Encode une image dans le format de la cible (RGBA8 quand le format par blocs n'est pas possible).
+ */
+static bool rc2d_rrespack_encodeImage(RC2D_RrespackChunk* chunk, SDL_Surface* surface, bool opaque)
+{
+    const Uint32 width = (Uint32)surface->w;
+    const Uint32 height = (Uint32)surface->h;
+    const bool blockAligned = (width % 4) == 0 && (height % 4) == 0;
+
+    int format = RRES_PIXELFORMAT_UNCOMP_R8G8B8A8;
+    Uint32 size = 0;
+    Uint8* pixels = NULL;
+
+    if (rc2d_rrespack.target == RC2D_RRESPACK_TARGET_DESKTOP && blockAligned)
+    {
+        pixels = rc2d_rrespack_encodeBC(surface, opaque, &size);
+        if (pixels == NULL) return false;
+        format = opaque ? RRES_PIXELFORMAT_COMP_DXT1_RGB : RRES_PIXELFORMAT_COMP_DXT5_RGBA;
+    }
+    else if (rc2d_rrespack.target == RC2D_RRESPACK_TARGET_MOBILE && blockAligned)
+    {
+        pixels = rc2d_rrespack_encodeASTC(chunk, surface, &size);
+        if (pixels != NULL) format = RRES_PIXELFORMAT_COMP_ASTC_4x4_RGBA;
+
+        // Repli RGBA8 : le résultat n'est pas gardé, le prochain passage réessaiera astcenc
+        else chunk->cacheable = false;
+    }
+    else if (rc2d_rrespack.target != RC2D_RRESPACK_TARGET_RGBA)
+    {
+        RC2D_log(RC2D_LOG_INFO, "%s: %ux%u is not a multiple of 4, kept as RGBA8", chunk->name, width, height);
+    }
+
+    if (pixels == NULL)
+    {
+        pixels = rc2d_rrespack_copyRGBA(surface, &size);
+        if (pixels == NULL) return false;
+    }
+
+    const bool success = rc2d_rrespack_buildImageChunk(chunk, width, height, format, pixels, size);
+    SDL_free(pixels);
+    return success;
+}
+
+/**
+ * Copie une image dans sa zone de la page : la bordure et l'arrondi répètent les bords de l'image.
+ */
+static void rc2d_rrespack_blitCell(SDL_Surface* page, const RC2D_RrespackInput* input)
+{
+    const SDL_Surface* source = input->surface;
+    const int left = (int)(input->cell.x + rc2d_rrespack.padding);
+    const int top = (int)(input->cell.y + rc2d_rrespack.padding);
+
+    for (Uint32 y = input->cell.y; y < input->cell.y + input->cell.height; y++)
+    {
+        const int sy = SDL_clamp((int)y - top, 0, source->h - 1);
+        const Uint8* sourceRow = (const Uint8*)source->pixels + (size_t)sy * source->pitch;
+        Uint8* row = (Uint8*)page->pixels + (size_t)y * page->pitch;
+
+        for (Uint32 x = input->cell.x; x < input->cell.x + input->cell.width; x++)
+        {
+            const int sx = SDL_clamp((int)x - left, 0, source->w - 1);
+            SDL_memcpy(row + x * 4, sourceRow + sx * 4, 4);
+        }
+    }
+}
+
+/**
+ * Assemble une page d'atlas. Les images sont décodées au besoin et libérées une fois copiées.
+ */
+static SDL_Surface* rc2d_rrespack_composePage(int pageIndex, bool* opaque)
+{
+    const RC2D_RrespackPage* page = &rc2d_rrespack.pages[pageIndex];
+    SDL_Surface* surface = SDL_CreateSurface((int)page->width, (int)page->height, SDL_PIXELFORMAT_RGBA32);
+    if (surface == NULL) return NULL;
+    SDL_memset(surface->pixels, 0, (size_t)surface->pitch * surface->h);
+
+    *opaque = true;
+    for (Uint32 i = 0; i < rc2d_rrespack.input_count; i++)
+    {
+        RC2D_RrespackInput* input = &rc2d_rrespack.inputs[i];
+        if (input->page != pageIndex) continue;
+
+        if (input->surface == NULL && !rc2d_rrespack_decodeInput(input, NULL, 0))
+        {
+            SDL_DestroySurface(surface);
+            return NULL;
+        }
+
+        // Les zones libres de la page ne sont jamais échantillonnées : seules les images comptent
+        if (*opaque && !rc2d_rrespack_isOpaque(input->surface)) *opaque = false;
+
+        rc2d_rrespack_blitCell(surface, input);
+        SDL_DestroySurface(input->surface);
+        input->surface = NULL;
+    }
+
+    return surface;
+}
+
+static void rc2d_rrespack_releaseInputs(const RC2D_RrespackChunk* chunk)
+{
+    for (Uint32 i = 0; i < rc2d_rrespack.input_count; i++)
+    {
+        RC2D_RrespackInput* input = &rc2d_rrespack.inputs[i];
+        const bool owned = (chunk->page >= 0 && input->page == chunk->page) || (chunk->input == (int)i);
+        if (owned && input->surface != NULL)
+        {
+            SDL_DestroySurface(input->surface);
+            input->surface = NULL;
+        }
+    }
+}
+
+static bool rc2d_rrespack_loadCachedChunk(RC2D_RrespackChunk* chunk)
+{
+    char* path = NULL;
+    if (SDL_asprintf(&path, "%s/%s.chunk", rc2d_rrespack.cache_dir, chunk->keyHex) < 0) return false;
+
+    size_t size = 0;
+    Uint8* blob = (Uint8*)SDL_LoadFile(path, &size);
+    SDL_free(path);
+    if (blob == NULL) return false;
+
+    rresResourceChunkInfo info;
+    SDL_zero(info);
+    if (size >= sizeof(info)) SDL_memcpy(&info, blob, sizeof(info));
+
+    // Un fichier tronqué ou abîmé est simplement réencodé
+    if (size < sizeof(info) || info.id != chunk->id || sizeof(info) + info.packedSize != size ||
+        rresComputeCRC32(blob + sizeof(info), (int)info.packedSize) != info.crc32)
+    {
+        SDL_free(blob);
+        return false;
+    }
+
+    chunk->blob = blob;
+    chunk->blobSize = size;
+    return true;
+}
+
+/**
+ * Job : chaque chunk d'image est repris du cache, ou assemblé, encodé, compressé puis gardé dans le cache.
+ */
+static void rc2d_rrespack_encodeChunks(Uint32 start, Uint32 end, void* data)
+{
+    (void)data;
+
+    for (Uint32 i = start; i < end; i++)
+    {
+        RC2D_RrespackChunk* chunk = &rc2d_rrespack.chunks[i];
+        if (chunk->blob != NULL) continue;
+
+        if (rc2d_rrespack_loadCachedChunk(chunk))
+        {
+            chunk->cached = true;
+            rc2d_rrespack_releaseInputs(chunk);
+            continue;
+        }
+
+        SDL_Surface* surface = NULL;
+        bool opaque = false;
+        if (chunk->page >= 0)
+        {
+            surface = rc2d_rrespack_composePage(chunk->page, &opaque);
+        }
+        else
+        {
+            RC2D_RrespackInput* input = &rc2d_rrespack.inputs[chunk->input];
+            if (input->surface != NULL || rc2d_rrespack_decodeInput(input, NULL, 0))
+            {
+                surface = input->surface;
+                input->surface = NULL;
+                opaque = rc2d_rrespack_isOpaque(surface);
+            }
+        }
+
+        if (surface == NULL || !rc2d_rrespack_encodeImage(chunk, surface, opaque))
+        {
+            RC2D_log(RC2D_LOG_ERROR, "Failed to encode %s", chunk->name);
+            chunk->failed = true;
+        }
+        SDL_DestroySurface(surface);
+        rc2d_rrespack_releaseInputs(chunk);
+
+        if (!chunk->failed && chunk->cacheable)
+        {
+            char* path = NULL;
+            if (SDL_asprintf(&path, "%s/%s.chunk", rc2d_rrespack.cache_dir, chunk->keyHex) >= 0)
+            {
+                if (!SDL_SaveFile(path, chunk->blob, chunk->blobSize))
+                {
+                    RC2D_log(RC2D_LOG_WARN, "Failed to cache %s: %s", chunk->name, SDL_GetError());
+                }
+                SDL_free(path);
+            }
+        }
+    }
+}
+
+/**
+ * Ajoute un chunk à la liste. Le nom est copié.
+ */
+static RC2D_RrespackChunk* rc2d_rrespack_addChunk(const char* name, int page, int input)
+{
+    RC2D_RrespackChunk* chunk = &rc2d_rrespack.chunks[rc2d_rrespack.chunk_count];
+    SDL_zerop(chunk);
+    chunk->name = SDL_strdup(name);
+    if (chunk->name == NULL) return NULL;
+
+    chunk->id = rresComputeCRC32((unsigned char*)chunk->name, (int)SDL_strlen(chunk->name));
+    chunk->page = page;
+    chunk->input = input;
+    chunk->cacheable = true;
+    rc2d_rrespack.chunk_count++;
+    return chunk;
+}
+
+/**
+ * Empreinte du contenu d'un chunk d'image : options d'encodage, puis empreinte et placement de chaque image.
+ * Le nom est compris (l'identifiant du chunk est écrit dans le blob), pas les noms des images d'une page
+ * (ils ne sont que dans l'index).
+ */
+static void rc2d_rrespack_computeChunkKey(RC2D_RrespackChunk* chunk)
+{
+    RC2D_RresMD5Context ctx;
+    rc2d_rres_md5Init(&ctx);
+    rc2d_rrespack_hashUint32(&ctx, RC2D_RRESPACK_CACHE_VERSION);
+    rc2d_rrespack_hashUint32(&ctx, (Uint32)rc2d_rrespack.target);
+    rc2d_rrespack_hashUint32(&ctx, rc2d_rrespack.compress ? 1 : 0);
+    rc2d_rrespack_hashUint32(&ctx, (Uint32)rc2d_rrespack.level);
+    rc2d_rres_md5Update(&ctx, chunk->name, SDL_strlen(chunk->name) + 1);
+
+    if (chunk->page >= 0)
+    {
+        const RC2D_RrespackPage* page = &rc2d_rrespack.pages[chunk->page];
+        rc2d_rrespack_hashUint32(&ctx, page->width);
+        rc2d_rrespack_hashUint32(&ctx, page->height);
+        rc2d_rrespack_hashUint32(&ctx, rc2d_rrespack.padding);
+
+        for (Uint32 i = 0; i < rc2d_rrespack.input_count; i++)
+        {
+            const RC2D_RrespackInput* input = &rc2d_rrespack.inputs[i];
+            if (input->page != chunk->page) continue;
+
+            rc2d_rres_md5Update(&ctx, input->hash, sizeof(input->hash));
+            rc2d_rres_md5Update(&ctx, &input->cell, sizeof(input->cell));
+        }
+    }
+    else
+    {
+        rc2d_rres_md5Update(&ctx, rc2d_rrespack.inputs[chunk->input].hash, sizeof(rc2d_rrespack.inputs[chunk->input].hash));
+    }
+
+    rc2d_rres_md5Final(&ctx, chunk->key);
+    rc2d_rrespack_hashToHex(chunk->key, chunk->keyHex);
+}
+
+/**
+ * Index de l'atlas : place de chaque image dans les pages (format décrit en tête de fichier).
+ */
+static bool rc2d_rrespack_buildIndexChunk(RC2D_RrespackChunk* chunk)
+{
+    Uint32 count = 0;
+    size_t entriesSize = 0;
+    for (Uint32 i = 0; i < rc2d_rrespack.input_count; i++)
+    {
+        const RC2D_RrespackInput* input = &rc2d_rrespack.inputs[i];
+        if (input->page < 0) continue;
+
+        count++;
+        entriesSize += 6 * sizeof(Uint32) + ((SDL_strlen(input->name) + 1 + 3) & ~(size_t)3);
+    }
+
+    const size_t rawSize = 3 * sizeof(Uint32) + entriesSize;
+    Uint8* raw = (Uint8*)SDL_calloc(1, rawSize);
+    if (raw == NULL) return false;
+
+    const Uint32 header[3] = { 2, (Uint32)entriesSize, count };
+    SDL_memcpy(raw, header, sizeof(header));
+
+    Uint8* cursor = raw + sizeof(header);
+    for (Uint32 i = 0; i < rc2d_rrespack.input_count; i++)
+    {
+        const RC2D_RrespackInput* input = &rc2d_rrespack.inputs[i];
+        if (input->page < 0) continue;
+
+        const size_t nameLength = SDL_strlen(input->name);
+        const Uint32 entry[6] = {
+            rc2d_rrespack.chunks[input->page].id,
+            input->cell.x + rc2d_rrespack.padding,
+            input->cell.y + rc2d_rrespack.padding,
+            input->width,
+            input->height,
+            (Uint32)((nameLength + 1 + 3) & ~(size_t)3)
+        };
+        SDL_memcpy(cursor, entry, sizeof(entry));
+        SDL_memcpy(cursor + sizeof(entry), input->name, nameLength);
+        cursor += sizeof(entry) + entry[5];
+    }
+
+    // Non compressé : lu sans copie dans la projection du pack
+    const bool success = rc2d_rrespack_buildChunkBlob(chunk, "RAWD", raw, (Uint32)rawSize, false);
+    SDL_free(raw);
+    return success;
+}
+
+static bool rc2d_rrespack_buildChunks(void)
+{
+    // Pages, images isolées, puis l'index de l'atlas
+    rc2d_rrespack.chunks = RC2D_calloc(rc2d_rrespack.page_count + rc2d_rrespack.input_count + 1, sizeof(RC2D_RrespackChunk));
+    if (rc2d_rrespack.chunks == NULL) return false;
+
+    for (Uint32 i = 0; i < rc2d_rrespack.page_count; i++)
+    {
+        char* name = NULL;
+        if (SDL_asprintf(&name, "%s_%u.png", rc2d_rrespack.atlas, i) < 0) return false;
+        RC2D_RrespackChunk* chunk = rc2d_rrespack_addChunk(name, (int)i, -1);
+        SDL_free(name);
+        if (chunk == NULL) return false;
+    }
+
+    for (Uint32 i = 0; i < rc2d_rrespack.input_count; i++)
+    {
+        if (rc2d_rrespack.inputs[i].page >= 0) continue;
+        if (rc2d_rrespack_addChunk(rc2d_rrespack.inputs[i].name, -1, (int)i) == NULL) return false;
+    }
+
+    for (Uint32 i = 0; i < rc2d_rrespack.chunk_count; i++) rc2d_rrespack_computeChunkKey(&rc2d_rrespack.chunks[i]);
+
+    if (rc2d_rrespack.page_count > 0)
+    {
+        char* name = NULL;
+        if (SDL_asprintf(&name, "%s.index", rc2d_rrespack.atlas) < 0) return false;
+        RC2D_RrespackChunk* chunk = rc2d_rrespack_addChunk(name, -1, -1);
+        SDL_free(name);
+        if (chunk == NULL || !rc2d_rrespack_buildIndexChunk(chunk)) return false;
+        chunk->cacheable = false;
+    }
+
+    if (rc2d_rrespack.chunk_count >= 65535)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "Too many chunks (%u): a rres file holds at most 65534 chunks plus its directory", rc2d_rrespack.chunk_count);
+        return false;
+    }
+
+    // Les identifiants (CRC32 des noms) doivent être uniques dans le pack
+    for (Uint32 i = 0; i < rc2d_rrespack.chunk_count; i++)
+    {
+        for (Uint32 j = i + 1; j < rc2d_rrespack.chunk_count; j++)
+        {
+            if (rc2d_rrespack.chunks[i].id == rc2d_rrespack.chunks[j].id)
+            {
+                RC2D_log(RC2D_LOG_CRITICAL, "%s and %s have the same resource id 0x%08x, rename one of them",
+                    rc2d_rrespack.chunks[i].name, rc2d_rrespack.chunks[j].name, rc2d_rrespack.chunks[i].id);
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Empreinte du pack complet : alignement, empreinte de chaque chunk et index de l'atlas.
+ */
+static void rc2d_rrespack_computePackKey(unsigned int key[4])
+{
+    RC2D_RresMD5Context ctx;
+    rc2d_rres_md5Init(&ctx);
+    rc2d_rrespack_hashUint32(&ctx, RC2D_RRESPACK_CACHE_VERSION);
+    rc2d_rrespack_hashUint32(&ctx, rc2d_rrespack.align);
+    rc2d_rrespack_hashUint32(&ctx, rc2d_rrespack.chunk_count);
+
+    for (Uint32 i = 0; i < rc2d_rrespack.chunk_count; i++)
+    {
+        const RC2D_RrespackChunk* chunk = &rc2d_rrespack.chunks[i];
+        if (chunk->blob != NULL) rc2d_rres_md5Update(&ctx, chunk->blob, chunk->blobSize);
+        else rc2d_rres_md5Update(&ctx, chunk->key, sizeof(chunk->key));
+    }
+
+    rc2d_rres_md5Final(&ctx, key);
+}
+
+/* --------------------------------------------------------------------------------------------------------------- */
+/* Écriture du pack                                                                                                 */
+/* --------------------------------------------------------------------------------------------------------------- */
+
+static bool rc2d_rrespack_writePadding(SDL_IOStream* io, Uint64* offset)
+{
+    static const Uint8 zeros[4096] = { 0 };
+
+    if (rc2d_rrespack.align <= 1) return true;
+
+    Uint64 padding = ((*offset + rc2d_rrespack.align - 1) & ~(Uint64)(rc2d_rrespack.align - 1)) - *offset;
+    *offset += padding;
+    while (padding > 0)
+    {
+        const size_t size = (size_t)SDL_min(padding, (Uint64)sizeof(zeros));
+        if (SDL_WriteIO(io, zeros, size) != size) return false;
+        padding -= size;
+    }
+
+    return true;
+}
+
+/**
+ * Chunk CDIR : propCount = 1, props[0] = nombre d'entrées, puis { id, offset, 0, taille du nom, nom } par chunk.
+ */
+static Uint8* rc2d_rrespack_buildDirectory(const Uint32* offsets, Uint32* size)
+{
+    size_t dataSize = 2 * sizeof(Uint32);
+    for (Uint32 i = 0; i < rc2d_rrespack.chunk_count; i++)
+    {
+        dataSize += 4 * sizeof(Uint32) + ((SDL_strlen(rc2d_rrespack.chunks[i].name) + 1 + 3) & ~(size_t)3);
+    }
+
+    Uint8* data = (Uint8*)SDL_calloc(1, sizeof(rresResourceChunkInfo) + dataSize);
+    if (data == NULL) return NULL;
+
+    Uint8* cursor = data + sizeof(rresResourceChunkInfo);
+    const Uint32 header[2] = { 1, rc2d_rrespack.chunk_count };
+    SDL_memcpy(cursor, header, sizeof(header));
+    cursor += sizeof(header);
+
+    for (Uint32 i = 0; i < rc2d_rrespack.chunk_count; i++)
+    {
+        const RC2D_RrespackChunk* chunk = &rc2d_rrespack.chunks[i];
+        const size_t nameLength = SDL_strlen(chunk->name);
+        const Uint32 entry[4] = { chunk->id, offsets[i], 0, (Uint32)((nameLength + 1 + 3) & ~(size_t)3) };
+        SDL_memcpy(cursor, entry, sizeof(entry));
+        SDL_memcpy(cursor + sizeof(entry), chunk->name, nameLength);
+        cursor += sizeof(entry) + entry[3];
+    }
+
+    rresResourceChunkInfo info;
+    SDL_zero(info);
+    SDL_memcpy(info.type, "CDIR", 4);
+    info.id = 0;
+    info.compType = RRES_COMP_NONE;
+    info.cipherType = RRES_CIPHER_NONE;
+    info.baseSize = (unsigned int)dataSize;
+    info.packedSize = (unsigned int)dataSize;
+    info.crc32 = rresComputeCRC32(data + sizeof(info), (int)dataSize);
+    SDL_memcpy(data, &info, sizeof(info));
+
+    *size = (Uint32)(sizeof(info) + dataSize);
+    return data;
+}
+
+/**
+ * Écrit le pack dans un fichier temporaire puis le renomme : un pack ouvert (projeté) n'est jamais réécrit en place.
+ */
+static bool rc2d_rrespack_writePack(Uint64* packSize)
+{
+    char* temporary = NULL;
+    if (SDL_asprintf(&temporary, "%s.tmp", rc2d_rrespack.output) < 0) return false;
+
+    Uint32* offsets = RC2D_calloc(SDL_max(rc2d_rrespack.chunk_count, 1), sizeof(Uint32));
+    SDL_IOStream* io = offsets != NULL ? SDL_IOFromFile(temporary, "wb") : NULL;
+    if (io == NULL)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "Failed to create %s: %s", temporary, SDL_GetError());
+        RC2D_safe_free(offsets);
+        SDL_free(temporary);
+        return false;
+    }
+
+    rresFileHeader header;
+    SDL_zero(header);
+    SDL_memcpy(header.id, "rres", 4);
+    header.version = 100;
+    header.chunkCount = (unsigned short)(rc2d_rrespack.chunk_count + 1);
+    header.reserved = rc2d_rrespack.align > 1 ? rc2d_rrespack.align : 0;
+
+    bool success = SDL_WriteIO(io, &header, sizeof(header)) == sizeof(header);
+    Uint64 offset = sizeof(header);
+
+    for (Uint32 i = 0; i < rc2d_rrespack.chunk_count && success; i++)
+    {
+        const RC2D_RrespackChunk* chunk = &rc2d_rrespack.chunks[i];
+        success = rc2d_rrespack_writePadding(io, &offset) && offset <= SDL_MAX_UINT32 &&
+                  SDL_WriteIO(io, chunk->blob, chunk->blobSize) == chunk->blobSize;
+        offsets[i] = (Uint32)offset;
+        offset += chunk->blobSize;
+    }
+
+    Uint32 directorySize = 0;
+    Uint8* directory = success ? rc2d_rrespack_buildDirectory(offsets, &directorySize) : NULL;
+    success = directory != NULL && rc2d_rrespack_writePadding(io, &offset) && offset + directorySize <= SDL_MAX_UINT32;
+    if (success)
+    {
+        header.cdOffset = (unsigned int)offset;
+        success = SDL_WriteIO(io, directory, directorySize) == directorySize;
+        offset += directorySize;
+    }
+
+    // En-tête définitif, avec l'offset du répertoire central
+    success = success && SDL_SeekIO(io, 0, SDL_IO_SEEK_SET) == 0 && SDL_WriteIO(io, &header, sizeof(header)) == sizeof(header);
+    if (!SDL_CloseIO(io)) success = false;
+
+    if (success && !SDL_RenamePath(temporary, rc2d_rrespack.output))
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "Failed to replace %s: %s", rc2d_rrespack.output, SDL_GetError());
+        success = false;
+    }
+    else if (!success)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "Failed to write %s (packs are limited to 4 GB): %s", temporary, SDL_GetError());
+    }
+
+    if (!success) SDL_RemovePath(temporary);
+
+    *packSize = offset;
+    SDL_free(directory);
+    RC2D_free(offsets);
+    SDL_free(temporary);
+    return success;
+}
+
+/**
+ * Supprime du cache les chunks qui ne font plus partie du pack.
+ */
+static void rc2d_rrespack_cleanCache(void)
+{
+    int count = 0;
+    char** files = SDL_GlobDirectory(rc2d_rrespack.cache_dir, "*.chunk", 0, &count);
+    if (files == NULL) return;
+
+    const char** keys = RC2D_malloc(SDL_max(rc2d_rrespack.chunk_count, 1) * sizeof(const char*));
+    if (keys == NULL)
+    {
+        SDL_free(files);
+        return;
+    }
+
+    Uint32 keyCount = 0;
+    for (Uint32 i = 0; i < rc2d_rrespack.chunk_count; i++)
+    {
+        if (rc2d_rrespack.chunks[i].cacheable) keys[keyCount++] = rc2d_rrespack.chunks[i].keyHex;
+    }
+    SDL_qsort(keys, keyCount, sizeof(const char*), rc2d_rrespack_compareStrings);
+
+    for (int i = 0; i < count; i++)
+    {
+        char key[33] = { 0 };
+        SDL_strlcpy(key, files[i], sizeof(key));
+        const char* keyPointer = key;
+        if (SDL_strlen(files[i]) == 32 + 6 && SDL_bsearch(&keyPointer, keys, keyCount, sizeof(const char*), rc2d_rrespack_compareStrings) != NULL) continue;
+
+        char* path = rc2d_rrespack_getCachePath(files[i]);
+        if (path != NULL)
+        {
+            SDL_RemovePath(path);
+            SDL_free(path);
+        }
+    }
+
+    RC2D_free(keys);
+    SDL_free(files);
+}
+
+/* --------------------------------------------------------------------------------------------------------------- */
+/* Programme                                                                                                        */
+/* --------------------------------------------------------------------------------------------------------------- */
+
+static bool rc2d_rrespack_run(void)
+{
+    const Uint64 start = SDL_GetPerformanceCounter();
+
+    if (rc2d_rrespack.cache != NULL) rc2d_rrespack.cache_dir = SDL_strdup(rc2d_rrespack.cache);
+    else if (SDL_asprintf(&rc2d_rrespack.cache_dir, "%s.cache", rc2d_rrespack.output) < 0) rc2d_rrespack.cache_dir = NULL;
+
+    if (rc2d_rrespack.cache_dir == NULL || !SDL_CreateDirectory(rc2d_rrespack.cache_dir))
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "Failed to create the cache directory: %s", SDL_GetError());
+        return false;
+    }
+
+    if (!rc2d_rrespack_listInputs()) return false;
+    if (rc2d_rrespack.input_count == 0)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "No PNG found in %s", rc2d_rrespack.input);
+        return false;
+    }
+
+    // 1. Empreintes des PNG (et décodage de ceux qui ont changé)
+    rc2d_rrespack_loadManifest();
+    rc2d_job_parallelFor(rc2d_rrespack.input_count, 1, rc2d_rrespack_hashInputs, NULL);
+
+    Uint32 failed = 0;
+    for (Uint32 i = 0; i < rc2d_rrespack.input_count; i++) failed += rc2d_rrespack.inputs[i].failed;
+    if (failed > 0)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "%u PNG could not be read", failed);
+        return false;
+    }
+
+    // 2. Placement dans l'atlas et liste des chunks
+    if (!rc2d_rrespack_packAtlas() || !rc2d_rrespack_buildChunks())
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "Failed to lay out the pack");
+        return false;
+    }
+
+    unsigned int packKey[4];
+    rc2d_rrespack_computePackKey(packKey);
+
+    SDL_PathInfo outputInfo;
+    if (rc2d_rrespack.manifest_has_pack && SDL_memcmp(packKey, rc2d_rrespack.manifest_pack, sizeof(packKey)) == 0 &&
+        SDL_GetPathInfo(rc2d_rrespack.output, &outputInfo) && outputInfo.type == SDL_PATHTYPE_FILE)
+    {
+        RC2D_log(RC2D_LOG_INFO, "%s is up to date (%u images)", rc2d_rrespack.output, rc2d_rrespack.input_count);
+        return true;
+    }
+
+    // 3. Encodage des chunks qui ne sont pas dans le cache
+    rc2d_job_parallelFor(rc2d_rrespack.chunk_count, 1, rc2d_rrespack_encodeChunks, NULL);
+
+    Uint32 cached = 0;
+    for (Uint32 i = 0; i < rc2d_rrespack.chunk_count; i++)
+    {
+        if (rc2d_rrespack.chunks[i].failed) failed++;
+        cached += rc2d_rrespack.chunks[i].cached;
+    }
+    if (failed > 0)
+    {
+        RC2D_log(RC2D_LOG_CRITICAL, "%u chunks could not be encoded", failed);
+        return false;
+    }
+
+    // 4. Écriture du pack, du manifeste, et nettoyage du cache
+    Uint64 packSize = 0;
+    if (!rc2d_rrespack_writePack(&packSize)) return false;
+
+    // Un chunk en repli RGBA8 (astcenc absent) change l'empreinte : le prochain passage réessaiera
+    bool complete = true;
+    for (Uint32 i = 0; i < rc2d_rrespack.chunk_count; i++)
+    {
+        const RC2D_RrespackChunk* chunk = &rc2d_rrespack.chunks[i];
+        if (!chunk->cacheable && (chunk->page >= 0 || chunk->input >= 0)) complete = false;
+    }
+    if (!complete) SDL_memset(packKey, 0, sizeof(packKey));
+
+    rc2d_rrespack_saveManifest(packKey);
+    rc2d_rrespack_cleanCache();
+
+    const double seconds = (double)(SDL_GetPerformanceCounter() - start) / (double)SDL_GetPerformanceFrequency();
+    RC2D_log(RC2D_LOG_INFO, "%s: %u images (%d decoded), %u atlas pages, %u chunks (%u from cache), %.2f MB in %.2f s",
+        rc2d_rrespack.output, rc2d_rrespack.input_count, SDL_GetAtomicInt(&rc2d_rrespack.decoded), rc2d_rrespack.page_count,
+        rc2d_rrespack.chunk_count, cached, (double)packSize / (1024.0 * 1024.0), seconds);
+    return true;
+}
+
+static void rc2d_rrespack_cleanup(void)
+{
+    for (Uint32 i = 0; i < rc2d_rrespack.input_count; i++)
+    {
+        SDL_DestroySurface(rc2d_rrespack.inputs[i].surface);
+        SDL_free(rc2d_rrespack.inputs[i].name);
+    }
+    RC2D_safe_free(rc2d_rrespack.inputs);
+
+    for (Uint32 i = 0; i < rc2d_rrespack.page_count; i++) rc2d_atlas_destroyPacker(rc2d_rrespack.pages[i].packer);
+    RC2D_safe_free(rc2d_rrespack.pages);
+
+    for (Uint32 i = 0; i < rc2d_rrespack.chunk_count; i++)
+    {
+        SDL_free(rc2d_rrespack.chunks[i].name);
+        SDL_free(rc2d_rrespack.chunks[i].blob);
+    }
+    RC2D_safe_free(rc2d_rrespack.chunks);
+
+    for (Uint32 i = 0; i < rc2d_rrespack.manifest_count; i++) SDL_free(rc2d_rrespack.manifest[i].name);
+    RC2D_safe_free(rc2d_rrespack.manifest);
+
+    SDL_free(rc2d_rrespack.cache_dir);
+}
+
+const RC2D_EngineConfig* rc2d_engine_setup(int argc, char* argv[])
+{
+    rc2d_logger_set_priority(RC2D_LOG_INFO);
+
+    // Outil en ligne de commande : le moteur n'est jamais initialisé, le processus se termine ici
+    if (!rc2d_rrespack_parseArgs(argc, argv))
+    {
+        exit(EXIT_FAILURE);
+    }
+
+    // Sans workers, rc2d_job_parallelFor exécute tout sur le thread appelant
+    if (!rc2d_job_init(rc2d_rrespack.jobs, false))
+    {
+        RC2D_log(RC2D_LOG_WARN, "Failed to start the job system, packing on a single thread");
+    }
+
+    const bool success = rc2d_rrespack_run();
+
+    rc2d_rrespack_cleanup();
+    rc2d_job_quit();
+
+    exit(success ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,229 @@
+#include "rc2d_rrespack_encode.h"
+
+bool rc2d_rrespack_isOpaque(const SDL_Surface* surface)
+{
+    for (int y = 0; y < surface->h; y++)
+    {
+        const Uint8* row = (const Uint8*)surface->pixels + (size_t)y * surface->pitch;
+        for (int x = 0; x < surface->w; x++)
+        {
+            if (row[x * 4 + 3] != 255) return false;
+        }
+    }
+
+    return true;
+}
+
+Uint16 rc2d_rrespack_packColor565(const float color[3])
+{
+    const int r = (int)(SDL_clamp(color[0], 0.0f, 255.0f) * 31.0f / 255.0f + 0.5f);
+    const int g = (int)(SDL_clamp(color[1], 0.0f, 255.0f) * 63.0f / 255.0f + 0.5f);
+    const int b = (int)(SDL_clamp(color[2], 0.0f, 255.0f) * 31.0f / 255.0f + 0.5f);
+    return (Uint16)((r << 11) | (g << 5) | b);
+}
+
+void rc2d_rrespack_unpackColor565(Uint16 color, int rgb[3])
+{
+    const int r = (color >> 11) & 31;
+    const int g = (color >> 5) & 63;
+    const int b = color & 31;
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+/**
+ * Bloc couleur BC1 (aussi utilisé par BC3) : extrémités sur l'axe principal des couleurs du bloc, en mode 4 couleurs.
+ */
+void rc2d_rrespack_encodeColorBlock(const Uint8 block[64], Uint8 out[8])
+{
+    float mean[3] = { 0.0f, 0.0f, 0.0f };
+    for (int i = 0; i < 16; i++)
+    {
+        for (int c = 0; c < 3; c++) mean[c] += block[i * 4 + c];
+    }
+    for (int c = 0; c < 3; c++) mean[c] /= 16.0f;
+
+    // Covariance des couleurs, puis axe principal par itérations de puissance
+    float cov[6] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    for (int i = 0; i < 16; i++)
+    {
+        const float r = block[i * 4 + 0] - mean[0];
+        const float g = block[i * 4 + 1] - mean[1];
+        const float b = block[i * 4 + 2] - mean[2];
+        cov[0] += r * r;
+        cov[1] += r * g;
+        cov[2] += r * b;
+        cov[3] += g * g;
+        cov[4] += g * b;
+        cov[5] += b * b;
+    }
+
+    /**
+     * Départ sur la composante la plus variable : (1, 1, 1) peut être orthogonal à l'axe principal (rouge qui monte
+     * quand le vert descend), les itérations tomberaient alors sur zéro et le bloc sur une seule couleur.
+     */
+    float axis[3] = { 0.0f, 0.0f, 0.0f };
+    axis[(cov[0] >= cov[3] && cov[0] >= cov[5]) ? 0 : (cov[3] >= cov[5] ? 1 : 2)] = 1.0f;
+    for (int iteration = 0; iteration < 8; iteration++)
+    {
+        const float x = cov[0] * axis[0] + cov[1] * axis[1] + cov[2] * axis[2];
+        const float y = cov[1] * axis[0] + cov[3] * axis[1] + cov[4] * axis[2];
+        const float z = cov[2] * axis[0] + cov[4] * axis[1] + cov[5] * axis[2];
+        const float scale = SDL_max(SDL_fabsf(x), SDL_max(SDL_fabsf(y), SDL_fabsf(z)));
+        if (scale < 1e-6f) break;
+
+        axis[0] = x / scale;
+        axis[1] = y / scale;
+        axis[2] = z / scale;
+    }
+
+    const float length = SDL_sqrtf(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+    for (int c = 0; c < 3; c++) axis[c] /= length;
+
+    float minT = 0.0f, maxT = 0.0f;
+    for (int i = 0; i < 16; i++)
+    {
+        const float t = (block[i * 4 + 0] - mean[0]) * axis[0] + (block[i * 4 + 1] - mean[1]) * axis[1] + (block[i * 4 + 2] - mean[2]) * axis[2];
+        minT = SDL_min(minT, t);
+        maxT = SDL_max(maxT, t);
+    }
+
+    float end0[3], end1[3];
+    for (int c = 0; c < 3; c++)
+    {
+        end0[c] = mean[c] + axis[c] * maxT;
+        end1[c] = mean[c] + axis[c] * minT;
+    }
+
+    // color0 > color1 : mode 4 couleurs (en BC1, color0 <= color1 passerait en mode 3 couleurs + transparent)
+    Uint16 color0 = rc2d_rrespack_packColor565(end0);
+    Uint16 color1 = rc2d_rrespack_packColor565(end1);
+    if (color0 < color1)
+    {
+        const Uint16 swap = color0;
+        color0 = color1;
+        color1 = swap;
+    }
+
+    Uint32 indices = 0;
+    if (color0 != color1)
+    {
+        int palette[4][3];
+        rc2d_rrespack_unpackColor565(color0, palette[0]);
+        rc2d_rrespack_unpackColor565(color1, palette[1]);
+        for (int c = 0; c < 3; c++)
+        {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        }
+
+        for (int i = 0; i < 16; i++)
+        {
+            Uint32 best = 0;
+            int bestDistance = SDL_MAX_SINT32;
+            for (Uint32 p = 0; p < 4; p++)
+            {
+                const int r = block[i * 4 + 0] - palette[p][0];
+                const int g = block[i * 4 + 1] - palette[p][1];
+                const int b = block[i * 4 + 2] - palette[p][2];
+                const int distance = r * r + g * g + b * b;
+                if (distance < bestDistance)
+                {
+                    bestDistance = distance;
+                    best = p;
+                }
+            }
+            indices |= best << (2 * i);
+        }
+    }
+
+    out[0] = (Uint8)(color0 & 0xFF);
+    out[1] = (Uint8)(color0 >> 8);
+    out[2] = (Uint8)(color1 & 0xFF);
+    out[3] = (Uint8)(color1 >> 8);
+    out[4] = (Uint8)(indices & 0xFF);
+    out[5] = (Uint8)((indices >> 8) & 0xFF);
+    out[6] = (Uint8)((indices >> 16) & 0xFF);
+    out[7] = (Uint8)(indices >> 24);
+}
+
+/**
+ * Bloc alpha BC3 (BC4) : extrémités min/max du bloc, mode 8 valeurs.
+ */
+void rc2d_rrespack_encodeAlphaBlock(const Uint8 block[64], Uint8 out[8])
+{
+    Uint8 alpha0 = 0, alpha1 = 255;
+    for (int i = 0; i < 16; i++)
+    {
+        alpha0 = SDL_max(alpha0, block[i * 4 + 3]);
+        alpha1 = SDL_min(alpha1, block[i * 4 + 3]);
+    }
+
+    out[0] = alpha0;
+    out[1] = alpha1;
+
+    Uint64 indices = 0;
+    if (alpha0 != alpha1)
+    {
+        int palette[8];
+        palette[0] = alpha0;
+        palette[1] = alpha1;
+        for (int p = 2; p < 8; p++) palette[p] = ((8 - p) * alpha0 + (p - 1) * alpha1) / 7;
+
+        for (int i = 0; i < 16; i++)
+        {
+            Uint64 best = 0;
+            int bestDistance = 256;
+            for (int p = 0; p < 8; p++)
+            {
+                const int distance = SDL_abs(block[i * 4 + 3] - palette[p]);
+                if (distance < bestDistance)
+                {
+                    bestDistance = distance;
+                    best = (Uint64)p;
+                }
+            }
+            indices |= best << (3 * i);
+        }
+    }
+
+    for (int i = 0; i < 6; i++) out[2 + i] = (Uint8)((indices >> (8 * i)) & 0xFF);
+}
+
+/**
+ * Encode une image RGBA32 (dimensions multiples de 4) en BC1 si elle est opaque, en BC3 sinon.
+ */
+Uint8* rc2d_rrespack_encodeBC(const SDL_Surface* surface, bool opaque, Uint32* size)
+{
+    const Uint32 blocksX = (Uint32)surface->w / 4;
+    const Uint32 blocksY = (Uint32)surface->h / 4;
+    const Uint32 blockSize = opaque ? 8 : 16;
+
+    *size = blocksX * blocksY * blockSize;
+    Uint8* data = (Uint8*)SDL_malloc(*size);
+    if (data == NULL) return NULL;
+
+    Uint8 block[64];
+    for (Uint32 by = 0; by < blocksY; by++)
+    {
+        for (Uint32 bx = 0; bx < blocksX; bx++)
+        {
+            for (Uint32 y = 0; y < 4; y++)
+            {
+                const Uint8* row = (const Uint8*)surface->pixels + (size_t)(by * 4 + y) * surface->pitch + bx * 16;
+                SDL_memcpy(block + y * 16, row, 16);
+            }
+
+            Uint8* out = data + (by * blocksX + bx) * blockSize;
+            if (!opaque)
+            {
+                rc2d_rrespack_encodeAlphaBlock(block, out);
+                out += 8;
+            }
+            rc2d_rrespack_encodeColorBlock(block, out);
+        }
+    }
+
+    return data;
+}
@@ -0,0 +1,70 @@
+#ifndef RC2D_RRESPACK_ENCODE_H
+#define RC2D_RRESPACK_ENCODE_H
+
+#include <SDL3/SDL_stdinc.h>  // Required for: Uint8, Uint16, Uint32
+#include <SDL3/SDL_surface.h> // Required for: SDL_Surface
+
+#include <stdbool.h>          // Required for: bool
+
+/* Configuration pour les définitions de fonctions C, même lors de l'utilisation de C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Encodeurs de rc2d_rrespack (BC1/BC3 et LZ4 haute compression), séparés de l'outil pour être testés.
+ * Aucun état global : toutes les fonctions peuvent être appelées depuis plusieurs jobs à la fois.
+ */
+
+/**
+ * Niveaux de compression LZ4 haute compression (mêmes bornes que LZ4HC) : le niveau fixe le nombre de candidats
+ * examinés par position. Un niveau <= 0 prend RC2D_RRESPACK_LZ4HC_LEVEL_DEFAULT.
+ */
+#define RC2D_RRESPACK_LZ4HC_LEVEL_MIN 1
+#define RC2D_RRESPACK_LZ4HC_LEVEL_DEFAULT 9
+#define RC2D_RRESPACK_LZ4HC_LEVEL_MAX 12
+
+/**
+ * Retourne true si tous les pixels d'une surface RGBA32 sont opaques.
+ */
+bool rc2d_rrespack_isOpaque(const SDL_Surface* surface);
+
+/**
+ * Convertit une couleur RGB (composantes 0..255, arrondies et bornées) en RGB565.
+ */
+Uint16 rc2d_rrespack_packColor565(const float color[3]);
+
+/**
+ * Convertit une couleur RGB565 en RGB 0..255, comme le fait le GPU (bits de poids fort répétés).
+ */
+void rc2d_rrespack_unpackColor565(Uint16 color, int rgb[3]);
+
+/**
+ * Encode un bloc 4x4 RGBA32 (64 octets, ligne par ligne) en bloc couleur BC1 de 8 octets, en mode 4 couleurs.
+ */
+void rc2d_rrespack_encodeColorBlock(const Uint8 block[64], Uint8 out[8]);
+
+/**
+ * Encode l'alpha d'un bloc 4x4 RGBA32 en bloc alpha BC3 de 8 octets, en mode 8 valeurs.
+ */
+void rc2d_rrespack_encodeAlphaBlock(const Uint8 block[64], Uint8 out[8]);
+
+/**
+ * Encode une image RGBA32 (dimensions multiples de 4) en BC1 si opaque est vrai, en BC3 sinon.
+ * Retourne les blocs (à libérer avec SDL_free) et leur taille dans size, ou NULL si l'allocation a échoué.
+ */
+Uint8* rc2d_rrespack_encodeBC(const SDL_Surface* surface, bool opaque, Uint32* size);
+
+/**
+ * Compresse un bloc au format LZ4 (décodé par LZ4_decompress_safe) en cherchant les correspondances dans des chaînes
+ * de hachage, avec évaluation paresseuse : plus lent que LZ4_compress_default, meilleur taux.
+ * Retourne la taille compressée, ou 0 si capacity ne suffit pas (LZ4_compressBound(size) suffit toujours).
+ */
+int rc2d_rrespack_compressLZ4HC(const void* source, void* destination, int size, int capacity, int level);
+
+/* Termine les définitions de fonctions C lors de l'utilisation de C++ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RC2D_RRESPACK_ENCODE_H
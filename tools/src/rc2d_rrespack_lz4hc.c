@@ -0,0 +1,208 @@
+#include "rc2d_rrespack_encode.h"
+
+/**
+ * Compresseur LZ4 haute compression de rc2d_rrespack.
+ *
+ * Le flux produit est un bloc LZ4 standard : séquences (jeton, littéraux, offset sur 2 octets, longueur), la dernière
+ * sans correspondance. Les règles de fin de bloc du format sont respectées (les 5 derniers octets sont des littéraux,
+ * la dernière correspondance commence au moins 12 octets avant la fin) : LZ4_decompress_safe le décode tel quel.
+ *
+ * Les positions sont indexées par le hachage de leurs 4 premiers octets. Chaque position garde l'écart vers la
+ * précédente de même hachage (chaîne de hachage sur une fenêtre de 64 Ko) : la recherche remonte la chaîne, au plus
+ * 1 << (niveau - 1) candidats. Une correspondance n'est émise que si celle qui commence à l'octet suivant n'est pas
+ * plus longue (évaluation paresseuse).
+ */
+
+#define RC2D_RRESPACK_LZ4HC_MINMATCH 4
+#define RC2D_RRESPACK_LZ4HC_LASTLITERALS 5
+#define RC2D_RRESPACK_LZ4HC_MFLIMIT 12
+#define RC2D_RRESPACK_LZ4HC_MAX_DISTANCE 65535
+#define RC2D_RRESPACK_LZ4HC_HASH_LOG 16
+#define RC2D_RRESPACK_LZ4HC_CHAIN_SIZE 65536
+
+typedef struct RC2D_RrespackLZ4HC {
+    const Uint8* source;
+    const Uint8* matchLimit;
+    Sint32* head;  // Dernière position de chaque hachage (-1 : aucune)
+    Uint16* chain; // Écart vers la position précédente de même hachage (0 : fin de chaîne), indexé modulo 64 Ko
+    Sint32 nextToInsert;
+    int attempts;
+} RC2D_RrespackLZ4HC;
+
+static Uint32 rc2d_rrespack_lz4hcHash(const Uint8* position)
+{
+    Uint32 value;
+    SDL_memcpy(&value, position, sizeof(value));
+    return (value * 2654435761u) >> (32 - RC2D_RRESPACK_LZ4HC_HASH_LOG);
+}
+
+/**
+ * Ajoute aux chaînes toutes les positions qui précèdent target.
+ */
+static void rc2d_rrespack_lz4hcInsert(RC2D_RrespackLZ4HC* hc, Sint32 target)
+{
+    while (hc->nextToInsert < target)
+    {
+        const Sint32 position = hc->nextToInsert++;
+        const Uint32 hash = rc2d_rrespack_lz4hcHash(hc->source + position);
+        const Sint32 previous = hc->head[hash];
+        const Sint32 delta = previous < 0 ? 0 : SDL_min(position - previous, RC2D_RRESPACK_LZ4HC_MAX_DISTANCE);
+
+        hc->chain[position & (RC2D_RRESPACK_LZ4HC_CHAIN_SIZE - 1)] = (Uint16)delta;
+        hc->head[hash] = position;
+    }
+}
+
+/**
+ * Cherche la plus longue correspondance de la position donnée dans la fenêtre.
+ * Retourne sa longueur (0 si aucune n'atteint RC2D_RRESPACK_LZ4HC_MINMATCH) et sa position dans match.
+ */
+static Uint32 rc2d_rrespack_lz4hcFindMatch(RC2D_RrespackLZ4HC* hc, Sint32 position, Sint32* match)
+{
+    rc2d_rrespack_lz4hcInsert(hc, position);
+
+    const Uint8* current = hc->source + position;
+    const Uint32 maxLength = (Uint32)(hc->matchLimit - current);
+    Uint32 bestLength = 0;
+
+    Sint32 candidate = hc->head[rc2d_rrespack_lz4hcHash(current)];
+    for (int attempt = 0; attempt < hc->attempts && candidate >= 0; attempt++)
+    {
+        if (position - candidate > RC2D_RRESPACK_LZ4HC_MAX_DISTANCE) break;
+
+        // Les chaînes sont partagées modulo 64 Ko : un candidat peut avoir un autre hachage, les octets sont comparés
+        const Uint8* reference = hc->source + candidate;
+        if (reference[bestLength] == current[bestLength] && SDL_memcmp(reference, current, RC2D_RRESPACK_LZ4HC_MINMATCH) == 0)
+        {
+            Uint32 length = RC2D_RRESPACK_LZ4HC_MINMATCH;
+            while (length < maxLength && reference[length] == current[length]) length++;
+
+            if (length > bestLength)
+            {
+                bestLength = length;
+                *match = candidate;
+                if (length == maxLength) break;
+            }
+        }
+
+        const Uint16 delta = hc->chain[candidate & (RC2D_RRESPACK_LZ4HC_CHAIN_SIZE - 1)];
+        if (delta == 0) break;
+        candidate -= delta;
+    }
+
+    return bestLength >= RC2D_RRESPACK_LZ4HC_MINMATCH ? bestLength : 0;
+}
+
+static void rc2d_rrespack_lz4hcWriteLength(Uint8** output, Uint32 length)
+{
+    for (; length >= 255; length -= 255) *(*output)++ = 255;
+    *(*output)++ = (Uint8)length;
+}
+
+/**
+ * Écrit une séquence : literalCount littéraux depuis literals, puis la correspondance (matchLength = 0 pour la
+ * dernière séquence du bloc). Retourne false si la sortie est trop petite.
+ */
+static bool rc2d_rrespack_lz4hcWriteSequence(Uint8** output, const Uint8* outputEnd, const Uint8* literals,
+                                             Uint32 literalCount, Uint32 offset, Uint32 matchLength)
+{
+    const size_t needed = 1 + (size_t)literalCount + literalCount / 255 + 1 +
+                          (matchLength > 0 ? 2 + (matchLength - RC2D_RRESPACK_LZ4HC_MINMATCH) / 255 + 1 : 0);
+    if ((size_t)(outputEnd - *output) < needed) return false;
+
+    Uint8* token = (*output)++;
+    *token = (Uint8)(SDL_min(literalCount, 15u) << 4);
+    if (literalCount >= 15) rc2d_rrespack_lz4hcWriteLength(output, literalCount - 15);
+
+    SDL_memcpy(*output, literals, literalCount);
+    *output += literalCount;
+
+    if (matchLength > 0)
+    {
+        *(*output)++ = (Uint8)(offset & 0xFF);
+        *(*output)++ = (Uint8)(offset >> 8);
+
+        const Uint32 length = matchLength - RC2D_RRESPACK_LZ4HC_MINMATCH;
+        *token |= (Uint8)SDL_min(length, 15u);
+        if (length >= 15) rc2d_rrespack_lz4hcWriteLength(output, length - 15);
+    }
+
+    return true;
+}
+
+int rc2d_rrespack_compressLZ4HC(const void* source, void* destination, int size, int capacity, int level)
+{
+    if (size < 0 || capacity <= 0) return 0;
+
+    if (level <= 0) level = RC2D_RRESPACK_LZ4HC_LEVEL_DEFAULT;
+    level = SDL_clamp(level, RC2D_RRESPACK_LZ4HC_LEVEL_MIN, RC2D_RRESPACK_LZ4HC_LEVEL_MAX);
+
+    const Uint8* input = (const Uint8*)source;
+    Uint8* output = (Uint8*)destination;
+    const Uint8* outputEnd = output + capacity;
+    Sint32 anchor = 0;
+
+    // Sous 13 octets, le format n'autorise aucune correspondance : tout est littéral
+    if (size > RC2D_RRESPACK_LZ4HC_MFLIMIT)
+    {
+        RC2D_RrespackLZ4HC hc;
+        hc.source = input;
+        hc.matchLimit = input + size - RC2D_RRESPACK_LZ4HC_LASTLITERALS;
+        hc.head = (Sint32*)SDL_malloc(sizeof(Sint32) << RC2D_RRESPACK_LZ4HC_HASH_LOG);
+        hc.chain = (Uint16*)SDL_malloc(sizeof(Uint16) * RC2D_RRESPACK_LZ4HC_CHAIN_SIZE);
+        hc.nextToInsert = 0;
+        hc.attempts = 1 << (level - 1);
+        if (hc.head == NULL || hc.chain == NULL)
+        {
+            SDL_free(hc.head);
+            SDL_free(hc.chain);
+            return 0;
+        }
+        SDL_memset(hc.head, 0xFF, sizeof(Sint32) << RC2D_RRESPACK_LZ4HC_HASH_LOG);
+
+        // Dernière position où une correspondance peut commencer
+        const Sint32 lastMatchStart = size - RC2D_RRESPACK_LZ4HC_MFLIMIT;
+
+        Sint32 position = 0;
+        while (position <= lastMatchStart)
+        {
+            Sint32 match = 0;
+            Uint32 length = rc2d_rrespack_lz4hcFindMatch(&hc, position, &match);
+            if (length == 0)
+            {
+                position++;
+                continue;
+            }
+
+            // Évaluation paresseuse : on décale tant que la position suivante offre une correspondance plus longue
+            while (position + 1 <= lastMatchStart)
+            {
+                Sint32 nextMatch = 0;
+                const Uint32 nextLength = rc2d_rrespack_lz4hcFindMatch(&hc, position + 1, &nextMatch);
+                if (nextLength <= length) break;
+
+                position++;
+                length = nextLength;
+                match = nextMatch;
+            }
+
+            if (!rc2d_rrespack_lz4hcWriteSequence(&output, outputEnd, input + anchor, (Uint32)(position - anchor),
+                                                  (Uint32)(position - match), length))
+            {
+                SDL_free(hc.head);
+                SDL_free(hc.chain);
+                return 0;
+            }
+
+            position += (Sint32)length;
+            anchor = position;
+        }
+
+        SDL_free(hc.head);
+        SDL_free(hc.chain);
+    }
+
+    if (!rc2d_rrespack_lz4hcWriteSequence(&output, outputEnd, input + anchor, (Uint32)(size - anchor), 0, 0)) return 0;
+
+    return (int)(output - (Uint8*)destination);
+}